@@ -104,6 +104,13 @@ class ThriftInfinityClient:
                                                 column_names=column_names,
                                                 fields=fields))
 
+    def bulk_insert(self, db_name: str, table_name: str, column_fields: list[ColumnField], row_count: int):
+        return self.client.BulkInsert(BulkInsertRequest(session_id=self.session_id,
+                                                        db_name=db_name,
+                                                        table_name=table_name,
+                                                        column_fields=column_fields,
+                                                        row_count=row_count))
+
     def import_data(self, db_name: str, table_name: str, file_name: str, import_options):
         return self.client.Import(ImportRequest(session_id=self.session_id,
                                                 db_name=db_name,
@@ -196,6 +196,7 @@ enum CopyFileType {
 CSV,
 JSON,
 FVECS,
+PARQUET,
 }
 
 enum ColumnType {
@@ -216,6 +217,7 @@ struct ColumnField {
 1: ColumnType column_type,
 2: list<binary> column_vectors = [],
 3: string column_name,
+4: optional ElementType element_type,
 }
 
 struct ImportOption {
@@ -364,6 +366,14 @@ struct InsertRequest {
 5:  i64 session_id,
 }
 
+struct BulkInsertRequest {
+1:  string db_name,
+2:  string table_name,
+3:  list<ColumnField> column_fields = [],
+4:  i64 row_count,
+5:  i64 session_id,
+}
+
 struct ImportRequest{
 1:  string db_name,
 2:  string table_name,
@@ -472,6 +482,7 @@ CommonResponse DropDatabase(1:DropDatabaseRequest request),
 CommonResponse CreateTable(1:CreateTableRequest request),
 CommonResponse DropTable(1:DropTableRequest request),
 CommonResponse Insert(1:InsertRequest request),
+CommonResponse BulkInsert(1:BulkInsertRequest request),
 CommonResponse Import(1:ImportRequest request),
 SelectResponse Select(1:SelectRequest request),
 SelectResponse Explain(1:ExplainRequest request),
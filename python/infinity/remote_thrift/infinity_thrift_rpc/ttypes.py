@@ -188,17 +188,20 @@ class CopyFileType(object):
     CSV = 0
     JSON = 1
     FVECS = 2
+    PARQUET = 3
 
     _VALUES_TO_NAMES = {
         0: "CSV",
         1: "JSON",
         2: "FVECS",
+        3: "PARQUET",
     }
 
     _NAMES_TO_VALUES = {
         "CSV": 0,
         "JSON": 1,
         "FVECS": 2,
+        "PARQUET": 3,
     }
 
 
@@ -2216,18 +2219,20 @@ class ColumnField(object):
      - column_type
      - column_vectors
      - column_name
+     - element_type
 
     """
 
 
     def __init__(self, column_type=None, column_vectors=[
-    ], column_name=None,):
+    ], column_name=None, element_type=None,):
         self.column_type = column_type
         if column_vectors is self.thrift_spec[2][4]:
             column_vectors = [
             ]
         self.column_vectors = column_vectors
         self.column_name = column_name
+        self.element_type = element_type
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -2258,6 +2263,11 @@ class ColumnField(object):
                     self.column_name = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
                 else:
                     iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.I32:
+                    self.element_type = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -2283,6 +2293,10 @@ class ColumnField(object):
             oprot.writeFieldBegin('column_name', TType.STRING, 3)
             oprot.writeString(self.column_name.encode('utf-8') if sys.version_info[0] == 2 else self.column_name)
             oprot.writeFieldEnd()
+        if self.element_type is not None:
+            oprot.writeFieldBegin('element_type', TType.I32, 4)
+            oprot.writeI32(self.element_type)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -4209,6 +4223,120 @@ class InsertRequest(object):
         return not (self == other)
 
 
+class BulkInsertRequest(object):
+    """
+    Attributes:
+     - db_name
+     - table_name
+     - column_fields
+     - row_count
+     - session_id
+
+    """
+
+
+    def __init__(self, db_name=None, table_name=None, column_fields=[
+    ], row_count=None, session_id=None,):
+        self.db_name = db_name
+        self.table_name = table_name
+        if column_fields is self.thrift_spec[3][4]:
+            column_fields = [
+            ]
+        self.column_fields = column_fields
+        self.row_count = row_count
+        self.session_id = session_id
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.STRING:
+                    self.db_name = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRING:
+                    self.table_name = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.LIST:
+                    self.column_fields = []
+                    (_etype171, _size168) = iprot.readListBegin()
+                    for _i172 in range(_size168):
+                        _elem173 = ColumnField()
+                        _elem173.read(iprot)
+                        self.column_fields.append(_elem173)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.I64:
+                    self.row_count = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 5:
+                if ftype == TType.I64:
+                    self.session_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('BulkInsertRequest')
+        if self.db_name is not None:
+            oprot.writeFieldBegin('db_name', TType.STRING, 1)
+            oprot.writeString(self.db_name.encode('utf-8') if sys.version_info[0] == 2 else self.db_name)
+            oprot.writeFieldEnd()
+        if self.table_name is not None:
+            oprot.writeFieldBegin('table_name', TType.STRING, 2)
+            oprot.writeString(self.table_name.encode('utf-8') if sys.version_info[0] == 2 else self.table_name)
+            oprot.writeFieldEnd()
+        if self.column_fields is not None:
+            oprot.writeFieldBegin('column_fields', TType.LIST, 3)
+            oprot.writeListBegin(TType.STRUCT, len(self.column_fields))
+            for iter174 in self.column_fields:
+                iter174.write(oprot)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        if self.row_count is not None:
+            oprot.writeFieldBegin('row_count', TType.I64, 4)
+            oprot.writeI64(self.row_count)
+            oprot.writeFieldEnd()
+        if self.session_id is not None:
+            oprot.writeFieldBegin('session_id', TType.I64, 5)
+            oprot.writeI64(self.session_id)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+
+
 class ImportRequest(object):
     """
     Attributes:
@@ -5625,6 +5753,7 @@ ColumnField.thrift_spec = (
     (2, TType.LIST, 'column_vectors', (TType.STRING, 'BINARY', False), [
     ], ),  # 2
     (3, TType.STRING, 'column_name', 'UTF8', None, ),  # 3
+    (4, TType.I32, 'element_type', None, None, ),  # 4
 )
 all_structs.append(ImportOption)
 ImportOption.thrift_spec = (
@@ -5797,6 +5926,16 @@ InsertRequest.thrift_spec = (
     ], ),  # 4
     (5, TType.I64, 'session_id', None, None, ),  # 5
 )
+all_structs.append(BulkInsertRequest)
+BulkInsertRequest.thrift_spec = (
+    None,  # 0
+    (1, TType.STRING, 'db_name', 'UTF8', None, ),  # 1
+    (2, TType.STRING, 'table_name', 'UTF8', None, ),  # 2
+    (3, TType.LIST, 'column_fields', (TType.STRUCT, [ColumnField, None], False), [
+    ], ),  # 3
+    (4, TType.I64, 'row_count', None, None, ),  # 4
+    (5, TType.I64, 'session_id', None, None, ),  # 5
+)
 all_structs.append(ImportRequest)
 ImportRequest.thrift_spec = (
     None,  # 0
@@ -21,7 +21,7 @@ import infinity.remote_thrift.infinity_thrift_rpc.ttypes as ttypes
 from infinity.common import INSERT_DATA, VEC
 from infinity.index import IndexInfo
 from infinity.remote_thrift.query_builder import Query, InfinityThriftQueryBuilder, ExplainQuery
-from infinity.remote_thrift.types import build_result
+from infinity.remote_thrift.types import build_result, build_column_field
 from infinity.remote_thrift.utils import traverse_conditions, check_valid_name, select_res_to_polars
 from infinity.table import Table, ExplainType
 
@@ -119,6 +119,24 @@ class RemoteTable(Table, ABC):
         else:
             raise Exception(res.error_msg)
 
+    def bulk_insert(self, columns: dict[str, Any]):
+        # {"c1": np.array([1, 2], dtype=np.int32), "c2": np.random.rand(2, 128).astype(np.float32), "c3": ["a", "b"]}
+        column_fields: list[ttypes.ColumnField] = []
+        row_count = None
+        for column_name, values in columns.items():
+            column_field, column_row_count = build_column_field(column_name, values)
+            if row_count is not None and row_count != column_row_count:
+                raise Exception(f"Column {column_name} has {column_row_count} rows, expect {row_count}")
+            row_count = column_row_count
+            column_fields.append(column_field)
+
+        res = self._conn.bulk_insert(db_name=self._db_name, table_name=self._table_name,
+                                     column_fields=column_fields, row_count=row_count or 0)
+        if res.success:
+            return res
+        else:
+            raise Exception(res.error_msg)
+
     def import_data(self, file_path: str, options=None):
 
         options = ttypes.ImportOption()
@@ -133,6 +151,8 @@ class RemoteTable(Table, ABC):
             options.copy_file_type = ttypes.CopyFileType.JSON
         elif file_name.endswith('.fvecs'):
             options.copy_file_type = ttypes.CopyFileType.FVECS
+        elif file_name.endswith('.parquet'):
+            options.copy_file_type = ttypes.CopyFileType.PARQUET
 
         with open(file_path, 'rb') as f:
             file_data = f.read()
@@ -16,6 +16,7 @@ import struct
 from collections import defaultdict
 from typing import Any, Tuple, Dict, List
 
+import numpy as np
 import polars as pl
 from numpy import dtype
 
@@ -44,6 +45,61 @@ def column_type_to_dtype(ttype: ttypes.ColumnType):
             raise NotImplementedError(f"Unsupported type {ttype}")
 
 
+
+def build_column_field(column_name: str, values) -> Tuple[ttypes.ColumnField, int]:
+    """Encode one column of a bulk insert batch, in the same layout the server uses for select results."""
+    if isinstance(values, np.ndarray):
+        array = np.ascontiguousarray(values)
+        element_type = None
+        if array.ndim == 2:
+            column_type = ttypes.ColumnType.ColumnEmbedding
+            match array.dtype:
+                case np.int8:
+                    element_type = ttypes.ElementType.ElementInt8
+                case np.int16:
+                    element_type = ttypes.ElementType.ElementInt16
+                case np.int32:
+                    element_type = ttypes.ElementType.ElementInt32
+                case np.int64:
+                    element_type = ttypes.ElementType.ElementInt64
+                case np.float32:
+                    element_type = ttypes.ElementType.ElementFloat32
+                case np.float64:
+                    element_type = ttypes.ElementType.ElementFloat64
+                case _:
+                    raise NotImplementedError(f"Unsupported embedding dtype {array.dtype}")
+        else:
+            match array.dtype:
+                case np.bool_:
+                    column_type = ttypes.ColumnType.ColumnBool
+                case np.int8:
+                    column_type = ttypes.ColumnType.ColumnInt8
+                case np.int16:
+                    column_type = ttypes.ColumnType.ColumnInt16
+                case np.int32:
+                    column_type = ttypes.ColumnType.ColumnInt32
+                case np.int64:
+                    column_type = ttypes.ColumnType.ColumnInt64
+                case np.float32:
+                    column_type = ttypes.ColumnType.ColumnFloat32
+                case np.float64:
+                    column_type = ttypes.ColumnType.ColumnFloat64
+                case _:
+                    raise NotImplementedError(f"Unsupported dtype {array.dtype}")
+        return ttypes.ColumnField(column_type=column_type, column_vectors=[array.tobytes()],
+                                  column_name=column_name, element_type=element_type), array.shape[0]
+
+    if isinstance(values, list) and all(isinstance(value, str) for value in values):
+        buffer = bytearray()
+        for value in values:
+            encoded = value.encode('utf-8')
+            buffer += struct.pack('<i', len(encoded))
+            buffer += encoded
+        return ttypes.ColumnField(column_type=ttypes.ColumnType.ColumnVarchar, column_vectors=[bytes(buffer)],
+                                  column_name=column_name), len(values)
+
+    raise NotImplementedError(f"Unsupported column data for {column_name}, expect numpy array or list of str")
+
 def logic_type_to_dtype(ttype: ttypes.DataType):
     match ttype.logic_type:
         case ttypes.LogicType.Boolean:
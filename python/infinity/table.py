@@ -14,7 +14,7 @@
 
 from abc import ABC, abstractmethod
 from enum import Enum
-from typing import Optional, Union
+from typing import Optional, Union, Any
 
 import infinity.remote_thrift.infinity_thrift_rpc.ttypes as ttypes
 from infinity.index import IndexInfo
@@ -62,6 +62,10 @@ class Table(ABC):
     def insert(self, data: list[dict[str, Union[str, int, float, list[Union[int, float]]]]]):
         pass
 
+    @abstractmethod
+    def bulk_insert(self, columns: dict[str, Any]):
+        pass
+
     @abstractmethod
     def import_data(self, file_path: str, options=None):
         pass
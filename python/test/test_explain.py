@@ -12,6 +12,9 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 
+import os
+import re
+
 import polars as pl
 import pytest
 
@@ -65,6 +68,96 @@ class TestExplain:
             res = table.output(["*"]).explain(ExplainType.Fragment)
             print(res)
 
-            with pytest.raises(Exception, match=r".*Not implement*"):
-                res = table.output(["*"]).explain(ExplainType.Analyze)
-                print(res)
+            res = table.output(["*"]).explain(ExplainType.Analyze)
+            print(res)
+
+    def test_explain_analyze(self):
+        """
+        target: test the statistics of explain analyze
+        method: explain analyze a filtered scan of a table with 3 rows
+        expect: every operator reports its executions, rows, time, memory and buffer loads with plausible values
+        """
+        infinity_obj = infinity.connect(common_values.TEST_REMOTE_HOST)
+        db_obj = infinity_obj.get_database("default")
+        db_obj.drop_table("test_explain_analyze", True)
+        table = db_obj.create_table("test_explain_analyze", {"c1": "int", "c2": "float"}, None)
+        assert table
+        table.insert([{"c1": 1, "c2": 1.0}, {"c1": 2, "c2": 2.0}, {"c1": 3, "c2": 3.0}])
+
+        res = table.output(["c1"]).filter("c2 > 1.5").explain(ExplainType.Analyze)
+        lines = [line.strip() for line in res[res.columns[0]].to_list()]
+        print("\n".join(lines))
+
+        executions = [re.fullmatch(r"- executions: (\d+) in (\d+) task\(s\)", line) for line in lines]
+        executions = [(int(m.group(1)), int(m.group(2))) for m in executions if m]
+        rows = [re.fullmatch(r"- rows: (\d+) in, (\d+) out", line) for line in lines]
+        rows = [(int(m.group(1)), int(m.group(2))) for m in rows if m]
+        times = [re.fullmatch(r"- time: (\d+)(ns|us|ms|s) wall, (\d+)(ns|us|ms|s) cpu", line) for line in lines]
+        times = [m for m in times if m]
+        buffers = [re.fullmatch(r"- buffer: (\d+) hits, (\d+) misses, [\d.]+[KMGT]?B read", line) for line in lines]
+        buffers = [(int(m.group(1)), int(m.group(2))) for m in buffers if m]
+        memories = [line for line in lines if re.fullmatch(r"- memory: [\d.]+[KMGT]?B allocated, [\d.]+[KMGT]?B at most in one execution", line)]
+
+        # project, filter and table scan
+        assert len(executions) == 3
+        assert len(rows) == 3
+        assert len(times) == 3
+        assert len(buffers) == 3
+        assert len(memories) == 3
+        assert all(execute_count >= task_count >= 1 for execute_count, task_count in executions)
+        assert not any(line == "- not executed" for line in lines)
+
+        # the scan reads the 3 rows, the filter keeps 2 of them and the projection outputs them
+        assert (0, 3) in rows
+        assert (3, 2) in rows
+        assert (2, 2) in rows
+
+        # the scan loads the column buffers, hits and misses together count every load
+        assert sum(hits + misses for hits, misses in buffers) > 0
+        assert any(int(m.group(1)) > 0 for m in times)
+        assert lines[-1].startswith("Peak query memory: ")
+
+        res = db_obj.drop_table("test_explain_analyze")
+        assert res.success
+
+    def test_explain_analyze_zone_map(self):
+        """
+        target: test that the table scan skips the blocks whose zone maps rule the filter out
+        method: import 4 blocks of increasing c1, explain analyze a filter that only the rows of the first block pass
+        expect: the table scan outputs at most one block of rows instead of all of them
+        """
+        infinity_obj = infinity.connect(common_values.TEST_REMOTE_HOST)
+        db_obj = infinity_obj.get_database("default")
+
+        block_capacity = 8192
+        row_count = 4 * block_capacity
+        test_dir = "/tmp/infinity/test_data/"
+        test_csv_dir = test_dir + "test_explain_analyze_zone_map.csv"
+        os.makedirs(test_dir, exist_ok=True)
+        with open(test_csv_dir, "w") as f:
+            for i in range(row_count):
+                f.write(f"{i}\n")
+
+        db_obj.drop_table("test_explain_analyze_zone_map", True)
+        table = db_obj.create_table("test_explain_analyze_zone_map", {"c1": "int"}, None)
+        assert table
+        res = table.import_data(test_csv_dir, None)
+        assert res.success
+
+        res = table.output(["c1"]).filter("c1 < 100").explain(ExplainType.Analyze)
+        lines = [line.strip() for line in res[res.columns[0]].to_list()]
+        print("\n".join(lines))
+
+        rows = [re.fullmatch(r"- rows: (\d+) in, (\d+) out", line) for line in lines]
+        rows = [(int(m.group(1)), int(m.group(2))) for m in rows if m]
+        # project, filter and table scan
+        assert len(rows) == 3
+        scan_rows = [out_count for in_count, out_count in rows if in_count == 0]
+        assert len(scan_rows) == 1
+        # without pruning the scan would output all the rows
+        assert 100 <= scan_rows[0] <= block_capacity
+        assert (100, 100) in rows
+
+        os.remove(test_csv_dir)
+        res = db_obj.drop_table("test_explain_analyze_zone_map")
+        assert res.success
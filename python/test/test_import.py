@@ -14,6 +14,8 @@
 
 import os
 
+import pytest
+
 import common_values
 import infinity
 
@@ -56,6 +58,149 @@ class TestImport:
         res = db_obj.drop_table("test_import")
         assert res.success
 
+    def test_import_multi_chunk(self):
+        """
+        target: test importing a csv file which is split into several chunks on the server
+        method: write a csv larger than one import chunk, with quoted line breaks, import it and check the rows
+        expect: every row is imported exactly once
+        """
+        infinity_obj = infinity.connect(common_values.TEST_REMOTE_HOST)
+        assert infinity_obj
+        db_obj = infinity_obj.get_database("default")
+        assert db_obj
+
+        row_count = 300000
+        test_dir = "/tmp/infinity/test_data/"
+        test_csv_dir = test_dir + "test_import_multi_chunk.csv"
+        os.makedirs(test_dir, exist_ok=True)
+        with open(test_csv_dir, "w") as f:
+            for i in range(row_count):
+                f.write(f'{i},"quoted, line\nbreak {i:064d}"\n')
+
+        db_obj.drop_table("test_import_multi_chunk", True)
+        table_obj = db_obj.create_table(
+            "test_import_multi_chunk", {"c1": "int", "c2": "varchar"}, None)
+        res = table_obj.import_data(test_csv_dir, None)
+        assert res.success
+
+        res = table_obj.output(["c1"]).to_df()
+        assert sorted(res["c1"].tolist()) == list(range(row_count))
+
+        os.remove(test_csv_dir)
+        res = db_obj.drop_table("test_import_multi_chunk")
+        assert res.success
+
+    def test_import_multi_chunk_failure(self):
+        """
+        target: test a failed import of a csv file which is split into several chunks on the server
+        method: write a csv larger than one import chunk whose last row has an extra column, import it
+        expect: the import fails and no row of the other chunks is left in the table
+        """
+        infinity_obj = infinity.connect(common_values.TEST_REMOTE_HOST)
+        assert infinity_obj
+        db_obj = infinity_obj.get_database("default")
+        assert db_obj
+
+        row_count = 1000000
+        test_dir = "/tmp/infinity/test_data/"
+        test_csv_dir = test_dir + "test_import_multi_chunk_failure.csv"
+        os.makedirs(test_dir, exist_ok=True)
+        with open(test_csv_dir, "w") as f:
+            for i in range(row_count):
+                f.write(f'{i},row {i:032d}\n')
+            f.write(f'{row_count},row,extra\n')
+
+        db_obj.drop_table("test_import_multi_chunk_failure", True)
+        table_obj = db_obj.create_table(
+            "test_import_multi_chunk_failure", {"c1": "int", "c2": "varchar"}, None)
+        with pytest.raises(Exception):
+            table_obj.import_data(test_csv_dir, None)
+
+        res = table_obj.output(["c1"]).to_df()
+        assert len(res) == 0
+
+        os.remove(test_csv_dir)
+        res = db_obj.drop_table("test_import_multi_chunk_failure")
+        assert res.success
+
+    def test_import_parquet(self):
+        """
+        target: test importing a parquet file with several row groups and unused columns
+        method: write a snappy compressed parquet file with pyarrow, import it into a table with part of its columns
+        expect: the table columns are imported, the other columns are ignored
+        """
+        pa = pytest.importorskip("pyarrow")
+        pq = pytest.importorskip("pyarrow.parquet")
+
+        infinity_obj = infinity.connect(common_values.TEST_REMOTE_HOST)
+        assert infinity_obj
+        db_obj = infinity_obj.get_database("default")
+        assert db_obj
+
+        row_count = 10000
+        test_dir = "/tmp/infinity/test_data/"
+        test_parquet_dir = test_dir + "test_import_parquet.parquet"
+        os.makedirs(test_dir, exist_ok=True)
+        arrow_table = pa.table({
+            "c1": pa.array(range(row_count), pa.int64()),
+            "unused": pa.array([f"unused {i}" for i in range(row_count)]),
+            "c2": pa.array([f"row {i % 100}" for i in range(row_count)]),
+            "c3": pa.array([[float(i), float(i + 1), float(i + 2)] for i in range(row_count)], pa.list_(pa.float32())),
+        })
+        pq.write_table(arrow_table, test_parquet_dir, row_group_size=3000, compression="snappy")
+
+        db_obj.drop_table("test_import_parquet", True)
+        table_obj = db_obj.create_table(
+            "test_import_parquet", {"c1": "int", "c2": "varchar", "c3": "vector,3,float"}, None)
+        res = table_obj.import_data(test_parquet_dir, None)
+        assert res.success
+
+        res = table_obj.output(["c1", "c2"]).to_df()
+        assert sorted(res["c1"].tolist()) == list(range(row_count))
+        assert sorted(res["c2"].tolist()) == sorted(f"row {i % 100}" for i in range(row_count))
+
+        # the four row groups are appended to one segment, which is only cut into blocks of 8192 rows
+        res = db_obj.show_tables()
+        res = res.filter(res["table"] == "test_import_parquet")
+        assert res["segment_count"][0] == 1
+        assert res["block_count"][0] == 2
+
+        os.remove(test_parquet_dir)
+        res = db_obj.drop_table("test_import_parquet")
+        assert res.success
+
+    def test_import_parquet_out_of_range(self):
+        """
+        target: test importing a parquet INT64 value out of the range of a SMALLINT column
+        method: write a parquet file with an int64 column holding 40000, import it into an int16 column
+        expect: the import fails rather than wrap the value, no row is imported
+        """
+        pa = pytest.importorskip("pyarrow")
+        pq = pytest.importorskip("pyarrow.parquet")
+
+        infinity_obj = infinity.connect(common_values.TEST_REMOTE_HOST)
+        assert infinity_obj
+        db_obj = infinity_obj.get_database("default")
+        assert db_obj
+
+        test_dir = "/tmp/infinity/test_data/"
+        test_parquet_dir = test_dir + "test_import_parquet_out_of_range.parquet"
+        os.makedirs(test_dir, exist_ok=True)
+        arrow_table = pa.table({"c1": pa.array([1, -2, 40000], pa.int64())})
+        pq.write_table(arrow_table, test_parquet_dir)
+
+        db_obj.drop_table("test_import_parquet_out_of_range", True)
+        table_obj = db_obj.create_table("test_import_parquet_out_of_range", {"c1": "int16"}, None)
+        with pytest.raises(Exception):
+            table_obj.import_data(test_parquet_dir, None)
+
+        res = table_obj.output(["c1"]).to_df()
+        assert len(res) == 0
+
+        os.remove(test_parquet_dir)
+        res = db_obj.drop_table("test_import_parquet_out_of_range")
+        assert res.success
+
     # import different file format data
     # import empty file
     # import format unrecognized data
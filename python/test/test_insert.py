@@ -11,12 +11,14 @@
 # WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
 # See the License for the specific language governing permissions and
 # limitations under the License.
+import numpy as np
 import pandas as pd
 import pytest
 from numpy import dtype
 
 import common_values
 import infinity
+from infinity.remote_thrift.types import build_column_field
 
 
 class TestInsert:
@@ -231,6 +233,50 @@ class TestInsert:
                            match=".*Insert values row count 8193 is larger than default block capacity 8192*"):
             table_obj.insert(values)
 
+    def test_bulk_insert(self):
+        infinity_obj = infinity.connect(common_values.TEST_REMOTE_HOST)
+        db_obj = infinity_obj.get_database("default")
+        db_obj.drop_table("test_bulk_insert", True)
+        table_obj = db_obj.create_table("test_bulk_insert", {
+            "c1": "int", "c2": "varchar", "c3": "vector,4,float"}, None)
+        assert table_obj
+
+        row_count = 10000
+        res = table_obj.bulk_insert({
+            "c1": np.arange(row_count, dtype=np.int32),
+            "c2": [f"row_{i}" for i in range(row_count)],
+            "c3": np.ones((row_count, 4), dtype=np.float32)})
+        assert res.success
+
+        res = table_obj.output(["c1"]).to_df()
+        assert len(res) == row_count
+
+        with pytest.raises(Exception):
+            table_obj.bulk_insert({
+                "c1": np.arange(2, dtype=np.int64),
+                "c2": ["a", "b"],
+                "c3": np.ones((2, 4), dtype=np.float32)})
+
+        # int32 elements have the size of float ones, only the element type tells them apart
+        with pytest.raises(Exception):
+            table_obj.bulk_insert({
+                "c1": np.arange(2, dtype=np.int32),
+                "c2": ["a", "b"],
+                "c3": np.ones((2, 4), dtype=np.int32)})
+
+        column_fields = [build_column_field("c1", np.arange(2, dtype=np.int32))[0],
+                         build_column_field("c2", ["a", "b"])[0],
+                         build_column_field("c3", np.ones((2, 4), dtype=np.float32))[0]]
+        res = table_obj._conn.bulk_insert(db_name="default", table_name="test_bulk_insert",
+                                          column_fields=column_fields, row_count=-2)
+        assert not res.success
+
+        res = table_obj.output(["c1"]).to_df()
+        assert len(res) == row_count
+
+        res = db_obj.drop_table("test_bulk_insert")
+        assert res.success
+
     # insert primitive data type not aligned with table definition
     # insert large varchar which exceeds the limit to table
     # insert embedding data which type info isn't match with table definition
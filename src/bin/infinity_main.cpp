@@ -22,6 +22,7 @@ import db_server;
 import infinity_exception;
 import infinity_context;
 import thrift_server;
+import http_server;
 
 namespace {
 
@@ -34,6 +35,9 @@ infinity::Thread pool_thrift_thread;
 infinity::PoolThriftServer pool_thrift_server;
 // infinity::NonBlockPoolThriftServer non_block_pool_thrift_server;
 
+infinity::Thread http_server_thread;
+infinity::HttpServer http_server;
+
 std::mutex server_mutex;
 std::condition_variable server_cv;
 
@@ -55,6 +59,9 @@ void ShutdownServer() {
 
     //            non_block_pool_thrift_server.Shutdown();
 
+    http_server.Shutdown();
+    http_server_thread.join();
+
     db_server.Shutdown();
 }
 
@@ -146,6 +153,9 @@ auto main(int argc, char **argv) -> int {
     pool_thrift_server.Init(thrift_server_port, thrift_server_pool_size);
     pool_thrift_thread = infinity::Thread([&]() { pool_thrift_server.Start(); });
 
+    http_server.Init(InfinityContext::instance().config()->listen_address(), InfinityContext::instance().config()->http_port());
+    http_server_thread = infinity::Thread([&]() { http_server.Start(); });
+
     //    non_block_pool_thrift_server.Init(9070, 64);
     //    non_block_pool_thrift_server.Start();
     shut_down_thread = infinity::Thread([&]() { ShutdownServer(); });
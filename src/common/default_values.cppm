@@ -65,6 +65,14 @@ export {
     constexpr SizeT SEGMENT_OFFSET_IN_DOCID = 23;           // it should be adjusted together with DEFAULT_SEGMENT_CAPACITY
     constexpr u64 SEGMENT_MASK_IN_DOCID = 0x7FFFFF;         // it should be adjusted together with DEFAULT_SEGMENT_CAPACITY
     constexpr u32 INVALID_SEGMENT_ID = std::numeric_limits<u32>::max();
+    constexpr u32 INVALID_SEGMENT_OFFSET = std::numeric_limits<u32>::max();
+    // segment id in the row ids of the rows a transaction has appended but not committed, only seen by its own scans
+    constexpr u32 TXN_LOCAL_SEGMENT_ID = INVALID_SEGMENT_ID - 1;
+
+    // import related constants
+    constexpr SizeT MIN_IMPORT_CHUNK_SIZE = 8 * 1024 * 1024;    // 8MB
+    constexpr SizeT MAX_IMPORT_CHUNK_SIZE = 1024 * 1024 * 1024; // 1GB
+    constexpr SizeT MIN_IMPORT_CHUNK_ROWS = 16 * DEFAULT_BLOCK_CAPACITY; // 128K rows
 
     // queue related constants, TODO: double check the necessary
     constexpr SizeT DEFAULT_READER_PREPARE_QUEUE_SIZE = 1024;
@@ -92,6 +100,13 @@ export {
     constexpr SizeT FULL_CHECKPOINT_INTERVAL_SEC = 60;          // 60 seconds
     constexpr SizeT DELTA_CHECKPOINT_INTERVAL_SEC = 20;         // 20 seconds
     constexpr SizeT DELTA_CHECKPOINT_INTERVAL_WAL_BYTES = 1000; // wal size
+
+    // background task processor
+    constexpr SizeT DEFAULT_BG_WORKER_COUNT = 4;
+    constexpr SizeT DEFAULT_BG_COMPACTION_CONCURRENCY = 1;
+    constexpr SizeT DEFAULT_BG_INDEX_BUILD_CONCURRENCY = 1;
+    constexpr u64 DEFAULT_COMPACTION_IO_RATE_LIMIT = 0; // bytes per second, 0 means unlimited
+
     constexpr std::string_view WAL_FILE_TEMP_FILE = "wal.log";
     constexpr std::string_view WAL_FILE_PREFIX = "wal.log.";
     constexpr std::string_view CATALOG_FILE_DIR = "catalog";
@@ -105,6 +120,8 @@ export {
     constexpr SizeT HNSW_M = 16;
     constexpr SizeT HNSW_EF_CONSTRUCTION = 200;
     constexpr SizeT HNSW_EF = 200;
+    // a graph merged from the graphs of compacted segments is rebuilt if less vertices are reachable in layer 0
+    constexpr double HNSW_MERGE_MIN_REACHABLE_RATIO = 0.99;
 
     // default distance compute blas parameter
     constexpr SizeT DISTANCE_COMPUTE_BLAS_QUERY_BS = 4096;
@@ -113,6 +130,9 @@ export {
     constexpr SizeT DBT_COMPACTION_M = 4;
     constexpr SizeT DBT_COMPACTION_C = 4;
     constexpr SizeT DBT_COMPACTION_S = DEFAULT_BLOCK_CAPACITY;
+
+    // full text search keeps offset + topn results to skip the first offset ones, deeper pages use the 'after' cursor
+    constexpr SizeT MATCH_MAX_RESULT_WINDOW = 10000;
 }
 
 // constexpr SizeT DEFAULT_BUFFER_SIZE = 8192;
@@ -0,0 +1,99 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+#include <algorithm>
+#include <bit>
+
+export module lock_free_ring_buffer;
+
+import stl;
+
+namespace infinity {
+
+// Bounded multi-producer multi-consumer queue on a ring of slots (D. Vyukov's algorithm).
+// Enqueue and dequeue never block and never allocate: TryEnqueue fails when the ring is full, TryDequeue when it is empty.
+// Each slot carries a sequence number telling whether it is ready for the producer or the consumer of a position.
+export template <typename T>
+class LockFreeRingBuffer {
+public:
+    // capacity is rounded up to a power of two
+    explicit LockFreeRingBuffer(SizeT capacity) : capacity_(std::bit_ceil(std::max<SizeT>(capacity, 2))), slots_(MakeUnique<Slot[]>(capacity_)) {
+        for (SizeT i = 0; i < capacity_; ++i) {
+            slots_[i].sequence_.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool TryEnqueue(T &&item) {
+        SizeT pos = enqueue_pos_.load(std::memory_order_relaxed);
+        Slot *slot = nullptr;
+        while (true) {
+            slot = &slots_[pos & (capacity_ - 1)];
+            const SizeT sequence = slot->sequence_.load(std::memory_order_acquire);
+            const i64 diff = static_cast<i64>(sequence) - static_cast<i64>(pos);
+            if (diff == 0) {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                // the slot still holds the item of the previous round
+                return false;
+            } else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+        slot->item_ = std::move(item);
+        slot->sequence_.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool TryDequeue(T &item) {
+        SizeT pos = dequeue_pos_.load(std::memory_order_relaxed);
+        Slot *slot = nullptr;
+        while (true) {
+            slot = &slots_[pos & (capacity_ - 1)];
+            const SizeT sequence = slot->sequence_.load(std::memory_order_acquire);
+            const i64 diff = static_cast<i64>(sequence) - static_cast<i64>(pos + 1);
+            if (diff == 0) {
+                if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = dequeue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+        item = std::move(slot->item_);
+        slot->sequence_.store(pos + capacity_, std::memory_order_release);
+        return true;
+    }
+
+    [[nodiscard]] inline SizeT capacity() const { return capacity_; }
+
+private:
+    struct Slot {
+        Atomic<SizeT> sequence_{};
+        T item_{};
+    };
+
+    const SizeT capacity_;
+    UniquePtr<Slot[]> slots_;
+    alignas(64) Atomic<SizeT> enqueue_pos_{0};
+    alignas(64) Atomic<SizeT> dequeue_pos_{0};
+};
+
+} // namespace infinity
@@ -0,0 +1,90 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+module memory_tracker;
+
+import stl;
+import status;
+import infinity_exception;
+import third_party;
+
+namespace infinity {
+
+namespace {
+
+thread_local QueryMemoryTracker *current_tracker = nullptr;
+thread_local u64 thread_charged_bytes = 0;
+
+} // namespace
+
+void QueryMemoryTracker::Charge(u64 size) {
+    const u64 used = used_.fetch_add(size) + size;
+    if (used > limit_) {
+        used_.fetch_sub(size);
+        RecoverableError(Status::OutOfMemory(
+            fmt::format("query needs {} more bytes, {} of query_memory_limit {} are in use", size, used - size, limit_)));
+    }
+    UpdatePeak(used);
+}
+
+bool QueryMemoryTracker::TryCharge(u64 size) {
+    const u64 used = used_.fetch_add(size) + size;
+    if (used > limit_) {
+        used_.fetch_sub(size);
+        return false;
+    }
+    UpdatePeak(used);
+    return true;
+}
+
+void QueryMemoryTracker::UpdatePeak(u64 used) {
+    u64 peak = peak_.load();
+    while (used > peak and !peak_.compare_exchange_weak(peak, used)) {
+    }
+}
+
+QueryMemoryTracker *QueryMemoryTracker::Current() { return current_tracker; }
+
+u64 QueryMemoryTracker::ThreadChargedBytes() { return thread_charged_bytes; }
+
+ScopedMemoryTracker::ScopedMemoryTracker(QueryMemoryTracker *tracker) : prev_tracker_(current_tracker) { current_tracker = tracker; }
+
+ScopedMemoryTracker::~ScopedMemoryTracker() { current_tracker = prev_tracker_; }
+
+void TrackedMemory::Grow(u64 size) {
+    if (tracker_.get() == nullptr) {
+        QueryMemoryTracker *tracker = QueryMemoryTracker::Current();
+        if (tracker == nullptr) {
+            // not allocated by a query
+            return;
+        }
+        tracker_ = tracker->shared_from_this();
+    }
+    tracker_->Charge(size);
+    size_ += size;
+    thread_charged_bytes += size;
+}
+
+void TrackedMemory::Reset() {
+    if (tracker_.get() != nullptr) {
+        tracker_->Release(size_);
+        tracker_.reset();
+    }
+    size_ = 0;
+}
+
+} // namespace infinity
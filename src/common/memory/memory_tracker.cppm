@@ -0,0 +1,93 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+export module memory_tracker;
+
+import stl;
+
+namespace infinity {
+
+// Memory used by one query, charged by the allocations made while its fragment tasks run.
+// A charge which would exceed the limit fails with Status::OutOfMemory, the query is then aborted and rolled back.
+export class QueryMemoryTracker : public EnableSharedFromThis<QueryMemoryTracker> {
+public:
+    explicit QueryMemoryTracker(u64 limit) : limit_(limit) {}
+
+    void Charge(u64 size);
+
+    // Charge if it fits in the limit, for the callers which can fall back to use less memory.
+    bool TryCharge(u64 size);
+
+    void Release(u64 size) { used_.fetch_sub(size); }
+
+    [[nodiscard]] inline u64 limit() const { return limit_; }
+
+    [[nodiscard]] inline u64 used() const { return used_.load(); }
+
+    [[nodiscard]] inline u64 peak() const { return peak_.load(); }
+
+    // tracker of the query whose task runs on this thread, nullptr if none
+    static QueryMemoryTracker *Current();
+
+    // bytes charged by this thread so far, for the statistics of the operators it runs
+    static u64 ThreadChargedBytes();
+
+private:
+    void UpdatePeak(u64 used);
+
+    const u64 limit_{};
+    Atomic<u64> used_{};
+    Atomic<u64> peak_{};
+};
+
+// Sets the tracker of the current thread during its lifetime.
+export class ScopedMemoryTracker {
+public:
+    explicit ScopedMemoryTracker(QueryMemoryTracker *tracker);
+
+    ~ScopedMemoryTracker();
+
+    ScopedMemoryTracker(const ScopedMemoryTracker &) = delete;
+    ScopedMemoryTracker &operator=(const ScopedMemoryTracker &) = delete;
+
+private:
+    QueryMemoryTracker *prev_tracker_{};
+};
+
+// Memory charged to the tracker of the current thread by its owner, released when the owner is destroyed.
+// It keeps the tracker alive, the owner may outlive the query, e.g. the blocks of a query result.
+export class TrackedMemory {
+public:
+    TrackedMemory() = default;
+
+    ~TrackedMemory() { Reset(); }
+
+    TrackedMemory(const TrackedMemory &) = delete;
+    TrackedMemory &operator=(const TrackedMemory &) = delete;
+
+    void Grow(u64 size);
+
+    void Reset();
+
+    [[nodiscard]] inline u64 size() const { return size_; }
+
+private:
+    SharedPtr<QueryMemoryTracker> tracker_{};
+    u64 size_{};
+};
+
+} // namespace infinity
@@ -48,6 +48,8 @@ module;
 #include "parallel_hashmap/phmap.h"
 #include "pgm/pgm_index.hpp"
 
+#include "roaring/roaring.hh"
+
 #include "vespalib/btree/btree.h"
 #include "vespalib/btree/btree.hpp"
 #include "vespalib/btree/btreeroot.h"
@@ -239,4 +241,7 @@ export template <typename KeyT,
 using BtreeStore = vespalib::btree::BTreeStore<KeyT, DataT, AggrT, CompareT, TraitsT, AggrCalcT>;
 export using GenerationHandler = vespalib::GenerationHandler;
 
+// compressed bitmap of u32, and / or / and not of two bitmaps use SIMD
+export using RoaringBitmap = roaring::Roaring;
+
 } // namespace infinity
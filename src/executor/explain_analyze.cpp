@@ -0,0 +1,145 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+#include <time.h>
+
+module explain_analyze;
+
+import stl;
+import physical_operator;
+import operator_state;
+import data_block;
+import explain_physical_plan;
+import memory_tracker;
+import buffer_obj;
+import profiler;
+import utility;
+import third_party;
+
+namespace infinity {
+
+namespace {
+
+i64 ThreadCpuTime() {
+    timespec ts{};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return static_cast<i64>(ts.tv_sec) * 1'000'000'000 + ts.tv_nsec;
+}
+
+i64 WallTime() { return ChronoCast<NanoSeconds>(Clock::now().time_since_epoch()).count(); }
+
+u64 FinalizedRowCount(const Vector<UniquePtr<DataBlock>> &data_blocks) {
+    u64 row_count = 0;
+    for (const auto &data_block : data_blocks) {
+        row_count += data_block->Finalized() ? data_block->selected_row_count() : 0;
+    }
+    return row_count;
+}
+
+} // namespace
+
+void ExplainAnalyzer::Record(const PhysicalOperator *op, i64 task_id, const OperatorAnalysis &execution) {
+    std::unique_lock lock(mutex_);
+    OperatorAnalysis &analysis = operator_analyses_[op];
+    analysis.task_ids_.insert(task_id);
+    ++analysis.execute_count_;
+    analysis.input_rows_ += execution.input_rows_;
+    analysis.output_rows_ += execution.output_rows_;
+    analysis.wall_time_ += execution.wall_time_;
+    analysis.cpu_time_ += execution.cpu_time_;
+    analysis.charged_bytes_ += execution.charged_bytes_;
+    analysis.max_charged_bytes_ = std::max(analysis.max_charged_bytes_, execution.charged_bytes_);
+    analysis.buffer_hit_count_ += execution.buffer_hit_count_;
+    analysis.buffer_miss_count_ += execution.buffer_miss_count_;
+    analysis.read_bytes_ += execution.read_bytes_;
+}
+
+void ExplainAnalyzer::Explain(const PhysicalOperator *op, SharedPtr<Vector<SharedPtr<String>>> &result, u64 peak_memory) const {
+    std::unique_lock lock(mutex_);
+    ExplainOperator(op, result, 0);
+    result->emplace_back(MakeShared<String>(fmt::format("Peak query memory: {}", Utility::FormatByteSize(peak_memory))));
+}
+
+void ExplainAnalyzer::ExplainOperator(const PhysicalOperator *op, SharedPtr<Vector<SharedPtr<String>>> &result, i64 intent_size) const {
+    ExplainPhysicalPlan::Explain(op, result, false, intent_size);
+
+    const String intent(intent_size, ' ');
+    auto iter = operator_analyses_.find(op);
+    if (iter == operator_analyses_.end()) {
+        result->emplace_back(MakeShared<String>(intent + " - not executed"));
+    } else {
+        const OperatorAnalysis &analysis = iter->second;
+        result->emplace_back(MakeShared<String>(fmt::format("{} - executions: {} in {} task(s)", intent, analysis.execute_count_, analysis.task_ids_.size())));
+        result->emplace_back(MakeShared<String>(fmt::format("{} - rows: {} in, {} out", intent, analysis.input_rows_, analysis.output_rows_)));
+        result->emplace_back(MakeShared<String>(fmt::format("{} - time: {} wall, {} cpu",
+                                                            intent,
+                                                            BaseProfiler::ElapsedToString(NanoSeconds(analysis.wall_time_)),
+                                                            BaseProfiler::ElapsedToString(NanoSeconds(analysis.cpu_time_)))));
+        result->emplace_back(MakeShared<String>(fmt::format("{} - memory: {} allocated, {} at most in one execution",
+                                                            intent,
+                                                            Utility::FormatByteSize(analysis.charged_bytes_),
+                                                            Utility::FormatByteSize(analysis.max_charged_bytes_))));
+        result->emplace_back(MakeShared<String>(fmt::format("{} - buffer: {} hits, {} misses, {} read",
+                                                            intent,
+                                                            analysis.buffer_hit_count_,
+                                                            analysis.buffer_miss_count_,
+                                                            Utility::FormatByteSize(analysis.read_bytes_))));
+    }
+
+    if (op->left() != nullptr) {
+        ExplainOperator(op->left(), result, intent_size + 2);
+    }
+    if (op->right() != nullptr) {
+        ExplainOperator(op->right(), result, intent_size + 2);
+    }
+}
+
+OperatorExecutionSample::OperatorExecutionSample(ExplainAnalyzer *analyzer, const OperatorState *operator_state) : analyzer_(analyzer) {
+    if (analyzer_ == nullptr) {
+        return;
+    }
+    // the input is counted before the operator consumes it
+    if (operator_state->prev_op_state_ != nullptr) {
+        start_.input_rows_ = FinalizedRowCount(operator_state->prev_op_state_->data_block_array_);
+    }
+    const BufferLoadStats &buffer_stats = ThreadBufferLoadStats();
+    start_.buffer_hit_count_ = buffer_stats.hit_count_;
+    start_.buffer_miss_count_ = buffer_stats.miss_count_;
+    start_.read_bytes_ = buffer_stats.read_bytes_;
+    start_.charged_bytes_ = QueryMemoryTracker::ThreadChargedBytes();
+    start_.cpu_time_ = ThreadCpuTime();
+    start_.wall_time_ = WallTime();
+}
+
+void OperatorExecutionSample::Stop(const PhysicalOperator *op, const OperatorState *operator_state, i64 task_id) {
+    if (analyzer_ == nullptr) {
+        return;
+    }
+    OperatorAnalysis execution;
+    execution.wall_time_ = WallTime() - start_.wall_time_;
+    execution.cpu_time_ = ThreadCpuTime() - start_.cpu_time_;
+    execution.charged_bytes_ = QueryMemoryTracker::ThreadChargedBytes() - start_.charged_bytes_;
+    const BufferLoadStats &buffer_stats = ThreadBufferLoadStats();
+    execution.buffer_hit_count_ = buffer_stats.hit_count_ - start_.buffer_hit_count_;
+    execution.buffer_miss_count_ = buffer_stats.miss_count_ - start_.buffer_miss_count_;
+    execution.read_bytes_ = buffer_stats.read_bytes_ - start_.read_bytes_;
+    execution.input_rows_ = start_.input_rows_;
+    execution.output_rows_ = FinalizedRowCount(operator_state->data_block_array_);
+    analyzer_->Record(op, task_id, execution);
+}
+
+} // namespace infinity
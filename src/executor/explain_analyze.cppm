@@ -0,0 +1,68 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+export module explain_analyze;
+
+import stl;
+import physical_operator;
+import operator_state;
+
+namespace infinity {
+
+// Execution statistics of one physical operator, summed over its executions in all the tasks of its fragment.
+struct OperatorAnalysis {
+    HashSet<i64> task_ids_{};
+    u64 execute_count_{};
+    u64 input_rows_{};
+    u64 output_rows_{};
+    i64 wall_time_{}; // ns
+    i64 cpu_time_{};  // ns
+    u64 charged_bytes_{};
+    u64 max_charged_bytes_{}; // in one execution
+    u64 buffer_hit_count_{};
+    u64 buffer_miss_count_{};
+    u64 read_bytes_{};
+};
+
+// Collects the statistics of the operators for EXPLAIN ANALYZE, while the explained plan runs.
+export class ExplainAnalyzer {
+public:
+    void Record(const PhysicalOperator *op, i64 task_id, const OperatorAnalysis &execution);
+
+    // The physical plan annotated with the statistics of each operator
+    void Explain(const PhysicalOperator *op, SharedPtr<Vector<SharedPtr<String>>> &result, u64 peak_memory) const;
+
+private:
+    void ExplainOperator(const PhysicalOperator *op, SharedPtr<Vector<SharedPtr<String>>> &result, i64 intent_size) const;
+
+    mutable std::mutex mutex_{};
+    HashMap<const PhysicalOperator *, OperatorAnalysis> operator_analyses_{};
+};
+
+// Measures one execution of an operator by the current thread, nothing is measured without analyzer.
+export class OperatorExecutionSample {
+public:
+    OperatorExecutionSample(ExplainAnalyzer *analyzer, const OperatorState *operator_state);
+
+    void Stop(const PhysicalOperator *op, const OperatorState *operator_state, i64 task_id);
+
+private:
+    ExplainAnalyzer *analyzer_{};
+    OperatorAnalysis start_{};
+};
+
+} // namespace infinity
@@ -14,6 +14,7 @@
 
 module;
 
+#include <algorithm>
 #include <string>
 
 module explain_physical_plan;
@@ -79,6 +80,7 @@ import base_expression;
 import knn_expression;
 import third_party;
 import select_statement;
+import top_n_threshold;
 import knn_expr;
 import extra_ddl_info;
 import column_def;
@@ -279,7 +281,11 @@ void ExplainPhysicalPlan::Explain(const PhysicalOperator *op, SharedPtr<Vector<S
             break;
         }
         default: {
-            UnrecoverableError("Unexpected logical node type");
+            // operators without dedicated explain, e.g. merge aggregate or command, show their name only
+            String header_str = intent_size != 0 ? String(intent_size - 2, ' ') + "-> " : String();
+            header_str += fmt::format("{} ({})", op->GetName(), op->node_id());
+            result->emplace_back(MakeShared<String>(header_str));
+            break;
         }
     }
 
@@ -720,6 +726,19 @@ void ExplainPhysicalPlan::Explain(const PhysicalTableScan *table_scan_node, Shar
     output_columns += table_scan_node->GetOutputNames()->back();
     output_columns += "]";
     result->emplace_back(MakeShared<String>(output_columns));
+
+    // Pushed down top-n threshold and limit
+    if (const auto &top_n_threshold = table_scan_node->top_n_threshold(); top_n_threshold.get() != nullptr) {
+        const Vector<SizeT> &column_ids = table_scan_node->ColumnIDs();
+        SizeT column_index = std::find(column_ids.begin(), column_ids.end(), top_n_threshold->column_id()) - column_ids.begin();
+        String top_n_str = String(intent_size, ' ') + " - top-n threshold: " + table_scan_node->GetOutputNames()->at(column_index);
+        top_n_str += top_n_threshold->order_type() == OrderType::kAsc ? " ASC" : " DESC";
+        result->emplace_back(MakeShared<String>(top_n_str));
+    }
+    if (table_scan_node->limit() > 0) {
+        String limit_str = String(intent_size, ' ') + " - limit: " + std::to_string(table_scan_node->limit());
+        result->emplace_back(MakeShared<String>(limit_str));
+    }
 }
 
 void ExplainPhysicalPlan::Explain(const PhysicalIndexScan *index_scan_node, SharedPtr<Vector<SharedPtr<String>>> &result, i64 intent_size) {
@@ -1297,6 +1316,24 @@ void ExplainPhysicalPlan::Explain(const PhysicalShow *show_node, SharedPtr<Vecto
             result->emplace_back(MakeShared<String>(output_columns_str));
             break;
         }
+        case ShowType::kShowTasks: {
+            String show_str;
+            if (intent_size != 0) {
+                show_str = String(intent_size - 2, ' ');
+                show_str += "-> SHOW TASKS ";
+            } else {
+                show_str = "SHOW TASKS ";
+            }
+            show_str += "(";
+            show_str += std::to_string(show_node->node_id());
+            show_str += ")";
+            result->emplace_back(MakeShared<String>(show_str));
+
+            String output_columns_str = String(intent_size, ' ');
+            output_columns_str += " - output columns: [task_id, task_class, task, status, elapsed_ms]";
+            result->emplace_back(MakeShared<String>(output_columns_str));
+            break;
+        }
         case ShowType::kInvalid: {
             UnrecoverableError("Invalid show type");
         }
@@ -1404,6 +1441,11 @@ void ExplainPhysicalPlan::Explain(const PhysicalImport *import_node, SharedPtr<V
             result->emplace_back(file_type);
             break;
         }
+        case CopyFileType::kParquet: {
+            SharedPtr<String> file_type = MakeShared<String>(String(intent_size, ' ') + " - type: PARQUET");
+            result->emplace_back(file_type);
+            break;
+        }
     }
 
     if (import_node->left() != nullptr or import_node->right() != nullptr) {
@@ -1466,6 +1508,11 @@ void ExplainPhysicalPlan::Explain(const PhysicalExport *export_node, SharedPtr<V
             result->emplace_back(file_type);
             break;
         }
+        case CopyFileType::kParquet: {
+            SharedPtr<String> file_type = MakeShared<String>(String(intent_size, ' ') + " - type: PARQUET");
+            result->emplace_back(file_type);
+            break;
+        }
     }
 
     if (export_node->left() != nullptr or export_node->right() != nullptr) {
@@ -14,6 +14,9 @@
 
 module;
 
+#include <algorithm>
+#include <cstring>
+
 module expression_evaluator;
 
 import stl;
@@ -34,10 +37,46 @@ import third_party;
 import infinity_exception;
 import expression_type;
 import bound_cast_func;
+import in_value_set;
+import value;
+import logical_type;
+import internal_types;
+import data_type;
+import bitmask;
+import vector_buffer;
+import selection;
 
 namespace infinity {
 
-void ExpressionEvaluator::Init(const DataBlock *input_data_block) { input_data_block_ = input_data_block; }
+namespace {
+
+// the expression can be evaluated without input rows
+bool IsConstantExpression(const SharedPtr<BaseExpression> &expr) {
+    switch (expr->type()) {
+        case ExpressionType::kValue: {
+            return true;
+        }
+        case ExpressionType::kCast:
+        case ExpressionType::kFunction: {
+            for (const auto &argument : expr->arguments()) {
+                if (!IsConstantExpression(argument)) {
+                    return false;
+                }
+            }
+            return !expr->arguments().empty();
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+} // namespace
+
+void ExpressionEvaluator::Init(const DataBlock *input_data_block) {
+    input_data_block_ = input_data_block;
+    selected_columns_.clear();
+}
 
 void ExpressionEvaluator::Execute(const SharedPtr<BaseExpression> &expr, SharedPtr<ExpressionState> &state, SharedPtr<ColumnVector> &output_column) {
 
@@ -119,8 +158,89 @@ void ExpressionEvaluator::Execute(const SharedPtr<CastExpression> &expr,
     expr->func_.function(child_output, output_column_vector, child_output->Size(), cast_parameters);
 }
 
-void ExpressionEvaluator::Execute(const SharedPtr<CaseExpression> &, SharedPtr<ExpressionState> &, SharedPtr<ColumnVector> &) {
-    UnrecoverableError("Case execution");
+void ExpressionEvaluator::Execute(const SharedPtr<CaseExpression> &expr,
+                                  SharedPtr<ExpressionState> &state,
+                                  SharedPtr<ColumnVector> &output_column_vector) {
+    Vector<CaseCheck> &case_checks = expr->CaseExpr();
+    const SizeT when_count = case_checks.size();
+    // branch when_count is the ELSE branch, a null branch column means a NULL result
+    Vector<SharedPtr<ColumnVector>> when_columns(when_count);
+    Vector<SharedPtr<ColumnVector>> branch_columns(when_count + 1);
+    auto execute_child = [&](const SharedPtr<BaseExpression> &child_expr, SizeT child_idx) -> SharedPtr<ColumnVector> {
+        SharedPtr<ExpressionState> &child_state = state->Children()[child_idx];
+        if (child_state.get() == nullptr) {
+            return nullptr;
+        }
+        SharedPtr<ColumnVector> &child_output = child_state->OutputColumnVector();
+        Execute(child_expr, child_state, child_output);
+        return child_output;
+    };
+    for (SizeT i = 0; i < when_count; ++i) {
+        when_columns[i] = execute_child(case_checks[i].when_expr_, 2 * i);
+        branch_columns[i] = execute_child(case_checks[i].then_expr_, 2 * i + 1);
+    }
+    branch_columns[when_count] = execute_child(expr->ElseExpr(), 2 * when_count);
+
+    SizeT row_count = input_data_block_ != nullptr ? input_data_block_->selected_row_count() : 1;
+    auto update_row_count = [&](const SharedPtr<ColumnVector> &column) {
+        if (column.get() != nullptr and column->vector_type() != ColumnVectorType::kConstant) {
+            row_count = column->Size();
+        }
+    };
+    for (SizeT i = 0; i < when_count; ++i) {
+        update_row_count(when_columns[i]);
+        update_row_count(branch_columns[i]);
+    }
+    update_row_count(branch_columns[when_count]);
+
+    // Branch of each row: the first WHEN which is true and not null, or ELSE.
+    // WHENs are applied from the last one with a select instead of a jump, so the first true one is left in the end.
+    Vector<u32> row_branches(row_count, when_count);
+    for (SizeT k = when_count; k-- > 0;) {
+        const ColumnVector &when_column = *when_columns[k];
+        const VectorBuffer &when_buffer = *when_column.buffer_;
+        const Bitmask &when_nulls = *when_column.nulls_ptr_;
+        const u32 branch = k;
+        if (when_column.vector_type() == ColumnVectorType::kConstant) {
+            if (when_nulls.IsTrue(0) and when_buffer.GetCompactBit(0)) {
+                std::fill(row_branches.begin(), row_branches.end(), branch);
+            }
+        } else if (when_nulls.IsAllTrue()) {
+            for (SizeT i = 0; i < row_count; ++i) {
+                row_branches[i] = when_buffer.GetCompactBit(i) ? branch : row_branches[i];
+            }
+        } else {
+            for (SizeT i = 0; i < row_count; ++i) {
+                row_branches[i] = (when_nulls.IsTrue(i) and when_buffer.GetCompactBit(i)) ? branch : row_branches[i];
+            }
+        }
+    }
+
+    // Gather the value of each row from its branch. Fixed-size values are copied as bytes, the others row by row.
+    output_column_vector->Finalize(row_count);
+    Bitmask &result_nulls = *output_column_vector->nulls_ptr_;
+    result_nulls.SetAllTrue();
+    const DataType &result_type = *output_column_vector->data_type();
+    const SizeT type_size = result_type.Size();
+    for (SizeT i = 0; i < row_count; ++i) {
+        const ColumnVector *branch_column = branch_columns[row_branches[i]].get();
+        if (branch_column == nullptr) {
+            result_nulls.SetFalse(i);
+            continue;
+        }
+        const SizeT src_idx = branch_column->vector_type() == ColumnVectorType::kConstant ? 0 : i;
+        if (!branch_column->nulls_ptr_->IsTrue(src_idx)) {
+            result_nulls.SetFalse(i);
+            continue;
+        }
+        if (result_type.type() == LogicalType::kBoolean) {
+            output_column_vector->buffer_->SetCompactBit(i, branch_column->buffer_->GetCompactBit(src_idx));
+        } else if (result_type.Plain()) {
+            std::memcpy(output_column_vector->data() + i * type_size, branch_column->data() + src_idx * type_size, type_size);
+        } else {
+            output_column_vector->CopyRow(*branch_column, i, src_idx);
+        }
+    }
 }
 
 void ExpressionEvaluator::Execute(const SharedPtr<ColumnExpression> &, SharedPtr<ExpressionState> &, SharedPtr<ColumnVector> &) {
@@ -170,11 +290,98 @@ void ExpressionEvaluator::Execute(const SharedPtr<ReferenceExpression> &expr,
         UnrecoverableError("Invalid column index");
     }
 
-    output_column_vector = input_data_block_->column_vectors[column_index];
+    const SharedPtr<Selection> &selection = input_data_block_->selection();
+    if (selection.get() == nullptr) {
+        output_column_vector = input_data_block_->column_vectors[column_index];
+        return;
+    }
+
+    // Expressions only see the selected rows, each referenced column is compacted once per block
+    if (selected_columns_.empty()) {
+        selected_columns_.resize(input_data_block_->column_count());
+    }
+    SharedPtr<ColumnVector> &selected_column = selected_columns_[column_index];
+    if (selected_column.get() == nullptr) {
+        const SharedPtr<ColumnVector> &input_column = input_data_block_->column_vectors[column_index];
+        selected_column = MakeShared<ColumnVector>(input_column->data_type());
+        selected_column->Initialize(*input_column, *selection);
+    }
+    output_column_vector = selected_column;
 }
 
-void ExpressionEvaluator::Execute(const SharedPtr<InExpression> &, SharedPtr<ExpressionState> &, SharedPtr<ColumnVector> &) {
-    RecoverableError(Status::NotSupport("IN execution isn't implemented yet."));
+void ExpressionEvaluator::Execute(const SharedPtr<InExpression> &expr,
+                                  SharedPtr<ExpressionState> &state,
+                                  SharedPtr<ColumnVector> &output_column_vector) {
+    SharedPtr<ExpressionState> &left_state = state->Children()[0];
+    SharedPtr<ColumnVector> &left_output = left_state->OutputColumnVector();
+    Execute(expr->left_operand(), left_state, left_output);
+
+    const bool left_is_constant = left_output->vector_type() == ColumnVectorType::kConstant;
+    SizeT row_count = left_output->Size();
+    if (left_is_constant) {
+        row_count = input_data_block_ != nullptr ? input_data_block_->selected_row_count() : 1;
+    }
+    const bool negate = expr->in_type() == InType::kNotIn;
+    const Vector<SharedPtr<BaseExpression>> &arguments = expr->arguments();
+
+    // A constant list is evaluated once into a value set for all the blocks of the state
+    if (state->in_value_set_.get() == nullptr) {
+        bool constant_list = true;
+        for (const auto &argument : arguments) {
+            constant_list = constant_list and IsConstantExpression(argument);
+        }
+        if (constant_list) {
+            Vector<Value> values;
+            values.reserve(arguments.size());
+            for (SizeT i = 0; i < arguments.size(); ++i) {
+                SharedPtr<ExpressionState> &argument_state = state->Children()[i + 1];
+                SharedPtr<ColumnVector> &argument_output = argument_state->OutputColumnVector();
+                Execute(arguments[i], argument_state, argument_output);
+                values.emplace_back(argument_output->GetValue(0));
+            }
+            state->in_value_set_ = InValueSet::Make(*left_output->data_type(), values);
+        }
+    }
+
+    if (state->in_value_set_.get() != nullptr) {
+        state->in_value_set_->Probe(left_output, row_count, negate, output_column_vector);
+    } else {
+        // compare row by row with the evaluated list
+        Vector<SharedPtr<ColumnVector>> argument_outputs;
+        argument_outputs.reserve(arguments.size());
+        for (SizeT i = 0; i < arguments.size(); ++i) {
+            SharedPtr<ExpressionState> &argument_state = state->Children()[i + 1];
+            SharedPtr<ColumnVector> &argument_output = argument_state->OutputColumnVector();
+            Execute(arguments[i], argument_state, argument_output);
+            argument_outputs.emplace_back(argument_output);
+        }
+        BooleanColumnWriter writer(output_column_vector);
+        for (SizeT i = 0; i < row_count; ++i) {
+            Value left_value = left_output->GetValue(left_is_constant ? 0 : i);
+            bool found = false;
+            for (const auto &argument_output : argument_outputs) {
+                const SizeT idx = argument_output->vector_type() == ColumnVectorType::kConstant ? 0 : i;
+                if (argument_output->nulls_ptr_->IsTrue(idx) and argument_output->GetValue(idx) == left_value) {
+                    found = true;
+                    break;
+                }
+            }
+            writer[i].SetValue(found != negate);
+        }
+    }
+
+    // null left operand gives null
+    Bitmask &result_nulls = *output_column_vector->nulls_ptr_;
+    if (left_is_constant) {
+        if (left_output->nulls_ptr_->IsTrue(0)) {
+            result_nulls.SetAllTrue();
+        } else {
+            result_nulls.SetAllFalse();
+        }
+    } else {
+        result_nulls.DeepCopy(*left_output->nulls_ptr_);
+    }
+    output_column_vector->Finalize(row_count);
 }
 
 } // namespace infinity
@@ -56,6 +56,8 @@ public:
 
 private:
     const DataBlock *input_data_block_{};
+    // Selected rows of the referenced columns, when the input block carries a selection
+    Vector<SharedPtr<ColumnVector>> selected_columns_{};
     bool in_aggregate_{false};
 };
 
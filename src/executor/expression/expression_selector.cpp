@@ -29,6 +29,10 @@ import expression_evaluator;
 import internal_types;
 import third_party;
 import data_type;
+import expression_type;
+import function_expression;
+import value_expression;
+import value;
 
 import infinity_exception;
 
@@ -39,6 +43,16 @@ SizeT ExpressionSelector::Select(const SharedPtr<BaseExpression> &expr,
                                  const DataBlock *input_data_block,
                                  DataBlock *output_data_block,
                                  SizeT count) {
+    SharedPtr<Selection> output_true_select = Select(expr, state, input_data_block, count);
+
+    // Shrink the input data block into output data block
+    // this Init function will throw if output_data_block is already initialized before
+    output_data_block->Init(input_data_block, output_true_select);
+    return output_true_select->Size();
+}
+
+SharedPtr<Selection>
+ExpressionSelector::Select(const SharedPtr<BaseExpression> &expr, SharedPtr<ExpressionState> &state, const DataBlock *input_data_block, SizeT count) {
     this->input_data_ = input_data_block;
     SharedPtr<Selection> input_select = nullptr;
     SharedPtr<Selection> output_true_select = MakeShared<Selection>();
@@ -46,11 +60,7 @@ SizeT ExpressionSelector::Select(const SharedPtr<BaseExpression> &expr,
     SharedPtr<Selection> output_false_select = nullptr;
 
     Select(expr, state, count, input_select, output_true_select, output_false_select);
-
-    // Shrink the input data block into output data block
-    // this Init function will throw if output_data_block is already initialized before
-    output_data_block->Init(input_data_block, output_true_select);
-    return output_true_select->Size();
+    return output_true_select;
 }
 
 void ExpressionSelector::Select(const SharedPtr<BaseExpression> &expr,
@@ -75,6 +85,29 @@ void ExpressionSelector::Select(const SharedPtr<BaseExpression> &expr,
                                 SharedPtr<ExpressionState> &state,
                                 SizeT count,
                                 SharedPtr<Selection> &output_true_select) {
+    switch (expr->type()) {
+        case ExpressionType::kValue: {
+            // a constant condition selects all rows or none, NULL is not true
+            const Value &value = static_cast<ValueExpression &>(*expr).GetValue();
+            if (value.type().type() == LogicalType::kBoolean and value.GetValue<BooleanT>()) {
+                for (SizeT idx = 0; idx < count; ++idx) {
+                    output_true_select->Append(idx);
+                }
+            }
+            return;
+        }
+        case ExpressionType::kFunction: {
+            if (static_cast<FunctionExpression &>(*expr).ScalarFunctionName() == "AND") {
+                SelectConjunction(expr, state, count, output_true_select);
+                return;
+            }
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+
     SharedPtr<ColumnVector> bool_column = MakeShared<ColumnVector>(MakeShared<DataType>(LogicalType::kBoolean));
     bool_column->Initialize(ColumnVectorType::kCompactBit);
 
@@ -85,6 +118,38 @@ void ExpressionSelector::Select(const SharedPtr<BaseExpression> &expr,
     Select(bool_column, count, output_true_select, true);
 }
 
+void ExpressionSelector::SelectConjunction(const SharedPtr<BaseExpression> &expr,
+                                           SharedPtr<ExpressionState> &state,
+                                           SizeT count,
+                                           SharedPtr<Selection> &output_true_select) {
+    auto left_select = MakeShared<Selection>();
+    left_select->Initialize(count);
+    Select(expr->arguments()[0], state->Children()[0], count, left_select);
+    const SizeT left_count = left_select->Size();
+    if (left_count == 0) {
+        // no row left in this block, the right condition isn't evaluated
+        return;
+    }
+    if (left_count == count) {
+        Select(expr->arguments()[1], state->Children()[1], count, output_true_select);
+        return;
+    }
+
+    // The right condition is evaluated only on the rows the left one selected, its selection indexes them
+    DataBlock left_block;
+    left_block.InitShared(input_data_, left_select);
+    const DataBlock *input_data = input_data_;
+    input_data_ = &left_block;
+    auto right_select = MakeShared<Selection>();
+    right_select->Initialize(left_count);
+    Select(expr->arguments()[1], state->Children()[1], left_count, right_select);
+    input_data_ = input_data;
+
+    for (SizeT right_idx = 0; right_idx < right_select->Size(); ++right_idx) {
+        output_true_select->Append(left_select->Get(right_select->Get(right_idx)));
+    }
+}
+
 void ExpressionSelector::Select(const SharedPtr<ColumnVector> &bool_column, SizeT count, SharedPtr<Selection> &output_true_select, bool nullable) {
     if (bool_column->vector_type() != ColumnVectorType::kCompactBit || bool_column->data_type()->type() != LogicalType::kBoolean) {
         UnrecoverableError("Attempting to select non-boolean expression");
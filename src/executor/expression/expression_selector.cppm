@@ -34,6 +34,9 @@ public:
                  DataBlock *output_data_block,
                  SizeT count);
 
+    // Rows of input_data_block on which expr is true
+    SharedPtr<Selection> Select(const SharedPtr<BaseExpression> &expr, SharedPtr<ExpressionState> &state, const DataBlock *input_data_block, SizeT count);
+
     void Select(const SharedPtr<BaseExpression> &expr,
                 SharedPtr<ExpressionState> &state,
                 SizeT count,
@@ -46,6 +49,9 @@ public:
     static void Select(const SharedPtr<ColumnVector> &bool_column, SizeT count, SharedPtr<Selection> &output_true_select, bool nullable);
 
 private:
+    // Select the rows of both arguments of an AND, the right one is only evaluated on the rows the left one selects
+    void SelectConjunction(const SharedPtr<BaseExpression> &expr, SharedPtr<ExpressionState> &state, SizeT count, SharedPtr<Selection> &output_true_select);
+
     const DataBlock *input_data_{nullptr};
 };
 
@@ -88,12 +88,20 @@ SharedPtr<ExpressionState> ExpressionState::CreateState(const SharedPtr<CaseExpr
 
     SharedPtr<ExpressionState> result = MakeShared<ExpressionState>();
 
+    // a NULL branch has no state, its rows are set to null
+    auto add_branch = [&](const SharedPtr<BaseExpression> &branch_expr) {
+        if (branch_expr->Type().type() == LogicalType::kNull) {
+            result->children_.emplace_back(nullptr);
+        } else {
+            result->AddChild(branch_expr);
+        }
+    };
     Vector<CaseCheck> &case_checks = case_expr->CaseExpr();
     for (auto &case_check : case_checks) {
         result->AddChild(case_check.when_expr_);
-        result->AddChild(case_check.then_expr_);
+        add_branch(case_check.then_expr_);
     }
-    result->AddChild(case_expr->ElseExpr());
+    add_branch(case_expr->ElseExpr());
 
     result->column_vector_ = MakeShared<ColumnVector>(MakeShared<DataType>(case_expr->Type()));
     result->column_vector_->Initialize(ColumnVectorType::kFlat, DEFAULT_VECTOR_SIZE);
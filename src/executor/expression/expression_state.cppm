@@ -24,6 +24,7 @@ import function_expression;
 import value_expression;
 import in_expression;
 import column_vector;
+import in_value_set;
 
 export module expression_state;
 
@@ -57,6 +58,9 @@ public:
 
     char *agg_state_{};
 
+    // values of a constant IN list, built at the first execution
+    UniquePtr<InValueSet> in_value_set_{};
+
 private:
     Vector<SharedPtr<ExpressionState>> children_;
     String name_;
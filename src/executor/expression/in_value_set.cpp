@@ -0,0 +1,104 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+module in_value_set;
+
+import stl;
+import column_vector;
+import value;
+import data_type;
+import logical_type;
+import internal_types;
+import fix_heap;
+
+namespace infinity {
+
+UniquePtr<InValueSet> InValueSet::Make(const DataType &type, const Vector<Value> &values) {
+    switch (type.type()) {
+        case LogicalType::kTinyInt:
+            return MakeUnique<InValueSetT<TinyIntT>>(values);
+        case LogicalType::kSmallInt:
+            return MakeUnique<InValueSetT<SmallIntT>>(values);
+        case LogicalType::kInteger:
+            return MakeUnique<InValueSetT<IntegerT>>(values);
+        case LogicalType::kBigInt:
+            return MakeUnique<InValueSetT<BigIntT>>(values);
+        case LogicalType::kFloat:
+            return MakeUnique<InValueSetT<FloatT>>(values);
+        case LogicalType::kDouble:
+            return MakeUnique<InValueSetT<DoubleT>>(values);
+        case LogicalType::kDate:
+            return MakeUnique<InValueSetT<DateT>>(values);
+        case LogicalType::kTime:
+            return MakeUnique<InValueSetT<TimeT>>(values);
+        case LogicalType::kDateTime:
+            return MakeUnique<InValueSetT<DateTimeT>>(values);
+        case LogicalType::kTimestamp:
+            return MakeUnique<InValueSetT<TimestampT>>(values);
+        case LogicalType::kVarchar:
+            return MakeUnique<VarcharInValueSet>(values);
+        default: {
+            return nullptr;
+        }
+    }
+}
+
+VarcharInValueSet::VarcharInValueSet(const Vector<Value> &values) {
+    values_.reserve(values.size());
+    for (const auto &value : values) {
+        values_.push_back(value.GetVarchar());
+    }
+    // views point into values_, which isn't resized any more
+    for (const auto &value : values_) {
+        value_set_.insert(value);
+        min_length_ = std::min(min_length_, value.size());
+        max_length_ = std::max(max_length_, value.size());
+    }
+}
+
+bool VarcharInValueSet::Contains(const VarcharT &value, FixHeapManager *heap_mgr) {
+    const SizeT length = value.length_;
+    if (length < min_length_ or length > max_length_) {
+        return false;
+    }
+    if (value.IsInlined()) {
+        return value_set_.contains(std::string_view(value.short_.data_, length));
+    }
+    if (value.is_value_) {
+        return value_set_.contains(std::string_view(value.value_.ptr_, length));
+    }
+    buffer_.resize(length);
+    heap_mgr->ReadFromHeap(buffer_.data(), value.vector_.chunk_id_, value.vector_.chunk_offset_, length);
+    return value_set_.contains(std::string_view(buffer_.data(), length));
+}
+
+void VarcharInValueSet::Probe(const SharedPtr<ColumnVector> &column, SizeT count, bool negate, SharedPtr<ColumnVector> &result) {
+    ColumnValueReader<VarcharT> reader(column);
+    BooleanColumnWriter writer(result);
+    if (column->vector_type() == ColumnVectorType::kConstant) {
+        const bool found = Contains(reader[0].GetValue(), reader.fix_heap_mgr());
+        for (SizeT i = 0; i < count; ++i) {
+            writer[i].SetValue(found != negate);
+        }
+        return;
+    }
+    for (SizeT i = 0; i < count; ++i) {
+        writer[i].SetValue(Contains(reader[i].GetValue(), reader.fix_heap_mgr()) != negate);
+    }
+}
+
+} // namespace infinity
@@ -0,0 +1,135 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+export module in_value_set;
+
+import stl;
+import column_vector;
+import value;
+import data_type;
+import logical_type;
+import internal_types;
+import fix_heap;
+
+namespace infinity {
+
+// Values of a constant IN list, built once per expression state and probed with whole column vectors.
+export class InValueSet {
+public:
+    virtual ~InValueSet() = default;
+
+    // Write (row in set) != negate of rows [0, count) of column into result, row 0 is used if column is constant.
+    // Nulls are not handled here.
+    virtual void Probe(const SharedPtr<ColumnVector> &column, SizeT count, bool negate, SharedPtr<ColumnVector> &result) = 0;
+
+    [[nodiscard]] virtual SizeT Size() const = 0;
+
+    // nullptr if the type can't be probed by value, the values are already of the given type
+    static UniquePtr<InValueSet> Make(const DataType &type, const Vector<Value> &values);
+};
+
+// Fixed-size types up to 8 bytes, compared by their bits.
+// Short lists are probed with a branch-free loop over all values, which the compiler vectorizes, long ones with a hash set.
+export template <typename T>
+class InValueSetT final : public InValueSet {
+    static_assert(sizeof(T) <= sizeof(u64) and std::is_trivially_copyable_v<T>);
+
+public:
+    static constexpr SizeT kLinearProbeLimit = 16;
+
+    explicit InValueSetT(const Vector<Value> &values) {
+        for (const auto &value : values) {
+            u64 key = ToKey(value.GetValue<T>());
+            if (std::find(sorted_keys_.begin(), sorted_keys_.end(), key) == sorted_keys_.end()) {
+                sorted_keys_.push_back(key);
+            }
+        }
+        std::sort(sorted_keys_.begin(), sorted_keys_.end());
+        if (sorted_keys_.size() > kLinearProbeLimit) {
+            key_set_.insert(sorted_keys_.begin(), sorted_keys_.end());
+        }
+    }
+
+    void Probe(const SharedPtr<ColumnVector> &column, SizeT count, bool negate, SharedPtr<ColumnVector> &result) override {
+        const auto *data = reinterpret_cast<const T *>(column->data());
+        const bool is_constant = column->vector_type() == ColumnVectorType::kConstant;
+        BooleanColumnWriter writer(result);
+        if (is_constant) {
+            const bool found = Contains(ToKey(data[0]));
+            for (SizeT i = 0; i < count; ++i) {
+                writer[i].SetValue(found != negate);
+            }
+            return;
+        }
+        for (SizeT i = 0; i < count; ++i) {
+            writer[i].SetValue(Contains(ToKey(data[i])) != negate);
+        }
+    }
+
+    [[nodiscard]] SizeT Size() const override { return sorted_keys_.size(); }
+
+private:
+    static inline u64 ToKey(T value) {
+        if constexpr (std::is_floating_point_v<T>) {
+            // -0.0 == 0.0
+            if (value == 0) {
+                value = 0;
+            }
+        }
+        u64 key = 0;
+        std::memcpy(&key, &value, sizeof(T));
+        return key;
+    }
+
+    inline bool Contains(u64 key) const {
+        if (sorted_keys_.size() > kLinearProbeLimit) {
+            return key_set_.contains(key);
+        }
+        bool found = false;
+        for (u64 candidate : sorted_keys_) {
+            found |= (candidate == key);
+        }
+        return found;
+    }
+
+    Vector<u64> sorted_keys_{};
+    HashSet<u64> key_set_{};
+};
+
+export class VarcharInValueSet final : public InValueSet {
+public:
+    explicit VarcharInValueSet(const Vector<Value> &values);
+
+    void Probe(const SharedPtr<ColumnVector> &column, SizeT count, bool negate, SharedPtr<ColumnVector> &result) override;
+
+    [[nodiscard]] SizeT Size() const override { return value_set_.size(); }
+
+private:
+    bool Contains(const VarcharT &value, FixHeapManager *heap_mgr);
+
+    Vector<String> values_{};
+    HashSet<std::string_view> value_set_{};
+    SizeT min_length_{std::numeric_limits<SizeT>::max()};
+    SizeT max_length_{};
+    String buffer_{};
+};
+
+} // namespace infinity
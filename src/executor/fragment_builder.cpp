@@ -32,6 +32,7 @@ import fragment_context;
 import logger;
 import third_party;
 import explain_statement;
+import query_context;
 
 namespace infinity {
 
@@ -51,7 +52,12 @@ void FragmentBuilder::BuildExplain(PhysicalOperator *phys_op, PlanFragment *curr
     switch (explain_op->explain_type()) {
 
         case ExplainType::kAnalyze: {
-            RecoverableError(Status::NotSupport("Not implement: Query analyze"));
+            // run the explained plan as child fragment, its operators are measured while the analyzer is set
+            auto explain_child_fragment = this->BuildFragment(phys_op->left());
+            query_context_ptr_->set_explain_analyzer(explain_op->analyzer());
+            current_fragment_ptr->AddOperator(phys_op);
+            current_fragment_ptr->AddChild(std::move(explain_child_fragment));
+            break;
         }
         case ExplainType::kAst:
         case ExplainType::kUnOpt:
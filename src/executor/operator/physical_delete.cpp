@@ -29,6 +29,8 @@ import logical_type;
 import data_block;
 import column_vector;
 import internal_types;
+import status;
+import infinity_exception;
 
 module physical_delete;
 
@@ -55,7 +57,9 @@ bool PhysicalDelete::Execute(QueryContext *query_context, OperatorState *operato
             }
         }
         if (!row_ids.empty()) {
-            txn->Delete(db_name, *table_name, row_ids);
+            if (Status status = txn->Delete(db_name, *table_name, row_ids); !status.ok()) {
+                RecoverableError(status);
+            }
             DeleteOperatorState* delete_operator_state = static_cast<DeleteOperatorState*>(operator_state);
             ++ delete_operator_state->count_;
             delete_operator_state->sum_ += row_ids.size();
@@ -31,6 +31,8 @@ import value;
 import status;
 import infinity_exception;
 import logical_type;
+import explain_analyze;
+import memory_tracker;
 
 namespace infinity {
 
@@ -54,7 +56,7 @@ void PhysicalExplain::Init() {
     switch (explain_type_) {
         case ExplainType::kAnalyze: {
             output_names_->emplace_back("Query Analyze");
-            RecoverableError(Status::NotSupport("Not implement: Query analyze"));
+            break;
         }
         case ExplainType::kAst: {
             output_names_->emplace_back("Abstract Syntax Tree");
@@ -89,7 +91,7 @@ void PhysicalExplain::Init() {
     }
 }
 
-bool PhysicalExplain::Execute(QueryContext *, OperatorState *operator_state) {
+bool PhysicalExplain::Execute(QueryContext *query_context, OperatorState *operator_state) {
     String title;
 
     auto column_vector_ptr = ColumnVector::Make(MakeShared<DataType>(LogicalType::kVarchar));
@@ -100,7 +102,10 @@ bool PhysicalExplain::Execute(QueryContext *, OperatorState *operator_state) {
     switch (explain_type_) {
         case ExplainType::kAnalyze: {
             title = "Query Analyze";
-            RecoverableError(Status::NotSupport("Not implement: Query analyze"));
+            // the explained plan is run by the child fragment, which has finished
+            texts_ = MakeShared<Vector<SharedPtr<String>>>();
+            analyzer_->Explain(left(), texts_, query_context->memory_tracker()->peak());
+            break;
         }
         case ExplainType::kAst: {
             title = "Abstract Syntax Tree";
@@ -27,6 +27,7 @@ import infinity_exception;
 import internal_types;
 import explain_statement;
 import data_type;
+import explain_analyze;
 
 namespace infinity {
 
@@ -37,7 +38,11 @@ public:
                              SharedPtr<Vector<SharedPtr<String>>> text_array,
                              UniquePtr<PhysicalOperator> left,
                              SharedPtr<Vector<LoadMeta>> load_metas)
-        : PhysicalOperator(PhysicalOperatorType::kExplain, std::move(left), nullptr, id, load_metas), explain_type_(type), texts_(std::move(text_array)) {}
+        : PhysicalOperator(PhysicalOperatorType::kExplain, std::move(left), nullptr, id, load_metas), explain_type_(type), texts_(std::move(text_array)) {
+        if (explain_type_ == ExplainType::kAnalyze) {
+            analyzer_ = MakeUnique<ExplainAnalyzer>();
+        }
+    }
 
     ~PhysicalExplain() override = default;
 
@@ -60,12 +65,15 @@ public:
 
     inline ExplainType explain_type() const { return explain_type_; }
 
+    inline ExplainAnalyzer *analyzer() const { return analyzer_.get(); }
+
     static void AlignParagraphs(Vector<SharedPtr<String>> &array1, Vector<SharedPtr<String>> &array2);
 
 private:
     ExplainType explain_type_{ExplainType::kPhysical};
     SharedPtr<Vector<SharedPtr<String>>> texts_{nullptr};
     SharedPtr<Vector<SharedPtr<String>>> task_texts_{nullptr};
+    UniquePtr<ExplainAnalyzer> analyzer_{}; // EXPLAIN ANALYZE only
 
     SharedPtr<Vector<String>> output_names_{};
     SharedPtr<Vector<SharedPtr<DataType>>> output_types_{};
@@ -14,22 +14,385 @@
 
 module;
 
-import query_context;
-import operator_state;
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <future>
 
 module physical_export;
 
+import stl;
+import query_context;
+import operator_state;
+import txn;
+import table_entry;
+import block_entry;
+import block_index;
+import buffer_manager;
+import column_vector;
+import column_def;
+import third_party;
+import defer_op;
+import status;
+import infinity_exception;
+import internal_types;
+import embedding_info;
+import statement_common;
+import logical_type;
+
 namespace infinity {
 
+namespace {
+
+template <typename T>
+void AppendEmbeddingText(String &output, const ColumnVector &column_vector, SizeT row_idx, SizeT dimension, char delimiter) {
+    const T *embedding = reinterpret_cast<const T *>(column_vector.data()) + row_idx * dimension;
+    output += '[';
+    for (SizeT i = 0; i < dimension; ++i) {
+        if (i > 0) {
+            output += delimiter;
+        }
+        output += fmt::format("{}", embedding[i]);
+    }
+    output += ']';
+}
+
+// Text of one cell. Floating point numbers use the shortest form that reads back to the same value. Embeddings are written
+// as "[e1<delimiter>e2...]": CSV import splits the elements on its own delimiter, JSON needs ','.
+String CellToString(const ColumnVector &column_vector, SizeT row_idx, char delimiter) {
+    switch (column_vector.data_type()->type()) {
+        case kFloat: {
+            return fmt::format("{}", reinterpret_cast<const FloatT *>(column_vector.data())[row_idx]);
+        }
+        case kDouble: {
+            return fmt::format("{}", reinterpret_cast<const DoubleT *>(column_vector.data())[row_idx]);
+        }
+        case kEmbedding: {
+            auto *embedding_info = static_cast<EmbeddingInfo *>(column_vector.data_type()->type_info().get());
+            SizeT dimension = embedding_info->Dimension();
+            String output;
+            switch (embedding_info->Type()) {
+                case kElemInt8: {
+                    AppendEmbeddingText<i8>(output, column_vector, row_idx, dimension, delimiter);
+                    break;
+                }
+                case kElemInt16: {
+                    AppendEmbeddingText<i16>(output, column_vector, row_idx, dimension, delimiter);
+                    break;
+                }
+                case kElemInt32: {
+                    AppendEmbeddingText<i32>(output, column_vector, row_idx, dimension, delimiter);
+                    break;
+                }
+                case kElemInt64: {
+                    AppendEmbeddingText<i64>(output, column_vector, row_idx, dimension, delimiter);
+                    break;
+                }
+                case kElemFloat: {
+                    AppendEmbeddingText<float>(output, column_vector, row_idx, dimension, delimiter);
+                    break;
+                }
+                case kElemDouble: {
+                    AppendEmbeddingText<double>(output, column_vector, row_idx, dimension, delimiter);
+                    break;
+                }
+                default: {
+                    output = column_vector.ToString(row_idx);
+                }
+            }
+            return output;
+        }
+        default: {
+            return column_vector.ToString(row_idx);
+        }
+    }
+}
+
+// An empty string is quoted, an empty field stands for NULL
+void AppendCSVField(String &output, const String &field, char delimiter) {
+    if (field.empty()) {
+        output += "\"\"";
+        return;
+    }
+    bool need_quote = false;
+    for (char c : field) {
+        if (c == delimiter or c == '"' or c == '\n' or c == '\r') {
+            need_quote = true;
+            break;
+        }
+    }
+    if (!need_quote) {
+        output += field;
+        return;
+    }
+    output += '"';
+    for (char c : field) {
+        if (c == '"') {
+            output += '"';
+        }
+        output += c;
+    }
+    output += '"';
+}
+
+void AppendJSONString(String &output, const String &str) {
+    output += '"';
+    for (char c : str) {
+        switch (c) {
+            case '"': {
+                output += "\\\"";
+                break;
+            }
+            case '\\': {
+                output += "\\\\";
+                break;
+            }
+            case '\n': {
+                output += "\\n";
+                break;
+            }
+            case '\r': {
+                output += "\\r";
+                break;
+            }
+            case '\t': {
+                output += "\\t";
+                break;
+            }
+            default: {
+                if (static_cast<u8>(c) < 0x20) {
+                    output += fmt::format("\\u{:04x}", static_cast<u8>(c));
+                } else {
+                    output += c;
+                }
+            }
+        }
+    }
+    output += '"';
+}
+
+void AppendJSONValue(String &output, const ColumnVector &column_vector, SizeT row_idx) {
+    if (!column_vector.nulls_ptr_->IsTrue(row_idx)) {
+        output += "null";
+        return;
+    }
+    switch (column_vector.data_type()->type()) {
+        case kBoolean:
+        case kTinyInt:
+        case kSmallInt:
+        case kInteger:
+        case kBigInt:
+        case kFloat:
+        case kDouble:
+        case kEmbedding: {
+            output += CellToString(column_vector, row_idx, ',');
+            break;
+        }
+        default: {
+            AppendJSONString(output, CellToString(column_vector, row_idx, ','));
+        }
+    }
+}
+
+} // namespace
+
 void PhysicalExport::Init() {}
 
-bool PhysicalExport::Execute(QueryContext *, OperatorState *operator_state) {
+bool PhysicalExport::Execute(QueryContext *query_context, OperatorState *operator_state) {
+    ExportOperatorState *export_op_state = static_cast<ExportOperatorState *>(operator_state);
+    switch (file_type_) {
+        case CopyFileType::kCSV: {
+            ExportCSV(query_context, export_op_state);
+            break;
+        }
+        case CopyFileType::kJSON: {
+            ExportJSON(query_context, export_op_state);
+            break;
+        }
+        case CopyFileType::kJSONL: {
+            ExportJSONL(query_context, export_op_state);
+            break;
+        }
+        case CopyFileType::kFVECS: {
+            ExportFVECS(query_context, export_op_state);
+            break;
+        }
+        case CopyFileType::kParquet: {
+            RecoverableError(Status::NotSupport("Export parquet is not supported."));
+            break;
+        }
+    }
     operator_state->SetComplete();
     return true;
 }
 
-void PhysicalExport::ExportCSV(QueryContext *) {}
+void PhysicalExport::ExportCSV(QueryContext *query_context, ExportOperatorState *export_op_state) {
+    TableEntry *table_entry = GetTableEntry(query_context);
+
+    String file_header;
+    if (header_) {
+        for (SizeT column_idx = 0; column_idx < table_entry->ColumnCount(); ++column_idx) {
+            if (column_idx > 0) {
+                file_header += delimiter_;
+            }
+            AppendCSVField(file_header, table_entry->GetColumnDefByID(column_idx)->name(), delimiter_);
+        }
+        file_header += '\n';
+    }
+
+    char delimiter = delimiter_;
+    auto export_row = [delimiter](const Vector<ColumnVector> &column_vectors, SizeT row_idx, String &output) {
+        for (SizeT column_idx = 0; column_idx < column_vectors.size(); ++column_idx) {
+            if (column_idx > 0) {
+                output += delimiter;
+            }
+            const ColumnVector &column_vector = column_vectors[column_idx];
+            if (!column_vector.nulls_ptr_->IsTrue(row_idx)) {
+                // NULL is an empty field
+                continue;
+            }
+            AppendCSVField(output, CellToString(column_vector, row_idx, delimiter), delimiter);
+        }
+        output += '\n';
+    };
+    SizeT row_count = ExportBlocks(query_context, table_entry, file_header, export_row);
+
+    auto result_msg = MakeUnique<String>(fmt::format("EXPORT {} Rows", row_count));
+    export_op_state->result_msg_ = std::move(result_msg);
+}
+
+void PhysicalExport::ExportJSON(QueryContext *, ExportOperatorState *) {
+    RecoverableError(Status::NotSupport("Export JSON is not implemented yet, use JSONL instead."));
+}
+
+void PhysicalExport::ExportJSONL(QueryContext *query_context, ExportOperatorState *export_op_state) {
+    TableEntry *table_entry = GetTableEntry(query_context);
+
+    // Column names are escaped once, each row only fills in the values
+    Vector<String> json_keys;
+    for (SizeT column_idx = 0; column_idx < table_entry->ColumnCount(); ++column_idx) {
+        String json_key;
+        AppendJSONString(json_key, table_entry->GetColumnDefByID(column_idx)->name());
+        json_key += ':';
+        json_keys.emplace_back(std::move(json_key));
+    }
+
+    auto export_row = [&json_keys](const Vector<ColumnVector> &column_vectors, SizeT row_idx, String &output) {
+        output += '{';
+        for (SizeT column_idx = 0; column_idx < column_vectors.size(); ++column_idx) {
+            if (column_idx > 0) {
+                output += ',';
+            }
+            output += json_keys[column_idx];
+            AppendJSONValue(output, column_vectors[column_idx], row_idx);
+        }
+        output += "}\n";
+    };
+    SizeT row_count = ExportBlocks(query_context, table_entry, String(), export_row);
+
+    auto result_msg = MakeUnique<String>(fmt::format("EXPORT {} Rows", row_count));
+    export_op_state->result_msg_ = std::move(result_msg);
+}
+
+void PhysicalExport::ExportFVECS(QueryContext *query_context, ExportOperatorState *export_op_state) {
+    TableEntry *table_entry = GetTableEntry(query_context);
+    if (table_entry->ColumnCount() != 1) {
+        RecoverableError(Status::NotSupport("Only table with one embedding column can be exported as FVECS file."));
+    }
+    auto &column_type = table_entry->GetColumnDefByID(0)->column_type_;
+    if (column_type->type() != kEmbedding) {
+        RecoverableError(Status::NotSupport("Only table with one embedding column can be exported as FVECS file."));
+    }
+    auto embedding_info = static_cast<EmbeddingInfo *>(column_type->type_info().get());
+    if (embedding_info->Type() != kElemFloat) {
+        RecoverableError(Status::NotSupport("Only embedding column with float element can be exported as FVECS file."));
+    }
 
-void PhysicalExport::ExportJSON(QueryContext *) {}
+    i32 dimension = embedding_info->Dimension();
+    SizeT row_size = sizeof(FloatT) * dimension;
+    auto export_row = [dimension, row_size](const Vector<ColumnVector> &column_vectors, SizeT row_idx, String &output) {
+        output.append(reinterpret_cast<const char *>(&dimension), sizeof(dimension));
+        output.append(reinterpret_cast<const char *>(column_vectors[0].data()) + row_idx * row_size, row_size);
+    };
+    SizeT row_count = ExportBlocks(query_context, table_entry, String(), export_row);
+
+    auto result_msg = MakeUnique<String>(fmt::format("EXPORT {} Rows", row_count));
+    export_op_state->result_msg_ = std::move(result_msg);
+}
+
+TableEntry *PhysicalExport::GetTableEntry(QueryContext *query_context) const {
+    Txn *txn = query_context->GetTxn();
+    auto [table_entry, status] = txn->GetTableByName(schema_name_, table_name_);
+    if (!status.ok()) {
+        RecoverableError(status);
+    }
+    return table_entry;
+}
+
+SizeT PhysicalExport::ExportBlocks(QueryContext *query_context, TableEntry *table_entry, const String &file_header, const ExportRowFunc &export_row) {
+    Txn *txn = query_context->GetTxn();
+    TxnTimeStamp begin_ts = txn->BeginTS();
+    BufferManager *buffer_mgr = txn->GetBufferMgr();
+    SizeT column_count = table_entry->ColumnCount();
+    SharedPtr<BlockIndex> block_index = table_entry->GetBlockIndex(begin_ts);
+
+    FILE *fp = fopen(file_path_.c_str(), "wb");
+    if (!fp) {
+        RecoverableError(Status::IOError(fmt::format("Can't open {}: {}", file_path_, strerror(errno))));
+    }
+    DeferFn defer_fn([&]() { fclose(fp); });
+    auto write_output = [&](const String &output) {
+        if (fwrite(output.data(), 1, output.size(), fp) != output.size()) {
+            RecoverableError(Status::IOError(fmt::format("Write {} failed: {}", file_path_, strerror(errno))));
+        }
+    };
+    write_output(file_header);
+
+    // Column data is read straight from the block buffers, only rows visible to this transaction are exported
+    auto export_block = [&](BlockEntry *block_entry) -> Pair<SizeT, String> {
+        Vector<ColumnVector> column_vectors;
+        for (SizeT column_idx = 0; column_idx < column_count; ++column_idx) {
+            column_vectors.emplace_back(block_entry->GetColumnBlockEntry(column_idx)->GetColumnVector(buffer_mgr));
+        }
+        SizeT row_count = 0;
+        String output;
+        BlockOffset read_offset = 0;
+        while (true) {
+            auto [row_begin, row_end] = block_entry->GetVisibleRange(begin_ts, read_offset);
+            if (row_begin == row_end) {
+                break;
+            }
+            for (SizeT row_idx = row_begin; row_idx < row_end; ++row_idx) {
+                export_row(column_vectors, row_idx, output);
+            }
+            row_count += row_end - row_begin;
+            read_offset = row_end;
+        }
+        return {row_count, std::move(output)};
+    };
+
+    SizeT parallelism = std::max<SizeT>(query_context->cpu_number_limit(), 1);
+    SizeT window_size = parallelism * 2;
+    SizeT row_count = 0;
+    ThreadPool pool(static_cast<int>(parallelism));
+    Deque<std::future<Pair<SizeT, String>>> pending_blocks;
+    auto write_front_block = [&]() {
+        auto [block_row_count, output] = pending_blocks.front().get();
+        pending_blocks.pop_front();
+        write_output(output);
+        row_count += block_row_count;
+    };
+    for (const auto &global_block_id : block_index->global_blocks_) {
+        BlockEntry *block_entry = block_index->GetBlockEntry(global_block_id.segment_id_, global_block_id.block_id_);
+        pending_blocks.emplace_back(pool.push([&export_block, block_entry](int) { return export_block(block_entry); }));
+        if (pending_blocks.size() >= window_size) {
+            write_front_block();
+        }
+    }
+    while (!pending_blocks.empty()) {
+        write_front_block();
+    }
+    return row_count;
+}
 
 } // namespace infinity
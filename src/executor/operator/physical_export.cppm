@@ -27,6 +27,8 @@ import infinity_exception;
 import internal_types;
 import statement_common;
 import data_type;
+import column_vector;
+import table_entry;
 
 namespace infinity {
 
@@ -58,9 +60,13 @@ public:
         return 0;
     }
 
-    void ExportCSV(QueryContext *query_context);
+    void ExportCSV(QueryContext *query_context, ExportOperatorState *export_op_state);
 
-    void ExportJSON(QueryContext *query_context);
+    void ExportJSON(QueryContext *query_context, ExportOperatorState *export_op_state);
+
+    void ExportJSONL(QueryContext *query_context, ExportOperatorState *export_op_state);
+
+    void ExportFVECS(QueryContext *query_context, ExportOperatorState *export_op_state);
 
     inline CopyFileType FileType() const { return file_type_; }
 
@@ -74,6 +80,15 @@ public:
 
     inline char delimiter() const { return delimiter_; }
 
+private:
+    // Appends the text of one row to the output buffer of its block
+    using ExportRowFunc = std::function<void(const Vector<ColumnVector> &column_vectors, SizeT row_idx, String &output)>;
+
+    TableEntry *GetTableEntry(QueryContext *query_context) const;
+
+    // Blocks are formatted on a thread pool and written out in table order, only a bounded window of blocks is kept in memory
+    SizeT ExportBlocks(QueryContext *query_context, TableEntry *table_entry, const String &file_header, const ExportRowFunc &export_row);
+
 private:
     SharedPtr<Vector<String>> output_names_{};
     SharedPtr<Vector<SharedPtr<DataType>>> output_types_{};
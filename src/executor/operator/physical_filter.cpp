@@ -27,6 +27,7 @@ import operator_state;
 import expression_state;
 import expression_selector;
 import data_block;
+import selection;
 import logger;
 import third_party;
 
@@ -64,6 +65,8 @@ bool PhysicalFilter::Execute(QueryContext *, OperatorState *operator_state) {
     }
 
     SizeT input_block_count = prev_op_state->data_block_array_.size();
+    // created once per task by MakeFilterState and reused across its input blocks
+    SharedPtr<ExpressionState> &condition_state = filter_operator_state->condition_state_;
 
     for(SizeT block_idx = 0; block_idx < input_block_count; ++ block_idx) {
 
@@ -72,12 +75,22 @@ bool PhysicalFilter::Execute(QueryContext *, OperatorState *operator_state) {
         DataBlock* output_data_block = data_block.get();
         operator_state->data_block_array_.emplace_back(std::move(data_block));
 
-        SharedPtr<ExpressionState> condition_state = ExpressionState::CreateState(condition_);
         DataBlock* input_data_block = prev_op_state->data_block_array_[block_idx].get();
+        SizeT row_count = input_data_block->row_count();
 
         // selector contains a pointer to input data, which should not be shared by multiple tasks
         ExpressionSelector selector;
-        SizeT selected_count = selector.Select(condition_, condition_state, input_data_block, output_data_block, input_data_block->row_count());
+        SharedPtr<Selection> selection = selector.Select(condition_, condition_state, input_data_block, row_count);
+        SizeT selected_count = selection->Size();
+
+        if (selected_count == row_count) {
+            // nothing is filtered out, pass the input column vectors through
+            output_data_block->InitShared(input_data_block, nullptr);
+        } else if (lazy_selection_ && selected_count > 0) {
+            output_data_block->InitShared(input_data_block, selection);
+        } else {
+            output_data_block->Init(input_data_block, selection);
+        }
 
         LOG_TRACE(fmt::format("{} rows after filter", selected_count));
     }
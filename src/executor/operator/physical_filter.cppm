@@ -50,9 +50,18 @@ public:
 
     inline const SharedPtr<BaseExpression> &condition() const { return condition_; }
 
+    // Set when the parent operator honors DataBlock::selection(), see PhysicalProject.
+    // The output blocks then share the input column vectors and carry the selected rows, the parent compacts only the columns
+    // its expressions read.
+    inline void SetLazySelection(bool lazy_selection) { lazy_selection_ = lazy_selection; }
+
+    inline bool lazy_selection() const { return lazy_selection_; }
+
 private:
     SharedPtr<BaseExpression> condition_;
 
+    bool lazy_selection_{false};
+
     SharedPtr<DataTable> input_table_{};
 };
 
@@ -14,7 +14,11 @@
 
 module;
 
+#include <algorithm>
+#include <cmath>
 #include <cstdlib>
+#include <limits>
+#include <sstream>
 #include <string>
 
 module physical_fusion;
@@ -41,117 +45,286 @@ import third_party;
 import infinity_exception;
 import value;
 import internal_types;
+import logical_type;
+import knn_expression;
+import knn_expr;
+import physical_knn_scan;
+import physical_merge_knn;
+import base_table_ref;
 
 namespace infinity {
 
-struct RRFRankDoc {
-    RowID row_id;
-    float score;
-    Vector<SizeT> ranks;
-};
+namespace {
+
+// Parse a positive integer option, e.g. rank_constant or topn
+SizeT ParsePositiveOption(const String &name, const String &value) {
+    char *end = nullptr;
+    long l = std::strtol(value.c_str(), &end, 10);
+    if (end == value.c_str() || *end != '\0' || l <= 0) {
+        RecoverableError(Status::SyntaxError(fmt::format("Fusion option {}={} isn't a positive integer.", name, value)));
+    }
+    return static_cast<SizeT>(l);
+}
+
+bool LowerScoreBetter(const PhysicalOperator *input_op) {
+    const KnnExpression *knn_expr = nullptr;
+    if (input_op->operator_type() == PhysicalOperatorType::kKnnScan) {
+        knn_expr = static_cast<const PhysicalKnnScan *>(input_op)->knn_expression_.get();
+    } else if (input_op->operator_type() == PhysicalOperatorType::kMergeKnn) {
+        knn_expr = static_cast<const PhysicalMergeKnn *>(input_op)->knn_expression_.get();
+    }
+    if (knn_expr == nullptr) {
+        return false;
+    }
+    return knn_expr->distance_type_ == KnnDistanceType::kL2 || knn_expr->distance_type_ == KnnDistanceType::kHamming;
+}
+
+} // namespace
 
 PhysicalFusion::PhysicalFusion(u64 id,
                                UniquePtr<PhysicalOperator> left,
                                UniquePtr<PhysicalOperator> right,
                                SharedPtr<FusionExpression> fusion_expr,
+                               SharedPtr<BaseTableRef> base_table_ref,
                                SharedPtr<Vector<LoadMeta>> load_metas)
-    : PhysicalOperator(PhysicalOperatorType::kFusion, std::move(left), std::move(right), id, load_metas), fusion_expr_(fusion_expr) {}
+    : PhysicalOperator(PhysicalOperatorType::kFusion, std::move(left), std::move(right), id, load_metas), fusion_expr_(fusion_expr),
+      base_table_ref_(std::move(base_table_ref)) {}
 
 PhysicalFusion::~PhysicalFusion() {}
 
-void PhysicalFusion::Init() {}
-
-bool PhysicalFusion::Execute(QueryContext *query_context, OperatorState *operator_state) {
-    FusionOperatorState *fusion_operator_state = static_cast<FusionOperatorState *>(operator_state);
-    if (!fusion_operator_state->input_complete_) {
-        return false;
+void PhysicalFusion::Init() {
+    Map<String, String> options;
+    if (fusion_expr_->options_.get() != nullptr) {
+        options = fusion_expr_->options_->options_;
     }
-    if (fusion_expr_->method_.compare("rrf") != 0) {
+    if (fusion_expr_->method_ == "rrf") {
+        method_ = FusionMethod::kRRF;
+        if (auto it = options.find("rank_constant"); it != options.end()) {
+            rank_constant_ = ParsePositiveOption(it->first, it->second);
+        }
+    } else if (fusion_expr_->method_ == "weighted_sum") {
+        method_ = FusionMethod::kWeightedSum;
+        if (auto it = options.find("normalize"); it != options.end()) {
+            if (it->second == "minmax") {
+                normalize_ = ScoreNormalize::kMinMax;
+            } else if (it->second == "zscore") {
+                normalize_ = ScoreNormalize::kZScore;
+            } else if (it->second == "none") {
+                normalize_ = ScoreNormalize::kNone;
+            } else {
+                RecoverableError(Status::SyntaxError(fmt::format("Fusion normalize {} isn't one of minmax, zscore, none.", it->second)));
+            }
+        }
+    } else {
         RecoverableError(Status::NotSupport(fmt::format("Fusion method {} is not implemented.", fusion_expr_->method_)));
     }
-    SizeT rank_constant = 60;
-    if (fusion_expr_->options_.get() != nullptr) {
-        if (auto it = fusion_expr_->options_->options_.find("rank_constant"); it != fusion_expr_->options_->options_.end()) {
-            long l = std::strtol(it->second.c_str(), NULL, 10);
-            if (l > 1) {
-                rank_constant = (SizeT)l;
+    if (auto it = options.find("topn"); it != options.end()) {
+        topn_ = ParsePositiveOption(it->first, it->second);
+    }
+
+    SizeT input_n = 0;
+    for (const PhysicalOperator *input_op : {left_.get(), right_.get()}) {
+        if (input_op != nullptr) {
+            lower_score_better_.push_back(LowerScoreBetter(input_op));
+            ++input_n;
+        }
+    }
+    weights_.assign(input_n, 1.0F);
+    if (auto it = options.find("weights"); method_ == FusionMethod::kWeightedSum && it != options.end()) {
+        weights_.clear();
+        std::istringstream weights_stream(it->second);
+        for (String weight; std::getline(weights_stream, weight, ',');) {
+            char *end = nullptr;
+            float w = std::strtof(weight.c_str(), &end);
+            if (end == weight.c_str() || *end != '\0' || !std::isfinite(w) || w < 0.0F) {
+                RecoverableError(Status::SyntaxError(fmt::format("Fusion weight {} isn't a non-negative number.", weight)));
             }
+            weights_.push_back(w);
+        }
+        if (weights_.size() != input_n) {
+            RecoverableError(Status::SyntaxError(fmt::format("Fusion has {} weights for {} inputs.", weights_.size(), input_n)));
         }
     }
+}
 
-    Vector<RRFRankDoc> rrf_vec;
-    Map<RowID, SizeT> rrf_map; // row_id to index of rrf_vec_
-    Vector<u64> fragment_ids;
-    SizeT fragment_idx = 0;
-    // 1 caclulate every doc's ranks
-    for (auto &[fragment_id, input_blocks] : fusion_operator_state->input_data_blocks_) {
-        fragment_ids.push_back(fragment_id);
-        SizeT base_rank = 1;
-        for (UniquePtr<DataBlock> &input_data_block : input_blocks) {
+void PhysicalFusion::ConsumeInputs(FusionOperatorState *fusion_operator_state) const {
+    const SizeT input_n = fusion_operator_state->input_fragment_ids_.size();
+    if (fusion_operator_state->consumed_block_counts_.empty()) {
+        fusion_operator_state->consumed_block_counts_.resize(input_n, 0);
+        fusion_operator_state->input_row_counts_.resize(input_n, 0);
+    }
+    auto &doc_map = fusion_operator_state->doc_map_;
+    auto &docs = fusion_operator_state->docs_;
+    for (SizeT input_idx = 0; input_idx < input_n; ++input_idx) {
+        auto &input_blocks = fusion_operator_state->input_data_blocks_[fusion_operator_state->input_fragment_ids_[input_idx]];
+        SizeT &consumed_block_count = fusion_operator_state->consumed_block_counts_[input_idx];
+        for (; consumed_block_count < input_blocks.size(); ++consumed_block_count) {
+            const DataBlock *input_data_block = input_blocks[consumed_block_count].get();
+            if (input_data_block == nullptr) {
+                continue;
+            }
             if (input_data_block->column_count() != GetOutputTypes()->size()) {
                 UnrecoverableError(fmt::format("input_data_block column count {} is incorrect, expect {}.",
                                                input_data_block->column_count(),
                                                GetOutputTypes()->size()));
             }
-            auto &row_id_column = *input_data_block->column_vectors[input_data_block->column_count() - 1];
-            auto row_ids = reinterpret_cast<RowID *>(row_id_column.data());
-            SizeT row_n = input_data_block->row_count();
-            for (SizeT i = 0; i < row_n; i++) {
-                RowID docId = row_ids[i];
-                if (rrf_map.find(docId) == rrf_map.end()) {
-                    RRFRankDoc doc;
-                    doc.row_id = docId;
-                    rrf_vec.push_back(doc);
-                    rrf_map[docId] = rrf_vec.size() - 1;
+            const SizeT column_n = input_data_block->column_count() - 2;
+            const auto &score_column = *input_data_block->column_vectors[column_n];
+            if (score_column.data_type()->type() != LogicalType::kFloat) {
+                UnrecoverableError(fmt::format("Fusion input score column type {} isn't float.", score_column.data_type()->ToString()));
+            }
+            const auto *scores = reinterpret_cast<const float *>(score_column.data());
+            const auto *row_ids = reinterpret_cast<const RowID *>(input_data_block->column_vectors[column_n + 1]->data());
+            const SizeT row_n = input_data_block->row_count();
+            u32 &base_rank = fusion_operator_state->input_row_counts_[input_idx];
+            for (SizeT i = 0; i < row_n; ++i) {
+                auto [iter, inserted] = doc_map.try_emplace(row_ids[i].ToUint64(), docs.size());
+                if (inserted) {
+                    docs.push_back(FusionDoc{row_ids[i], Vector<u32>(input_n, 0), Vector<float>(input_n, 0.0F)});
                 }
-                RRFRankDoc &doc = rrf_vec[rrf_map[docId]];
-                doc.ranks.resize(fragment_idx + 1, 0);
-                doc.ranks[fragment_idx] = base_rank + i;
+                FusionDoc &doc = docs[iter->second];
+                doc.ranks_[input_idx] = base_rank + 1 + i;
+                doc.scores_[input_idx] = scores[i];
             }
             base_rank += row_n;
         }
-        fragment_idx++;
+    }
+}
+
+Vector<float> PhysicalFusion::FuseScores(const FusionOperatorState *fusion_operator_state) const {
+    const auto &docs = fusion_operator_state->docs_;
+    const SizeT input_n = fusion_operator_state->input_fragment_ids_.size();
+    Vector<float> fused_scores(docs.size(), 0.0F);
+    if (method_ == FusionMethod::kRRF) {
+        for (SizeT doc_idx = 0; doc_idx < docs.size(); ++doc_idx) {
+            for (u32 rank : docs[doc_idx].ranks_) {
+                if (rank != 0) {
+                    fused_scores[doc_idx] += 1.0F / (rank_constant_ + rank);
+                }
+            }
+        }
+        return fused_scores;
     }
 
-    // 2 caclulate every doc's score
-    for (auto &doc : rrf_vec) {
-        doc.score = 0.0F;
-        for (auto &rank : doc.ranks) {
-            if (rank == 0)
+    // weighted sum: a doc missing from an input gets nothing from it
+    for (SizeT input_idx = 0; input_idx < input_n; ++input_idx) {
+        const float sign = lower_score_better_[input_idx] ? -1.0F : 1.0F;
+        double min_score = std::numeric_limits<double>::max();
+        double max_score = std::numeric_limits<double>::lowest();
+        double sum = 0.0, square_sum = 0.0;
+        SizeT count = 0;
+        for (const FusionDoc &doc : docs) {
+            if (doc.ranks_[input_idx] != 0) {
+                double score = sign * doc.scores_[input_idx];
+                min_score = std::min(min_score, score);
+                max_score = std::max(max_score, score);
+                sum += score;
+                square_sum += score * score;
+                ++count;
+            }
+        }
+        if (count == 0) {
+            continue;
+        }
+        const double mean = sum / count;
+        const double stddev = std::sqrt(std::max(square_sum / count - mean * mean, 0.0));
+        for (SizeT doc_idx = 0; doc_idx < docs.size(); ++doc_idx) {
+            const FusionDoc &doc = docs[doc_idx];
+            if (doc.ranks_[input_idx] == 0) {
                 continue;
-            doc.score += 1.0F / (rank_constant + rank);
+            }
+            double score = sign * doc.scores_[input_idx];
+            switch (normalize_) {
+                case ScoreNormalize::kMinMax: {
+                    score = max_score > min_score ? (score - min_score) / (max_score - min_score) : 1.0;
+                    break;
+                }
+                case ScoreNormalize::kZScore: {
+                    score = stddev > 0.0 ? (score - mean) / stddev : 0.0;
+                    break;
+                }
+                case ScoreNormalize::kNone: {
+                    break;
+                }
+            }
+            fused_scores[doc_idx] += weights_[input_idx] * score;
         }
     }
-    // 3 sort docs in reverse per their score
-    std::sort(std::begin(rrf_vec), std::end(rrf_vec), [](const RRFRankDoc &lhs, const RRFRankDoc &rhs) noexcept { return lhs.score > rhs.score; });
+    return fused_scores;
+}
+
+bool PhysicalFusion::Execute(QueryContext *query_context, OperatorState *operator_state) {
+    FusionOperatorState *fusion_operator_state = static_cast<FusionOperatorState *>(operator_state);
+    // 1 read every arrived input block into docs, not waiting for the other inputs
+    ConsumeInputs(fusion_operator_state);
+    if (!fusion_operator_state->input_complete_) {
+        return false;
+    }
+
+    // 2 calculate every doc's score
+    const auto &docs = fusion_operator_state->docs_;
+    Vector<float> fused_scores = FuseScores(fusion_operator_state);
+    // The first input containing the doc and its rank there, which also break ties of the score.
+    // It doesn't depend on the order the input blocks arrived in.
+    auto first_input = [&](SizeT doc_idx) {
+        const auto &ranks = docs[doc_idx].ranks_;
+        SizeT input_idx = 0;
+        while (input_idx < ranks.size() && ranks[input_idx] == 0) {
+            ++input_idx;
+        }
+        if (input_idx >= ranks.size()) {
+            UnrecoverableError(fmt::format("Cannot find fragment_idx"));
+        }
+        return Pair<SizeT, u32>(input_idx, ranks[input_idx]);
+    };
+    auto better = [&](SizeT lhs, SizeT rhs) {
+        if (fused_scores[lhs] != fused_scores[rhs]) {
+            return fused_scores[lhs] > fused_scores[rhs];
+        }
+        return first_input(lhs) < first_input(rhs);
+    };
+
+    // 3 keep the top n docs in a heap whose top is the worst kept doc, instead of sorting all the docs
+    const SizeT output_n = topn_ == 0 ? docs.size() : std::min(topn_, docs.size());
+    Vector<SizeT> top_docs;
+    top_docs.reserve(output_n);
+    for (SizeT doc_idx = 0; doc_idx < docs.size() && output_n > 0; ++doc_idx) {
+        if (top_docs.size() < output_n) {
+            top_docs.push_back(doc_idx);
+            std::push_heap(top_docs.begin(), top_docs.end(), better);
+        } else if (better(doc_idx, top_docs.front())) {
+            std::pop_heap(top_docs.begin(), top_docs.end(), better);
+            top_docs.back() = doc_idx;
+            std::push_heap(top_docs.begin(), top_docs.end(), better);
+        }
+    }
+    std::sort_heap(top_docs.begin(), top_docs.end(), better);
 
     // 4 generate output data blocks
     UniquePtr<DataBlock> output_data_block = DataBlock::MakeUniquePtr();
     output_data_block->Init(*GetOutputTypes());
     SizeT row_count = 0;
-    for (RRFRankDoc &doc : rrf_vec) {
+    for (SizeT doc_idx : top_docs) {
         // 4.1 get every doc's columns from input data blocks
         if (row_count == output_data_block->capacity()) {
             output_data_block->Finalize();
             operator_state->data_block_array_.push_back(std::move(output_data_block));
             output_data_block = DataBlock::MakeUniquePtr();
+            output_data_block->Init(*GetOutputTypes());
             row_count = 0;
         }
-        SizeT fragment_idx = 0;
-        while (fragment_idx < doc.ranks.size() && doc.ranks[fragment_idx] == 0)
-            fragment_idx++;
-        if (fragment_idx >= doc.ranks.size()) {
-            UnrecoverableError(fmt::format("Cannot find fragment_idx"));
-        }
-        u64 fragment_id = fragment_ids[fragment_idx];
+        auto [input_idx, rank] = first_input(doc_idx);
+        u64 fragment_id = fusion_operator_state->input_fragment_ids_[input_idx];
         auto &input_blocks = fusion_operator_state->input_data_blocks_[fragment_id];
         if (input_blocks.size() == 0) {
             UnrecoverableError(fmt::format("input_data_blocks_[{}] is empty.", fragment_id));
         }
         SizeT block_idx = 0;
-        SizeT row_idx = doc.ranks[fragment_idx] - 1;
-        while (row_idx >= input_blocks[block_idx]->row_count()) {
-            row_idx -= input_blocks[block_idx]->row_count();
+        SizeT row_idx = rank - 1;
+        while (block_idx < input_blocks.size() && (input_blocks[block_idx].get() == nullptr || row_idx >= input_blocks[block_idx]->row_count())) {
+            if (input_blocks[block_idx].get() != nullptr) {
+                row_idx -= input_blocks[block_idx]->row_count();
+            }
             block_idx++;
         }
         if (block_idx >= input_blocks.size()) {
@@ -163,14 +336,16 @@ bool PhysicalFusion::Execute(QueryContext *query_context, OperatorState *operato
             output_data_block->column_vectors[i]->AppendWith(*input_blocks[block_idx]->column_vectors[i], row_idx, 1);
         }
         // 4.2 add hidden columns: score, row_id
-        Value v = Value::MakeFloat(doc.score);
+        Value v = Value::MakeFloat(fused_scores[doc_idx]);
         output_data_block->column_vectors[column_n]->AppendValue(v);
-        output_data_block->column_vectors[column_n + 1]->AppendWith(doc.row_id, 1);
+        output_data_block->column_vectors[column_n + 1]->AppendWith(docs[doc_idx].row_id_, 1);
         row_count++;
     }
     output_data_block->Finalize();
     operator_state->data_block_array_.push_back(std::move(output_data_block));
     fusion_operator_state->input_data_blocks_.clear();
+    fusion_operator_state->doc_map_.clear();
+    fusion_operator_state->docs_.clear();
     operator_state->SetComplete();
     return true;
 }
@@ -28,6 +28,7 @@ import load_meta;
 import infinity_exception;
 import internal_types;
 import data_type;
+import base_table_ref;
 
 namespace infinity {
 
@@ -37,6 +38,7 @@ public:
                             UniquePtr<PhysicalOperator> left,
                             UniquePtr<PhysicalOperator> right,
                             SharedPtr<FusionExpression> fusion_expr,
+                            SharedPtr<BaseTableRef> base_table_ref,
                             SharedPtr<Vector<LoadMeta>> load_metas);
     ~PhysicalFusion() override;
 
@@ -55,10 +57,32 @@ public:
 
     String ToString(i64 &space) const;
 
+    // the operators above load the columns of the output rows from the table
+    void FillingTableRefs(HashMap<SizeT, SharedPtr<BaseTableRef>> &table_refs) override {
+        table_refs.insert({base_table_ref_->table_index_, base_table_ref_});
+    }
+
     SharedPtr<FusionExpression> fusion_expr_;
+    SharedPtr<BaseTableRef> base_table_ref_;
 
 private:
-
+    enum class FusionMethod { kRRF, kWeightedSum };
+    // how the scores of one input are mapped to a common scale before they are weighted and summed
+    enum class ScoreNormalize { kMinMax, kZScore, kNone };
+
+    // Read the input blocks arrived since the last call into the docs of the state.
+    void ConsumeInputs(FusionOperatorState *fusion_operator_state) const;
+
+    Vector<float> FuseScores(const FusionOperatorState *fusion_operator_state) const;
+
+    FusionMethod method_{FusionMethod::kRRF};
+    SizeT rank_constant_{60};
+    ScoreNormalize normalize_{ScoreNormalize::kMinMax};
+    Vector<float> weights_{};
+    // 0: output all the docs
+    SizeT topn_{0};
+    // knn inputs measuring distance, e.g. l2, score their best rows lowest
+    Vector<bool> lower_score_better_{};
 };
 
 } // namespace infinity
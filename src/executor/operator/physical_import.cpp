@@ -19,12 +19,18 @@ module;
 // #include "zsv/common.h"
 // }
 
+#include <algorithm>
 #include <cerrno>
 #include <cstdio>
 #include <cstring>
+#include <future>
+#include <limits>
+#include <utility>
 
 #include <vector>
 
+#include "simdjson.h"
+
 module physical_import;
 
 import stl;
@@ -57,6 +63,7 @@ import column_def;
 import wal_entry;
 
 import catalog;
+import parquet_reader;
 
 namespace infinity {
 
@@ -87,6 +94,10 @@ bool PhysicalImport::Execute(QueryContext *query_context, OperatorState *operato
             ImportFVECS(query_context, import_op_state);
             break;
         }
+        case CopyFileType::kParquet: {
+            ImportParquet(query_context, import_op_state);
+            break;
+        }
     }
     import_op_state->SetComplete();
     Txn *txn = query_context->GetTxn();
@@ -174,40 +185,721 @@ void PhysicalImport::ImportFVECS(QueryContext *query_context, ImportOperatorStat
     import_op_state->result_msg_ = std::move(result_msg);
 }
 
+namespace {
+
+// Feeds zsv with the bytes of one import chunk only
+struct ImportChunkReader {
+    FILE *fp_{};
+    SizeT remaining_{};
+    SizeT quote_count_{};
+};
+
+SizeT ReadImportChunk(void *buffer, SizeT n, SizeT size, void *stream) {
+    auto *chunk_reader = static_cast<ImportChunkReader *>(stream);
+    SizeT read_n = fread(buffer, 1, std::min(n * size, chunk_reader->remaining_), chunk_reader->fp_);
+    chunk_reader->remaining_ -= read_n;
+    const auto *data = static_cast<const char *>(buffer);
+    chunk_reader->quote_count_ += std::count(data, data + read_n, '"');
+    return n == 0 ? 0 : read_n / n;
+}
+
+void CheckJSONError(simdjson::error_code error, const String &column_name) {
+    if (error != simdjson::SUCCESS) {
+        RecoverableError(Status::ImportFileFormatError(fmt::format("Column {}: {}", column_name, simdjson::error_message(error))));
+    }
+}
+
+template <typename T, typename JSONValue>
+T GetJSONValue(JSONValue &&value, const String &column_name) {
+    if constexpr (std::is_same_v<T, bool>) {
+        bool v{};
+        CheckJSONError(value.get_bool().get(v), column_name);
+        return v;
+    } else if constexpr (std::is_integral_v<T>) {
+        i64 v{};
+        CheckJSONError(value.get_int64().get(v), column_name);
+        return static_cast<T>(v);
+    } else {
+        double v{};
+        CheckJSONError(value.get_double().get(v), column_name);
+        return static_cast<T>(v);
+    }
+}
+
+template <typename T, typename JSONValue>
+void AppendJSONValue(ColumnVector &column_vector, JSONValue &&value, const String &column_name) {
+    T v = GetJSONValue<T>(std::forward<JSONValue>(value), column_name);
+    column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(&v));
+}
+
+template <typename T, typename JSONValue>
+void AppendJSONEmbedding(ColumnVector &column_vector, JSONValue &&value, const String &column_name, SizeT dimension) {
+    simdjson::ondemand::array array;
+    CheckJSONError(value.get_array().get(array), column_name);
+    Vector<T> embedding;
+    embedding.reserve(dimension);
+    for (auto element : array) {
+        embedding.push_back(GetJSONValue<T>(element, column_name));
+    }
+    if (embedding.size() != dimension) {
+        RecoverableError(Status::ImportFileFormatError(
+            fmt::format("Column {}: embedding dimension {} doesn't match with table definition ({}).", column_name, embedding.size(), dimension)));
+    }
+    column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(embedding.data()));
+}
+
+void JSONLRowHandler(simdjson::ondemand::document &line_json, ImportChunkWriter &writer) {
+    Vector<ColumnVector> &column_vectors = writer.RowColumnVectors();
+    for (SizeT i = 0; auto &column_vector : column_vectors) {
+        const ColumnDef *column_def = writer.table_entry_->GetColumnDefByID(i++);
+        const String &column_name = column_def->name_;
+        auto value = line_json[column_name];
+
+        switch (column_vector.data_type()->type()) {
+            case kBoolean: {
+                AppendJSONValue<bool>(column_vector, value, column_name);
+                break;
+            }
+            case kTinyInt: {
+                AppendJSONValue<i8>(column_vector, value, column_name);
+                break;
+            }
+            case kSmallInt: {
+                AppendJSONValue<i16>(column_vector, value, column_name);
+                break;
+            }
+            case kInteger: {
+                AppendJSONValue<i32>(column_vector, value, column_name);
+                break;
+            }
+            case kBigInt: {
+                AppendJSONValue<i64>(column_vector, value, column_name);
+                break;
+            }
+            case kFloat: {
+                AppendJSONValue<float>(column_vector, value, column_name);
+                break;
+            }
+            case kDouble: {
+                AppendJSONValue<double>(column_vector, value, column_name);
+                break;
+            }
+            case kVarchar: {
+                std::string_view str_view;
+                CheckJSONError(value.get_string().get(str_view), column_name);
+                column_vector.AppendByStringView(str_view, ',');
+                break;
+            }
+            case kEmbedding: {
+                auto embedding_info = static_cast<EmbeddingInfo *>(column_vector.data_type()->type_info().get());
+                SizeT dim = embedding_info->Dimension();
+                switch (embedding_info->Type()) {
+                    case kElemInt8: {
+                        AppendJSONEmbedding<i8>(column_vector, value, column_name, dim);
+                        break;
+                    }
+                    case kElemInt16: {
+                        AppendJSONEmbedding<i16>(column_vector, value, column_name, dim);
+                        break;
+                    }
+                    case kElemInt32: {
+                        AppendJSONEmbedding<i32>(column_vector, value, column_name, dim);
+                        break;
+                    }
+                    case kElemInt64: {
+                        AppendJSONEmbedding<i64>(column_vector, value, column_name, dim);
+                        break;
+                    }
+                    case kElemFloat: {
+                        AppendJSONEmbedding<float>(column_vector, value, column_name, dim);
+                        break;
+                    }
+                    case kElemDouble: {
+                        AppendJSONEmbedding<double>(column_vector, value, column_name, dim);
+                        break;
+                    }
+                    default: {
+                        UnrecoverableError("Not implement: Embedding type.");
+                    }
+                }
+                break;
+            }
+            default: {
+                UnrecoverableError("Not implement: Invalid data type.");
+            }
+        }
+    }
+    writer.FinishRow();
+}
+
+} // namespace
+
+Vector<ColumnVector> &ImportChunkWriter::RowColumnVectors() {
+    if (block_entry_.get() == nullptr) {
+        if (segment_entry_.get() == nullptr) {
+            SegmentID segment_id = NewCatalog::GetNextSegmentID(table_entry_);
+            segment_entry_ = SegmentEntry::NewSegmentEntry(table_entry_, segment_id, txn_, true);
+        }
+        block_entry_ = BlockEntry::NewBlockEntry(segment_entry_.get(), segment_entry_->GetNextBlockID(), 0, table_entry_->ColumnCount(), txn_);
+        column_vectors_.clear();
+        auto *buffer_mgr = txn_->GetBufferMgr();
+        for (SizeT i = 0; i < table_entry_->ColumnCount(); ++i) {
+            auto *block_column_entry = block_entry_->GetColumnBlockEntry(i);
+            column_vectors_.emplace_back(block_column_entry->GetColumnVector(buffer_mgr));
+        }
+    }
+    return column_vectors_;
+}
+
+SizeT ImportChunkWriter::BlockRoom() {
+    RowColumnVectors();
+    return block_entry_->GetAvailableCapacity();
+}
+
+void ImportChunkWriter::FinishRows(SizeT row_count) {
+    SizeT block_offset = block_entry_->row_count();
+    for (SizeT i = 0; i < column_vectors_.size(); ++i) {
+        block_entry_->GetColumnBlockEntry(i)->UpdateZoneMap(column_vectors_[i], block_offset, row_count);
+    }
+    block_entry_->IncreaseRowCount(row_count);
+    row_count_ += row_count;
+
+    if (block_entry_->GetAvailableCapacity() <= 0) {
+        segment_entry_->AppendBlockEntry(std::move(block_entry_));
+        // we have already used all space of the segment
+        if (segment_entry_->Room() <= 0) {
+            SealSegment();
+        }
+    }
+}
+
+void ImportChunkWriter::Finish() {
+    if (block_entry_.get() != nullptr) {
+        segment_entry_->AppendBlockEntry(std::move(block_entry_));
+    }
+    if (segment_entry_.get() != nullptr) {
+        SealSegment();
+    }
+}
+
+void ImportChunkWriter::Discard() {
+    block_entry_.reset();
+    if (segment_entry_.get() != nullptr) {
+        segment_entries_.emplace_back(std::move(segment_entry_));
+    }
+    LocalFileSystem fs;
+    for (auto &segment_entry : segment_entries_) {
+        const String &segment_dir = *segment_entry->segment_dir();
+        if (fs.Exists(segment_dir)) {
+            fs.DeleteDirectory(segment_dir);
+        }
+    }
+    segment_entries_.clear();
+    row_count_ = 0;
+}
+
+void ImportChunkWriter::SealSegment() {
+    LOG_INFO(fmt::format("Segment {} saved", segment_entry_->segment_id()));
+    segment_entry_->FlushNewData();
+    segment_entries_.emplace_back(std::move(segment_entry_));
+}
+
 void PhysicalImport::ImportCSV(QueryContext *query_context, ImportOperatorState *import_op_state) {
-    // opts, parser and parser_context points to each other.
-    // opt -> parser_context
-    // parser->opt
-    // parser_context -> parser
+    auto import_chunk = [this](SizeT begin, SizeT end, bool first_chunk, ImportChunkWriter &writer) {
+        ImportCSVChunk(begin, end, first_chunk, writer);
+    };
+    SizeT row_count = ImportFileChunks(query_context, import_chunk, true);
+
+    auto result_msg = MakeUnique<String>(fmt::format("IMPORT {} Rows", row_count));
+    import_op_state->result_msg_ = std::move(result_msg);
+}
+
+void PhysicalImport::ImportJSONL(QueryContext *query_context, ImportOperatorState *import_op_state) {
+    auto import_chunk = [this](SizeT begin, SizeT end, bool, ImportChunkWriter &writer) { ImportJSONLChunk(begin, end, writer); };
+    SizeT row_count = ImportFileChunks(query_context, import_chunk, false);
+
+    auto result_msg = MakeUnique<String>(fmt::format("IMPORT {} Rows", row_count));
+    import_op_state->result_msg_ = std::move(result_msg);
+}
+
+void PhysicalImport::ImportJSON(QueryContext *, ImportOperatorState *) {
+    RecoverableError(Status::NotSupport("Import JSON is not implemented yet."));
+}
+
+namespace {
+
+// Parquet physical types an import column accepts. Embeddings are read from list columns of numbers.
+bool ParquetColumnFits(const DataType &data_type, const ParquetColumn &parquet_column) {
+    if (data_type.type() == kEmbedding) {
+        auto embedding_info = static_cast<EmbeddingInfo *>(data_type.type_info().get());
+        if (!parquet_column.is_list_ or embedding_info->Type() == kElemBit) {
+            return false;
+        }
+        switch (parquet_column.type_) {
+            case ParquetType::kInt32:
+            case ParquetType::kInt64:
+            case ParquetType::kFloat:
+            case ParquetType::kDouble: {
+                return true;
+            }
+            default: {
+                return false;
+            }
+        }
+    }
+    if (parquet_column.is_list_) {
+        return false;
+    }
+    switch (data_type.type()) {
+        case kBoolean: {
+            return parquet_column.type_ == ParquetType::kBoolean;
+        }
+        case kTinyInt:
+        case kSmallInt:
+        case kInteger:
+        case kBigInt: {
+            return parquet_column.type_ == ParquetType::kInt32 or parquet_column.type_ == ParquetType::kInt64;
+        }
+        case kFloat:
+        case kDouble: {
+            return parquet_column.type_ == ParquetType::kFloat or parquet_column.type_ == ParquetType::kDouble;
+        }
+        case kVarchar: {
+            return parquet_column.type_ == ParquetType::kByteArray;
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+SizeT ParquetValueWidth(ParquetType type) {
+    switch (type) {
+        case ParquetType::kBoolean: {
+            return 1;
+        }
+        case ParquetType::kInt32:
+        case ParquetType::kFloat: {
+            return 4;
+        }
+        case ParquetType::kInt64:
+        case ParquetType::kDouble: {
+            return 8;
+        }
+        default: {
+            UnrecoverableError(fmt::format("Unexpected parquet type {}", ParquetTypeToString(type)));
+        }
+    }
+    return 0;
+}
+
+// Whether the parquet value is representable in the integer column type, e.g. an INT64 value in a SMALLINT column
+template <typename Dst, typename Src>
+bool ParquetValueInRange(Src value) {
+    if constexpr (std::is_integral_v<Src>) {
+        return std::in_range<Dst>(value);
+    } else {
+        // false for NaN too
+        return value >= static_cast<Src>(std::numeric_limits<Dst>::lowest()) and value <= static_cast<Src>(std::numeric_limits<Dst>::max());
+    }
+}
+
+template <typename Dst, typename Src>
+const u8 *CastParquetValues(const u8 *values, SizeT count, Vector<u8> &buffer) {
+    if constexpr (std::is_same_v<Dst, Src>) {
+        return values;
+    } else {
+        buffer.resize(count * sizeof(Dst));
+        const auto *src = reinterpret_cast<const Src *>(values);
+        auto *dst = reinterpret_cast<Dst *>(buffer.data());
+        for (SizeT idx = 0; idx < count; ++idx) {
+            if constexpr (std::is_integral_v<Dst> and !std::is_same_v<Dst, BooleanT>) {
+                // a narrowing cast would wrap, the import fails rather than store another value
+                if (!ParquetValueInRange<Dst>(src[idx])) {
+                    RecoverableError(Status::ImportFileFormatError(
+                        fmt::format("Parquet value {} is out of the range [{}, {}] of the column type.",
+                                    src[idx],
+                                    static_cast<i64>(std::numeric_limits<Dst>::lowest()),
+                                    static_cast<i64>(std::numeric_limits<Dst>::max()))));
+                }
+            }
+            dst[idx] = static_cast<Dst>(src[idx]);
+        }
+        return buffer.data();
+    }
+}
+
+template <typename Dst>
+const u8 *CastParquetValues(ParquetType type, const u8 *values, SizeT count, Vector<u8> &buffer) {
+    switch (type) {
+        case ParquetType::kBoolean: {
+            return CastParquetValues<Dst, u8>(values, count, buffer);
+        }
+        case ParquetType::kInt32: {
+            return CastParquetValues<Dst, i32>(values, count, buffer);
+        }
+        case ParquetType::kInt64: {
+            return CastParquetValues<Dst, i64>(values, count, buffer);
+        }
+        case ParquetType::kFloat: {
+            return CastParquetValues<Dst, float>(values, count, buffer);
+        }
+        case ParquetType::kDouble: {
+            return CastParquetValues<Dst, double>(values, count, buffer);
+        }
+        default: {
+            UnrecoverableError(fmt::format("Unexpected parquet type {}", ParquetTypeToString(type)));
+        }
+    }
+    return nullptr;
+}
+
+// Lays out count parquet values as the column (or embedding element) type expects them. When the types already match
+// the chunk data is returned as is, so it's copied into the block only once.
+const u8 *ParquetValuesAsColumnType(const DataType &data_type, ParquetType type, const u8 *values, SizeT count, Vector<u8> &buffer) {
+    if (data_type.type() == kEmbedding) {
+        auto embedding_info = static_cast<EmbeddingInfo *>(data_type.type_info().get());
+        switch (embedding_info->Type()) {
+            case kElemInt8: {
+                return CastParquetValues<i8>(type, values, count, buffer);
+            }
+            case kElemInt16: {
+                return CastParquetValues<i16>(type, values, count, buffer);
+            }
+            case kElemInt32: {
+                return CastParquetValues<i32>(type, values, count, buffer);
+            }
+            case kElemInt64: {
+                return CastParquetValues<i64>(type, values, count, buffer);
+            }
+            case kElemFloat: {
+                return CastParquetValues<float>(type, values, count, buffer);
+            }
+            case kElemDouble: {
+                return CastParquetValues<double>(type, values, count, buffer);
+            }
+            default: {
+                UnrecoverableError("Not implement: Embedding type.");
+            }
+        }
+        return nullptr;
+    }
+    switch (data_type.type()) {
+        case kBoolean: {
+            return CastParquetValues<BooleanT>(type, values, count, buffer);
+        }
+        case kTinyInt: {
+            return CastParquetValues<TinyIntT>(type, values, count, buffer);
+        }
+        case kSmallInt: {
+            return CastParquetValues<SmallIntT>(type, values, count, buffer);
+        }
+        case kInteger: {
+            return CastParquetValues<IntegerT>(type, values, count, buffer);
+        }
+        case kBigInt: {
+            return CastParquetValues<BigIntT>(type, values, count, buffer);
+        }
+        case kFloat: {
+            return CastParquetValues<FloatT>(type, values, count, buffer);
+        }
+        case kDouble: {
+            return CastParquetValues<DoubleT>(type, values, count, buffer);
+        }
+        default: {
+            UnrecoverableError("Not implement: Invalid data type.");
+        }
+    }
+    return nullptr;
+}
+
+SizeT ValuesPerRow(const DataType &data_type) {
+    if (data_type.type() == kEmbedding) {
+        return static_cast<EmbeddingInfo *>(data_type.type_info().get())->Dimension();
+    }
+    return 1;
+}
+
+} // namespace
+
+void PhysicalImport::ImportParquet(QueryContext *query_context, ImportOperatorState *import_op_state) {
+    ParquetReader reader(file_path_);
+
+    // Only the columns of the table are read, pages of the other columns in the file are never touched
+    SizeT column_count = table_entry_->ColumnCount();
+    Vector<SizeT> parquet_column_ids(column_count);
+    for (SizeT i = 0; i < column_count; ++i) {
+        const ColumnDef *column_def = table_entry_->GetColumnDefByID(i);
+        i64 parquet_column_id = reader.FindColumn(column_def->name_);
+        if (parquet_column_id < 0) {
+            RecoverableError(Status::ImportFileFormatError(fmt::format("Column {} isn't found in the parquet file.", column_def->name_)));
+        }
+        const ParquetColumn &parquet_column = reader.Columns()[parquet_column_id];
+        if (!ParquetColumnFits(*column_def->column_type_, parquet_column)) {
+            RecoverableError(Status::ImportFileFormatError(fmt::format("Column {}: parquet {}{} can't be imported into {}.",
+                                                                       column_def->name_,
+                                                                       parquet_column.is_list_ ? "list of " : "",
+                                                                       ParquetTypeToString(parquet_column.type_),
+                                                                       column_def->column_type_->ToString())));
+        }
+        parquet_column_ids[i] = parquet_column_id;
+    }
+
+    auto import_row_group = [&](SizeT row_group_idx, ImportChunkWriter &writer) {
+        SizeT row_count = reader.RowGroupRowCount(row_group_idx);
+        Vector<ParquetColumnChunk> chunks;
+        chunks.reserve(column_count);
+        for (SizeT i = 0; i < column_count; ++i) {
+            const ColumnDef *column_def = table_entry_->GetColumnDefByID(i);
+            const ParquetColumnChunk &chunk = chunks.emplace_back(reader.ReadColumnChunk(row_group_idx, parquet_column_ids[i]));
+            if (chunk.null_count_ > 0) {
+                RecoverableError(Status::ImportFileFormatError(fmt::format("Column {}: {} null values in row group {}, null isn't supported.",
+                                                                           column_def->name_,
+                                                                           chunk.null_count_,
+                                                                           row_group_idx)));
+            }
+            SizeT values_per_row = ValuesPerRow(*column_def->column_type_);
+            if (column_def->column_type_->type() == kEmbedding) {
+                for (u32 list_size : chunk.list_sizes_) {
+                    if (list_size != values_per_row) {
+                        auto err_msg = fmt::format("Column {}: embedding dimension {} doesn't match with table definition ({}).",
+                                                   column_def->name_,
+                                                   list_size,
+                                                   values_per_row);
+                        RecoverableError(Status::ImportFileFormatError(err_msg));
+                    }
+                }
+            }
+            if (chunk.value_count_ != row_count * values_per_row) {
+                RecoverableError(Status::ImportFileFormatError(fmt::format("Column {}: {} values in row group {} which has {} rows.",
+                                                                           column_def->name_,
+                                                                           chunk.value_count_,
+                                                                           row_group_idx,
+                                                                           row_count)));
+            }
+        }
+
+        Vector<u8> buffer;
+        for (SizeT row_idx = 0; row_idx < row_count;) {
+            SizeT append_count = std::min(row_count - row_idx, writer.BlockRoom());
+            Vector<ColumnVector> &column_vectors = writer.RowColumnVectors();
+            for (SizeT i = 0; i < column_count; ++i) {
+                ColumnVector &column_vector = column_vectors[i];
+                const DataType &data_type = *column_vector.data_type();
+                const ParquetColumnChunk &chunk = chunks[i];
+                if (data_type.type() == kVarchar) {
+                    const auto *data = reinterpret_cast<const char *>(chunk.data_.data());
+                    for (SizeT value_idx = row_idx; value_idx < row_idx + append_count; ++value_idx) {
+                        SizeT begin = chunk.offsets_[value_idx];
+                        column_vector.AppendByStringView(std::string_view(data + begin, chunk.offsets_[value_idx + 1] - begin), ',');
+                    }
+                    continue;
+                }
+                SizeT values_per_row = ValuesPerRow(data_type);
+                const u8 *values = chunk.data_.data() + row_idx * values_per_row * ParquetValueWidth(chunk.type_);
+                const u8 *raw = ParquetValuesAsColumnType(data_type, chunk.type_, values, append_count * values_per_row, buffer);
+                column_vector.AppendByRawBuffer(reinterpret_cast<const_ptr_t>(raw), append_count);
+            }
+            writer.FinishRows(append_count);
+            row_idx += append_count;
+        }
+    };
+
+    // Row groups are split into contiguous ranges with about the same number of rows, at most one per worker and each with at least
+    // MIN_IMPORT_CHUNK_ROWS rows. A worker appends all row groups of its range to the same blocks and segments, so segments aren't
+    // cut at row group boundaries.
+    SizeT row_group_count = reader.RowGroupCount();
+    SizeT total_rows = 0;
+    for (SizeT row_group_idx = 0; row_group_idx < row_group_count; ++row_group_idx) {
+        total_rows += reader.RowGroupRowCount(row_group_idx);
+    }
+    SizeT max_range_count = std::min<SizeT>(query_context->cpu_number_limit(), total_rows / MIN_IMPORT_CHUNK_ROWS);
+    SizeT range_count = std::clamp<SizeT>(max_range_count, 1, std::max<SizeT>(row_group_count, 1));
+    Vector<SizeT> range_offsets{0};
+    SizeT range_rows = 0;
+    for (SizeT row_group_idx = 0; row_group_idx + 1 < row_group_count; ++row_group_idx) {
+        range_rows += reader.RowGroupRowCount(row_group_idx);
+        if (range_offsets.size() < range_count and range_rows * range_count >= total_rows * range_offsets.size()) {
+            range_offsets.emplace_back(row_group_idx + 1);
+        }
+    }
+    range_offsets.emplace_back(row_group_count);
+
+    auto import_row_groups = [&](SizeT range_idx, ImportChunkWriter &writer) {
+        for (SizeT row_group_idx = range_offsets[range_idx]; row_group_idx < range_offsets[range_idx + 1]; ++row_group_idx) {
+            import_row_group(row_group_idx, writer);
+        }
+        writer.Finish();
+    };
+    SizeT chunk_count = row_group_count == 0 ? 0 : range_offsets.size() - 1;
+    SizeT row_count = ImportChunks(query_context, chunk_count, import_row_groups).value();
+
+    auto result_msg = MakeUnique<String>(fmt::format("IMPORT {} Rows", row_count));
+    import_op_state->result_msg_ = std::move(result_msg);
+}
+
+Vector<SizeT> PhysicalImport::SplitImportFile(SizeT file_size, SizeT chunk_size) const {
+    Vector<SizeT> chunk_offsets{0};
+    if (file_size <= chunk_size) {
+        return chunk_offsets;
+    }
+
     FILE *fp = fopen(file_path_.c_str(), "rb");
     if (!fp) {
         UnrecoverableError(strerror(errno));
     }
+    DeferFn defer_fn([&]() { fclose(fp); });
+
+    // Seek to each cut point and move it right after the next line break, only the bytes around the cut points are read
+    Vector<char> buffer(64 << 10);
+    SizeT next_cut = chunk_size;
+    SizeT scan_pos = next_cut - 1;
+    while (next_cut < file_size) {
+        if (fseeko(fp, static_cast<off_t>(scan_pos), SEEK_SET) != 0) {
+            UnrecoverableError(strerror(errno));
+        }
+        SizeT read_n = fread(buffer.data(), 1, buffer.size(), fp);
+        if (read_n == 0) {
+            break;
+        }
+        const auto *line_end = static_cast<const char *>(std::memchr(buffer.data(), '\n', read_n));
+        if (line_end == nullptr) {
+            scan_pos += read_n;
+            continue;
+        }
+        SizeT cut = scan_pos + (line_end - buffer.data()) + 1;
+        if (cut < file_size) {
+            chunk_offsets.emplace_back(cut);
+        }
+        next_cut = cut + chunk_size;
+        scan_pos = next_cut - 1;
+    }
+    return chunk_offsets;
+}
+
+SizeT PhysicalImport::ImportFileChunks(QueryContext *query_context, const ImportFileChunkFunc &import_chunk, bool quote_aware) {
+    SizeT file_size = 0;
+    {
+        LocalFileSystem fs;
+        UniquePtr<FileHandler> file_handler = fs.OpenFile(file_path_, FileFlags::READ_FLAG, FileLockType::kReadLock);
+        DeferFn file_defer([&]() { fs.Close(*file_handler); });
+        file_size = fs.GetFileSize(*file_handler);
+    }
+
+    // Every worker gets at least one chunk, the chunk size is bounded so that huge files are still parsed in pieces.
+    SizeT parallelism = std::max<SizeT>(query_context->cpu_number_limit(), 1);
+    SizeT chunk_size = std::clamp(file_size / parallelism + 1, MIN_IMPORT_CHUNK_SIZE, MAX_IMPORT_CHUNK_SIZE);
+    Vector<SizeT> chunk_offsets = SplitImportFile(file_size, chunk_size);
+    SizeT chunk_count = chunk_offsets.size();
+
+    auto import_file_chunk = [&](SizeT chunk_idx, ImportChunkWriter &writer) {
+        SizeT end = chunk_idx + 1 < chunk_count ? chunk_offsets[chunk_idx + 1] : file_size;
+        import_chunk(chunk_offsets[chunk_idx], end, chunk_idx == 0, writer);
+    };
+    if (!quote_aware || chunk_count == 1) {
+        return ImportChunks(query_context, chunk_count, import_file_chunk).value();
+    }
+
+    // A quoted CSV field may contain line breaks, so a cut point may be inside of it. Then the quotes of some chunk are unbalanced
+    // or its rows fail to parse, and the file is imported again as a single chunk, which also reports the errors of a malformed file.
+    Optional<SizeT> row_count;
+    try {
+        row_count = ImportChunks(query_context, chunk_count, import_file_chunk);
+    } catch (RecoverableException &e) {
+        LOG_WARN(fmt::format("Import {} in {} chunks failed: {}, import it as a single chunk.", file_path_, chunk_count, e.what()));
+    }
+    if (!row_count.has_value()) {
+        chunk_count = 1;
+        row_count = ImportChunks(query_context, chunk_count, import_file_chunk);
+    }
+    return row_count.value();
+}
+
+Optional<SizeT> PhysicalImport::ImportChunks(QueryContext *query_context, SizeT chunk_count, const ImportChunkFunc &import_chunk) {
+    if (chunk_count == 0) {
+        return 0;
+    }
+    SizeT parallelism = std::clamp<SizeT>(query_context->cpu_number_limit(), 1, chunk_count);
 
-    UniquePtr<ZxvParserCtx> parser_context = nullptr;
+    Txn *txn = query_context->GetTxn();
+    Vector<UniquePtr<ImportChunkWriter>> writers;
+    Vector<std::future<void>> futures;
+    Atomic<bool> cancelled{false};
     {
-        Txn *txn = query_context->GetTxn();
-        auto *buffer_mgr = txn->GetBufferMgr();
-        u64 segment_id = NewCatalog::GetNextSegmentID(table_entry_);
-        SharedPtr<SegmentEntry> segment_entry = SegmentEntry::NewSegmentEntry(table_entry_, segment_id, txn, true);
-        UniquePtr<BlockEntry> block_entry = BlockEntry::NewBlockEntry(segment_entry.get(), 0, 0, table_entry_->ColumnCount(), txn);
-        Vector<ColumnVector> column_vectors;
-        int column_count = table_entry_->ColumnCount();
-        for (int i = 0; i < column_count; ++i) {
-            auto *block_column_entry = block_entry->GetColumnBlockEntry(i);
-            column_vectors.emplace_back(block_column_entry->GetColumnVector(buffer_mgr));
+        ThreadPool pool(static_cast<int>(parallelism));
+        for (SizeT chunk_idx = 0; chunk_idx < chunk_count; ++chunk_idx) {
+            ImportChunkWriter *writer = writers.emplace_back(MakeUnique<ImportChunkWriter>(table_entry_, txn)).get();
+            futures.emplace_back(pool.push([&, chunk_idx, writer](int) {
+                if (cancelled.load()) {
+                    return;
+                }
+                try {
+                    import_chunk(chunk_idx, *writer);
+                } catch (...) {
+                    cancelled.store(true);
+                    throw;
+                }
+            }));
+        }
+        // pool waits for all pushed chunks on destruction
+    }
+
+    // Rethrow the first failure in file order, the segments other chunks have flushed are removed first
+    try {
+        for (auto &future : futures) {
+            future.get();
+        }
+    } catch (...) {
+        for (auto &writer : writers) {
+            writer->Discard();
+        }
+        throw;
+    }
+    if (chunk_count > 1 && std::any_of(writers.begin(), writers.end(), [](const auto &writer) { return writer->unbalanced_quotes_; })) {
+        for (auto &writer : writers) {
+            writer->Discard();
         }
-        parser_context = MakeUnique<ZxvParserCtx>(table_entry_, txn, segment_entry, std::move(block_entry), std::move(column_vectors), delimiter_);
+        return None;
+    }
+
+    // Segments are handed over in chunk order, so rows keep the order of the input file
+    TxnTableStore *txn_store = txn->GetTxnTableStore(table_entry_);
+    SizeT row_count = 0;
+    for (auto &writer : writers) {
+        for (auto &segment_entry : writer->segment_entries_) {
+            AddSegmentData(txn_store, segment_entry);
+        }
+        row_count += writer->row_count_;
+    }
+    return row_count;
+}
+
+void PhysicalImport::ImportCSVChunk(SizeT begin, SizeT end, bool first_chunk, ImportChunkWriter &writer) {
+    FILE *fp = fopen(file_path_.c_str(), "rb");
+    if (!fp) {
+        UnrecoverableError(strerror(errno));
+    }
+    DeferFn defer_fn([&]() { fclose(fp); });
+    if (fseeko(fp, static_cast<off_t>(begin), SEEK_SET) != 0) {
+        UnrecoverableError(strerror(errno));
     }
+    ImportChunkReader chunk_reader{fp, end - begin};
+
+    // opts, parser and parser_context points to each other.
+    // opt -> parser_context
+    // parser->opt
+    // parser_context -> parser
+    auto parser_context = MakeUnique<ZxvParserCtx>(writer, delimiter_);
 
     auto opts = MakeUnique<ZsvOpts>();
-    if (header_) {
+    if (header_ and first_chunk) {
         opts->row_handler = CSVHeaderHandler;
     } else {
         opts->row_handler = CSVRowHandler;
     }
     opts->delimiter = delimiter_;
-    opts->stream = fp;
+    opts->read = ReadImportChunk;
+    opts->stream = &chunk_reader;
     opts->ctx = parser_context.get();
     opts->buffsize = (1 << 20); // default buffer size 256k, we use 1M
 
@@ -218,15 +910,8 @@ void PhysicalImport::ImportCSV(QueryContext *query_context, ImportOperatorState
         ;
     }
     parser_context->parser_.Finish();
-
-    { // add the last segment entry
-        auto *txn_store = parser_context->txn_->GetTxnTableStore(table_entry_);
-        auto segment_entry = parser_context->segment_entry_;
-        auto &block_entry = parser_context->block_entry_;
-        segment_entry->AppendBlockEntry(std::move(block_entry));
-        SaveSegmentData(txn_store, segment_entry);
-    }
-    fclose(fp);
+    writer.Finish();
+    writer.unbalanced_quotes_ = chunk_reader.quote_count_ % 2 != 0;
 
     if (csv_parser_status != zsv_status_no_more_input) {
         if (parser_context->err_msg_.get() != nullptr) {
@@ -236,78 +921,43 @@ void PhysicalImport::ImportCSV(QueryContext *query_context, ImportOperatorState
             UnrecoverableError(err_msg);
         }
     }
-
-    auto result_msg = MakeUnique<String>(fmt::format("IMPORT {} Rows", parser_context->row_count_));
-    import_op_state->result_msg_ = std::move(result_msg);
 }
 
-void PhysicalImport::ImportJSONL(QueryContext *query_context, ImportOperatorState *import_op_state) {
-    LocalFileSystem fs;
-    UniquePtr<FileHandler> file_handler = fs.OpenFile(file_path_, FileFlags::READ_FLAG, FileLockType::kReadLock);
-    DeferFn file_defer([&]() { fs.Close(*file_handler); });
-
-    SizeT file_size = fs.GetFileSize(*file_handler);
-    String jsonl_str(file_size + 1, 0);
-    SizeT read_n = file_handler->Read(jsonl_str.data(), file_size);
-    if (read_n != file_size) {
-        UnrecoverableError(fmt::format("Read file size {} doesn't match with file size {}.", read_n, file_size));
+void PhysicalImport::ImportJSONLChunk(SizeT begin, SizeT end, ImportChunkWriter &writer) {
+    SizeT chunk_len = end - begin;
+    // simdjson reads up to SIMDJSON_PADDING bytes past the end of a document
+    simdjson::padded_string jsonl_str(chunk_len);
+    {
+        LocalFileSystem fs;
+        UniquePtr<FileHandler> file_handler = fs.OpenFile(file_path_, FileFlags::READ_FLAG, FileLockType::kReadLock);
+        DeferFn file_defer([&]() { fs.Close(*file_handler); });
+        fs.Seek(*file_handler, begin);
+        SizeT read_n = file_handler->Read(jsonl_str.data(), chunk_len);
+        if (read_n != chunk_len) {
+            UnrecoverableError(fmt::format("Read file size {} doesn't match with chunk size {}.", read_n, chunk_len));
+        }
     }
 
-    Txn *txn = query_context->GetTxn();
-    TxnTableStore *txn_store = txn->GetTxnTableStore(table_entry_);
-    u64 segment_id = NewCatalog::GetNextSegmentID(table_entry_);
-    SharedPtr<SegmentEntry> segment_entry = SegmentEntry::NewSegmentEntry(table_entry_, segment_id, txn, true);
-    UniquePtr<BlockEntry> block_entry = BlockEntry::NewBlockEntry(segment_entry.get(), 0, 0, table_entry_->ColumnCount(), txn);
-
+    simdjson::ondemand::parser parser;
+    const char *jsonl_data = jsonl_str.data();
     SizeT start_pos = 0;
-    Vector<ColumnVector> column_vectors;
-    for (SizeT i = 0; i < table_entry_->ColumnCount(); ++i) {
-        auto *block_column_entry = block_entry->GetColumnBlockEntry(i);
-        column_vectors.emplace_back(block_column_entry->GetColumnVector(txn->GetBufferMgr()));
-    }
-    while (true) {
-        SizeT end_pos = jsonl_str.find('\n', start_pos);
-        if (end_pos == String::npos) {
-            end_pos = file_size;
-        }
-        std::string_view json_sv(jsonl_str.data() + start_pos, end_pos - start_pos);
-        if (end_pos == file_size) {
-            segment_entry->AppendBlockEntry(std::move(block_entry));
-            SaveSegmentData(txn_store, segment_entry);
-            break;
-        }
+    while (start_pos < chunk_len) {
+        const auto *line_end = static_cast<const char *>(std::memchr(jsonl_data + start_pos, '\n', chunk_len - start_pos));
+        SizeT end_pos = line_end == nullptr ? chunk_len : line_end - jsonl_data;
+        std::string_view json_sv(jsonl_data + start_pos, end_pos - start_pos);
+        SizeT capacity = chunk_len - start_pos + SIMDJSON_PADDING;
         start_pos = end_pos + 1;
+        if (json_sv.find_first_not_of(" \t\r") == std::string_view::npos) {
+            continue;
+        }
 
-        nlohmann::json line_json = nlohmann::json::parse(json_sv);
-
-        JSONLRowHandler(line_json, column_vectors);
-        block_entry->IncreaseRowCount(1);
-
-        if (block_entry->GetAvailableCapacity() <= 0) {
-            LOG_INFO(fmt::format("Block {} saved", block_entry->block_id()));
-            segment_entry->AppendBlockEntry(std::move(block_entry));
-            if (segment_entry->Room() <= 0) {
-                LOG_INFO(fmt::format("Segment {} saved", segment_entry->segment_id()));
-                SaveSegmentData(txn_store, segment_entry);
-                u64 segment_id = NewCatalog::GetNextSegmentID(table_entry_);
-                segment_entry = SegmentEntry::NewSegmentEntry(table_entry_, segment_id, txn, true);
-            }
-
-            block_entry = BlockEntry::NewBlockEntry(segment_entry.get(), segment_entry->GetNextBlockID(), 0, table_entry_->ColumnCount(), txn);
-            column_vectors.clear();
-            for (SizeT i = 0; i < table_entry_->ColumnCount(); ++i) {
-                auto *block_column_entry = block_entry->GetColumnBlockEntry(i);
-                column_vectors.emplace_back(block_column_entry->GetColumnVector(txn->GetBufferMgr()));
-            }
+        simdjson::ondemand::document line_json;
+        if (auto error = parser.iterate(json_sv.data(), json_sv.size(), capacity).get(line_json); error != simdjson::SUCCESS) {
+            RecoverableError(Status::ImportFileFormatError(fmt::format("Invalid JSON line: {}", simdjson::error_message(error))));
         }
+        JSONLRowHandler(line_json, writer);
     }
-
-    auto result_msg = MakeUnique<String>(fmt::format("IMPORT {} Rows", table_entry_->row_count()));
-    import_op_state->result_msg_ = std::move(result_msg);
-}
-
-void PhysicalImport::ImportJSON(QueryContext *, ImportOperatorState *) {
-    RecoverableError(Status::NotSupport("Import JSON is not implemented yet."));
+    writer.Finish();
 }
 
 void PhysicalImport::CSVHeaderHandler(void *context) {
@@ -341,154 +991,38 @@ void PhysicalImport::CSVHeaderHandler(void *context) {
 
 void PhysicalImport::CSVRowHandler(void *context) {
     ZxvParserCtx *parser_context = static_cast<ZxvParserCtx *>(context);
+    ImportChunkWriter &writer = parser_context->writer_;
 
     auto *table_entry = parser_context->table_entry_;
     SizeT column_count = parser_context->parser_.CellCount();
 
-    auto *txn = parser_context->txn_;
-    auto txn_store = txn->GetTxnTableStore(table_entry);
-    auto *buffer_mgr = txn->GetBufferMgr();
-
-    auto segment_entry = parser_context->segment_entry_;
-    UniquePtr<BlockEntry> block_entry = std::move(parser_context->block_entry_);
-
     // if column count is larger than columns defined from schema, extra columns are abandoned
     if (column_count != table_entry->ColumnCount()) {
         UniquePtr<String> err_msg =
-            MakeUnique<String>(fmt::format("CSV file row count isn't match with table schema, row id: {}.", parser_context->row_count_));
+            MakeUnique<String>(fmt::format("CSV file row count isn't match with table schema, row id: {}.", writer.row_count_));
         LOG_ERROR(*err_msg);
         RecoverableError(Status::ColumnCountMismatch(*err_msg));
     }
 
-    // append data to segment entry
+    // append data to the block of this chunk
+    Vector<ColumnVector> &column_vectors = writer.RowColumnVectors();
     for (SizeT column_idx = 0; column_idx < column_count; ++column_idx) {
         ZsvCell cell = parser_context->parser_.GetCell(column_idx);
         std::string_view str_view{};
         if (cell.len) {
             str_view = std::string_view((char *)cell.str, cell.len);
         }
-        auto &column_vector = parser_context->column_vectors_[column_idx];
-        column_vector.AppendByStringView(str_view, parser_context->delimiter_);
-    }
-    block_entry->IncreaseRowCount(1);
-    ++parser_context->row_count_;
-
-    if (block_entry->GetAvailableCapacity() <= 0) {
-        segment_entry->AppendBlockEntry(std::move(block_entry));
-        // we have already used all space of the segment
-        if (segment_entry->Room() <= 0) {
-            SaveSegmentData(txn_store, segment_entry);
-            u64 segment_id = NewCatalog::GetNextSegmentID(parser_context->table_entry_);
-            segment_entry = SegmentEntry::NewSegmentEntry(table_entry, segment_id, txn, true);
-            parser_context->segment_entry_ = segment_entry;
-        }
-
-        block_entry = BlockEntry::NewBlockEntry(segment_entry.get(), segment_entry->GetNextBlockID(), 0, table_entry->ColumnCount(), txn);
-        parser_context->column_vectors_.clear();
-        for (SizeT i = 0; i < column_count; ++i) {
-            auto *block_column_entry = block_entry->GetColumnBlockEntry(i);
-            parser_context->column_vectors_.emplace_back(block_column_entry->GetColumnVector(buffer_mgr));
-        }
-    }
-
-    // set parser context
-    parser_context->block_entry_ = std::move(block_entry);
-}
-
-void PhysicalImport::JSONLRowHandler(const nlohmann::json &line_json, Vector<ColumnVector> &column_vectors) {
-    for (SizeT i = 0; auto &column_vector : column_vectors) {
-        const ColumnDef *column_def = table_entry_->GetColumnDefByID(i++);
-
-        switch (column_vector.data_type()->type()) {
-            case kBoolean: {
-                bool v = line_json[column_def->name_];
-                column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(&v));
-                break;
-            }
-            case kTinyInt: {
-                i8 v = line_json[column_def->name_];
-                column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(&v));
-                break;
-            }
-            case kSmallInt: {
-                i16 v = line_json[column_def->name_];
-                column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(&v));
-                break;
-            }
-            case kInteger: {
-                i32 v = line_json[column_def->name_];
-                column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(&v));
-                break;
-            }
-            case kBigInt: {
-                i64 v = line_json[column_def->name_];
-                column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(&v));
-                break;
-            }
-            case kFloat: {
-                float v = line_json[column_def->name_];
-                column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(&v));
-                break;
-            }
-            case kDouble: {
-                double v = line_json[column_def->name_];
-                column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(&v));
-                break;
-            }
-            case kVarchar: {
-                std::string_view str_view = line_json[column_def->name_].get<std::string_view>();
-                column_vector.AppendByStringView(str_view, ',');
-                break;
-            }
-            case kEmbedding: {
-                auto embedding_info = static_cast<EmbeddingInfo *>(column_vector.data_type()->type_info().get());
-                // SizeT dim = embedding_info->Dimension();
-                switch (embedding_info->Type()) {
-                    case kElemInt8: {
-                        Vector<i8> &&embedding = line_json[column_def->name_].get<Vector<i8>>();
-                        column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(embedding.data()));
-                        break;
-                    }
-                    case kElemInt16: {
-                        Vector<i16> &&embedding = line_json[column_def->name_].get<Vector<i16>>();
-                        column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(embedding.data()));
-                        break;
-                    }
-                    case kElemInt32: {
-                        Vector<i32> &&embedding = line_json[column_def->name_].get<Vector<i32>>();
-                        column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(embedding.data()));
-                        break;
-                    }
-                    case kElemInt64: {
-                        Vector<i64> &&embedding = line_json[column_def->name_].get<Vector<i64>>();
-                        column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(embedding.data()));
-                        break;
-                    }
-                    case kElemFloat: {
-                        Vector<float> &&embedding = line_json[column_def->name_].get<Vector<float>>();
-                        column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(embedding.data()));
-                        break;
-                    }
-                    case kElemDouble: {
-                        Vector<double> &&embedding = line_json[column_def->name_].get<Vector<double>>();
-                        column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(embedding.data()));
-                        break;
-                    }
-                    default: {
-                        UnrecoverableError("Not implement: Embedding type.");
-                    }
-                }
-                break;
-            }
-            default: {
-                UnrecoverableError("Not implement: Invalid data type.");
-            }
-        }
+        column_vectors[column_idx].AppendByStringView(str_view, parser_context->delimiter_);
     }
+    writer.FinishRow();
 }
 
 void PhysicalImport::SaveSegmentData(TxnTableStore *txn_store, SharedPtr<SegmentEntry> &segment_entry) {
     segment_entry->FlushNewData();
+    AddSegmentData(txn_store, segment_entry);
+}
+
+void PhysicalImport::AddSegmentData(TxnTableStore *txn_store, SharedPtr<SegmentEntry> &segment_entry) {
     const auto [block_cnt, last_block_row_count] = segment_entry->GetWalInfo();
 
     const String &db_name = *txn_store->table_entry_->GetDBName();
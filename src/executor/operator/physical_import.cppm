@@ -38,27 +38,54 @@ import data_type;
 
 namespace infinity {
 
-class ZxvParserCtx {
+// Builds the segments of one import chunk on the worker that parses it. Full segments are flushed right away, the
+// transaction picks them up in chunk order once the worker is done.
+class ImportChunkWriter {
+public:
+    ImportChunkWriter(TableEntry *table_entry, Txn *txn) : table_entry_(table_entry), txn_(txn) {}
+
+    // Column vectors of the block that the next row goes to
+    Vector<ColumnVector> &RowColumnVectors();
+
+    // Rows the current block can still take, opens a new block when needed
+    SizeT BlockRoom();
+
+    void FinishRow() { FinishRows(1); }
+
+    // Called after appending row_count rows to RowColumnVectors(), which must fit in BlockRoom()
+    void FinishRows(SizeT row_count);
+
+    void Finish();
+
+    // Remove the segments already flushed, when the import fails
+    void Discard();
+
 public:
-    ZsvParser parser_;
-    SizeT row_count_{};
-    SharedPtr<String> err_msg_{};
     TableEntry *const table_entry_{};
     Txn *const txn_{};
+    SizeT row_count_{};
+    Vector<SharedPtr<SegmentEntry>> segment_entries_{};
+    // CSV only: the chunk has an odd number of quotes, so a cut point before or after it is inside a quoted field
+    bool unbalanced_quotes_{false};
+
+private:
+    void SealSegment();
+
     SharedPtr<SegmentEntry> segment_entry_{};
     UniquePtr<BlockEntry> block_entry_{};
     Vector<ColumnVector> column_vectors_{};
+};
+
+class ZxvParserCtx {
+public:
+    ZsvParser parser_;
+    ImportChunkWriter &writer_;
+    SharedPtr<String> err_msg_{};
+    TableEntry *const table_entry_{};
     const char delimiter_{};
 
 public:
-    ZxvParserCtx(TableEntry *table_entry,
-                 Txn *txn,
-                 SharedPtr<SegmentEntry> segment_entry,
-                 UniquePtr<BlockEntry> block_entry,
-                 Vector<ColumnVector> &&column_vectors,
-                 char delimiter)
-        : row_count_(0), err_msg_(nullptr), table_entry_(table_entry), txn_(txn), segment_entry_(segment_entry), block_entry_(std::move(block_entry)),
-          column_vectors_(std::move(column_vectors)), delimiter_(delimiter) {}
+    ZxvParserCtx(ImportChunkWriter &writer, char delimiter) : writer_(writer), table_entry_(writer.table_entry_), delimiter_(delimiter) {}
 };
 
 export class PhysicalImport : public PhysicalOperator {
@@ -98,6 +125,8 @@ public:
 
     void ImportJSONL(QueryContext *query_context, ImportOperatorState *import_op_state);
 
+    void ImportParquet(QueryContext *query_context, ImportOperatorState *import_op_state);
+
     inline const TableEntry *table_entry() const { return table_entry_; }
 
     inline CopyFileType FileType() const { return file_type_; }
@@ -110,13 +139,32 @@ public:
 
     static void SaveSegmentData(TxnTableStore *txn_store, SharedPtr<SegmentEntry> &segment_entry);
 
+    // Register a segment which is already flushed to the transaction
+    static void AddSegmentData(TxnTableStore *txn_store, SharedPtr<SegmentEntry> &segment_entry);
+
 private:
+    using ImportChunkFunc = std::function<void(SizeT chunk_idx, ImportChunkWriter &writer)>;
+
+    using ImportFileChunkFunc = std::function<void(SizeT begin, SizeT end, bool first_chunk, ImportChunkWriter &writer)>;
+
+    // Start offsets of the import chunks, each chunk ends right after a line break
+    Vector<SizeT> SplitImportFile(SizeT file_size, SizeT chunk_size) const;
+
+    // Imports chunk_count chunks concurrently and hands their segments to the transaction in chunk order.
+    // Returns none without importing anything if a chunk has unbalanced quotes.
+    Optional<SizeT> ImportChunks(QueryContext *query_context, SizeT chunk_count, const ImportChunkFunc &import_chunk);
+
+    // Splits a text file into byte ranges and imports them with ImportChunks
+    SizeT ImportFileChunks(QueryContext *query_context, const ImportFileChunkFunc &import_chunk, bool quote_aware);
+
+    void ImportCSVChunk(SizeT begin, SizeT end, bool first_chunk, ImportChunkWriter &writer);
+
+    void ImportJSONLChunk(SizeT begin, SizeT end, ImportChunkWriter &writer);
+
     static void CSVHeaderHandler(void *);
 
     static void CSVRowHandler(void *);
 
-    void JSONLRowHandler(const nlohmann::json &line_json, Vector<ColumnVector> &column_vectors);
-
 private:
     SharedPtr<Vector<String>> output_names_{};
     SharedPtr<Vector<SharedPtr<DataType>>> output_types_{};
@@ -14,7 +14,7 @@
 
 module;
 
-#include <bit>
+#include <type_traits>
 #include <vector>
 
 module physical_index_scan;
@@ -32,8 +32,13 @@ import secondary_index_scan_execute_expression;
 import logical_type;
 import segment_column_index_entry;
 import segment_entry;
-// TODO:use bitset
-import bitmask;
+import bsi;
+import index_base;
+import create_index_info;
+import secondary_index_delta;
+import buffer_manager;
+import table_entry;
+import column_def;
 
 namespace infinity {
 
@@ -94,16 +99,12 @@ bool PhysicalIndexScan::Execute(QueryContext *query_context, OperatorState *oper
     return true;
 }
 
-// TODO: replace bitmask with bitmap
-// Vector<u32>: selected rows in segment (used when selected_num <= (segment_row_cnt / 32)), i.e. size(Vector) <= size(Bitmask)
-// Bitmask: selected rows in segment (used when selected_num > (segment_row_cnt / 32))
+// selected rows in segment, kept as a roaring bitmap: a sorted array for sparse results, dense bitmaps or runs for large ones
 class FilterResult {
 private:
-    using SelectedRows = std::variant<Vector<u32>, Bitmask>;
-
     const u32 segment_row_count_{};        // count of rows in segment, include deleted rows
     const u32 segment_row_actual_count_{}; // count of rows in segment, exclude deleted rows
-    SelectedRows selected_rows_;           // default to Vector<u32>()
+    RoaringBitmap selected_rows_;          // default to empty
 
 public:
     explicit FilterResult(u32 segment_row_count, u32 segment_row_actual_count)
@@ -117,110 +118,13 @@ public:
     [[nodiscard]] inline u32 SegmentRowActualCount() const { return segment_row_actual_count_; }
 
     // result after consider if_reverse_select_
-    [[nodiscard]] inline u32 SelectedNum() const {
-        return std::visit(Overload{[](const Vector<u32> &selected_rows) -> u32 { return selected_rows.size(); },
-                                   [](const Bitmask &bitmask) -> u32 { return bitmask.CountTrue(); }},
-                          selected_rows_);
-    }
+    [[nodiscard]] inline u32 SelectedNum() const { return selected_rows_.cardinality(); }
 
-    inline void MergeOr(FilterResult &other) {
-        // merge selected_rows_
-        std::visit(Overload{[](Bitmask &left_bitmask, const Bitmask &right_bitmask) { left_bitmask.MergeOr(right_bitmask); },
-                            [](Bitmask &left_bitmask, const Vector<u32> &right_selected_rows) {
-                                for (auto offset : right_selected_rows) {
-                                    left_bitmask.SetTrue(offset);
-                                }
-                            },
-                            [&](Vector<u32> &left_selected_rows, Bitmask &right_bitmask) {
-                                for (auto offset : left_selected_rows) {
-                                    right_bitmask.SetTrue(offset);
-                                }
-                                std::swap(selected_rows_, other.selected_rows_);
-                            },
-                            [](Vector<u32> &left_selected_rows, const Vector<u32> &right_selected_rows) {
-                                const u32 left_size = left_selected_rows.size();
-                                const u32 right_size = right_selected_rows.size();
-                                u32 i = 0, j = 0;
-                                Vector<u32> merged_selected_rows;
-                                merged_selected_rows.reserve(left_size + right_size);
-                                while (i < left_size and j < right_size) {
-                                    if (left_selected_rows[i] < right_selected_rows[j]) {
-                                        merged_selected_rows.emplace_back(left_selected_rows[i]);
-                                        ++i;
-                                    } else if (left_selected_rows[i] > right_selected_rows[j]) {
-                                        merged_selected_rows.emplace_back(right_selected_rows[j]);
-                                        ++j;
-                                    } else {
-                                        merged_selected_rows.emplace_back(left_selected_rows[i]);
-                                        ++i;
-                                        ++j;
-                                    }
-                                }
-                                while (i < left_size) {
-                                    merged_selected_rows.emplace_back(left_selected_rows[i]);
-                                    ++i;
-                                }
-                                while (j < right_size) {
-                                    merged_selected_rows.emplace_back(right_selected_rows[j]);
-                                    ++j;
-                                }
-                                std::swap(merged_selected_rows, left_selected_rows);
-                            }},
-                   selected_rows_,
-                   other.selected_rows_);
-    }
+    inline void MergeOr(const FilterResult &other) { selected_rows_ |= other.selected_rows_; }
 
-    inline void MergeAnd(FilterResult &other) {
-        // merge selected_rows_
-        std::visit(Overload{[](Bitmask &left_bitmask, const Bitmask &right_bitmask) { left_bitmask.Merge(right_bitmask); },
-                            [&](Bitmask &left_bitmask, Vector<u32> &right_selected_rows) {
-                                // apply left bitmask as filter on right vector
-                                u32 new_right_size = 0;
-                                for (auto offset : right_selected_rows) {
-                                    if (left_bitmask.IsTrue(offset)) {
-                                        right_selected_rows[new_right_size++] = offset;
-                                    }
-                                }
-                                // possible: new_right_size = 0
-                                right_selected_rows.resize(new_right_size);
-                                std::swap(selected_rows_, other.selected_rows_);
-                            },
-                            [](Vector<u32> &left_selected_rows, const Bitmask &right_bitmask) {
-                                // apply right bitmask as filter on left vector
-                                u32 new_left_size = 0;
-                                for (auto offset : left_selected_rows) {
-                                    if (right_bitmask.IsTrue(offset)) {
-                                        left_selected_rows[new_left_size++] = offset;
-                                    }
-                                }
-                                // possible: new_left_size = 0
-                                left_selected_rows.resize(new_left_size);
-                            },
-                            [](Vector<u32> &left_selected_rows, const Vector<u32> &right_selected_rows) {
-                                // apply right vector as filter on left vector
-                                const u32 right_size = right_selected_rows.size();
-                                u32 i = 0;
-                                u32 new_left_size = 0;
-                                for (u32 offset : left_selected_rows) {
-                                    while (i < right_size and right_selected_rows[i] < offset) {
-                                        ++i;
-                                    }
-                                    if (i < right_size and right_selected_rows[i] == offset) {
-                                        left_selected_rows[new_left_size++] = offset;
-                                        ++i;
-                                    }
-                                }
-                                // possible: new_left_size = 0
-                                left_selected_rows.resize(new_left_size);
-                            }},
-                   selected_rows_,
-                   other.selected_rows_);
-    }
+    inline void MergeAnd(const FilterResult &other) { selected_rows_ &= other.selected_rows_; }
 
-    inline void SetEmptyResult() {
-        // use empty vector
-        selected_rows_.emplace<Vector<u32>>();
-    }
+    inline void SetEmptyResult() { selected_rows_ = RoaringBitmap(); }
 
     template <typename ColumnValueType>
     inline void
@@ -231,14 +135,9 @@ public:
         auto index_part_capacity = index->GetPartCapacity();
         auto index_part_num = index->GetPartNum();
         auto index_data_num = index->GetDataNum();
-        if (index_data_num != SegmentRowActualCount()) {
-            if (index_data_num < SegmentRowActualCount()) {
-                UnrecoverableError("FilterResult::ExecuteSingleRange(): index_data_num < SegmentRowActualCount(). index error.");
-            } else {
-                LOG_INFO(fmt::format("FilterResult::ExecuteSingleRange(): index_data_num: {}, SegmentRowActualCount(): {}. Some rows are deleted.",
-                                     index_data_num,
-                                     SegmentRowActualCount()));
-            }
+        // rows appended after the index was built are searched in the delta
+        if (index_data_num == 0) {
+            return SetEmptyResult();
         }
         auto [begin_val, end_val] = interval_range.GetRange();
         // 1. search PGM and get approximate search range
@@ -368,62 +267,96 @@ public:
             return SetEmptyResult();
         }
         u32 result_size = end_pos - begin_pos;
-        // use array or bitmask for result
-        // use array when result_size <= 1024 or size of array (u32 type) <= size of bitmask
-        bool use_array = result_size <= 1024 or result_size <= (std::bit_ceil(SegmentRowCount()) / 32);
         // 4. output result
-        auto index_offset_b_ptr = static_cast<const u32 *>(index_data_b->GetColumnOffsetData());
-        if (use_array) {
-            auto &selected_rows = selected_rows_.emplace<Vector<u32>>();
-            selected_rows.reserve(result_size);
-            for (u32 i = 0; i < result_size; ++i) {
-                if (begin_part_offset == begin_part_size) {
-                    index_handle_b = index_entry.GetIndexPartAt(++begin_part_id);
-                    index_data_b = static_cast<const SecondaryIndexDataPart *>(index_handle_b.GetData());
-                    index_offset_b_ptr = static_cast<const u32 *>(index_data_b->GetColumnOffsetData());
-                    begin_part_size = index_data_b->GetPartSize();
-                    begin_part_offset = 0;
-                }
-                selected_rows.emplace_back(index_offset_b_ptr[begin_part_offset]);
-                ++begin_part_offset;
+        // the offsets of each index part are sorted by key, add them part by part
+        selected_rows_ = RoaringBitmap();
+        while (true) {
+            auto index_offset_b_ptr = static_cast<const u32 *>(index_data_b->GetColumnOffsetData());
+            u32 add_count = std::min<u32>(result_size, begin_part_size - begin_part_offset);
+            selected_rows_.addMany(add_count, index_offset_b_ptr + begin_part_offset);
+            if ((result_size -= add_count) == 0) {
+                return;
             }
-            // need to sort
-            std::sort(selected_rows.begin(), selected_rows.end());
-            return;
+            index_handle_b = index_entry.GetIndexPartAt(++begin_part_id);
+            index_data_b = static_cast<const SecondaryIndexDataPart *>(index_handle_b.GetData());
+            begin_part_size = index_data_b->GetPartSize();
+            begin_part_offset = 0;
+        }
+    }
+
+    template <typename ColumnValueType>
+    inline void ExecuteSingleRangeBSI(const FilterIntervalRangeT<ColumnValueType> &interval_range, SegmentColumnIndexEntry &index_entry) {
+        using T = FilterIntervalRangeT<ColumnValueType>::T;
+        if constexpr (std::is_floating_point_v<T>) {
+            UnrecoverableError("FilterResult::ExecuteSingleRangeBSI(): bsi index can't be built on floating point column.");
         } else {
-            auto &bitmask = selected_rows_.emplace<Bitmask>();
-            bitmask.Initialize(std::bit_ceil(SegmentRowCount()));
-            bitmask.SetAllFalse();
-            for (u32 i = 0; i < result_size; ++i) {
-                if (begin_part_offset == begin_part_size) {
-                    index_handle_b = index_entry.GetIndexPartAt(++begin_part_id);
-                    index_data_b = static_cast<const SecondaryIndexDataPart *>(index_handle_b.GetData());
-                    index_offset_b_ptr = static_cast<const u32 *>(index_data_b->GetColumnOffsetData());
-                    begin_part_size = index_data_b->GetPartSize();
-                    begin_part_offset = 0;
-                }
-                bitmask.SetTrue(index_offset_b_ptr[begin_part_offset]);
-                ++begin_part_offset;
-            }
-            return;
+            BufferHandle index_handle = index_entry.GetIndex();
+            auto index = static_cast<const BitSlicedIndex *>(index_handle.GetData());
+            auto [begin_val, end_val] = interval_range.GetRange();
+            selected_rows_ = index->RangeBetween(begin_val, end_val);
         }
     }
 
+    // rows appended to the segment after the index was built, [begin_offset, ...), visible at begin_ts
+    template <typename ColumnValueType>
+    inline void ExecuteSingleRangeDelta(const FilterIntervalRangeT<ColumnValueType> &interval_range,
+                                        ColumnIndexEntry *column_index_entry,
+                                        const SegmentEntry *segment_entry,
+                                        SegmentOffset begin_offset,
+                                        BufferManager *buffer_mgr,
+                                        TxnTimeStamp begin_ts) {
+        const ColumnID column_id = column_index_entry->column_id();
+        const DataType &data_type = *(segment_entry->GetTableEntry()->GetColumnDefByID(column_id)->type());
+        auto delta = column_index_entry->GetSecondaryIndexDelta(segment_entry->segment_id(), begin_offset, data_type);
+        auto [begin_val, end_val] = interval_range.GetRange();
+        RoaringBitmap delta_rows;
+        static_cast<SecondaryIndexDeltaT<ColumnValueType> *>(delta.get())
+            ->Search(segment_entry, buffer_mgr, column_id, begin_ts, begin_val, end_val, delta_rows);
+        selected_rows_ |= delta_rows;
+    }
+
+    // rows [0, return value) of the segment are covered by the index
+    static inline u32 IndexCoveredRows(SegmentColumnIndexEntry &index_entry, bool use_bsi) {
+        BufferHandle index_handle = index_entry.GetIndex();
+        if (use_bsi) {
+            return static_cast<const BitSlicedIndex *>(index_handle.GetData())->SegmentRowCount();
+        }
+        return static_cast<const SecondaryIndexDataHead *>(index_handle.GetData())->GetFullDataNum();
+    }
+
     inline void ExecuteSingleRange(const HashMap<ColumnID, SharedPtr<ColumnIndexEntry>> &column_index_map,
                                    const FilterExecuteSingleRange &single_range,
-                                   SegmentID segment_id) {
+                                   const SegmentEntry *segment_entry,
+                                   BufferManager *buffer_mgr,
+                                   TxnTimeStamp begin_ts) {
         // step 1. check if range is empty
         if (single_range.IsEmpty()) {
             return SetEmptyResult();
         }
         // step 2. get ColumnID and prepare SegmentColumnIndexEntry
+        const SegmentID segment_id = segment_entry->segment_id();
         ColumnID column_id = single_range.GetColumnID();
-        auto const &index_by_segment = column_index_map.at(column_id)->index_by_segment();
-        SegmentColumnIndexEntry &index_entry = *(index_by_segment.at(segment_id));
-        // step 3. search index
+        ColumnIndexEntry *column_index_entry = column_index_map.at(column_id).get();
+        auto const &index_by_segment = column_index_entry->index_by_segment();
+        // the segment has no index entry if it is created after the index
+        auto index_iter = index_by_segment.find(segment_id);
+        SegmentColumnIndexEntry *index_entry = index_iter == index_by_segment.end() ? nullptr : index_iter->second.get();
+        // step 3. search index, then the rows appended after it
         auto &interval_range_variant = single_range.GetIntervalRange();
+        const bool use_bsi = column_index_entry->index_base_ptr()->index_type_ == IndexType::kBSI;
         std::visit(Overload{[&]<typename ColumnValueType>(const FilterIntervalRangeT<ColumnValueType> &interval_range) {
-                                ExecuteSingleRangeT(interval_range, index_entry, segment_id);
+                                u32 index_covered_rows = 0;
+                                if (index_entry != nullptr) {
+                                    if (use_bsi) {
+                                        ExecuteSingleRangeBSI(interval_range, *index_entry);
+                                    } else {
+                                        ExecuteSingleRangeT(interval_range, *index_entry, segment_id);
+                                    }
+                                    index_covered_rows = IndexCoveredRows(*index_entry, use_bsi);
+                                }
+                                if (index_covered_rows < SegmentRowCount()) {
+                                    ExecuteSingleRangeDelta(interval_range, column_index_entry, segment_entry, index_covered_rows, buffer_mgr, begin_ts);
+                                }
                             },
                             [](const std::monostate &empty) {
                                 UnrecoverableError("FilterResult::ExecuteSingleRange(): class member interval_range_ not initialized!");
@@ -431,83 +364,41 @@ public:
                    interval_range_variant);
     }
 
-    inline void Output(Vector<UniquePtr<DataBlock>> &output_data_blocks, SegmentID segment_id, const DeleteFilter &delete_filter) const {
+    inline void Output(Vector<UniquePtr<DataBlock>> &output_data_blocks, SegmentID segment_id, const RoaringBitmap &deleted_rows) {
         const u32 block_capacity = DEFAULT_BLOCK_CAPACITY;
-        const u32 selected_row_num = SelectedNum(); // before delete filter
-        u32 output_rows = 0;
-        u32 invalid_rows = 0;
+        const u32 selected_row_num = SelectedNum(); // before removing deleted rows
         // check if output_data_blocks is empty
         if (!output_data_blocks.empty()) {
             UnrecoverableError("FilterResult::Output(): output data block array should be empty.");
         }
+        selected_rows_ -= deleted_rows;
+        const u32 output_rows = SelectedNum();
+        const u32 invalid_rows = selected_row_num - output_rows;
         Vector<SharedPtr<DataType>> output_types;
         output_types.emplace_back(MakeShared<DataType>(LogicalType::kRowID));
         // 1. prepare first output_data_block
         auto append_data_block = [&]() {
             auto data_block = DataBlock::MakeUniquePtr();
-            // u32 write_size = std::min(block_capacity, selected_row_num - row_idx);
             // TODO: error: if Init with write_size != pow of 2, error will occur in Bitmask::Initialize()
             data_block->Init(output_types);
             output_data_blocks.emplace_back(std::move(data_block));
         };
         append_data_block();
         // 2. output
-        // delete_filter: return false if the row is deleted
-        std::visit(Overload{[&](const Bitmask &bitmask) {
-                                u32 output_block_row_id = 0;
-                                DataBlock *output_block_ptr = output_data_blocks.back().get();
-                                // TODO: 64 bit in a loop?
-                                const u32 segment_row_count = SegmentRowCount();
-                                for (u32 segment_offset = 0; segment_offset < segment_row_count; ++segment_offset) {
-                                    if (bitmask.IsTrue(segment_offset)) {
-                                        if (!delete_filter(segment_offset)) {
-                                            // deleted
-                                            ++invalid_rows;
-                                            continue;
-                                        }
-                                        if (output_block_row_id == block_capacity) {
-                                            output_block_ptr->Finalize();
-                                            append_data_block();
-                                            output_block_ptr = output_data_blocks.back().get();
-                                            output_block_row_id = 0;
-                                        }
-                                        RowID row_id(segment_id, segment_offset);
-                                        output_block_ptr->AppendValueByPtr(0, (ptr_t)&row_id);
-                                        ++output_block_row_id;
-                                        ++output_rows;
-                                    }
-                                }
-                                output_block_ptr->Finalize();
-                                if (output_rows + invalid_rows != selected_row_num) {
-                                    UnrecoverableError("FilterResult::Output(): output row num error.");
-                                }
-                            },
-                            [&](const Vector<u32> &selected_rows) {
-                                u32 output_block_row_id = 0;
-                                DataBlock *output_block_ptr = output_data_blocks.back().get();
-                                for (u32 segment_offset : selected_rows) {
-                                    if (!delete_filter(segment_offset)) {
-                                        // deleted
-                                        ++invalid_rows;
-                                        continue;
-                                    }
-                                    if (output_block_row_id == block_capacity) {
-                                        output_block_ptr->Finalize();
-                                        append_data_block();
-                                        output_block_ptr = output_data_blocks.back().get();
-                                        output_block_row_id = 0;
-                                    }
-                                    RowID row_id(segment_id, segment_offset);
-                                    output_block_ptr->AppendValueByPtr(0, (ptr_t)&row_id);
-                                    ++output_block_row_id;
-                                    ++output_rows;
-                                }
-                                output_block_ptr->Finalize();
-                                if (output_rows + invalid_rows != selected_row_num) {
-                                    UnrecoverableError("FilterResult::Output(): output row num error.");
-                                }
-                            }},
-                   selected_rows_);
+        u32 output_block_row_id = 0;
+        DataBlock *output_block_ptr = output_data_blocks.back().get();
+        for (u32 segment_offset : selected_rows_) {
+            if (output_block_row_id == block_capacity) {
+                output_block_ptr->Finalize();
+                append_data_block();
+                output_block_ptr = output_data_blocks.back().get();
+                output_block_row_id = 0;
+            }
+            RowID row_id(segment_id, segment_offset);
+            output_block_ptr->AppendValueByPtr(0, (ptr_t)&row_id);
+            ++output_block_row_id;
+        }
+        output_block_ptr->Finalize();
         LOG_INFO(fmt::format("FilterResult::Output(): output rows: {}, invalid candidate rows: {}", output_rows, invalid_rows));
     }
 };
@@ -515,6 +406,7 @@ public:
 void PhysicalIndexScan::ExecuteInternal(QueryContext *query_context, IndexScanOperatorState *index_scan_operator_state) const {
     Txn *txn = query_context->GetTxn();
     TxnTimeStamp begin_ts = txn->BeginTS();
+    BufferManager *buffer_mgr = query_context->storage()->buffer_manager();
 
     auto &output_data_blocks = index_scan_operator_state->data_block_array_;
     auto &segment_ids = *(index_scan_operator_state->segment_ids_);
@@ -570,7 +462,7 @@ void PhysicalIndexScan::ExecuteInternal(QueryContext *query_context, IndexScanOp
                             },
                             [&](const FilterExecuteSingleRange &single_range) {
                                 result_stack.emplace_back(segment_row_count, segment_row_actual_count);
-                                result_stack.back().ExecuteSingleRange(column_index_map_, single_range, segment_id);
+                                result_stack.back().ExecuteSingleRange(column_index_map_, single_range, segment_entry, buffer_mgr, begin_ts);
                             }},
                    elem);
     }
@@ -578,11 +470,10 @@ void PhysicalIndexScan::ExecuteInternal(QueryContext *query_context, IndexScanOp
     if (result_stack.size() != 1) {
         UnrecoverableError("ExecuteInternal(): filter result stack error.");
     }
-    // prepare filter for deleted rows
-    DeleteFilter delete_filter(segment_entry, begin_ts);
-    // output
+    // remove deleted rows and output
+    RoaringBitmap deleted_rows = segment_entry->GetDeletedRows(begin_ts);
     auto &result = result_stack.back();
-    result.Output(output_data_blocks, segment_id, delete_filter);
+    result.Output(output_data_blocks, segment_id, deleted_rows);
 
     LOG_TRACE(fmt::format("IndexScan: job number: {}, segment_ids.size(): {}", next_idx, segment_ids.size()));
     // update next_idx
@@ -69,6 +69,7 @@ import knn_expr;
 import block_entry;
 import column_index_entry;
 import segment_entry;
+import metrics;
 
 namespace infinity {
 
@@ -91,6 +92,19 @@ void ReadDataBlock(DataBlock *output,
     output->Finalize();
 }
 
+// Same as above for a block the transaction appended but hasn't committed, which holds all the columns of the table
+void ReadDataBlock(DataBlock *output, const auto row_count, const DataBlock *local_block, u16 local_block_id, const Vector<SizeT> &column_ids) {
+    for (SizeT output_column_id = 0; auto column_id : column_ids) {
+        if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+            u32 segment_offset = local_block_id * DEFAULT_BLOCK_CAPACITY;
+            output->column_vectors[output_column_id++]->AppendWith(RowID(TXN_LOCAL_SEGMENT_ID, segment_offset), row_count);
+        } else {
+            output->column_vectors[output_column_id++]->AppendWith(*local_block->column_vectors[column_id], 0, row_count);
+        }
+    }
+    output->Finalize();
+}
+
 void MergeIntoBitmask(const VectorBuffer *input_bool_column_buffer,
                       const SharedPtr<Bitmask> &input_null_mask,
                       const SizeT count,
@@ -142,9 +156,35 @@ void MergeIntoBitmask(const VectorBuffer *input_bool_column_buffer,
     }
 }
 
+// Adds the rows of the bool column which are true and not null
+void MergeIntoBitmap(const VectorBuffer *input_bool_column_buffer,
+                     const SharedPtr<Bitmask> &input_null_mask,
+                     const SizeT count,
+                     RoaringBitmap &bitmap,
+                     SizeT bitmap_offset) {
+    const bool all_valid = input_null_mask->IsAllTrue();
+    auto is_selected = [&](SizeT idx) {
+        return input_bool_column_buffer->GetCompactBit(idx) && (all_valid || input_null_mask->IsTrue(idx));
+    };
+    for (SizeT idx = 0; idx < count;) {
+        if (!is_selected(idx)) {
+            ++idx;
+            continue;
+        }
+        // add the whole run of selected rows at once
+        SizeT run_end = idx + 1;
+        while (run_end < count && is_selected(run_end)) {
+            ++run_end;
+        }
+        bitmap.addRange(bitmap_offset + idx, bitmap_offset + run_end);
+        idx = run_end;
+    }
+}
+
 void PhysicalKnnScan::Init() {}
 
 bool PhysicalKnnScan::Execute(QueryContext *query_context, OperatorState *operator_state) {
+    ScopedLatency scan_latency(Metrics::instance().knn_scan_latency_);
     auto *knn_scan_operator_state = static_cast<KnnScanOperatorState *>(operator_state);
     auto elem_type = knn_scan_operator_state->knn_scan_function_data_->knn_scan_shared_data_->elem_type_;
     auto dist_type = knn_scan_operator_state->knn_scan_function_data_->knn_scan_shared_data_->knn_distance_type_;
@@ -256,6 +296,22 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
 
     SizeT index_task_n = knn_scan_shared_data->index_entries_->size();
     SizeT brute_task_n = knn_scan_shared_data->block_column_entries_->size();
+    BlockIndex *block_index = knn_scan_shared_data->table_ref_->block_index_.get();
+    SizeT local_task_n = block_index->LocalBlockCount();
+
+    // filter the rows read into db_for_filter_ and build bitmask, if filter_expression_ != nullptr
+    auto filter_into_bitmask = [&](SizeT row_count, Bitmask &bitmask) {
+        auto &filter_state_ = knn_scan_function_data->filter_state_;
+        auto &bool_column = knn_scan_function_data->bool_column_;
+        bool_column->Initialize(ColumnVectorType::kCompactBit, row_count);
+        ExpressionEvaluator expr_evaluator;
+        expr_evaluator.Init(knn_scan_function_data->db_for_filter_.get());
+        expr_evaluator.Execute(filter_expression_, filter_state_, bool_column);
+        const VectorBuffer *bool_column_buffer = bool_column->buffer_.get();
+        SharedPtr<Bitmask> &null_mask = bool_column->nulls_ptr_;
+        MergeIntoBitmask(bool_column_buffer, null_mask, row_count, bitmask, true);
+        bool_column->Reset();
+    };
 
     if (u64 block_column_idx = knn_scan_shared_data->current_block_idx_++; block_column_idx < brute_task_n) {
         LOG_TRACE(fmt::format("KnnScan: {} brute force {}/{}", knn_scan_function_data->task_id_, block_column_idx + 1, brute_task_n));
@@ -269,21 +325,17 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
         bitmask.Initialize(std::bit_ceil(row_count));
         if (filter_expression_) {
             auto db_for_filter = knn_scan_function_data->db_for_filter_.get();
-            auto &filter_state_ = knn_scan_function_data->filter_state_;
-            auto &bool_column = knn_scan_function_data->bool_column_;
-            // filter and build bitmask, if filter_expression_ != nullptr
             db_for_filter->Reset(row_count);
             ReadDataBlock(db_for_filter, buffer_mgr, row_count, block_entry, base_table_ref_->column_ids_);
-            bool_column->Initialize(ColumnVectorType::kCompactBit, row_count);
-            ExpressionEvaluator expr_evaluator;
-            expr_evaluator.Init(db_for_filter);
-            expr_evaluator.Execute(filter_expression_, filter_state_, bool_column);
-            const VectorBuffer *bool_column_buffer = bool_column->buffer_.get();
-            SharedPtr<Bitmask> &null_mask = bool_column->nulls_ptr_;
-            MergeIntoBitmask(bool_column_buffer, null_mask, row_count, bitmask, true);
-            bool_column->Reset();
+            filter_into_bitmask(row_count, bitmask);
         }
         block_entry->SetDeleteBitmask(begin_ts, bitmask);
+        if (const Vector<BlockOffset> *local_deletes = block_index->GetLocalDeletes(block_entry->segment_id(), block_entry->block_id());
+            local_deletes != nullptr) {
+            for (BlockOffset block_offset : *local_deletes) {
+                bitmask.SetFalse(block_offset);
+            }
+        }
 
         ColumnVector column_vector = block_column_entry->GetColumnVector(buffer_mgr);
 
@@ -311,9 +363,10 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
             segment_entry = iter->second;
         }
         auto segment_row_count = segment_entry->row_count();
-        Bitmask bitmask;
+        // rows which pass the filter and aren't deleted
+        RoaringBitmap bitmap;
+        bool use_bitmap = false;
         if (filter_expression_) {
-            bitmask.Initialize(std::bit_ceil(segment_row_count));
             SizeT segment_row_count_real = 0;
             auto db_for_filter = knn_scan_function_data->db_for_filter_.get();
             auto &filter_state_ = knn_scan_function_data->filter_state_;
@@ -330,7 +383,7 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
                 expr_evaluator.Execute(filter_expression_, filter_state_, bool_column);
                 const VectorBuffer *bool_column_buffer = bool_column->buffer_.get();
                 SharedPtr<Bitmask> &null_mask = bool_column->nulls_ptr_;
-                MergeIntoBitmask(bool_column_buffer, null_mask, row_count, bitmask, true, segment_row_count_real);
+                MergeIntoBitmap(bool_column_buffer, null_mask, row_count, bitmap, segment_row_count_real);
                 segment_row_count_real += row_count;
                 bool_column->Reset();
             }
@@ -340,8 +393,22 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
                                                segment_row_count_real,
                                                segment_row_count));
             }
+            bitmap -= segment_entry->GetDeletedRows(begin_ts);
+            use_bitmap = bitmap.cardinality() < segment_row_count;
+        }
+        if (const auto *local_deletes = block_index->GetSegmentLocalDeletes(segment_id); local_deletes != nullptr) {
+            // the rows deleted by the transaction itself are filtered out with the bitmap, as if they were deleted by a committed one
+            if (!filter_expression_) {
+                bitmap.addRange(0, segment_row_count);
+                bitmap -= segment_entry->GetDeletedRows(begin_ts);
+            }
+            for (const auto &[block_id, block_offsets] : *local_deletes) {
+                for (BlockOffset block_offset : block_offsets) {
+                    bitmap.remove(block_id * DEFAULT_BLOCK_CAPACITY + block_offset);
+                }
+            }
+            use_bitmap = true;
         }
-        bool use_bitmask = !bitmask.IsAllTrue();
 
         switch (segment_column_index_entry->column_index_entry()->index_base_ptr()->index_type_) {
             case IndexType::kIVFFlat: {
@@ -355,7 +422,11 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
                                                      knn_scan_shared_data->dimension_,
                                                      knn_scan_shared_data->elem_type_);
                     ann_ivfflat_query.Begin();
-                    ann_ivfflat_query.Search(index, segment_id, n_probes, bitmask);
+                    if (use_bitmap) {
+                        ann_ivfflat_query.Search(index, segment_id, n_probes, bitmap);
+                    } else {
+                        ann_ivfflat_query.Search(index, segment_id, n_probes);
+                    }
                     ann_ivfflat_query.EndWithoutSort();
                     auto dists = ann_ivfflat_query.GetDistances();
                     auto row_ids = ann_ivfflat_query.GetIDs();
@@ -400,14 +471,10 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
                         SizeT result_n1 = 0;
                         UniquePtr<DataType[]> d_ptr = nullptr;
                         UniquePtr<SegmentOffset[]> l_ptr = nullptr;
-                        if (use_bitmask) {
-                            if (segment_entry->CheckAnyDelete(begin_ts)) {
-                                DeleteWithBitmaskFilter filter(bitmask, segment_entry, begin_ts);
-                                std::tie(result_n1, d_ptr, l_ptr) = index->template KnnSearch<false>(query, knn_scan_shared_data->topk_, filter);
-                            } else {
-                                BitmaskFilter<SegmentOffset> filter(bitmask);
-                                std::tie(result_n1, d_ptr, l_ptr) = index->template KnnSearch<false>(query, knn_scan_shared_data->topk_, filter);
-                            }
+                        if (use_bitmap) {
+                            // deleted rows are already removed from the bitmap
+                            BitmapFilter<SegmentOffset> filter(bitmap);
+                            std::tie(result_n1, d_ptr, l_ptr) = index->template KnnSearch<false>(query, knn_scan_shared_data->topk_, filter);
                         } else {
                             if (segment_entry->CheckAnyDelete(begin_ts)) {
                                 DeleteFilter filter(segment_entry, begin_ts);
@@ -501,11 +568,36 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
                 UnrecoverableError("Not implemented");
             }
         }
+    } else if (u64 local_block_idx = knn_scan_shared_data->current_local_block_idx_++; local_block_idx < local_task_n) {
+        LOG_TRACE(fmt::format("KnnScan: {} uncommitted block {}/{}", knn_scan_function_data->task_id_, local_block_idx + 1, local_task_n));
+        // brute force over a block the transaction appended but hasn't committed
+        SizeT row_count{};
+        const DataBlock *local_block = block_index->GetLocalBlock(local_block_idx, row_count);
+        Bitmask bitmask;
+        bitmask.Initialize(std::bit_ceil(row_count));
+        if (filter_expression_) {
+            auto db_for_filter = knn_scan_function_data->db_for_filter_.get();
+            db_for_filter->Reset(row_count);
+            ReadDataBlock(db_for_filter, row_count, local_block, local_block_idx, base_table_ref_->column_ids_);
+            filter_into_bitmask(row_count, bitmask);
+        }
+
+        auto *column_expr = static_cast<ColumnExpression *>(knn_expression_->arguments()[0].get());
+        const ColumnVector &column_vector = *local_block->column_vectors[column_expr->binding().column_idx];
+        auto data = reinterpret_cast<const DataType *>(column_vector.data());
+        merge_heap->Search(query,
+                           data,
+                           knn_scan_shared_data->dimension_,
+                           dist_func->dist_func_,
+                           row_count,
+                           TXN_LOCAL_SEGMENT_ID,
+                           local_block_idx,
+                           bitmask);
     }
-    if (knn_scan_shared_data->current_index_idx_ >= index_task_n && knn_scan_shared_data->current_block_idx_ >= brute_task_n) {
+    if (knn_scan_shared_data->current_index_idx_ >= index_task_n && knn_scan_shared_data->current_block_idx_ >= brute_task_n &&
+        knn_scan_shared_data->current_local_block_idx_ >= local_task_n) {
         LOG_TRACE(fmt::format("KnnScan: {} task finished", knn_scan_function_data->task_id_));
         // all task Complete
-        BlockIndex *block_index = knn_scan_shared_data->table_ref_->block_index_.get();
 
         merge_heap->End();
         i64 result_n = std::min(knn_scan_shared_data->topk_, merge_heap->total_count());
@@ -539,8 +631,15 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
                 BlockID block_id = segment_offset / DEFAULT_BLOCK_CAPACITY;
                 BlockOffset block_offset = segment_offset % DEFAULT_BLOCK_CAPACITY;
 
-                BlockEntry *block_entry = block_index->GetBlockEntry(segment_id, block_id);
-                if (block_entry == nullptr) {
+                BlockEntry *block_entry = nullptr;
+                const DataBlock *local_block = nullptr;
+                if (segment_id == TXN_LOCAL_SEGMENT_ID) {
+                    SizeT local_row_count{};
+                    local_block = block_index->GetLocalBlock(block_id, local_row_count);
+                } else {
+                    block_entry = block_index->GetBlockEntry(segment_id, block_id);
+                }
+                if (block_entry == nullptr and local_block == nullptr) {
                     UnrecoverableError(fmt::format("Cannot find block segment id: {}, block id: {}", segment_id, block_id));
                 }
 
@@ -554,6 +653,10 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
                 SizeT column_n = base_table_ref_->column_ids_.size();
                 for (SizeT i = 0; i < column_n; ++i) {
                     SizeT column_id = base_table_ref_->column_ids_[i];
+                    if (local_block != nullptr) {
+                        output_block_ptr->column_vectors[i]->AppendWith(*local_block->column_vectors[column_id], block_offset, 1);
+                        continue;
+                    }
                     auto *block_column_entry = block_entry->GetColumnBlockEntry(column_id);
                     ColumnVector &&column_vector = block_column_entry->GetColumnVector(query_context->storage()->buffer_manager());
 
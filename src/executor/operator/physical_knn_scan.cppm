@@ -73,12 +73,13 @@ public:
 
     void PlanWithIndex(QueryContext *query_context);
 
+    // the blocks the transaction appended but hasn't committed are searched by brute force too
     inline SizeT TaskCount() const {
-        return block_column_entries_->size() + index_entries_->size();
+        return block_column_entries_->size() + index_entries_->size() + base_table_ref_->block_index_->LocalBlockCount();
     }
 
     SizeT TaskletCount() override {
-        return block_column_entries_->size() + index_entries_->size();
+        return block_column_entries_->size() + index_entries_->size() + base_table_ref_->block_index_->LocalBlockCount();
     }
 
     void FillingTableRefs(HashMap<SizeT, SharedPtr<BaseTableRef>> &table_refs) override {
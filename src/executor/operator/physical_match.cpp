@@ -16,6 +16,7 @@ module;
 
 #include "analysis/token_attributes.hpp"
 #include "search/filter.hpp"
+#include <cstdlib>
 #include <string>
 
 module physical_match;
@@ -37,6 +38,7 @@ import base_expression;
 import match_expression;
 import default_values;
 import infinity_exception;
+import status;
 import iresearch_datastore;
 import value;
 import third_party;
@@ -46,9 +48,11 @@ import load_meta;
 import irs_index_entry;
 import block_entry;
 import block_column_entry;
+import block_index;
 import logical_type;
 import search_options;
 import query_driver;
+import metrics;
 
 namespace infinity {
 
@@ -64,6 +68,49 @@ PhysicalMatch::~PhysicalMatch() = default;
 
 void PhysicalMatch::Init() {}
 
+namespace {
+
+SizeT ParsePageOption(const String &name, const String &value, bool allow_zero) {
+    char *end = nullptr;
+    long long l = std::strtoll(value.c_str(), &end, 10);
+    if (end == value.c_str() || *end != '\0' || l < 0 || (l == 0 && !allow_zero)) {
+        const char *expected = allow_zero ? "non-negative" : "positive";
+        RecoverableError(Status::SyntaxError(fmt::format("Match option {}={} isn't a {} integer.", name, value, expected)));
+    }
+    return static_cast<SizeT>(l);
+}
+
+// topn: results of the page, offset: results to skip,
+// after=<row_id>: results ranked after the given one, e.g. the ROW_ID() of the last result of the previous page
+SearchPage ParseSearchPage(const Map<String, String> &options) {
+    SearchPage page;
+    if (auto it = options.find("topn"); it != options.end()) {
+        page.topn_ = ParsePageOption(it->first, it->second, false);
+    }
+    if (auto it = options.find("offset"); it != options.end()) {
+        page.offset_ = ParsePageOption(it->first, it->second, true);
+    }
+    if (page.offset_ > 0 && (page.offset_ >= MATCH_MAX_RESULT_WINDOW || page.offset_ + page.topn_ > MATCH_MAX_RESULT_WINDOW)) {
+        RecoverableError(
+            Status::SyntaxError(fmt::format("Match offset + topn exceeds {}, use the 'after' option to page deeper.", MATCH_MAX_RESULT_WINDOW)));
+    }
+    if (auto it = options.find("after"); it != options.end()) {
+        const String &value = it->second;
+        char *end = nullptr;
+        u64 row_id = std::strtoull(value.c_str(), &end, 10);
+        if (end == value.c_str() || *end != '\0' || value[0] == '-') {
+            RecoverableError(Status::SyntaxError(fmt::format("Match option after={} isn't a row id.", value)));
+        }
+        RowID after_row(row_id);
+        page.after_doc_ = RowID2DocID(after_row.segment_id_,
+                                      after_row.segment_offset_ / DEFAULT_BLOCK_CAPACITY,
+                                      after_row.segment_offset_ % DEFAULT_BLOCK_CAPACITY);
+    }
+    return page;
+}
+
+} // namespace
+
 static void AnalyzeFunc(const std::string &analyzer_name, const std::string &text, std::vector<std::string> &terms) {
     UniquePtr<IRSAnalyzer> analyzer = AnalyzerPool::instance().Get(analyzer_name);
     // refers to https://github.com/infiniflow/iresearch/blob/master/tests/analysis/jieba_analyzer_tests.cpp
@@ -76,6 +123,7 @@ static void AnalyzeFunc(const std::string &analyzer_name, const std::string &tex
 }
 
 bool PhysicalMatch::Execute(QueryContext *query_context, OperatorState *operator_state) {
+    ScopedLatency scan_latency(Metrics::instance().match_scan_latency_);
     // 1 build irs::filter
     // 1.1 populate column2analyzer
     TransactionID txn_id = query_context->GetTxn()->TxnID();
@@ -86,6 +134,7 @@ bool PhysicalMatch::Execute(QueryContext *query_context, OperatorState *operator
     // 1.2 parse options into map, populate default_field
     SearchOptions search_ops(match_expr_->options_text_);
     String default_field = search_ops.options_["default_field"];
+    SearchPage page = ParseSearchPage(search_ops.options_);
     // 1.3 build filter
     QueryDriver driver(column2analyzer, default_field);
     driver.analyze_func_ = AnalyzeFunc;
@@ -101,20 +150,40 @@ bool PhysicalMatch::Execute(QueryContext *query_context, OperatorState *operator
     if (dataStore == nullptr) {
         UnrecoverableError(fmt::format("IrsIndexEntry::irs_index_ is nullptr for table {}", *base_table_ref_->table_entry_ptr_->GetTableName()));
     }
-    rc = dataStore->Search(flt.get(), search_ops.options_, result);
+    // the rows the transaction has deleted itself are still in the index until it commits
+    const BlockIndex *block_index = base_table_ref_->block_index_.get();
+    RoaringBitmap deleted_docs;
+    for (const auto &[segment_id, block_deletes] : block_index->local_deletes_) {
+        for (const auto &[block_id, block_offsets] : block_deletes) {
+            for (BlockOffset block_offset : block_offsets) {
+                deleted_docs.add(RowID2DocID(segment_id, block_id, block_offset));
+            }
+        }
+    }
+    const RoaringBitmap *deleted_docs_ptr = block_index->HasLocalDeletes() ? &deleted_docs : nullptr;
+    rc = dataStore->Search(flt.get(), search_ops.options_, page, query_context->cpu_number_limit(), deleted_docs_ptr, result);
     if (rc != 0) {
         UnrecoverableError("IRSDataStore::Search failed");
     }
 
-    // 3 populate result datablock
-    // FIXME: what if result exceed DataBlock's capacity?
-    // 3.1 initialize output datablock
+    // 3 populate result datablocks
+    // 3.1 initialize output datablock, a new one once it is full
     Vector<SizeT> &column_ids = base_table_ref_->column_ids_;
     SizeT column_n = column_ids.size();
-    UniquePtr<DataBlock> output_data_block = DataBlock::MakeUniquePtr();
-    output_data_block->Init(*GetOutputTypes());
+    operator_state->data_block_array_.emplace_back(DataBlock::MakeUniquePtr());
+    operator_state->data_block_array_.back()->Init(*GetOutputTypes());
+    SizeT output_row_count = 0;
 
     for (ScoredId &scoredId : result) {
+        DataBlock *output_data_block = operator_state->data_block_array_.back().get();
+        if (output_row_count == DEFAULT_BLOCK_CAPACITY) {
+            output_data_block->Finalize();
+            operator_state->data_block_array_.emplace_back(DataBlock::MakeUniquePtr());
+            operator_state->data_block_array_.back()->Init(*GetOutputTypes());
+            output_data_block = operator_state->data_block_array_.back().get();
+            output_row_count = 0;
+        }
+
         // 3.2 enrich columns needed by later operators
         RowID row_id = DocID2RowID(scoredId.second);
         u32 segment_id = row_id.segment_id_;
@@ -135,9 +204,9 @@ bool PhysicalMatch::Execute(QueryContext *query_context, OperatorState *operator
         Value v = Value::MakeFloat(scoredId.first);
         output_data_block->column_vectors[column_id++]->AppendValue(v);
         output_data_block->column_vectors[column_id]->AppendWith(row_id, 1);
+        ++output_row_count;
     }
-    output_data_block->Finalize();
-    operator_state->data_block_array_.emplace_back(std::move(output_data_block));
+    operator_state->data_block_array_.back()->Finalize();
 
     operator_state->SetComplete();
     return true;
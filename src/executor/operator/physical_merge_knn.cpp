@@ -122,8 +122,15 @@ void PhysicalMergeKnn::ExecuteInner(QueryContext *query_context, MergeKnnOperato
                 u16 block_offset = segment_offset % DEFAULT_BLOCK_CAPACITY;
                 // LOG_TRACE(fmt::format("Row offset: {}: {}: {}, distance: {}", segment_id, block_id, block_offset, result_dists[top_idx]));
 
-                BlockEntry *block_entry = block_index->GetBlockEntry(segment_id, block_id);
-                if (block_entry == nullptr) {
+                BlockEntry *block_entry = nullptr;
+                const DataBlock *local_block = nullptr;
+                if (segment_id == TXN_LOCAL_SEGMENT_ID) {
+                    SizeT local_row_count{};
+                    local_block = block_index->GetLocalBlock(block_id, local_row_count);
+                } else {
+                    block_entry = block_index->GetBlockEntry(segment_id, block_id);
+                }
+                if (block_entry == nullptr and local_block == nullptr) {
                     UnrecoverableError(fmt::format("Cannot find block segment id: {}, block id: {}", segment_id, block_id));
                 }
 
@@ -139,6 +146,10 @@ void PhysicalMergeKnn::ExecuteInner(QueryContext *query_context, MergeKnnOperato
                 SizeT column_n = table_ref_->column_ids_.size();
                 for (SizeT i = 0; i < column_n; ++i) {
                     SizeT column_id = table_ref_->column_ids_[i];
+                    if (local_block != nullptr) {
+                        output_data_block->column_vectors[i]->AppendWith(*local_block->column_vectors[column_id], block_offset, 1);
+                        continue;
+                    }
                     ColumnVector &&column_vector = block_entry->GetColumnBlockEntry(column_id)->GetColumnVector(buffer_mgr);
                     output_data_block->column_vectors[i]->AppendWith(column_vector, block_offset, 1);
                 }
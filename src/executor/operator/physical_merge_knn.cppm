@@ -63,6 +63,12 @@ public:
 
     inline u64 knn_table_index() const { return knn_table_index_; }
 
+    // for InputLoad
+    // necessary because MergeKnn is the first operator in a pipeline
+    void FillingTableRefs(HashMap<SizeT, SharedPtr<BaseTableRef>> &table_refs) override {
+        table_refs.insert({table_ref_->table_index_, table_ref_});
+    }
+
 private:
     template <typename T, template <typename, typename> typename C>
     void ExecuteInner(QueryContext *query_context, MergeKnnOperatorState *operator_state);
@@ -104,6 +104,9 @@ bool PhysicalProject::Execute(QueryContext *, OperatorState *operator_state) {
                 //        blocks_column.emplace_back(output_data_block->column_vectors[expr_idx]);
                 evaluator.Execute(expressions_[expr_idx], expr_states[expr_idx], output_data_block->column_vectors[expr_idx]);
             }
+
+            // If the input comes from a filter which didn't compact its rows, the evaluator compacts the referenced columns
+            // before evaluating, so the expressions only run on the selected rows.
             output_data_block->Finalize();
         }
 
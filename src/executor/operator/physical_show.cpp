@@ -14,6 +14,7 @@
 
 module;
 
+#include <algorithm>
 #include <string>
 
 module physical_show;
@@ -57,6 +58,9 @@ import logical_type;
 import create_index_info;
 import column_index_entry;
 import segment_iter;
+import backgroud_process;
+import bg_task;
+import storage;
 
 namespace infinity {
 
@@ -219,6 +223,23 @@ void PhysicalShow::Init() {
             output_types_->emplace_back(varchar_type);
             break;
         }
+        case ShowType::kShowTasks: {
+            output_names_->reserve(5);
+            output_types_->reserve(5);
+
+            output_names_->emplace_back("task_id");
+            output_names_->emplace_back("task_class");
+            output_names_->emplace_back("task");
+            output_names_->emplace_back("status");
+            output_names_->emplace_back("elapsed_ms");
+
+            output_types_->emplace_back(bigint_type);
+            output_types_->emplace_back(varchar_type);
+            output_types_->emplace_back(varchar_type);
+            output_types_->emplace_back(varchar_type);
+            output_types_->emplace_back(bigint_type);
+            break;
+        }
         default: {
             RecoverableError(Status::NotSupport("Not implemented show type"));
         }
@@ -274,6 +295,10 @@ bool PhysicalShow::Execute(QueryContext *query_context, OperatorState *operator_
             ExecuteShowVar(query_context, show_operator_state);
             break;
         }
+        case ShowType::kShowTasks: {
+            ExecuteShowTasks(query_context, show_operator_state);
+            break;
+        }
         default: {
             UnrecoverableError("Invalid chunk scan type");
         }
@@ -1416,7 +1441,8 @@ void PhysicalShow::ExecuteShowIndexes(QueryContext *query_context, ShowOperatorS
                         other_parameters = fmt::format("analyzer = {}", index_full_text->analyzer_);
                         break;
                     }
-                    case IndexType::kSecondary: {
+                    case IndexType::kSecondary:
+                    case IndexType::kBSI: {
                         // there is no other_parameters
                         break;
                     }
@@ -1635,6 +1661,68 @@ void PhysicalShow::ExecuteShowGlobalStatus(QueryContext *query_context, ShowOper
     show_operator_state->output_.emplace_back(std::move(output_block_ptr));
 }
 
+void PhysicalShow::ExecuteShowTasks(QueryContext *query_context, ShowOperatorState *show_operator_state) {
+    SharedPtr<DataType> varchar_type = MakeShared<DataType>(LogicalType::kVarchar);
+    SharedPtr<DataType> bigint_type = MakeShared<DataType>(LogicalType::kBigInt);
+    Vector<SharedPtr<ColumnDef>> output_column_defs = {
+        MakeShared<ColumnDef>(0, bigint_type, "task_id", HashSet<ConstraintType>()),
+        MakeShared<ColumnDef>(1, varchar_type, "task_class", HashSet<ConstraintType>()),
+        MakeShared<ColumnDef>(2, varchar_type, "task", HashSet<ConstraintType>()),
+        MakeShared<ColumnDef>(3, varchar_type, "status", HashSet<ConstraintType>()),
+        MakeShared<ColumnDef>(4, bigint_type, "elapsed_ms", HashSet<ConstraintType>()),
+    };
+
+    SharedPtr<TableDef> table_def = TableDef::Make(MakeShared<String>("default"), MakeShared<String>("tasks"), output_column_defs);
+    output_ = MakeShared<DataTable>(table_def, TableType::kResult);
+
+    UniquePtr<DataBlock> output_block_ptr = DataBlock::MakeUniquePtr();
+    Vector<SharedPtr<DataType>> output_column_types{
+        bigint_type,
+        varchar_type,
+        varchar_type,
+        varchar_type,
+        bigint_type,
+    };
+
+    output_block_ptr->Init(output_column_types);
+
+    // running tasks first, then queued ones, in priority order
+    Vector<BGTaskInfo> task_infos = query_context->storage()->bg_processor()->ListTasks();
+    std::stable_sort(task_infos.begin(), task_infos.end(), [](const BGTaskInfo &left, const BGTaskInfo &right) {
+        return left.running_ > right.running_;
+    });
+    for (const auto &task_info : task_infos) {
+        {
+            Value value = Value::MakeBigInt(task_info.task_id_);
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[0]);
+        }
+        {
+            Value value = Value::MakeVarchar(BGTaskClassToString(task_info.task_class_));
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[1]);
+        }
+        {
+            Value value = Value::MakeVarchar(task_info.task_text_);
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[2]);
+        }
+        {
+            Value value = Value::MakeVarchar(task_info.running_ ? "running" : "queued");
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[3]);
+        }
+        {
+            Value value = Value::MakeBigInt(task_info.elapsed_ms_);
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[4]);
+        }
+    }
+
+    output_block_ptr->Finalize();
+    show_operator_state->output_.emplace_back(std::move(output_block_ptr));
+}
+
 void PhysicalShow::ExecuteShowVar(QueryContext *query_context, ShowOperatorState *show_operator_state) {
     SharedPtr<DataType> varchar_type = MakeShared<DataType>(LogicalType::kVarchar);
     Vector<SharedPtr<ColumnDef>> output_column_defs = {
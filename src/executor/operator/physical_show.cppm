@@ -96,6 +96,8 @@ private:
 
     void ExecuteShowVar(QueryContext *query_context, ShowOperatorState *operator_state);
 
+    void ExecuteShowTasks(QueryContext *query_context, ShowOperatorState *operator_state);
+
 private:
     ShowType scan_type_{ShowType::kInvalid};
     String db_name_{};
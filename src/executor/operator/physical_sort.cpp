@@ -37,6 +37,7 @@ import infinity_exception;
 import third_party;
 import status;
 import physical_top;
+import memory_tracker;
 
 namespace infinity {
 
@@ -170,6 +171,9 @@ bool PhysicalSort::Execute(QueryContext *, OperatorState *operator_state) {
     Vector<BlockRawIndex> block_indexes;
     auto pre_op_state = operator_state->prev_op_state_;
 
+    // the sorted copy of the blocks is charged by its column vectors, the row indexes here
+    TrackedMemory index_memory;
+    index_memory.Grow(pre_op_state->data_block_array_.size() * DEFAULT_BLOCK_CAPACITY * sizeof(BlockRawIndex));
     block_indexes.reserve(pre_op_state->data_block_array_.size() * DEFAULT_BLOCK_CAPACITY);
     // filling block_indexes
     for (u32 block_id = 0; block_id < pre_op_state->data_block_array_.size(); block_id++) {
@@ -198,6 +202,9 @@ bool PhysicalSort::Execute(QueryContext *, OperatorState *operator_state) {
     Vector<Vector<BlockRawIndex>> indexes_group;
 
     merge_comparator.Init();
+    index_memory.Reset();
+    // the runs and their merge result
+    index_memory.Grow(2 * unmerge_sorted_blocks.size() * DEFAULT_BLOCK_CAPACITY * sizeof(BlockRawIndex));
     indexes_group.reserve(unmerge_sorted_blocks.size());
 
     for (u32 block_id = 0; block_id < unmerge_sorted_blocks.size(); ++block_id) {
@@ -42,6 +42,12 @@ import infinity_exception;
 import logical_type;
 
 import block_entry;
+import block_column_entry;
+import zone_map;
+import value;
+import secondary_index_scan_middle_expression;
+import secondary_index_scan_execute_expression;
+import top_n_threshold;
 
 namespace infinity {
 
@@ -83,7 +89,7 @@ TableEntry *PhysicalTableScan::TableEntry() const { return base_table_ref_->tabl
 
 SizeT PhysicalTableScan::BlockEntryCount() const { return base_table_ref_->block_index_->BlockCount(); }
 
-SizeT PhysicalTableScan::TaskletCount() { return base_table_ref_->block_index_->BlockCount(); }
+SizeT PhysicalTableScan::TaskletCount() { return base_table_ref_->block_index_->BlockCount() + base_table_ref_->block_index_->LocalBlockCount(); }
 
 BlockIndex *PhysicalTableScan::GetBlockIndex() const { return base_table_ref_->block_index_.get(); }
 
@@ -100,7 +106,22 @@ Vector<SizeT> &PhysicalTableScan::ColumnIDs() const {
 Vector<SharedPtr<Vector<GlobalBlockID>>> PhysicalTableScan::PlanBlockEntries(i64 parallel_count) const {
     BlockIndex *block_index = base_table_ref_->block_index_.get();
 
-    u64 all_block_count = block_index->BlockCount();
+    Vector<GlobalBlockID> global_blocks;
+    global_blocks.reserve(block_index->BlockCount());
+    for (const auto &global_block_id : block_index->global_blocks_) {
+        if (zone_map_filter_.empty() or BlockMayMatch(block_index->GetBlockEntry(global_block_id.segment_id_, global_block_id.block_id_))) {
+            global_blocks.emplace_back(global_block_id);
+        }
+    }
+    if (SizeT skipped_count = block_index->BlockCount() - global_blocks.size(); skipped_count > 0) {
+        LOG_TRACE(fmt::format("TableScan: zone maps skip {} of {} blocks", skipped_count, block_index->BlockCount()));
+    }
+    // the uncommitted blocks of the transaction have no zone map
+    for (SizeT local_block_id = 0; local_block_id < block_index->LocalBlockCount(); ++local_block_id) {
+        global_blocks.emplace_back(GlobalBlockID{TXN_LOCAL_SEGMENT_ID, static_cast<u16>(local_block_id)});
+    }
+
+    u64 all_block_count = global_blocks.size();
     u64 block_per_task = all_block_count / parallel_count;
     u64 residual = all_block_count % parallel_count;
 
@@ -108,16 +129,97 @@ Vector<SharedPtr<Vector<GlobalBlockID>>> PhysicalTableScan::PlanBlockEntries(i64
     for (SizeT task_id = 0, global_block_id = 0, residual_idx = 0; (i64)task_id < parallel_count; ++task_id) {
         result[task_id] = MakeShared<Vector<GlobalBlockID>>();
         for (u64 block_id_in_task = 0; block_id_in_task < block_per_task; ++block_id_in_task) {
-            result[task_id]->emplace_back(block_index->global_blocks_[global_block_id++]);
+            result[task_id]->emplace_back(global_blocks[global_block_id++]);
         }
         if (residual_idx < residual) {
-            result[task_id]->emplace_back(block_index->global_blocks_[global_block_id++]);
+            result[task_id]->emplace_back(global_blocks[global_block_id++]);
             ++residual_idx;
         }
     }
     return result;
 }
 
+bool PhysicalTableScan::BlockMayMatch(const BlockEntry *block_entry) const {
+    SizeT block_row_count = block_entry->row_count();
+    Vector<bool> result_stack;
+    ColumnID column_id{};
+    const Value *value = nullptr;
+    for (const auto &elem : zone_map_filter_) {
+        std::visit(Overload{[&](ColumnID id) { column_id = id; },
+                            [&](const Value &val) { value = &val; },
+                            [&](FilterCompareType compare_type) {
+                                if (compare_type == FilterCompareType::kAlwaysFalse or compare_type == FilterCompareType::kAlwaysTrue) {
+                                    result_stack.push_back(compare_type == FilterCompareType::kAlwaysTrue);
+                                    return;
+                                }
+                                const BlockColumnEntry *column_entry = block_entry->GetColumnBlockEntry(column_id);
+                                ZoneMap zone_map = column_entry->GetZoneMap();
+                                // the zone map doesn't cover the block, e.g. the block was imported before a restart
+                                if (zone_map.row_count() < block_row_count) {
+                                    result_stack.push_back(true);
+                                    return;
+                                }
+                                switch (compare_type) {
+                                    case FilterCompareType::kEqual: {
+                                        result_stack.push_back(zone_map.MayContainEqual(*value));
+                                        break;
+                                    }
+                                    case FilterCompareType::kLessEqual: {
+                                        result_stack.push_back(zone_map.MayContainLessEqual(*value));
+                                        break;
+                                    }
+                                    case FilterCompareType::kGreaterEqual: {
+                                        result_stack.push_back(zone_map.MayContainGreaterEqual(*value));
+                                        break;
+                                    }
+                                    default: {
+                                        UnrecoverableError("PhysicalTableScan::BlockMayMatch(): compare type error.");
+                                    }
+                                }
+                            },
+                            [&](BooleanCombineType combine_type) {
+                                if (result_stack.size() < 2) {
+                                    UnrecoverableError("PhysicalTableScan::BlockMayMatch(): zone map filter error.");
+                                }
+                                bool right = result_stack.back();
+                                result_stack.pop_back();
+                                bool left = result_stack.back();
+                                result_stack.back() = combine_type == BooleanCombineType::kAnd ? left and right : left or right;
+                            }},
+                   elem);
+    }
+    if (result_stack.size() != 1) {
+        UnrecoverableError("PhysicalTableScan::BlockMayMatch(): zone map filter error.");
+    }
+    return result_stack.back();
+}
+
+bool PhysicalTableScan::BlockMayQualify(const BlockEntry *block_entry) const {
+    ZoneMap zone_map = block_entry->GetColumnBlockEntry(top_n_threshold_->column_id())->GetZoneMap();
+    if (zone_map.row_count() < block_entry->row_count()) {
+        return true;
+    }
+    return top_n_threshold_->MayQualify(zone_map);
+}
+
+void PhysicalTableScan::ReadLocalBlock(DataBlock *output,
+                                       const DataBlock *local_block,
+                                       u16 block_id,
+                                       SizeT read_offset,
+                                       SizeT read_size,
+                                       const Vector<SizeT> &column_ids) {
+    // local blocks hold all the columns of the table in order
+    SizeT output_column_id{0};
+    for (auto column_id : column_ids) {
+        if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+            u32 segment_offset = block_id * DEFAULT_BLOCK_CAPACITY + read_offset;
+            output->column_vectors[output_column_id++]->AppendWith(RowID(TXN_LOCAL_SEGMENT_ID, segment_offset), read_size);
+        } else {
+            output->column_vectors[output_column_id++]->AppendWith(*local_block->column_vectors[column_id], read_offset, read_size);
+        }
+    }
+}
+
 void PhysicalTableScan::ExecuteInternal(QueryContext *query_context, TableScanOperatorState *table_scan_operator_state) {
     if (!table_scan_operator_state->data_block_array_.empty()) {
         UnrecoverableError("Table scan output data block array should be empty");
@@ -137,6 +239,11 @@ void PhysicalTableScan::ExecuteInternal(QueryContext *query_context, TableScanOp
         table_scan_operator_state->SetComplete();
         return;
     }
+    if (limit_ > 0 and output_row_count_.load() >= limit_) {
+        // the other tasks have already output enough rows for the limit
+        table_scan_operator_state->SetComplete();
+        return;
+    }
 
     TxnTimeStamp begin_ts = query_context->GetTxn()->BeginTS();
     SizeT &read_offset = table_scan_function_data_ptr->current_read_offset_;
@@ -155,7 +262,30 @@ void PhysicalTableScan::ExecuteInternal(QueryContext *query_context, TableScanOp
         u32 segment_id = block_ids->at(block_ids_idx).segment_id_;
         u16 block_id = block_ids->at(block_ids_idx).block_id_;
 
+        if (segment_id == TXN_LOCAL_SEGMENT_ID) {
+            SizeT row_count{};
+            const DataBlock *local_block = block_index->GetLocalBlock(block_id, row_count);
+            if (read_offset == row_count) {
+                ++block_ids_idx;
+                read_offset = 0;
+                continue;
+            }
+            if (write_capacity == 0) {
+                break;
+            }
+            auto write_size = std::min(write_capacity, row_count - read_offset);
+            ReadLocalBlock(output_ptr, local_block, block_id, read_offset, write_size, column_ids);
+            write_capacity -= write_size;
+            read_offset += write_size;
+            continue;
+        }
+
         BlockEntry *current_block_entry = block_index->GetBlockEntry(segment_id, block_id);
+        if (read_offset == 0 and top_n_threshold_.get() != nullptr and !BlockMayQualify(current_block_entry)) {
+            LOG_TRACE(fmt::format("TableScan: top-n threshold skips block ({},{})", segment_id, block_id));
+            ++block_ids_idx;
+            continue;
+        }
         auto [row_begin, row_end] = current_block_entry->GetVisibleRange(begin_ts, read_offset);
         if (row_begin == row_end) {
             // we have read all data from current block, move to next block
@@ -163,6 +293,20 @@ void PhysicalTableScan::ExecuteInternal(QueryContext *query_context, TableScanOp
             read_offset = 0;
             continue;
         }
+        if (const Vector<BlockOffset> *local_deletes = block_index->GetLocalDeletes(segment_id, block_id); local_deletes != nullptr) {
+            // the rows deleted by the transaction itself end the visible range, the ones at its beginning are skipped
+            auto delete_it = std::lower_bound(local_deletes->begin(), local_deletes->end(), row_begin);
+            for (; delete_it != local_deletes->end() and *delete_it == row_begin and row_begin < row_end; ++delete_it) {
+                ++row_begin;
+            }
+            if (row_begin == row_end) {
+                read_offset = row_end;
+                continue;
+            }
+            if (delete_it != local_deletes->end() and *delete_it < row_end) {
+                row_end = *delete_it;
+            }
+        }
         if (write_capacity == 0) {
             // output is full
             break;
@@ -194,6 +338,10 @@ void PhysicalTableScan::ExecuteInternal(QueryContext *query_context, TableScanOp
     }
 
     output_ptr->Finalize();
+
+    if (limit_ > 0 and output_row_count_.fetch_add(output_ptr->row_count()) + output_ptr->row_count() >= limit_) {
+        table_scan_operator_state->SetComplete();
+    }
 }
 
 } // namespace infinity
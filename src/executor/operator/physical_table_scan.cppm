@@ -30,14 +30,23 @@ import block_index;
 import load_meta;
 import internal_types;
 import data_type;
+import secondary_index_scan_middle_expression;
+import top_n_threshold;
 
 namespace infinity {
 
+struct BlockEntry;
+class DataBlock;
+
 export class PhysicalTableScan : public PhysicalOperator {
 public:
-    explicit PhysicalTableScan(u64 id, SharedPtr<BaseTableRef> base_table_ref, SharedPtr<Vector<LoadMeta>> load_metas, bool add_row_id = false)
+    explicit PhysicalTableScan(u64 id,
+                               SharedPtr<BaseTableRef> base_table_ref,
+                               SharedPtr<Vector<LoadMeta>> load_metas,
+                               bool add_row_id = false,
+                               Vector<FilterEvaluatorElem> zone_map_filter = {})
         : PhysicalOperator(PhysicalOperatorType::kTableScan, nullptr, nullptr, id, load_metas), base_table_ref_(std::move(base_table_ref)),
-          add_row_id_(add_row_id) {}
+          add_row_id_(add_row_id), zone_map_filter_(std::move(zone_map_filter)) {}
 
     ~PhysicalTableScan() override = default;
 
@@ -65,6 +74,16 @@ public:
 
     Vector<SizeT> &ColumnIDs() const;
 
+    // ORDER BY ... LIMIT above the scan: skip the blocks which can't beat the k-th row found so far
+    inline void SetTopNThreshold(SharedPtr<TopNThreshold> top_n_threshold) { top_n_threshold_ = std::move(top_n_threshold); }
+
+    inline const SharedPtr<TopNThreshold> &top_n_threshold() const { return top_n_threshold_; }
+
+    // LIMIT right above the scan, without ORDER BY or filter: the tasks stop once they have output limit rows in total
+    inline void SetLimit(SizeT limit) { limit_ = limit; }
+
+    inline SizeT limit() const { return limit_; }
+
     bool ParallelExchange() const override { return true; }
 
     bool IsExchange() const override { return true; }
@@ -76,11 +95,30 @@ public:
 private:
     void ExecuteInternal(QueryContext *query_context, TableScanOperatorState *table_scan_operator_state);
 
+    // Rows [read_offset, read_offset + read_size) of a block the transaction appended but hasn't committed
+    static void ReadLocalBlock(DataBlock *output,
+                               const DataBlock *local_block,
+                               u16 block_id,
+                               SizeT read_offset,
+                               SizeT read_size,
+                               const Vector<SizeT> &column_ids);
+
+    // Whether the zone maps of the block can't rule out zone_map_filter_
+    bool BlockMayMatch(const BlockEntry *block_entry) const;
+
+    // Whether the zone map of the top-n key can't rule out that the block has one of the top rows
+    bool BlockMayQualify(const BlockEntry *block_entry) const;
+
 private:
     SharedPtr<BaseTableRef> base_table_ref_{};
 
     bool add_row_id_;
     mutable Vector<SizeT> column_ids_;
+    Vector<FilterEvaluatorElem> zone_map_filter_;
+
+    SharedPtr<TopNThreshold> top_n_threshold_{};
+    SizeT limit_{}; // 0: no limit
+    Atomic<SizeT> output_row_count_{};
 };
 
 } // namespace infinity
@@ -37,6 +37,7 @@ import third_party;
 import status;
 import logical_type;
 import internal_types;
+import top_n_threshold;
 
 namespace infinity {
 
@@ -55,6 +56,9 @@ public:
         return size_;
     }
 
+    // the last (k-th when the heap is full) row of the result, (input block id, row id)
+    Pair<u32, u32> LastResultRowID() const { return candidate_local_row_ids_[size_ - 1]; }
+
 private:
     u32 size_{};
     u32 limit_{};
@@ -345,6 +349,14 @@ bool PhysicalTop::Execute(QueryContext *, OperatorState *operator_state) {
     auto eval_columns = GetEvalColumns(sort_expressions_, (static_cast<TopOperatorState *>(operator_state))->expr_states_, input_data_block_array);
     TopSolver solve_top(limit_, prefer_left_function_);
     auto output_row_cnt = solve_top.WriteTopResultsToOutput(eval_columns, input_data_block_array, output_data_block_array);
+    if (top_n_threshold_.get() != nullptr and output_row_cnt == limit_) {
+        // limit_ rows are at least as good as this one, a row worse than it can't be in the final result
+        auto [block_id, row_id] = solve_top.LastResultRowID();
+        const auto &key_column = eval_columns[block_id][0];
+        if (key_column->nulls_ptr_->IsTrue(row_id)) {
+            top_n_threshold_->Update(key_column->GetValue(row_id));
+        }
+    }
     input_data_block_array.clear();
     HandleOutputOffset(output_row_cnt, offset_, output_data_block_array);
     if (prev_op_state->Complete()) {
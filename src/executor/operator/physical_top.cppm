@@ -35,6 +35,7 @@ import physical_limit;
 import internal_types;
 import select_statement;
 import data_type;
+import top_n_threshold;
 
 namespace infinity {
 
@@ -103,6 +104,9 @@ public:
     // for MergeTop
     inline auto const &GetInnerCompareFunction() const { return prefer_left_function_; }
 
+    // shared with the table scan below, see PhysicalPlanner::BuildTop
+    inline void SetTopNThreshold(SharedPtr<TopNThreshold> top_n_threshold) { top_n_threshold_ = std::move(top_n_threshold); }
+
     // for Top and MergeTop
     static void HandleOutputOffset(u32 total_row_cnt, u32 offset, Vector<UniquePtr<DataBlock>> &output_data_block_array);
 
@@ -122,7 +126,7 @@ private:
     Vector<OrderType> order_by_types_;                   // ASC or DESC
     Vector<SharedPtr<BaseExpression>> sort_expressions_; // expressions to sort
     CompareTwoRowAndPreferLeft prefer_left_function_;    // compare function
-    // TODO: save a common threshold value for all tasks
+    SharedPtr<TopNThreshold> top_n_threshold_;           // common threshold of all tasks, may be null
 };
 
 } // namespace infinity
@@ -34,6 +34,8 @@ import expression_state;
 import base_expression;
 import logical_type;
 import internal_types;
+import status;
+import infinity_exception;
 
 namespace infinity {
 
@@ -75,8 +77,10 @@ bool PhysicalUpdate::Execute(QueryContext *query_context, OperatorState *operato
 
             SharedPtr<DataBlock> output_data_block = DataBlock::Make();
             output_data_block->Init(column_vectors);
+            if (Status status = txn->Delete(db_name, *table_name, row_ids); !status.ok()) {
+                RecoverableError(status);
+            }
             txn->Append(db_name, *table_name, output_data_block);
-            txn->Delete(db_name, *table_name, row_ids);
 
             UpdateOperatorState* update_operator_state = static_cast<UpdateOperatorState*>(operator_state);
             ++ update_operator_state->count_;
@@ -121,6 +121,7 @@ export struct MergeKnnOperatorState : public OperatorState {
 // Filter
 export struct FilterOperatorState : public OperatorState {
     inline explicit FilterOperatorState() : OperatorState(PhysicalOperatorType::kFilter) {}
+    SharedPtr<ExpressionState> condition_state_{}; // reused by all the input blocks of the task
 };
 
 // IndexScan
@@ -247,6 +248,8 @@ export struct ImportOperatorState : public OperatorState {
 // Export
 export struct ExportOperatorState : public OperatorState {
     inline explicit ExportOperatorState() : OperatorState(PhysicalOperatorType::kExport) {}
+
+    UniquePtr<String> result_msg_{};
 };
 
 // Alter
@@ -350,14 +353,29 @@ export struct MatchOperatorState : public OperatorState {
 };
 
 // Fusion
+// A row found in the fusion inputs, with its rank (1-based, 0 if absent) and raw score in each input
+export struct FusionDoc {
+    RowID row_id_{};
+    Vector<u32> ranks_{};
+    Vector<float> scores_{};
+};
+
 export struct FusionOperatorState : public OperatorState {
     inline explicit FusionOperatorState() : OperatorState(PhysicalOperatorType::kFusion) {}
 
     // Fusion is the first op, no previous operator state.
     // This is to tell op that source is drained.
     bool input_complete_{false};
-    // This is to cache all input data before calculation.
+    // Fragment id of each input, in the order of the fusion children.
+    Vector<u64> input_fragment_ids_{};
+    // Input blocks by fragment id, kept to materialize the output rows.
     Map<u64, Vector<UniquePtr<DataBlock>>> input_data_blocks_{};
+
+    // Input blocks are read into docs_ as they arrive, the scores are fused once all inputs are complete.
+    Vector<SizeT> consumed_block_counts_{};
+    Vector<u32> input_row_counts_{};
+    HashMap<u64, SizeT> doc_map_{}; // RowID::ToUint64() to the index in docs_
+    Vector<FusionDoc> docs_{};
 };
 
 // Source
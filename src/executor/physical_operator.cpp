@@ -31,6 +31,8 @@ import block_entry;
 import block_column_entry;
 import logical_type;
 import internal_types;
+import data_block;
+import block_index;
 
 namespace infinity {
 
@@ -67,22 +69,53 @@ void PhysicalOperator::InputLoad(QueryContext *query_context, OperatorState *ope
         }
 
         auto row_column_id = input_block->column_count() - 1;
+        const auto *row_ids = reinterpret_cast<const RowID *>(input_block->column_vectors[row_column_id]->data());
+        // The columns of each block are loaded once for all its rows in the input block.
+        // Rows of a block come together after a scan, but e.g. after fusion or top they are scattered over the blocks.
+        // A loaded column vector pins its buffer, so only the recently used blocks are kept.
+        constexpr SizeT max_cached_blocks = 64;
+        HashMap<u64, Vector<ColumnVector>> block_columns;
 
         for (SizeT j = 0; j < row_count; ++j) {
             // If late materialization needs to be optional, then this needs to be modified
-            RowID row_id = input_block->GetValue(row_column_id, j).value_.row;
+            RowID row_id = row_ids[j];
             u32 segment_id = row_id.segment_id_;
             u32 segment_offset = row_id.segment_offset_;
             u16 block_id = segment_offset / DEFAULT_BLOCK_CAPACITY;
             u16 block_offset = segment_offset % DEFAULT_BLOCK_CAPACITY;
 
-            const BlockEntry *block_entry = table_ref->block_index_->GetBlockEntry(segment_id, block_id);
-            for (SizeT k = 0; k < load_column_count; ++k) {
-                auto binding = load_metas[k].binding_;
-                BlockColumnEntry *block_column_ptr = block_entry->GetColumnBlockEntry(binding.column_idx);
+            if (segment_id == TXN_LOCAL_SEGMENT_ID) {
+                SizeT local_row_count{};
+                const DataBlock *local_block = table_ref->block_index_->GetLocalBlock(block_id, local_row_count);
+                if (local_block == nullptr or block_offset >= local_row_count) {
+                    UnrecoverableError(fmt::format("Cannot find the uncommitted row: {}", row_id.ToString()));
+                }
+                for (SizeT k = 0; k < load_column_count; ++k) {
+                    const ColumnVector &local_column = *local_block->column_vectors[load_metas[k].binding_.column_idx];
+                    input_block->column_vectors[load_metas[k].index_]->AppendWith(local_column, block_offset, 1);
+                }
+                continue;
+            }
 
-                ColumnVector column_vector = block_column_ptr->GetColumnVector(query_context->storage()->buffer_manager());
-                input_block->column_vectors[load_metas[k].index_]->AppendWith(column_vector, block_offset, 1);
+            const u64 block_key = (u64(segment_id) << 16) | block_id;
+            if (block_columns.size() >= max_cached_blocks and !block_columns.contains(block_key)) {
+                block_columns.clear();
+            }
+            auto [iter, inserted] = block_columns.try_emplace(block_key);
+            Vector<ColumnVector> &column_vectors = iter->second;
+            if (inserted) {
+                const BlockEntry *block_entry = table_ref->block_index_->GetBlockEntry(segment_id, block_id);
+                if (block_entry == nullptr) {
+                    UnrecoverableError(fmt::format("Cannot find block segment id: {}, block id: {}", segment_id, block_id));
+                }
+                column_vectors.reserve(load_column_count);
+                for (SizeT k = 0; k < load_column_count; ++k) {
+                    BlockColumnEntry *block_column_ptr = block_entry->GetColumnBlockEntry(load_metas[k].binding_.column_idx);
+                    column_vectors.emplace_back(block_column_ptr->GetColumnVector(query_context->storage()->buffer_manager()));
+                }
+            }
+            for (SizeT k = 0; k < load_column_count; ++k) {
+                input_block->column_vectors[load_metas[k].index_]->AppendWith(column_vectors[k], block_offset, 1);
             }
         }
     }
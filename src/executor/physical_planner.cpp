@@ -125,9 +125,54 @@ import create_index_info;
 import command_statement;
 import explain_statement;
 import load_meta;
+import top_n_threshold;
+import zone_map;
+import reference_expression;
+import expression_type;
+import default_values;
+import base_expression;
+import select_statement;
 
 namespace infinity {
 
+namespace {
+
+bool HasLoadMeta(const PhysicalOperator *op) { return op->load_metas().get() != nullptr and !op->load_metas()->empty(); }
+
+// The table scan under op and some filters. The filters only drop rows, so the columns of op (except the lately
+// loaded ones) are still the columns output by the scan.
+PhysicalTableScan *TableScanUnderFilters(PhysicalOperator *op) {
+    while (op->operator_type() == PhysicalOperatorType::kFilter and !HasLoadMeta(op)) {
+        op = op->left();
+    }
+    if (op->operator_type() != PhysicalOperatorType::kTableScan) {
+        return nullptr;
+    }
+    return static_cast<PhysicalTableScan *>(op);
+}
+
+// Shares the k-th value of each top task with the table scan below, when the first sort key is a column of the scan
+// that zone maps are kept for.
+void PushDownTopN(PhysicalTop *top_op, const SharedPtr<BaseExpression> &first_sort_expression, OrderType order_type) {
+    if (HasLoadMeta(top_op) or first_sort_expression->type() != ExpressionType::kReference) {
+        return;
+    }
+    PhysicalTableScan *table_scan = TableScanUnderFilters(top_op->left());
+    if (table_scan == nullptr or !ZoneMap::Supported(first_sort_expression->Type())) {
+        return;
+    }
+    SizeT column_index = static_cast<ReferenceExpression *>(first_sort_expression.get())->column_index();
+    const Vector<SizeT> &column_ids = table_scan->ColumnIDs();
+    if (column_index >= column_ids.size() or column_ids[column_index] == COLUMN_IDENTIFIER_ROW_ID) {
+        return;
+    }
+    auto top_n_threshold = MakeShared<TopNThreshold>(column_ids[column_index], order_type);
+    top_op->SetTopNThreshold(top_n_threshold);
+    table_scan->SetTopNThreshold(std::move(top_n_threshold));
+}
+
+} // namespace
+
 UniquePtr<PhysicalOperator> PhysicalPlanner::BuildPhysicalOperator(const SharedPtr<LogicalNode> &logical_operator) const {
 
     UniquePtr<PhysicalOperator> result{nullptr};
@@ -663,6 +708,10 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildLimit(const SharedPtr<LogicalN
         if (logical_limit->offset_expression_.get() != nullptr) {
             child_limit += (static_pointer_cast<ValueExpression>(logical_limit->offset_expression_))->GetValue().value_.big_int;
         }
+        if (input_physical_operator->operator_type() == PhysicalOperatorType::kTableScan) {
+            // every row of the scan passes the limit, so the scan tasks can stop once they have output child_limit rows in total
+            static_cast<PhysicalTableScan *>(input_physical_operator.get())->SetLimit(child_limit);
+        }
         auto child_limit_op = MakeUnique<PhysicalLimit>(logical_operator->node_id(),
                                                         std::move(input_physical_operator),
                                                         MakeShared<ValueExpression>(Value::MakeBigInt(child_limit)),
@@ -719,6 +768,7 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildTop(const SharedPtr<LogicalNod
                                                     logical_operator_top->sort_expressions_,
                                                     logical_operator_top->order_by_types_,
                                                     logical_operator_top->load_metas());
+        PushDownTopN(child_top_op.get(), logical_operator_top->sort_expressions_[0], logical_operator_top->order_by_types_[0]);
         return MakeUnique<PhysicalMergeTop>(query_context_ptr_->GetNextNodeID(),
                                             logical_operator_top->base_table_ref_,
                                             std::move(child_top_op),
@@ -739,6 +789,10 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildProjection(const SharedPtr<Log
     UniquePtr<PhysicalOperator> input_physical_operator{};
     if (input_logical_node.get() != nullptr) {
         input_physical_operator = BuildPhysicalOperator(input_logical_node);
+        if (input_physical_operator->operator_type() == PhysicalOperatorType::kFilter) {
+            // projection evaluates on the rows selected by the filter, the filter needn't copy them
+            static_cast<PhysicalFilter *>(input_physical_operator.get())->SetLazySelection(true);
+        }
     }
     return MakeUnique<PhysicalProject>(logical_operator->node_id(),
                                        logical_project->table_index_,
@@ -795,7 +849,8 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildTableScan(const SharedPtr<Logi
     return MakeUnique<PhysicalTableScan>(logical_operator->node_id(),
                                          logical_table_scan->base_table_ref_,
                                          logical_operator->load_metas(),
-                                         logical_table_scan->add_row_id_);
+                                         logical_table_scan->add_row_id_,
+                                         std::move(logical_table_scan->zone_map_filter_));
 }
 
 UniquePtr<PhysicalOperator> PhysicalPlanner::BuildIndexScan(const SharedPtr<LogicalNode> &logical_operator) const {
@@ -856,6 +911,7 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildFusion(const SharedPtr<Logical
                                       std::move(left_phy),
                                       std::move(right_phy),
                                       logical_fusion->fusion_expr_,
+                                      logical_fusion->base_table_ref_,
                                       logical_operator->load_metas());
 }
 
@@ -912,10 +968,6 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildExplain(const SharedPtr<Logica
 
     UniquePtr<PhysicalExplain> explain_node{nullptr};
     switch (logical_explain->explain_type()) {
-        case ExplainType::kAnalyze: {
-            RecoverableError(Status::NotSupport("Not implement: Explain analyze"));
-            break;
-        }
         case ExplainType::kAst:
         case ExplainType::kUnOpt:
         case ExplainType::kOpt: {
@@ -936,6 +988,7 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildExplain(const SharedPtr<Logica
                                                        logical_operator->load_metas());
             break;
         }
+        case ExplainType::kAnalyze:
         case ExplainType::kFragment:
         case ExplainType::kPipeline: {
             explain_node = MakeUnique<PhysicalExplain>(logical_explain->node_id(),
@@ -0,0 +1,77 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+module top_n_threshold;
+
+import stl;
+import value;
+import zone_map;
+import select_statement;
+import internal_types;
+
+namespace infinity {
+
+bool TopNThreshold::Update(const Value &value) {
+    i64 int_key{};
+    double float_key{};
+    bool is_float{};
+    if (!ZoneMap::OrderKey(value, int_key, float_key, is_float)) {
+        return false;
+    }
+    std::unique_lock lock(mutex_);
+    if (threshold_.has_value()) {
+        if (is_float != is_float_) {
+            return false;
+        }
+        bool tighter = false;
+        if (order_type_ == OrderType::kAsc) {
+            tighter = is_float ? float_key < float_key_ : int_key < int_key_;
+        } else {
+            tighter = is_float ? float_key > float_key_ : int_key > int_key_;
+        }
+        if (!tighter) {
+            return false;
+        }
+    }
+    threshold_ = value;
+    is_float_ = is_float;
+    int_key_ = int_key;
+    float_key_ = float_key;
+    return true;
+}
+
+bool TopNThreshold::MayQualify(const ZoneMap &zone_map) const {
+    if (zone_map.null_count() > 0) {
+        return true;
+    }
+    std::unique_lock lock(mutex_);
+    if (!threshold_.has_value()) {
+        return true;
+    }
+    // rows equal to the threshold are kept, a tie may still be part of the result
+    if (order_type_ == OrderType::kAsc) {
+        return zone_map.MayContainLessEqual(*threshold_);
+    }
+    return zone_map.MayContainGreaterEqual(*threshold_);
+}
+
+Optional<Value> TopNThreshold::threshold() const {
+    std::unique_lock lock(mutex_);
+    return threshold_;
+}
+
+} // namespace infinity
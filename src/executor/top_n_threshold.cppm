@@ -0,0 +1,60 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+export module top_n_threshold;
+
+import stl;
+import value;
+import zone_map;
+import select_statement;
+import internal_types;
+
+namespace infinity {
+
+// The k-th value of the first sort key of ORDER BY ... LIMIT k, shared by the tasks of a top-n query.
+// Each PhysicalTop task offers the k-th row of its own result, so the threshold only gets tighter, and the
+// table scan below skips the blocks whose zone map shows no row can be better than it.
+export class TopNThreshold {
+public:
+    // column_id: the table column of the first sort key
+    TopNThreshold(ColumnID column_id, OrderType order_type) : column_id_(column_id), order_type_(order_type) {}
+
+    // Returns true if value is tighter than the current threshold and replaces it
+    bool Update(const Value &value);
+
+    // Whether some row of the block may still be among the top k rows.
+    // A block with null keys can't be skipped, since the nulls aren't ordered by the zone map.
+    bool MayQualify(const ZoneMap &zone_map) const;
+
+    inline ColumnID column_id() const { return column_id_; }
+
+    inline OrderType order_type() const { return order_type_; }
+
+    Optional<Value> threshold() const;
+
+private:
+    const ColumnID column_id_{};
+    const OrderType order_type_{};
+
+    mutable std::mutex mutex_{};
+    Optional<Value> threshold_{};
+    bool is_float_{};
+    i64 int_key_{};
+    double float_key_{};
+};
+
+} // namespace infinity
@@ -0,0 +1,155 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+#include <bit>
+
+export module aggregate_kernel;
+
+import stl;
+
+namespace infinity {
+
+// Whole-block kernels of the numeric aggregates.
+// valid_units is the null bitmask of the input: bit i % 64 of valid_units[i / 64] is set if row i isn't null, nullptr means no null.
+// Several independent accumulators break the dependency between adjacent rows, so that the loops are vectorized by the compiler
+// for the target instruction set (built with -march=native).
+
+constexpr SizeT KERNEL_LANES = 8;
+constexpr SizeT UNIT_BITS = 64;
+
+template <typename ResultType, typename ValueType>
+inline ResultType SumDense(const ValueType *__restrict input, SizeT count) {
+    ResultType acc[KERNEL_LANES]{};
+    SizeT idx = 0;
+    for (; idx + KERNEL_LANES <= count; idx += KERNEL_LANES) {
+        for (SizeT lane = 0; lane < KERNEL_LANES; ++lane) {
+            acc[lane] += input[idx + lane];
+        }
+    }
+    ResultType sum{};
+    for (SizeT lane = 0; lane < KERNEL_LANES; ++lane) {
+        sum += acc[lane];
+    }
+    for (; idx < count; ++idx) {
+        sum += input[idx];
+    }
+    return sum;
+}
+
+template <typename ValueType, bool is_min>
+inline ValueType ExtremeDense(const ValueType *__restrict input, SizeT count, ValueType init) {
+    ValueType acc[KERNEL_LANES];
+    for (SizeT lane = 0; lane < KERNEL_LANES; ++lane) {
+        acc[lane] = init;
+    }
+    SizeT idx = 0;
+    for (; idx + KERNEL_LANES <= count; idx += KERNEL_LANES) {
+        for (SizeT lane = 0; lane < KERNEL_LANES; ++lane) {
+            const ValueType value = input[idx + lane];
+            if constexpr (is_min) {
+                acc[lane] = value < acc[lane] ? value : acc[lane];
+            } else {
+                acc[lane] = value > acc[lane] ? value : acc[lane];
+            }
+        }
+    }
+    ValueType result = init;
+    for (SizeT lane = 0; lane < KERNEL_LANES; ++lane) {
+        if constexpr (is_min) {
+            result = acc[lane] < result ? acc[lane] : result;
+        } else {
+            result = acc[lane] > result ? acc[lane] : result;
+        }
+    }
+    for (; idx < count; ++idx) {
+        if constexpr (is_min) {
+            result = input[idx] < result ? input[idx] : result;
+        } else {
+            result = input[idx] > result ? input[idx] : result;
+        }
+    }
+    return result;
+}
+
+// count of the rows which aren't null
+export inline SizeT CountValidKernel(const u64 *__restrict valid_units, SizeT count) {
+    if (valid_units == nullptr) {
+        return count;
+    }
+    SizeT valid_count = 0;
+    const SizeT full_units = count / UNIT_BITS;
+    for (SizeT unit_idx = 0; unit_idx < full_units; ++unit_idx) {
+        valid_count += std::popcount(valid_units[unit_idx]);
+    }
+    if (const SizeT tail = count % UNIT_BITS; tail != 0) {
+        valid_count += std::popcount(valid_units[full_units] & ((u64(1) << tail) - 1));
+    }
+    return valid_count;
+}
+
+// sum of the rows which aren't null
+export template <typename ResultType, typename ValueType>
+ResultType SumKernel(const ValueType *__restrict input, const u64 *__restrict valid_units, SizeT count) {
+    if (valid_units == nullptr) {
+        return SumDense<ResultType>(input, count);
+    }
+    ResultType sum{};
+    for (SizeT begin = 0, unit_idx = 0; begin < count; begin += UNIT_BITS, ++unit_idx) {
+        const SizeT unit_count = std::min(UNIT_BITS, count - begin);
+        const u64 unit = valid_units[unit_idx];
+        if (unit == std::numeric_limits<u64>::max()) {
+            sum += SumDense<ResultType>(input + begin, unit_count);
+        } else if (unit != 0) {
+            // null rows are added as zero instead of branching on each row
+            ResultType unit_sum{};
+            for (SizeT idx = 0; idx < unit_count; ++idx) {
+                unit_sum += ((unit >> idx) & 1) ? ResultType(input[begin + idx]) : ResultType{};
+            }
+            sum += unit_sum;
+        }
+    }
+    return sum;
+}
+
+// min / max of init and the rows which aren't null
+export template <typename ValueType, bool is_min>
+ValueType ExtremeKernel(const ValueType *__restrict input, const u64 *__restrict valid_units, SizeT count, ValueType init) {
+    if (valid_units == nullptr) {
+        return ExtremeDense<ValueType, is_min>(input, count, init);
+    }
+    ValueType result = init;
+    for (SizeT begin = 0, unit_idx = 0; begin < count; begin += UNIT_BITS, ++unit_idx) {
+        const SizeT unit_count = std::min(UNIT_BITS, count - begin);
+        const u64 unit = valid_units[unit_idx];
+        if (unit == std::numeric_limits<u64>::max()) {
+            result = ExtremeDense<ValueType, is_min>(input + begin, unit_count, result);
+        } else if (unit != 0) {
+            // null rows are replaced by the current result, which doesn't change it
+            for (SizeT idx = 0; idx < unit_count; ++idx) {
+                const ValueType value = ((unit >> idx) & 1) ? input[begin + idx] : result;
+                if constexpr (is_min) {
+                    result = value < result ? value : result;
+                } else {
+                    result = value > result ? value : result;
+                }
+            }
+        }
+    }
+    return result;
+}
+
+} // namespace infinity
@@ -22,6 +22,7 @@ import status;
 import infinity_exception;
 import aggregate_function;
 import aggregate_function_set;
+import aggregate_kernel;
 
 import third_party;
 import logical_type;
@@ -71,6 +72,11 @@ public:
         value_ += (input[idx] * count);
     }
 
+    inline void BlockUpdate(const TinyIntT *__restrict input, const u64 *__restrict valid_units, SizeT count) {
+        value_ += SumKernel<i64>(input, valid_units, count);
+        count_ += CountValidKernel(valid_units, count);
+    }
+
     [[nodiscard]] inline ptr_t Finalize() {
         result_ = value_ / count_;
         return (ptr_t)&result_;
@@ -105,6 +111,11 @@ public:
         value_ += (input[idx] * count);
     }
 
+    inline void BlockUpdate(const SmallIntT *__restrict input, const u64 *__restrict valid_units, SizeT count) {
+        value_ += SumKernel<i64>(input, valid_units, count);
+        count_ += CountValidKernel(valid_units, count);
+    }
+
     inline ptr_t Finalize() {
         result_ = value_ / count_;
         return (ptr_t)&result_;
@@ -139,6 +150,11 @@ public:
         value_ += (input[idx] * count);
     }
 
+    inline void BlockUpdate(const IntegerT *__restrict input, const u64 *__restrict valid_units, SizeT count) {
+        value_ += SumKernel<i64>(input, valid_units, count);
+        count_ += CountValidKernel(valid_units, count);
+    }
+
     inline ptr_t Finalize() {
         result_ = value_ / count_;
         return (ptr_t)&result_;
@@ -173,6 +189,11 @@ public:
         value_ += (input[idx] * count);
     }
 
+    inline void BlockUpdate(const BigIntT *__restrict input, const u64 *__restrict valid_units, SizeT count) {
+        value_ += SumKernel<i64>(input, valid_units, count);
+        count_ += CountValidKernel(valid_units, count);
+    }
+
     inline ptr_t Finalize() {
         result_ = value_ / count_;
         return (ptr_t)&result_;
@@ -207,6 +228,11 @@ public:
         value_ += (input[idx] * count);
     }
 
+    inline void BlockUpdate(const FloatT *__restrict input, const u64 *__restrict valid_units, SizeT count) {
+        value_ += SumKernel<DoubleT>(input, valid_units, count);
+        count_ += CountValidKernel(valid_units, count);
+    }
+
     inline ptr_t Finalize() {
         result_ = value_ / count_;
         return (ptr_t)&result_;
@@ -241,6 +267,11 @@ public:
         value_ += (input[idx] * count);
     }
 
+    inline void BlockUpdate(const DoubleT *__restrict input, const u64 *__restrict valid_units, SizeT count) {
+        value_ += SumKernel<DoubleT>(input, valid_units, count);
+        count_ += CountValidKernel(valid_units, count);
+    }
+
     inline ptr_t Finalize() {
         result_ = value_ / count_;
         return (ptr_t)&result_;
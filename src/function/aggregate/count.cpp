@@ -22,6 +22,7 @@ import logical_type;
 import infinity_exception;
 import aggregate_function;
 import aggregate_function_set;
+import aggregate_kernel;
 
 import third_party;
 import internal_types;
@@ -40,6 +41,8 @@ public:
 
     inline void ConstantUpdate(ValueType *__restrict, SizeT, SizeT count) { count_ += count; }
 
+    inline void BlockUpdate(const ValueType *__restrict, const u64 *__restrict valid_units, SizeT count) { count_ += CountValidKernel(valid_units, count); }
+
     inline ptr_t Finalize() { return (ptr_t)&count_; }
 
     inline static SizeT Size(const DataType &) { return sizeof(i64); }
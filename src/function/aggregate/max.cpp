@@ -22,6 +22,7 @@ import status;
 import infinity_exception;
 import aggregate_function;
 import aggregate_function_set;
+import aggregate_kernel;
 
 import third_party;
 import logical_type;
@@ -73,6 +74,10 @@ public:
 
     inline void ConstantUpdate(const TinyIntT *__restrict input, SizeT idx, SizeT) { value_ = value_ < input[idx] ? input[idx] : value_; }
 
+    inline void BlockUpdate(const TinyIntT *__restrict input, const u64 *__restrict valid_units, SizeT count) {
+        value_ = ExtremeKernel<TinyIntT, false>(input, valid_units, count, value_);
+    }
+
     inline ptr_t Finalize() { return (ptr_t)&value_; }
 
     inline static SizeT Size(const DataType &) { return sizeof(TinyIntT); }
@@ -89,6 +94,10 @@ public:
 
     inline void ConstantUpdate(const SmallIntT *__restrict input, SizeT idx, SizeT) { value_ = value_ < input[idx] ? input[idx] : value_; }
 
+    inline void BlockUpdate(const SmallIntT *__restrict input, const u64 *__restrict valid_units, SizeT count) {
+        value_ = ExtremeKernel<SmallIntT, false>(input, valid_units, count, value_);
+    }
+
     inline ptr_t Finalize() { return (ptr_t)&value_; }
 
     inline static SizeT Size(const DataType &) { return sizeof(SmallIntT); }
@@ -105,6 +114,10 @@ public:
 
     inline void ConstantUpdate(const IntegerT *__restrict input, SizeT idx, SizeT) { value_ = value_ < input[idx] ? input[idx] : value_; }
 
+    inline void BlockUpdate(const IntegerT *__restrict input, const u64 *__restrict valid_units, SizeT count) {
+        value_ = ExtremeKernel<IntegerT, false>(input, valid_units, count, value_);
+    }
+
     inline ptr_t Finalize() { return (ptr_t)&value_; }
 
     inline static SizeT Size(const DataType &) { return sizeof(IntegerT); }
@@ -121,6 +134,10 @@ public:
 
     inline void ConstantUpdate(const BigIntT *__restrict input, SizeT idx, SizeT) { value_ = value_ < input[idx] ? input[idx] : value_; }
 
+    inline void BlockUpdate(const BigIntT *__restrict input, const u64 *__restrict valid_units, SizeT count) {
+        value_ = ExtremeKernel<BigIntT, false>(input, valid_units, count, value_);
+    }
+
     inline ptr_t Finalize() { return (ptr_t)&value_; }
 
     inline static SizeT Size(const DataType &) { return sizeof(BigIntT); }
@@ -150,12 +167,16 @@ struct MaxState<FloatT, FloatT> {
 public:
     FloatT value_;
 
-    void Initialize() { this->value_ = std::numeric_limits<f32>::min(); }
+    void Initialize() { this->value_ = std::numeric_limits<f32>::lowest(); }
 
     void Update(const FloatT *__restrict input, SizeT idx) { value_ = value_ < input[idx] ? input[idx] : value_; }
 
     inline void ConstantUpdate(const FloatT *__restrict input, SizeT idx, SizeT) { value_ = value_ < input[idx] ? input[idx] : value_; }
 
+    inline void BlockUpdate(const FloatT *__restrict input, const u64 *__restrict valid_units, SizeT count) {
+        value_ = ExtremeKernel<FloatT, false>(input, valid_units, count, value_);
+    }
+
     inline ptr_t Finalize() { return (ptr_t)&value_; }
 
     inline static SizeT Size(const DataType &) { return sizeof(FloatT); }
@@ -166,12 +187,16 @@ struct MaxState<DoubleT, DoubleT> {
 public:
     DoubleT value_;
 
-    void Initialize() { this->value_ = std::numeric_limits<f64>::min(); }
+    void Initialize() { this->value_ = std::numeric_limits<f64>::lowest(); }
 
     void Update(const DoubleT *__restrict input, SizeT idx) { value_ = value_ < input[idx] ? input[idx] : value_; }
 
     inline void ConstantUpdate(const DoubleT *__restrict input, SizeT idx, SizeT) { value_ = value_ < input[idx] ? input[idx] : value_; }
 
+    inline void BlockUpdate(const DoubleT *__restrict input, const u64 *__restrict valid_units, SizeT count) {
+        value_ = ExtremeKernel<DoubleT, false>(input, valid_units, count, value_);
+    }
+
     inline ptr_t Finalize() { return (ptr_t)&value_; }
 
     inline static SizeT Size(const DataType &) { return sizeof(DoubleT); }
@@ -22,6 +22,7 @@ import logical_type;
 import infinity_exception;
 import aggregate_function;
 import aggregate_function_set;
+import aggregate_kernel;
 
 import third_party;
 import status;
@@ -73,6 +74,10 @@ public:
 
     inline void ConstantUpdate(const TinyIntT *__restrict input, SizeT idx, SizeT) { value_ = input[idx] < value_ ? input[idx] : value_; }
 
+    inline void BlockUpdate(const TinyIntT *__restrict input, const u64 *__restrict valid_units, SizeT count) {
+        value_ = ExtremeKernel<TinyIntT, true>(input, valid_units, count, value_);
+    }
+
     inline ptr_t Finalize() { return (ptr_t)&value_; }
 
     inline static SizeT Size(const DataType &) { return sizeof(TinyIntT); }
@@ -89,6 +94,10 @@ public:
 
     inline void ConstantUpdate(const SmallIntT *__restrict input, SizeT idx, SizeT ) { value_ = input[idx] < value_ ? input[idx] : value_; }
 
+    inline void BlockUpdate(const SmallIntT *__restrict input, const u64 *__restrict valid_units, SizeT count) {
+        value_ = ExtremeKernel<SmallIntT, true>(input, valid_units, count, value_);
+    }
+
     inline ptr_t Finalize() { return (ptr_t)&value_; }
 
     inline static SizeT Size(const DataType &) { return sizeof(SmallIntT); }
@@ -105,6 +114,10 @@ public:
 
     inline void ConstantUpdate(const IntegerT *__restrict input, SizeT idx, SizeT) { value_ = input[idx] < value_ ? input[idx] : value_; }
 
+    inline void BlockUpdate(const IntegerT *__restrict input, const u64 *__restrict valid_units, SizeT count) {
+        value_ = ExtremeKernel<IntegerT, true>(input, valid_units, count, value_);
+    }
+
     inline ptr_t Finalize() { return (ptr_t)&value_; }
 
     inline static SizeT Size(const DataType &) { return sizeof(IntegerT); }
@@ -121,6 +134,10 @@ public:
 
     inline void ConstantUpdate(const BigIntT *__restrict input, SizeT idx, SizeT) { value_ = input[idx] < value_ ? input[idx] : value_; }
 
+    inline void BlockUpdate(const BigIntT *__restrict input, const u64 *__restrict valid_units, SizeT count) {
+        value_ = ExtremeKernel<BigIntT, true>(input, valid_units, count, value_);
+    }
+
     inline ptr_t Finalize() { return (ptr_t)&value_; }
 
     inline static SizeT Size(const DataType &) { return sizeof(BigIntT); }
@@ -156,6 +173,10 @@ public:
 
     inline void ConstantUpdate(const FloatT *__restrict input, SizeT idx, SizeT) { value_ = input[idx] < value_ ? input[idx] : value_; }
 
+    inline void BlockUpdate(const FloatT *__restrict input, const u64 *__restrict valid_units, SizeT count) {
+        value_ = ExtremeKernel<FloatT, true>(input, valid_units, count, value_);
+    }
+
     inline ptr_t Finalize() { return (ptr_t)&value_; }
 
     inline static SizeT Size(const DataType &) { return sizeof(FloatT); }
@@ -172,6 +193,10 @@ public:
 
     inline void ConstantUpdate(const DoubleT *__restrict input, SizeT idx, SizeT) { value_ = input[idx] < value_ ? input[idx] : value_; }
 
+    inline void BlockUpdate(const DoubleT *__restrict input, const u64 *__restrict valid_units, SizeT count) {
+        value_ = ExtremeKernel<DoubleT, true>(input, valid_units, count, value_);
+    }
+
     inline ptr_t Finalize() { return (ptr_t)&value_; }
 
     inline static SizeT Size(const DataType &) { return sizeof(DoubleT); }
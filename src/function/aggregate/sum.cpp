@@ -22,6 +22,7 @@ import status;
 import infinity_exception;
 import aggregate_function;
 import aggregate_function_set;
+import aggregate_kernel;
 
 import third_party;
 import logical_type;
@@ -55,6 +56,10 @@ public:
 
     inline void ConstantUpdate(const TinyIntT *__restrict input, SizeT idx, SizeT count) { sum_ += input[idx] * count; }
 
+    inline void BlockUpdate(const TinyIntT *__restrict input, const u64 *__restrict valid_units, SizeT count) {
+        sum_ += SumKernel<i64>(input, valid_units, count);
+    }
+
     inline ptr_t Finalize() { return (ptr_t)&sum_; }
 
     inline static SizeT Size(const DataType &) { return sizeof(i64); }
@@ -71,6 +76,10 @@ public:
 
     inline void ConstantUpdate(const SmallIntT *__restrict input, SizeT idx, SizeT count) { sum_ += input[idx] * count; }
 
+    inline void BlockUpdate(const SmallIntT *__restrict input, const u64 *__restrict valid_units, SizeT count) {
+        sum_ += SumKernel<i64>(input, valid_units, count);
+    }
+
     inline ptr_t Finalize() { return (ptr_t)&sum_; }
 
     inline static SizeT Size(const DataType &) { return sizeof(i64); }
@@ -87,6 +96,10 @@ public:
 
     inline void ConstantUpdate(const IntegerT *__restrict input, SizeT idx, SizeT count) { sum_ += input[idx] * count; }
 
+    inline void BlockUpdate(const IntegerT *__restrict input, const u64 *__restrict valid_units, SizeT count) {
+        sum_ += SumKernel<i64>(input, valid_units, count);
+    }
+
     inline ptr_t Finalize() { return (ptr_t)&sum_; }
 
     inline static SizeT Size(const DataType &) { return sizeof(i64); }
@@ -103,6 +116,10 @@ public:
 
     inline void ConstantUpdate(const BigIntT *__restrict input, SizeT idx, SizeT count) { sum_ += input[idx] * count; }
 
+    inline void BlockUpdate(const BigIntT *__restrict input, const u64 *__restrict valid_units, SizeT count) {
+        sum_ += SumKernel<i64>(input, valid_units, count);
+    }
+
     inline ptr_t Finalize() { return (ptr_t)&sum_; }
 
     inline static SizeT Size(const DataType &) { return sizeof(i64); }
@@ -119,6 +136,10 @@ public:
 
     inline void ConstantUpdate(const FloatT *__restrict input, SizeT idx, SizeT count) { sum_ += input[idx] * count; }
 
+    inline void BlockUpdate(const FloatT *__restrict input, const u64 *__restrict valid_units, SizeT count) {
+        sum_ += SumKernel<DoubleT>(input, valid_units, count);
+    }
+
     inline ptr_t Finalize() { return (ptr_t)&sum_; }
 
     inline static SizeT Size(const DataType &) { return sizeof(DoubleT); }
@@ -135,6 +156,10 @@ public:
 
     inline void ConstantUpdate(const DoubleT *__restrict input, SizeT idx, SizeT count) { sum_ += input[idx] * count; }
 
+    inline void BlockUpdate(const DoubleT *__restrict input, const u64 *__restrict valid_units, SizeT count) {
+        sum_ += SumKernel<DoubleT>(input, valid_units, count);
+    }
+
     inline ptr_t Finalize() { return (ptr_t)&sum_; }
 
     inline static SizeT Size(const DataType &) { return sizeof(DoubleT); }
@@ -23,6 +23,7 @@ import function;
 import function_data;
 import column_vector;
 import vector_buffer;
+import bitmask;
 import infinity_exception;
 import base_expression;
 import data_type;
@@ -65,8 +66,17 @@ public:
             case ColumnVectorType::kFlat: {
                 SizeT row_count = input_column_vector->Size();
                 auto *input_ptr = (InputType *)(input_column_vector->data());
-                for (SizeT idx = 0; idx < row_count; ++idx) {
-                    ((AggregateState *)state)->Update(input_ptr, idx);
+                if constexpr (requires(AggregateState &agg_state, const InputType *input, const u64 *valid_units, SizeT count) {
+                                  agg_state.BlockUpdate(input, valid_units, count);
+                              }) {
+                    // the state consumes the whole block, null rows are skipped
+                    const Bitmask &nulls = *(input_column_vector->nulls_ptr_);
+                    const u64 *valid_units = nulls.IsAllTrue() ? nullptr : nulls.GetData();
+                    ((AggregateState *)state)->BlockUpdate(input_ptr, valid_units, row_count);
+                } else {
+                    for (SizeT idx = 0; idx < row_count; ++idx) {
+                        ((AggregateState *)state)->Update(input_ptr, idx);
+                    }
                 }
                 break;
             }
@@ -105,6 +105,8 @@ void BuiltinFunctions::RegisterScalarFunction() {
     // like function
     RegisterLikeFunction(catalog_ptr_);
     RegisterNotLikeFunction(catalog_ptr_);
+    RegisterILikeFunction(catalog_ptr_);
+    RegisterNotILikeFunction(catalog_ptr_);
 
     // extract function
     RegisterExtractFunction(catalog_ptr_);
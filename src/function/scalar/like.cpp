@@ -14,6 +14,8 @@
 
 module;
 
+#include <cstring>
+
 module like;
 
 import stl;
@@ -22,6 +24,11 @@ import logical_type;
 import infinity_exception;
 import scalar_function;
 import scalar_function_set;
+import column_vector;
+import data_block;
+import binary_operator;
+import bitmask;
+import fix_heap;
 
 import third_party;
 import internal_types;
@@ -29,114 +36,241 @@ import data_type;
 
 namespace infinity {
 
-bool LikeOperator(const ptr_t left_ptr, SizeT left_len, const ptr_t right_ptr, SizeT right_len) {
-    SizeT left_idx{0}, right_idx{0};
-
-    while (right_idx < right_len) {
-        char left_char = left_ptr[left_idx];
-        char right_char = right_ptr[right_idx];
-        if (right_char == '_' or (left_char == right_char)) {
-            ++left_idx;
-            ++right_idx;
-        } else if (right_char == '%') {
-            ++right_idx;
-
-            // If there are more than one %
-            while (right_idx < right_len && right_ptr[right_idx] == '%') {
-                ++right_idx;
-            }
+namespace {
 
-            // % is the last character
-            if (right_idx == right_len) {
-                return true;
-            }
+inline char FoldChar(char c) { return (c >= 'A' and c <= 'Z') ? c - 'A' + 'a' : c; }
+
+} // namespace
 
-            // Check any left part is matched with rest of right part.
-            while (left_idx < left_len) {
-                if (LikeOperator(&left_ptr[left_idx], left_len - left_idx, &right_ptr[right_idx], right_len - right_idx)) {
-                    return true;
-                }
-                ++left_idx;
+LikeMatcher::LikeMatcher(const String &pattern, bool ignore_case) : ignore_case_(ignore_case) {
+    String folded_pattern = pattern;
+    if (ignore_case_) {
+        for (auto &c : folded_pattern) {
+            c = FoldChar(c);
+        }
+    }
+    has_percent_ = folded_pattern.find('%') != String::npos;
+    anchored_begin_ = folded_pattern.empty() or folded_pattern.front() != '%';
+    anchored_end_ = folded_pattern.empty() or folded_pattern.back() != '%';
+    SizeT begin = 0;
+    while (begin <= folded_pattern.size()) {
+        SizeT end = folded_pattern.find('%', begin);
+        if (end == String::npos) {
+            end = folded_pattern.size();
+        }
+        // consecutive '%' leave empty segments, they match anything
+        if (end > begin or !has_percent_) {
+            Segment segment;
+            segment.text_ = folded_pattern.substr(begin, end - begin);
+            segment.first_fixed_ = segment.text_.find_first_not_of('_');
+            if (segment.first_fixed_ == String::npos) {
+                segment.first_fixed_ = segment.text_.size();
             }
+            segment.has_wildcard_ = segment.text_.find('_') != String::npos;
+            min_length_ += segment.text_.size();
+            segments_.push_back(std::move(segment));
+        }
+        begin = end + 1;
+    }
+}
 
-            // Not matched
-            return false;
-        } else {
+bool LikeMatcher::MatchSegmentAt(const Segment &segment, const char *data) const {
+    const char *text = segment.text_.data();
+    const SizeT size = segment.text_.size();
+    if (!segment.has_wildcard_) {
+        return std::memcmp(data, text, size) == 0;
+    }
+    for (SizeT i = 0; i < size; ++i) {
+        if (text[i] != '_' and text[i] != data[i]) {
             return false;
         }
     }
+    return true;
+}
 
-    while (right_idx < right_len && right_ptr[right_idx] == '%') {
-        ++right_idx;
+const char *LikeMatcher::FindSegment(const Segment &segment, const char *begin, const char *end) const {
+    const SizeT size = segment.text_.size();
+    if (static_cast<SizeT>(end - begin) < size) {
+        return nullptr;
+    }
+    if (!segment.has_wildcard_) {
+        return static_cast<const char *>(::memmem(begin, end - begin, segment.text_.data(), size));
+    }
+    const SizeT fixed = segment.first_fixed_;
+    if (fixed == size) {
+        return begin;
     }
+    // look for the first fixed char with memchr, then verify the whole segment from there
+    const char fixed_char = segment.text_[fixed];
+    const char *last_start = end - size;
+    for (const char *start = begin; start <= last_start;) {
+        const auto *hit = static_cast<const char *>(std::memchr(start + fixed, fixed_char, last_start - start + 1));
+        if (hit == nullptr) {
+            return nullptr;
+        }
+        start = hit - fixed;
+        if (MatchSegmentAt(segment, start)) {
+            return start;
+        }
+        ++start;
+    }
+    return nullptr;
+}
 
-    return left_idx == left_len && right_idx == right_len;
+bool LikeMatcher::Match(const char *data, SizeT len) const {
+    if (len < min_length_) {
+        return false;
+    }
+    if (!has_percent_ and len != min_length_) {
+        return false;
+    }
+    if (ignore_case_) {
+        folded_.resize(len);
+        for (SizeT i = 0; i < len; ++i) {
+            folded_[i] = FoldChar(data[i]);
+        }
+        data = folded_.data();
+    }
+    if (!has_percent_) {
+        // no '%': the single segment has to match the whole string
+        return MatchSegmentAt(segments_[0], data);
+    }
+    const char *begin = data;
+    const char *end = data + len;
+    SizeT first = 0;
+    SizeT last = segments_.size();
+    // len >= min_length_, so the anchored head and tail don't overlap
+    if (anchored_begin_) {
+        const Segment &head = segments_[first++];
+        if (!MatchSegmentAt(head, begin)) {
+            return false;
+        }
+        begin += head.text_.size();
+    }
+    if (anchored_end_ and last > first) {
+        const Segment &tail = segments_[--last];
+        end -= tail.text_.size();
+        if (!MatchSegmentAt(tail, end)) {
+            return false;
+        }
+    }
+    for (SizeT i = first; i < last; ++i) {
+        const char *hit = FindSegment(segments_[i], begin, end);
+        if (hit == nullptr) {
+            return false;
+        }
+        begin = hit + segments_[i].text_.size();
+    }
+    return true;
 }
 
-struct LikeFunction {
-    template <typename TA, typename TB, typename TC>
-    static inline void Run(TA, TB, TC &) {
-        UnrecoverableError("Not implement: LikeFunction");
+bool LikeMatcher::MayMatch(const char *prefix, SizeT prefix_len, SizeT len) const {
+    if (len < min_length_ or (!has_percent_ and len != min_length_)) {
+        return false;
     }
-};
+    if (!anchored_begin_ or segments_.empty()) {
+        return true;
+    }
+    const String &head = segments_[0].text_;
+    const SizeT check_len = std::min(prefix_len, head.size());
+    for (SizeT i = 0; i < check_len; ++i) {
+        const char c = ignore_case_ ? FoldChar(prefix[i]) : prefix[i];
+        if (head[i] != '_' and head[i] != c) {
+            return false;
+        }
+    }
+    return true;
+}
 
-template <>
-inline void LikeFunction::Run(VarcharT &, VarcharT &, bool &) {
-    UnrecoverableError("Not implement: varchar like varchar");
+// Matchers of the patterns met in one call of the function, the pattern is almost always a constant,
+// so it is compiled once for the whole block.
+class LikeState {
+public:
+    explicit LikeState(bool ignore_case) : ignore_case_(ignore_case) {}
 
-//    ptr_t left_ptr = left.GetDataPtr();
-//    SizeT left_len = left.GetDataLen();
-//    ptr_t right_ptr = right.GetDataPtr();
-//    SizeT right_len = right.GetDataLen();
+    const LikeMatcher &GetMatcher(const VarcharT &pattern, FixHeapManager *heap_mgr) {
+        if (matcher_.get() == nullptr or pattern_ != &pattern) {
+            pattern_ = &pattern;
+            const char *data = GetData(pattern, heap_mgr);
+            matcher_ = MakeUnique<LikeMatcher>(String(data, pattern.length_), ignore_case_);
+        }
+        return *matcher_;
+    }
 
-//    result = LikeOperator(left_ptr, left_len, right_ptr, right_len);
-}
+    // chars of value, non-inlined strings are copied from the heap into buffer_
+    const char *GetData(const VarcharT &value, FixHeapManager *heap_mgr) {
+        if (value.IsInlined()) {
+            return value.short_.data_;
+        }
+        if (value.is_value_) {
+            return value.value_.ptr_;
+        }
+        buffer_.resize(value.length_);
+        heap_mgr->ReadFromHeap(buffer_.data(), value.vector_.chunk_id_, value.vector_.chunk_offset_, value.length_);
+        return buffer_.data();
+    }
+
+private:
+    const bool ignore_case_{false};
+    const VarcharT *pattern_{nullptr};
+    UniquePtr<LikeMatcher> matcher_{};
+    String buffer_{};
+};
 
-struct NotLikeFunction {
+template <bool negate>
+struct LikeOperator {
     template <typename TA, typename TB, typename TC>
-    static inline void Run(TA, TB, TC &) {
-        UnrecoverableError("Not implement: not like function");
+    static inline void Execute(const TA &left, const TB &right, TC &result, Bitmask *, SizeT, void *state_ptr) {
+        auto *state = static_cast<LikeState *>(state_ptr);
+        const LikeMatcher &matcher = state->GetMatcher(right.GetValue(), right.fix_heap_mgr());
+        const VarcharT &value = left.GetValue();
+        bool match = false;
+        if (value.IsInlined()) {
+            match = matcher.Match(value.short_.data_, value.length_);
+        } else if (matcher.MayMatch(value.vector_.prefix_, VARCHAR_PREFIX_LENGTH, value.length_)) {
+            // the prefix is at the same place for vector and value varchar
+            match = matcher.Match(state->GetData(value, left.fix_heap_mgr()), value.length_);
+        }
+        result.SetValue(match != negate);
     }
 };
 
-template <>
-inline void NotLikeFunction::Run(VarcharT &, VarcharT &, bool &) {
-    UnrecoverableError("Not implement: varchar not like varchar");
-
-//    ptr_t left_ptr = left.GetDataPtr();
-//    SizeT left_len = left.GetDataLen();
-//    ptr_t right_ptr = right.GetDataPtr();
-//    SizeT right_len = right.GetDataLen();
-
-//    result = !LikeOperator(left_ptr, left_len, right_ptr, right_len);
+template <bool ignore_case, bool negate>
+void LikeFunction(const DataBlock &input, SharedPtr<ColumnVector> &output) {
+    if (input.column_count() != 2) {
+        UnrecoverableError("Like function: input column count isn't two.");
+    }
+    LikeState state(ignore_case);
+    BinaryOperator::Execute<VarcharT, VarcharT, BooleanT, LikeOperator<negate>>(input.column_vectors[0],
+                                                                               input.column_vectors[1],
+                                                                               output,
+                                                                               input.row_count(),
+                                                                               &state,
+                                                                               true);
 }
 
-void RegisterLikeFunction(const UniquePtr<NewCatalog> &catalog_ptr) {
-    String func_name = "like";
-
+void RegisterLikeFunctionSet(const UniquePtr<NewCatalog> &catalog_ptr, const String &func_name, ScalarFunctionType function) {
     SharedPtr<ScalarFunctionSet> function_set_ptr = MakeShared<ScalarFunctionSet>(func_name);
 
     ScalarFunction varchar_like_function(func_name,
                                          {DataType(LogicalType::kVarchar), DataType(LogicalType::kVarchar)},
                                          DataType(kBoolean),
-                                         &ScalarFunction::BinaryFunction<VarcharT, VarcharT, BooleanT, LikeFunction>);
+                                         std::move(function));
     function_set_ptr->AddFunction(varchar_like_function);
 
     NewCatalog::AddFunctionSet(catalog_ptr.get(), function_set_ptr);
 }
 
-void RegisterNotLikeFunction(const UniquePtr<NewCatalog> &catalog_ptr) {
-    String func_name = "not_like";
+void RegisterLikeFunction(const UniquePtr<NewCatalog> &catalog_ptr) { RegisterLikeFunctionSet(catalog_ptr, "like", &LikeFunction<false, false>); }
 
-    SharedPtr<ScalarFunctionSet> function_set_ptr = MakeShared<ScalarFunctionSet>(func_name);
+void RegisterNotLikeFunction(const UniquePtr<NewCatalog> &catalog_ptr) {
+    RegisterLikeFunctionSet(catalog_ptr, "not_like", &LikeFunction<false, true>);
+}
 
-    ScalarFunction varchar_not_like_function(func_name,
-                                             {DataType(LogicalType::kVarchar), DataType(LogicalType::kVarchar)},
-                                             DataType(kBoolean),
-                                             &ScalarFunction::BinaryFunction<VarcharT, VarcharT, BooleanT, NotLikeFunction>);
-    function_set_ptr->AddFunction(varchar_not_like_function);
+void RegisterILikeFunction(const UniquePtr<NewCatalog> &catalog_ptr) { RegisterLikeFunctionSet(catalog_ptr, "ilike", &LikeFunction<true, false>); }
 
-    NewCatalog::AddFunctionSet(catalog_ptr.get(), function_set_ptr);
+void RegisterNotILikeFunction(const UniquePtr<NewCatalog> &catalog_ptr) {
+    RegisterLikeFunctionSet(catalog_ptr, "not_ilike", &LikeFunction<true, true>);
 }
 
-} // namespace infinity
\ No newline at end of file
+} // namespace infinity
@@ -22,8 +22,51 @@ namespace infinity {
 
 class NewCatalog;
 
+// LIKE pattern compiled once and matched against many strings.
+// '%' matches any sequence of chars and '_' matches exactly one char, there is no escape char.
+// The pattern is split at '%' into segments: the first one is anchored at the begin of the string (unless the pattern starts with '%'),
+// the last one at the end (unless the pattern ends with '%'), the others are searched leftmost in order.
+// Taking the leftmost occurrence of each floating segment is always safe, so a string is matched without backtracking:
+// prefix / suffix patterns cost a memcmp, contains patterns a memmem, the general case one memmem per segment.
+export class LikeMatcher {
+public:
+    explicit LikeMatcher(const String &pattern, bool ignore_case = false);
+
+    bool Match(const char *data, SizeT len) const;
+
+    // false if no string of length len beginning with prefix[0, prefix_len) can match, prefix_len may be less than len.
+    // Used to reject strings by the inline prefix of VarcharT before reading the heap.
+    bool MayMatch(const char *prefix, SizeT prefix_len, SizeT len) const;
+
+    [[nodiscard]] inline bool ignore_case() const { return ignore_case_; }
+
+private:
+    struct Segment {
+        String text_{};
+        SizeT first_fixed_{}; // index of the first char which is not '_', text_.size() if all chars are '_'
+        bool has_wildcard_{false};
+    };
+
+    bool MatchSegmentAt(const Segment &segment, const char *data) const;
+
+    // leftmost occurrence of segment in [begin, end), nullptr if none
+    const char *FindSegment(const Segment &segment, const char *begin, const char *end) const;
+
+    Vector<Segment> segments_{};
+    bool anchored_begin_{true};
+    bool anchored_end_{true};
+    bool has_percent_{false};
+    SizeT min_length_{};
+    bool ignore_case_{false};
+    mutable String folded_{}; // lower case copy of the matched string for ILIKE
+};
+
 export void RegisterLikeFunction(const UniquePtr<NewCatalog> &catalog_ptr);
 
 export void RegisterNotLikeFunction(const UniquePtr<NewCatalog> &catalog_ptr);
 
+export void RegisterILikeFunction(const UniquePtr<NewCatalog> &catalog_ptr);
+
+export void RegisterNotILikeFunction(const UniquePtr<NewCatalog> &catalog_ptr);
+
 } // namespace infinity
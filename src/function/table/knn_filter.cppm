@@ -19,6 +19,7 @@ export module knn_filter;
 import stl;
 import hnsw_common;
 import bitmask;
+import third_party;
 
 import segment_entry;
 
@@ -47,16 +48,15 @@ private:
     const TxnTimeStamp query_ts_;
 };
 
-export class DeleteWithBitmaskFilter final : public FilterBase<SegmentOffset> {
+export template <typename LabelType>
+class BitmapFilter final : public FilterBase<LabelType> {
 public:
-    explicit DeleteWithBitmaskFilter(const Bitmask &bitmask, const SegmentEntry *segment, TxnTimeStamp query_ts)
-        : bitmask_filter_(bitmask), delete_filter_(segment, query_ts) {}
+    explicit BitmapFilter(const RoaringBitmap &bitmap) : bitmap_(bitmap) {}
 
-    bool operator()(const SegmentOffset &segment_offset) const final { return bitmask_filter_(segment_offset) && delete_filter_(segment_offset); }
+    bool operator()(const LabelType &label) const final { return bitmap_.contains(label); }
 
 private:
-    BitmaskFilter<SegmentOffset> bitmask_filter_;
-    DeleteFilter delete_filter_;
+    const RoaringBitmap &bitmap_;
 };
 
 } // namespace infinity
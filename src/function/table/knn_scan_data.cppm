@@ -71,6 +71,7 @@ public:
 
     atomic_u64 current_block_idx_{0};
     atomic_u64 current_index_idx_{0};
+    atomic_u64 current_local_block_idx_{0};
 };
 
 //-------------------------------------------------------------------
@@ -151,12 +151,18 @@ Status Config::Init(const SharedPtr<String> &config_path) {
     // Set the log level before performance test of DB
     LogLevel default_log_level = LogLevel::kInfo;
 
+    SharedPtr<String> default_slow_query_log_filename = MakeShared<String>("slow_query.log");
+    u64 default_slow_query_threshold_ms = 0;
+
     // Default storage config
     SharedPtr<String> default_data_dir = MakeShared<String>("/tmp/infinity/data");
     u64 default_row_size = 8192lu;
     u64 default_storage_capacity = 64 * 1024lu * 1024lu * 1024lu; // 64Gib
     u64 default_garbage_collection_interval = 0;                  // real-time
     double default_garbage_collection_storage_ratio = 0;          // disable the function
+    u64 default_bg_worker_count = DEFAULT_BG_WORKER_COUNT;
+    u64 default_compaction_concurrency = DEFAULT_BG_COMPACTION_CONCURRENCY;
+    u64 default_compaction_io_rate_limit = DEFAULT_COMPACTION_IO_RATE_LIMIT;
 
     // Default buffer config
     u64 default_buffer_pool_size = 4 * 1024lu * 1024lu * 1024lu; // 4Gib
@@ -223,6 +229,9 @@ Status Config::Init(const SharedPtr<String> &config_path) {
             system_option_.log_max_size = default_log_max_size; // 1Gib
             system_option_.log_file_rotate_count = default_log_file_rotate_count;
             system_option_.log_level = default_log_level;
+            system_option_.slow_query_log_file_path =
+                MakeShared<String>(fmt::format("{}/{}", *system_option_.log_dir, *default_slow_query_log_filename));
+            system_option_.slow_query_threshold_ms = default_slow_query_threshold_ms;
         }
 
         // Storage
@@ -232,6 +241,9 @@ Status Config::Init(const SharedPtr<String> &config_path) {
             system_option_.storage_capacity_ = default_storage_capacity;
             system_option_.garbage_collection_interval_ = default_garbage_collection_interval;
             system_option_.garbage_collection_storage_ratio_ = default_garbage_collection_storage_ratio;
+            system_option_.bg_worker_count_ = default_bg_worker_count;
+            system_option_.compaction_concurrency_ = default_compaction_concurrency;
+            system_option_.compaction_io_rate_limit_ = default_compaction_io_rate_limit;
         }
 
         // Buffer
@@ -390,6 +402,10 @@ Status Config::Init(const SharedPtr<String> &config_path) {
             } else {
                 return Status::InvalidLogLevel(log_level);
             }
+
+            String slow_query_log_filename = log_config["slow_query_log_filename"].value_or(*default_slow_query_log_filename);
+            system_option_.slow_query_log_file_path = MakeShared<String>(fmt::format("{}/{}", *system_option_.log_dir, slow_query_log_filename));
+            system_option_.slow_query_threshold_ms = log_config["slow_query_threshold_ms"].value_or(default_slow_query_threshold_ms);
         }
 
         // Storage
@@ -411,6 +427,15 @@ Status Config::Init(const SharedPtr<String> &config_path) {
 
             system_option_.garbage_collection_storage_ratio_ =
                 storage_config["garbage_collection_storage_ratio"].value_or(default_garbage_collection_storage_ratio);
+
+            system_option_.bg_worker_count_ = storage_config["background_worker_count"].value_or(default_bg_worker_count);
+            system_option_.compaction_concurrency_ = storage_config["compaction_concurrency"].value_or(default_compaction_concurrency);
+            // per second, "0KB" means unlimited
+            String compaction_io_rate_limit_str = storage_config["compaction_io_rate_limit"].value_or("0KB");
+            Status rate_status = ParseByteSize(compaction_io_rate_limit_str, system_option_.compaction_io_rate_limit_);
+            if (!rate_status.ok()) {
+                return rate_status;
+            }
         }
 
         // Buffer
@@ -480,6 +505,8 @@ void Config::PrintAll() const {
     fmt::print(" - log_max_size: {}\n", Utility::FormatByteSize(system_option_.log_max_size));
     fmt::print(" - log_file_rotate_count: {}\n", system_option_.log_file_rotate_count);
     fmt::print(" - log_level: {}\n", LogLevel2Str(system_option_.log_level));
+    fmt::print(" - slow_query_log_file_path: {}\n", system_option_.slow_query_log_file_path->c_str());
+    fmt::print(" - slow_query_threshold_ms: {}\n", system_option_.slow_query_threshold_ms);
 
     // Storage
     fmt::print(" - data_dir: {}\n", system_option_.data_dir->c_str());
@@ -487,6 +514,9 @@ void Config::PrintAll() const {
     fmt::print(" - storage_capacity: {}\n", Utility::FormatByteSize(system_option_.storage_capacity_));
     fmt::print(" - garbage_collection_interval: {}\n", Utility::FormatTimeInfo(system_option_.garbage_collection_interval_));
     fmt::print(" - garbage_collection_storage_ratio: {}\n", system_option_.garbage_collection_storage_ratio_);
+    fmt::print(" - background_worker_count: {}\n", system_option_.bg_worker_count_);
+    fmt::print(" - compaction_concurrency: {}\n", system_option_.compaction_concurrency_);
+    fmt::print(" - compaction_io_rate_limit: {}/s\n", Utility::FormatByteSize(system_option_.compaction_io_rate_limit_));
 
     // Buffer
     fmt::print(" - buffer_pool_size: {}\n", Utility::FormatByteSize(system_option_.buffer_pool_size));
@@ -81,6 +81,11 @@ public:
 
     [[nodiscard]] inline LogLevel log_level() const { return system_option_.log_level; }
 
+    [[nodiscard]] inline SharedPtr<String> slow_query_log_file_path() const { return system_option_.slow_query_log_file_path; }
+
+    // statements running at least this long are written to the slow query log, 0 disables it
+    [[nodiscard]] inline u64 slow_query_threshold_ms() const { return system_option_.slow_query_threshold_ms; }
+
     // Storage
     [[nodiscard]] inline SharedPtr<String> data_dir() const { return system_option_.data_dir; }
 
@@ -92,6 +97,12 @@ public:
 
     [[nodiscard]] inline double garbage_collection_storage_ratio() const { return system_option_.garbage_collection_storage_ratio_; }
 
+    [[nodiscard]] inline u64 bg_worker_count() const { return system_option_.bg_worker_count_; }
+
+    [[nodiscard]] inline u64 compaction_concurrency() const { return system_option_.compaction_concurrency_; }
+
+    [[nodiscard]] inline u64 compaction_io_rate_limit() const { return system_option_.compaction_io_rate_limit_; }
+
     // Buffer
     [[nodiscard]] inline u64 buffer_pool_size() const { return system_option_.buffer_pool_size; }
 
@@ -23,6 +23,7 @@ import resource_manager;
 import task_scheduler;
 import storage;
 import session_manager;
+import slow_query_log;
 
 namespace infinity {
 
@@ -36,6 +37,11 @@ void InfinityContext::Init(const SharedPtr<String> &config_path) {
 
         Logger::Initialize(config_.get());
 
+        SlowQueryLog::instance().Init(*config_->slow_query_log_file_path(),
+                                      config_->log_max_size(),
+                                      config_->log_file_rotate_count(),
+                                      config_->slow_query_threshold_ms());
+
         resource_manager_ = MakeUnique<ResourceManager>(config_->worker_cpu_limit(), config_->total_memory_size());
 
         task_scheduler_ = MakeUnique<TaskScheduler>(config_.get());
@@ -65,6 +71,8 @@ void InfinityContext::UnInit() {
 
     resource_manager_.reset();
 
+    SlowQueryLog::instance().UnInit();
+
     Logger::Shutdown();
 
     config_.reset();
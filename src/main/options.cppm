@@ -60,6 +60,8 @@ export struct SystemOptions {
     u64 log_max_size{};
     SizeT log_file_rotate_count{};
     LogLevel log_level{};
+    SharedPtr<String> slow_query_log_file_path{};
+    u64 slow_query_threshold_ms{}; // 0: no slow query log
     //    spdlog::level::level_enum log_level{spdlog::level::info};
 
     // Storage
@@ -68,6 +70,9 @@ export struct SystemOptions {
     u64 storage_capacity_{};
     u64 garbage_collection_interval_{}; // unit: seconds, 0 means real-time
     double garbage_collection_storage_ratio_{}; // 0~1.0, 0 means disable the function
+    u64 bg_worker_count_{};
+    u64 compaction_concurrency_{};
+    u64 compaction_io_rate_limit_{}; // bytes per second, 0 means unlimited
 
     // Buffer
     u64 buffer_pool_size{};
@@ -14,6 +14,7 @@
 
 module;
 
+#include <algorithm>
 #include <sstream>
 #include <csignal>
 //#include "gperftools/profiler.h"
@@ -49,6 +50,20 @@ import status;
 import session_manager;
 import base_statement;
 import parser_result;
+import query_options;
+import table_entry;
+import column_def;
+import column_vector;
+import data_type;
+import logical_type;
+import default_values;
+import data_table;
+import table_def;
+import metrics;
+import slow_query_log;
+import explain_physical_plan;
+import embedding_info;
+import internal_types;
 
 namespace infinity {
 
@@ -68,8 +83,9 @@ void QueryContext::Init(Config *global_config_ptr,
     session_manager_ = session_manager;
 
     initialized_ = true;
-    cpu_number_limit_ = resource_manager_ptr->GetCpuResource();
-    memory_size_limit_ = resource_manager_ptr->GetMemoryResource();
+    // query_cpu_limit bounds the tasks of each fragment, so the workers a query occupies at once
+    cpu_number_limit_ = resource_manager_ptr->GetCpuResource(std::max<u64>(std::min<u64>(global_config_ptr->query_cpu_limit(), Thread::hardware_concurrency()), 1));
+    memory_size_limit_ = global_config_ptr->query_memory_limit();
 
     parser_ = MakeUnique<SQLParser>();
     logical_planner_ = MakeUnique<LogicalPlanner>(this);
@@ -80,6 +96,7 @@ void QueryContext::Init(Config *global_config_ptr,
 
 QueryResult QueryContext::Query(const String &query) {
     CreateQueryProfiler();
+    query_text_ = query;
 
     StartProfile(QueryPhase::kParser);
     UniquePtr<ParserResult> parsed_result = MakeUnique<ParserResult>();
@@ -106,6 +123,16 @@ QueryResult QueryContext::Query(const String &query) {
 QueryResult QueryContext::QueryStatement(const BaseStatement *statement) {
     QueryResult query_result;
 //    ProfilerStart("Query");
+    // memory still held by the blocks of the previous result stays charged to the previous tracker
+    memory_tracker_ = MakeShared<QueryMemoryTracker>(memory_size_limit_);
+    explain_analyzer_ = nullptr;
+    ScopedLatency query_latency(Metrics::instance().QueryLatency(statement->type_));
+    const i64 slow_query_threshold = SlowQueryLog::instance().threshold();
+    if (slow_query_threshold > 0 and query_profiler_ == nullptr) {
+        // statements from the sdk don't pass Query()
+        CreateQueryProfiler();
+    }
+    const auto query_begin = Clock::now();
     try {
         this->CreateTxn();
         this->BeginTxn();
@@ -160,6 +187,11 @@ QueryResult QueryContext::QueryStatement(const BaseStatement *statement) {
         this->CommitTxn();
         StopProfile(QueryPhase::kCommit);
 
+        if (slow_query_threshold > 0) {
+            if (i64 elapsed = ElapsedFromStart(Clock::now(), query_begin).count(); elapsed >= slow_query_threshold) {
+                SubmitSlowQuery(statement, physical_plan.get(), elapsed, "OK");
+            }
+        }
     } catch (RecoverableException &e) {
 
         StopProfile();
@@ -169,6 +201,12 @@ QueryResult QueryContext::QueryStatement(const BaseStatement *statement) {
         query_result.result_table_ = nullptr;
         query_result.status_.Init(e.ErrorCode(), e.what());
 
+        if (slow_query_threshold > 0) {
+            if (i64 elapsed = ElapsedFromStart(Clock::now(), query_begin).count(); elapsed >= slow_query_threshold) {
+                SubmitSlowQuery(statement, nullptr, elapsed, e.what());
+            }
+        }
+
     } catch (UnrecoverableException &e) {
 
         LOG_CRITICAL(e.what());
@@ -181,6 +219,169 @@ QueryResult QueryContext::QueryStatement(const BaseStatement *statement) {
     return query_result;
 }
 
+void QueryContext::SubmitSlowQuery(const BaseStatement *statement, const PhysicalOperator *physical_plan, i64 elapsed, const String &status) {
+    auto record = MakeUnique<SlowQueryRecord>();
+    record->session_id_ = session_ptr_->session_id();
+    record->query_text_ = query_text_.empty() ? statement->ToString() : query_text_;
+    record->elapsed_ = elapsed;
+    record->status_ = status;
+    if (physical_plan != nullptr) {
+        auto texts = MakeShared<Vector<SharedPtr<String>>>();
+        try {
+            ExplainPhysicalPlan::Explain(physical_plan, texts);
+            for (const auto &text : *texts) {
+                record->physical_plan_ += fmt::format("{}\n", *text);
+            }
+        } catch (RecoverableException &e) {
+            record->physical_plan_ = fmt::format("{}\n", e.what());
+        }
+    }
+    if (query_profiler_ != nullptr) {
+        record->profile_ = query_profiler_->ToString();
+    }
+    SlowQueryLog::instance().Submit(std::move(record));
+}
+
+QueryResult QueryContext::BulkInsert(const String &table_name, const Vector<BulkInsertColumn> &columns, i64 input_row_count) {
+    QueryResult query_result;
+    try {
+        if (input_row_count < 0) {
+            RecoverableError(Status::InvalidParameterValue("row_count", std::to_string(input_row_count), "non-negative integer"));
+        }
+        const SizeT row_count = input_row_count;
+        this->CreateTxn();
+        this->BeginTxn();
+        Txn *txn = session_ptr_->GetTxn();
+        const String &db_name = session_ptr_->current_database();
+
+        auto [table_entry, status] = txn->GetTableEntry(db_name, table_name);
+        if (!status.ok()) {
+            RecoverableError(status);
+        }
+
+        SizeT column_count = table_entry->ColumnCount();
+        if (columns.size() != column_count) {
+            RecoverableError(Status::ColumnCountMismatch(
+                fmt::format("Bulk insert provides {} columns, table {} has {} columns.", columns.size(), table_name, column_count)));
+        }
+
+        // Map each table column to its input column and validate the payload size up front.
+        Vector<const BulkInsertColumn *> input_columns(column_count, nullptr);
+        Vector<SharedPtr<DataType>> column_types;
+        column_types.reserve(column_count);
+        for (SizeT column_id = 0; column_id < column_count; ++column_id) {
+            const ColumnDef *column_def = table_entry->GetColumnDefByID(column_id);
+            for (const auto &column : columns) {
+                if (column.column_name_ == column_def->name()) {
+                    input_columns[column_id] = &column;
+                    break;
+                }
+            }
+            if (input_columns[column_id] == nullptr) {
+                RecoverableError(Status::ColumnNotExist(column_def->name()));
+            }
+
+            const SharedPtr<DataType> &column_type = column_def->type();
+            const BulkInsertColumn &input_column = *input_columns[column_id];
+            if (input_column.logical_type_ != column_type->type()) {
+                RecoverableError(Status::DataTypeMismatch(column_type->ToString(), LogicalType2Str(input_column.logical_type_)));
+            }
+            if (column_type->type() == LogicalType::kEmbedding) {
+                // the payload size can't tell e.g. float from int32 elements, so the element type must be given and match
+                auto *embedding_info = static_cast<EmbeddingInfo *>(column_type->type_info().get());
+                if (!input_column.embedding_data_type_.has_value()) {
+                    RecoverableError(Status::DataTypeMismatch(column_type->ToString(), "embedding without element type"));
+                }
+                if (input_column.embedding_data_type_.value() != embedding_info->Type()) {
+                    RecoverableError(Status::DataTypeMismatch(
+                        column_type->ToString(),
+                        fmt::format("embedding of {}", EmbeddingType::EmbeddingDataType2String(input_column.embedding_data_type_.value()))));
+                }
+            }
+            if (column_type->type() == LogicalType::kBoolean) {
+                if (input_column.data_.size() != row_count) {
+                    RecoverableError(Status::ImportFileFormatError(fmt::format("Column {} expects {} bytes", column_def->name(), row_count)));
+                }
+            } else if (column_type->type() != LogicalType::kVarchar) {
+                // compared by division, the product could overflow with a forged row count
+                SizeT type_size = column_type->Size();
+                if (input_column.data_.size() % type_size != 0 || input_column.data_.size() / type_size != row_count) {
+                    RecoverableError(Status::ImportFileFormatError(fmt::format("Column {} expects {} values of {} bytes, got {} bytes",
+                                                                               column_def->name(),
+                                                                               row_count,
+                                                                               type_size,
+                                                                               input_column.data_.size())));
+                }
+            }
+            column_types.emplace_back(column_type);
+        }
+
+        Vector<SizeT> varchar_offsets(column_count, 0);
+        for (SizeT block_start = 0; block_start < row_count; block_start += DEFAULT_BLOCK_CAPACITY) {
+            SizeT block_row_count = std::min<SizeT>(DEFAULT_BLOCK_CAPACITY, row_count - block_start);
+            SharedPtr<DataBlock> input_block = DataBlock::Make();
+            input_block->Init(column_types);
+            for (SizeT column_id = 0; column_id < column_count; ++column_id) {
+                const BulkInsertColumn &input_column = *input_columns[column_id];
+                ColumnVector &column_vector = *input_block->column_vectors[column_id];
+                switch (column_types[column_id]->type()) {
+                    case LogicalType::kVarchar: {
+                        SizeT &offset = varchar_offsets[column_id];
+                        const std::string_view &data = input_column.data_;
+                        for (SizeT row_idx = 0; row_idx < block_row_count; ++row_idx) {
+                            i32 length = 0;
+                            if (offset + sizeof(i32) > data.size()) {
+                                RecoverableError(Status::ImportFileFormatError(fmt::format("Column {} is truncated", input_column.column_name_)));
+                            }
+                            std::memcpy(&length, data.data() + offset, sizeof(i32));
+                            offset += sizeof(i32);
+                            if (length < 0 || offset + length > data.size()) {
+                                RecoverableError(Status::ImportFileFormatError(fmt::format("Column {} is truncated", input_column.column_name_)));
+                            }
+                            column_vector.AppendByStringView(data.substr(offset, length), ',');
+                            offset += length;
+                        }
+                        break;
+                    }
+                    case LogicalType::kBoolean: {
+                        column_vector.AppendByRawBuffer(input_column.data_.data() + block_start, block_row_count);
+                        break;
+                    }
+                    default: {
+                        SizeT type_size = column_types[column_id]->Size();
+                        column_vector.AppendByRawBuffer(input_column.data_.data() + block_start * type_size, block_row_count);
+                        break;
+                    }
+                }
+            }
+            input_block->Finalize();
+
+            Status append_status = txn->Append(db_name, table_name, input_block);
+            if (!append_status.ok()) {
+                RecoverableError(append_status);
+            }
+        }
+
+        this->CommitTxn();
+
+        Vector<SharedPtr<ColumnDef>> column_defs;
+        SharedPtr<TableDef> result_table_def_ptr = MakeShared<TableDef>(MakeShared<String>("default"), MakeShared<String>("Tables"), column_defs);
+        query_result.result_table_ = MakeShared<DataTable>(result_table_def_ptr, TableType::kDataTable);
+        query_result.result_table_->SetResultMsg(MakeUnique<String>(fmt::format("INSERTED {} Rows", row_count)));
+        query_result.root_operator_type_ = LogicalNodeType::kInsert;
+    } catch (RecoverableException &e) {
+        this->RollbackTxn();
+        query_result.result_table_ = nullptr;
+        query_result.status_.Init(e.ErrorCode(), e.what());
+    } catch (UnrecoverableException &e) {
+        LOG_CRITICAL(e.what());
+        raise(SIGUSR1);
+    }
+
+    session_ptr_->IncreaseQueryCount();
+    return query_result;
+}
+
 void QueryContext::CreateTxn() {
     if (session_ptr_->GetTxn() == nullptr) {
         Txn* new_txn = storage_->txn_manager()->CreateTxn();
@@ -29,6 +29,9 @@ import optimizer;
 import status;
 import query_result;
 import base_statement;
+import query_options;
+import memory_tracker;
+import slow_query_log;
 
 export module query_context;
 
@@ -38,6 +41,8 @@ class LogicalPlanner;
 class PhysicalPlanner;
 class FragmentBuilder;
 class TaskScheduler;
+class ExplainAnalyzer;
+class PhysicalOperator;
 
 export class QueryContext {
 
@@ -65,6 +70,9 @@ public:
 
     QueryResult QueryStatement(const BaseStatement *statement);
 
+    // Append a column-oriented batch straight into the transaction table store, skipping planning and expression evaluation.
+    QueryResult BulkInsert(const String &table_name, const Vector<BulkInsertColumn> &columns, i64 input_row_count);
+
     inline void set_current_schema(const String &current_schema) { session_ptr_->set_current_schema(current_schema); }
 
     [[nodiscard]] inline const String &schema_name() const { return session_ptr_->current_database(); }
@@ -73,8 +81,19 @@ public:
 
     [[nodiscard]] inline bool is_enable_profiling() const { return session_ptr_->options()->enable_profiling_; }
 
+    // the running statement is profiled, for the session or for the slow query log
+    [[nodiscard]] inline bool is_profiling() const { return query_profiler_ != nullptr; }
+
     [[nodiscard]] inline u64 memory_size_limit() const { return memory_size_limit_; }
 
+    // memory used by the running statement, its allocations fail beyond memory_size_limit()
+    [[nodiscard]] inline QueryMemoryTracker *memory_tracker() const { return memory_tracker_.get(); }
+
+    // set while the plan of an EXPLAIN ANALYZE statement runs
+    [[nodiscard]] inline ExplainAnalyzer *explain_analyzer() const { return explain_analyzer_; }
+
+    inline void set_explain_analyzer(ExplainAnalyzer *explain_analyzer) { explain_analyzer_ = explain_analyzer; }
+
     [[nodiscard]] inline u64 query_id() const { return query_id_; }
 
     [[nodiscard]] inline u64 max_node_id() const { return current_max_node_id_; }
@@ -121,17 +140,20 @@ public:
 
 private:
     inline void CreateQueryProfiler() {
-        if (is_enable_profiling()) {
+        // a statement is known to be slow only when it ends, so all of them are profiled while the slow query log is on
+        if (is_enable_profiling() or SlowQueryLog::instance().threshold() > 0) {
             query_profiler_ = MakeShared<QueryProfiler>(true);
         }
     }
 
     inline void RecordQueryProfiler(const StatementType &type) {
         if (type != StatementType::kCommand && type != StatementType::kExplain && type != StatementType::kShow) {
-            GetTxn()->GetCatalog()->AppendProfilerRecord(query_profiler_);
+            GetTxn()->GetCatalog()->AppendProfilerRecord(is_enable_profiling() ? query_profiler_ : nullptr);
         }
     }
 
+    void SubmitSlowQuery(const BaseStatement *statement, const PhysicalOperator *physical_plan, i64 elapsed, const String &status);
+
     inline void StartProfile(QueryPhase phase) {
         if(query_profiler_) {
             query_profiler_->StartPhase(phase);
@@ -158,6 +180,7 @@ private:
     UniquePtr<FragmentBuilder> fragment_builder_{};
 
     SharedPtr<QueryProfiler> query_profiler_{};
+    String query_text_{}; // of the statement parsed by Query()
 
     Config *global_config_{};
     TaskScheduler *scheduler_{};
@@ -183,6 +206,8 @@ private:
 
     u64 cpu_number_limit_{};
     u64 memory_size_limit_{};
+    SharedPtr<QueryMemoryTracker> memory_tracker_{};
+    ExplainAnalyzer *explain_analyzer_{};
 
     bool initialized_{false};
 
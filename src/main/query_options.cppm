@@ -14,9 +14,11 @@
 
 export module query_options;
 
-
+import stl;
 import extra_ddl_info;
 import statement_common;
+import logical_type;
+import knn_expr;
 
 namespace infinity {
 
@@ -48,4 +50,22 @@ public:
     CopyFileType copy_file_type_{CopyFileType::kCSV};
 };
 
+export class ExportOptions {
+public:
+    char delimiter_{','};
+    bool header_{false};
+    CopyFileType copy_file_type_{CopyFileType::kCSV};
+};
+
+// One column of a column-oriented insert batch. Fixed width values are stored back to back in their in-memory layout,
+// varchar values as a sequence of (i32 length, bytes).
+export class BulkInsertColumn {
+public:
+    String column_name_{};
+    LogicalType logical_type_{LogicalType::kInvalid};
+    // element type of an embedding column
+    Optional<EmbeddingDataType> embedding_data_type_{};
+    std::string_view data_{};
+};
+
 } // namespace infinity
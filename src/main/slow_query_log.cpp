@@ -0,0 +1,103 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+#include <thread>
+
+module slow_query_log;
+
+import stl;
+import third_party;
+import profiler;
+import logger;
+import lock_free_ring_buffer;
+
+namespace infinity {
+
+void SlowQueryLog::Init(const String &file_path, u64 max_size, SizeT rotate_count, u64 threshold_ms) {
+    if (threshold_ms == 0 or running_) {
+        return;
+    }
+    auto sink = MakeShared<spdlog::sinks::rotating_file_sink_mt>(file_path, max_size, rotate_count);
+    Vector<spdlog::sink_ptr> sinks{sink};
+    logger_ = MakeShared<spdlog::logger>("slow_query", sinks.begin(), sinks.end());
+    logger_->set_pattern("[%Y-%m-%d %H:%M:%S.%e] %v");
+
+    running_ = true;
+    writer_ = Thread([this] { WriteLoop(); });
+    threshold_.store(static_cast<i64>(threshold_ms) * 1'000'000, std::memory_order_relaxed);
+    LOG_INFO(fmt::format("Slow query log: {}, threshold: {}ms", file_path, threshold_ms));
+}
+
+void SlowQueryLog::UnInit() {
+    if (!running_) {
+        return;
+    }
+    threshold_.store(0, std::memory_order_relaxed);
+    running_ = false;
+    writer_.join();
+    logger_.reset();
+    if (u64 dropped_count = dropped_count_.exchange(0); dropped_count > 0) {
+        LOG_WARN(fmt::format("Slow query log dropped {} records", dropped_count));
+    }
+}
+
+void SlowQueryLog::Submit(UniquePtr<SlowQueryRecord> record) {
+    if (!ring_buffer_.TryEnqueue(std::move(record))) {
+        dropped_count_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void SlowQueryLog::WriteLoop() {
+    while (running_) {
+        if (Drain() == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+    }
+    // records submitted before UnInit
+    Drain();
+}
+
+SizeT SlowQueryLog::Drain() {
+    SizeT count = 0;
+    UniquePtr<SlowQueryRecord> record;
+    while (ring_buffer_.TryDequeue(record)) {
+        logger_->info("{}", Format(*record));
+        record.reset();
+        ++count;
+    }
+    if (count > 0) {
+        logger_->flush();
+    }
+    return count;
+}
+
+String SlowQueryLog::Format(const SlowQueryRecord &record) {
+    String text = fmt::format("session: {}, elapsed: {}, status: {}\n# query: {}\n",
+                              record.session_id_,
+                              BaseProfiler::ElapsedToString(NanoSeconds(record.elapsed_)),
+                              record.status_,
+                              record.query_text_);
+    if (!record.physical_plan_.empty()) {
+        text += fmt::format("# physical plan:\n{}", record.physical_plan_);
+    }
+    if (!record.profile_.empty()) {
+        text += fmt::format("# profile:\n{}", record.profile_);
+    }
+    return text;
+}
+
+} // namespace infinity
@@ -0,0 +1,74 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+export module slow_query_log;
+
+import stl;
+import singleton;
+import third_party;
+import lock_free_ring_buffer;
+
+namespace infinity {
+
+export struct SlowQueryRecord {
+    u64 session_id_{};
+    String query_text_{};
+    i64 elapsed_{}; // ns
+    String status_{};
+    String physical_plan_{};
+    String profile_{}; // query phases and operators
+};
+
+// Statements running at least threshold() are submitted by the query context and written to a rotating file by a
+// background thread. Submitting goes through a lock-free ring buffer: queries never wait for the file, a record is
+// dropped if the writer falls behind by a whole ring.
+export class SlowQueryLog : public Singleton<SlowQueryLog> {
+public:
+    static constexpr SizeT kRingBufferCapacity = 1024;
+
+    void Init(const String &file_path, u64 max_size, SizeT rotate_count, u64 threshold_ms);
+
+    void UnInit();
+
+    // ns, 0 when the slow query log is disabled
+    [[nodiscard]] inline i64 threshold() const { return threshold_.load(std::memory_order_relaxed); }
+
+    void Submit(UniquePtr<SlowQueryRecord> record);
+
+    [[nodiscard]] inline u64 dropped_count() const { return dropped_count_.load(std::memory_order_relaxed); }
+
+    static String Format(const SlowQueryRecord &record);
+
+private:
+    friend class Singleton;
+
+    SlowQueryLog() = default;
+
+    void WriteLoop();
+
+    // write the records in the ring buffer, returns the number of records written
+    SizeT Drain();
+
+    atomic_i64 threshold_{0};
+    atomic_u64 dropped_count_{0};
+    atomic_bool running_{false};
+    LockFreeRingBuffer<UniquePtr<SlowQueryRecord>> ring_buffer_{kRingBufferCapacity};
+    SharedPtr<spdlog::logger> logger_{};
+    Thread writer_{};
+};
+
+} // namespace infinity
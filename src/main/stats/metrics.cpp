@@ -0,0 +1,236 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+#include <algorithm>
+
+module metrics;
+
+import stl;
+import third_party;
+import infinity_exception;
+import base_statement;
+
+namespace infinity {
+
+namespace {
+
+atomic_u64 next_shard_index{0};
+
+const char *StatementTypeName(StatementType type) {
+    switch (type) {
+        case StatementType::kSelect:
+            return "select";
+        case StatementType::kCopy:
+            return "copy";
+        case StatementType::kInsert:
+            return "insert";
+        case StatementType::kUpdate:
+            return "update";
+        case StatementType::kDelete:
+            return "delete";
+        case StatementType::kCreate:
+            return "create";
+        case StatementType::kDrop:
+            return "drop";
+        case StatementType::kPrepare:
+            return "prepare";
+        case StatementType::kExecute:
+            return "execute";
+        case StatementType::kAlter:
+            return "alter";
+        case StatementType::kShow:
+            return "show";
+        case StatementType::kExplain:
+            return "explain";
+        case StatementType::kFlush:
+            return "flush";
+        case StatementType::kOptimize:
+            return "optimize";
+        case StatementType::kCommand:
+            return "command";
+        default:
+            return "invalid";
+    }
+}
+
+String JoinLabels(const String &labels, const String &label) {
+    if (labels.empty()) {
+        return fmt::format("{{{}}}", label);
+    }
+    return fmt::format("{{{},{}}}", labels, label);
+}
+
+} // namespace
+
+SizeT MetricShardIndex() {
+    thread_local SizeT shard_index = next_shard_index.fetch_add(1, std::memory_order_relaxed) % kMetricShardCount;
+    return shard_index;
+}
+
+u64 ShardedCounter::Value() const {
+    u64 value = 0;
+    for (const auto &shard : shards_) {
+        value += shard.value_.load(std::memory_order_relaxed);
+    }
+    return value;
+}
+
+Histogram::Histogram(Vector<u64> upper_bounds, f64 unit_scale) : upper_bounds_(std::move(upper_bounds)), unit_scale_(unit_scale) {
+    if (upper_bounds_.size() > kMaxBucketCount or !std::is_sorted(upper_bounds_.begin(), upper_bounds_.end())) {
+        UnrecoverableError("Histogram: invalid bucket upper bounds");
+    }
+}
+
+void Histogram::Observe(u64 value) {
+    // upper bounds are inclusive, as `le` of prometheus
+    const SizeT bucket_idx = std::lower_bound(upper_bounds_.begin(), upper_bounds_.end(), value) - upper_bounds_.begin();
+    Shard &shard = shards_[MetricShardIndex()];
+    shard.counts_[bucket_idx].fetch_add(1, std::memory_order_relaxed);
+    shard.sum_.fetch_add(value, std::memory_order_relaxed);
+}
+
+u64 Histogram::Count() const { return CumulativeCount(upper_bounds_.size()); }
+
+u64 Histogram::Sum() const {
+    u64 sum = 0;
+    for (const auto &shard : shards_) {
+        sum += shard.sum_.load(std::memory_order_relaxed);
+    }
+    return sum;
+}
+
+u64 Histogram::CumulativeCount(SizeT bucket_idx) const {
+    u64 count = 0;
+    for (const auto &shard : shards_) {
+        for (SizeT i = 0; i <= bucket_idx; ++i) {
+            count += shard.counts_[i].load(std::memory_order_relaxed);
+        }
+    }
+    return count;
+}
+
+void Histogram::Render(String &output, const String &name, const String &labels) const {
+    // read the buckets once, so that the cumulative counts are consistent with each other and with _count
+    Array<u64, kMaxBucketCount + 1> counts{};
+    u64 sum = 0;
+    for (const auto &shard : shards_) {
+        for (SizeT i = 0; i <= upper_bounds_.size(); ++i) {
+            counts[i] += shard.counts_[i].load(std::memory_order_relaxed);
+        }
+        sum += shard.sum_.load(std::memory_order_relaxed);
+    }
+    u64 cumulative_count = 0;
+    for (SizeT i = 0; i <= upper_bounds_.size(); ++i) {
+        cumulative_count += counts[i];
+        String le = i < upper_bounds_.size() ? fmt::format("le=\"{}\"", upper_bounds_[i] / unit_scale_) : String("le=\"+Inf\"");
+        output += fmt::format("{}_bucket{} {}\n", name, JoinLabels(labels, le), cumulative_count);
+    }
+    const String sample_labels = labels.empty() ? String() : fmt::format("{{{}}}", labels);
+    output += fmt::format("{}_sum{} {}\n", name, sample_labels, sum / unit_scale_);
+    output += fmt::format("{}_count{} {}\n", name, sample_labels, cumulative_count);
+}
+
+Vector<u64> Histogram::LatencyBounds() {
+    constexpr u64 us = 1000;
+    return {50 * us,
+            100 * us,
+            250 * us,
+            500 * us,
+            1000 * us,
+            2500 * us,
+            5000 * us,
+            10'000 * us,
+            25'000 * us,
+            50'000 * us,
+            100'000 * us,
+            250'000 * us,
+            500'000 * us,
+            1'000'000 * us,
+            2'500'000 * us,
+            5'000'000 * us,
+            10'000'000 * us};
+}
+
+Vector<u64> Histogram::SizeBounds() {
+    Vector<u64> bounds;
+    for (u64 bound = 1; bound <= 4096; bound *= 2) {
+        bounds.push_back(bound);
+    }
+    return bounds;
+}
+
+void AppendMetricHeader(String &output, const String &name, const String &type, const String &help) {
+    output += fmt::format("# HELP {} {}\n# TYPE {} {}\n", name, help, name, type);
+}
+
+void AppendMetricSample(String &output, const String &name, const String &labels, f64 value) {
+    if (labels.empty()) {
+        output += fmt::format("{} {}\n", name, value);
+    } else {
+        output += fmt::format("{}{{{}}} {}\n", name, labels, value);
+    }
+}
+
+Metrics::Metrics()
+    : wal_write_latency_(Histogram::LatencyBounds(), 1e9), wal_flush_latency_(Histogram::LatencyBounds(), 1e9),
+      wal_batch_size_(Histogram::SizeBounds(), 1), full_checkpoint_duration_(Histogram::LatencyBounds(), 1e9),
+      delta_checkpoint_duration_(Histogram::LatencyBounds(), 1e9), compaction_duration_(Histogram::LatencyBounds(), 1e9),
+      knn_scan_latency_(Histogram::LatencyBounds(), 1e9), match_scan_latency_(Histogram::LatencyBounds(), 1e9) {
+    query_latency_.reserve(kStatementTypeCount);
+    for (SizeT i = 0; i < kStatementTypeCount; ++i) {
+        query_latency_.emplace_back(MakeUnique<Histogram>(Histogram::LatencyBounds(), 1e9));
+    }
+}
+
+void Metrics::Render(String &output) const {
+    AppendMetricHeader(output, "infinity_query_duration_seconds", "histogram", "Latency of the statements by statement type.");
+    for (SizeT i = static_cast<SizeT>(StatementType::kSelect); i < kStatementTypeCount; ++i) {
+        const String labels = fmt::format("type=\"{}\"", StatementTypeName(static_cast<StatementType>(i)));
+        query_latency_[i]->Render(output, "infinity_query_duration_seconds", labels);
+    }
+
+    AppendMetricHeader(output, "infinity_buffer_evictions_total", "counter", "Buffer objects freed to make room in the buffer pool.");
+    AppendMetricSample(output, "infinity_buffer_evictions_total", "", buffer_eviction_count_.Value());
+    AppendMetricHeader(output, "infinity_buffer_evicted_bytes_total", "counter", "Bytes freed to make room in the buffer pool.");
+    AppendMetricSample(output, "infinity_buffer_evicted_bytes_total", "", buffer_evicted_bytes_.Value());
+
+    AppendMetricHeader(output, "infinity_wal_write_duration_seconds", "histogram", "Time to write a batch of wal entries.");
+    wal_write_latency_.Render(output, "infinity_wal_write_duration_seconds", "");
+    AppendMetricHeader(output, "infinity_wal_flush_duration_seconds", "histogram", "Time to flush the wal file after writing a batch.");
+    wal_flush_latency_.Render(output, "infinity_wal_flush_duration_seconds", "");
+    AppendMetricHeader(output, "infinity_wal_batch_entries", "histogram", "Wal entries written in one batch.");
+    wal_batch_size_.Render(output, "infinity_wal_batch_entries", "");
+    AppendMetricHeader(output, "infinity_wal_written_bytes_total", "counter", "Bytes written to the wal.");
+    AppendMetricSample(output, "infinity_wal_written_bytes_total", "", wal_written_bytes_.Value());
+
+    AppendMetricHeader(output, "infinity_checkpoint_duration_seconds", "histogram", "Time of the checkpoints.");
+    full_checkpoint_duration_.Render(output, "infinity_checkpoint_duration_seconds", "type=\"full\"");
+    delta_checkpoint_duration_.Render(output, "infinity_checkpoint_duration_seconds", "type=\"delta\"");
+
+    AppendMetricHeader(output, "infinity_compaction_duration_seconds", "histogram", "Time of the segment compaction tasks.");
+    compaction_duration_.Render(output, "infinity_compaction_duration_seconds", "");
+    AppendMetricHeader(output, "infinity_compacted_rows_total", "counter", "Rows copied into compacted segments.");
+    AppendMetricSample(output, "infinity_compacted_rows_total", "", compacted_row_count_.Value());
+    AppendMetricHeader(output, "infinity_compacted_bytes_total", "counter", "Bytes of column blocks copied into compacted segments.");
+    AppendMetricSample(output, "infinity_compacted_bytes_total", "", compacted_bytes_.Value());
+
+    AppendMetricHeader(output, "infinity_scan_duration_seconds", "histogram", "Time of one execution of the search operators.");
+    knn_scan_latency_.Render(output, "infinity_scan_duration_seconds", "type=\"knn\"");
+    match_scan_latency_.Render(output, "infinity_scan_duration_seconds", "type=\"match\"");
+}
+
+} // namespace infinity
@@ -0,0 +1,136 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+export module metrics;
+
+import stl;
+import singleton;
+import base_statement;
+
+namespace infinity {
+
+constexpr SizeT kMetricShardCount = 16;
+
+// Shard of the calling thread. Threads are spread over the shards round robin, so concurrent updates seldom share a cache line.
+SizeT MetricShardIndex();
+
+// Monotonic counter, a relaxed add on the shard of the thread. Reading sums the shards.
+export class ShardedCounter {
+public:
+    inline void Add(u64 value = 1) { shards_[MetricShardIndex()].value_.fetch_add(value, std::memory_order_relaxed); }
+
+    [[nodiscard]] u64 Value() const;
+
+private:
+    struct alignas(64) Shard {
+        atomic_u64 value_{};
+    };
+    Array<Shard, kMetricShardCount> shards_{};
+};
+
+// Histogram with fixed bucket upper bounds. Values are observed as integers in the unit of the bounds (e.g. ns),
+// they are divided by unit_scale when exported (e.g. 1e9 to export seconds).
+export class Histogram {
+public:
+    static constexpr SizeT kMaxBucketCount = 24;
+
+    Histogram(Vector<u64> upper_bounds, f64 unit_scale);
+
+    void Observe(u64 value);
+
+    [[nodiscard]] u64 Count() const;
+
+    [[nodiscard]] u64 Sum() const;
+
+    // Cumulative count of the bucket of upper_bounds()[bucket_idx], bucket_idx == upper_bounds().size() is +Inf
+    [[nodiscard]] u64 CumulativeCount(SizeT bucket_idx) const;
+
+    [[nodiscard]] inline const Vector<u64> &upper_bounds() const { return upper_bounds_; }
+
+    // Samples of the histogram in Prometheus text format, labels are like `type="select"` or empty.
+    void Render(String &output, const String &name, const String &labels) const;
+
+    // 50us .. 10s in ns
+    static Vector<u64> LatencyBounds();
+
+    // 1 .. 4096
+    static Vector<u64> SizeBounds();
+
+private:
+    struct alignas(64) Shard {
+        Array<atomic_u64, kMaxBucketCount + 1> counts_{};
+        atomic_u64 sum_{};
+    };
+    Vector<u64> upper_bounds_{};
+    f64 unit_scale_{1};
+    Array<Shard, kMetricShardCount> shards_{};
+};
+
+// Observes the lifetime of the object in ns
+export class ScopedLatency {
+public:
+    explicit ScopedLatency(Histogram &histogram) : histogram_(histogram), begin_(Clock::now()) {}
+
+    ~ScopedLatency() { histogram_.Observe(ElapsedFromStart(Clock::now(), begin_).count()); }
+
+private:
+    Histogram &histogram_;
+    TimePoint<Clock> begin_;
+};
+
+export void AppendMetricHeader(String &output, const String &name, const String &type, const String &help);
+
+export void AppendMetricSample(String &output, const String &name, const String &labels, f64 value);
+
+// Metrics updated by the server components. Gauges which can be read from the components directly
+// (buffer pool usage, scheduler workloads) are not kept here, the http server samples them when scraped.
+export class Metrics : public Singleton<Metrics> {
+public:
+    Histogram &QueryLatency(StatementType type) { return *query_latency_[static_cast<SizeT>(type)]; }
+
+    // Prometheus text format
+    void Render(String &output) const;
+
+    ShardedCounter buffer_eviction_count_{};
+    ShardedCounter buffer_evicted_bytes_{};
+
+    Histogram wal_write_latency_;
+    Histogram wal_flush_latency_;
+    Histogram wal_batch_size_;
+    ShardedCounter wal_written_bytes_{};
+
+    Histogram full_checkpoint_duration_;
+    Histogram delta_checkpoint_duration_;
+
+    Histogram compaction_duration_;
+    ShardedCounter compacted_row_count_{};
+    ShardedCounter compacted_bytes_{};
+
+    Histogram knn_scan_latency_;
+    Histogram match_scan_latency_;
+
+private:
+    friend class Singleton;
+
+    Metrics();
+
+    static constexpr SizeT kStatementTypeCount = static_cast<SizeT>(StatementType::kCommand) + 1;
+
+    Vector<UniquePtr<Histogram>> query_latency_{}; // indexed by statement type
+};
+
+} // namespace infinity
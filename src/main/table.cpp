@@ -101,6 +101,17 @@ QueryResult Table::Insert(Vector<String> *columns, Vector<Vector<ParsedExpr *> *
     return result;
 }
 
+QueryResult Table::BulkInsert(const Vector<BulkInsertColumn> &columns, i64 row_count) {
+    UniquePtr<QueryContext> query_context_ptr = MakeUnique<QueryContext>(session_.get());
+    query_context_ptr->Init(InfinityContext::instance().config(),
+                            InfinityContext::instance().task_scheduler(),
+                            InfinityContext::instance().storage(),
+                            InfinityContext::instance().resource_manager(),
+                            InfinityContext::instance().session_manager());
+    QueryResult result = query_context_ptr->BulkInsert(table_name_, columns, row_count);
+    return result;
+}
+
 QueryResult Table::Import(const String &path, ImportOptions import_options) {
     UniquePtr<QueryContext> query_context_ptr = MakeUnique<QueryContext>(session_.get());
     query_context_ptr->Init(InfinityContext::instance().config(),
@@ -123,6 +134,28 @@ QueryResult Table::Import(const String &path, ImportOptions import_options) {
     return result;
 }
 
+QueryResult Table::Export(const String &path, ExportOptions export_options) {
+    UniquePtr<QueryContext> query_context_ptr = MakeUnique<QueryContext>(session_.get());
+    query_context_ptr->Init(InfinityContext::instance().config(),
+                            InfinityContext::instance().task_scheduler(),
+                            InfinityContext::instance().storage(),
+                            InfinityContext::instance().resource_manager(),
+                            InfinityContext::instance().session_manager());
+    UniquePtr<CopyStatement> export_statement = MakeUnique<CopyStatement>();
+
+    export_statement->copy_from_ = false;
+    export_statement->file_path_ = path;
+    export_statement->schema_name_ = session_->current_database();
+    export_statement->table_name_ = table_name_;
+
+    export_statement->header_ = export_options.header_;
+    export_statement->copy_file_type_ = export_options.copy_file_type_;
+    export_statement->delimiter_ = export_options.delimiter_;
+
+    QueryResult result = query_context_ptr->QueryStatement(export_statement.get());
+    return result;
+}
+
 QueryResult Table::Delete(ParsedExpr *filter) {
     UniquePtr<QueryContext> query_context_ptr = MakeUnique<QueryContext>(session_.get());
     query_context_ptr->Init(InfinityContext::instance().config(),
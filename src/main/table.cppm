@@ -38,8 +38,12 @@ public:
 
     QueryResult Insert(Vector<String> *columns, Vector<Vector<ParsedExpr *> *> *values);
 
+    QueryResult BulkInsert(const Vector<BulkInsertColumn> &columns, i64 row_count);
+
     QueryResult Import(const String &path, ImportOptions import_options);
 
+    QueryResult Export(const String &path, ExportOptions export_options);
+
     QueryResult Delete(ParsedExpr *filter);
 
     QueryResult Update(ParsedExpr *filter, Vector<UpdateExpr *> *update_list);
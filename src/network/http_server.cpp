@@ -0,0 +1,171 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/write.hpp>
+#include <sys/socket.h>
+#include <sys/time.h>
+
+module http_server;
+
+import stl;
+import boost;
+import third_party;
+import logger;
+import metrics;
+import infinity_context;
+import storage;
+import buffer_manager;
+import task_scheduler;
+
+namespace infinity {
+
+namespace {
+
+constexpr SizeT kMaxRequestHeaderSize = 8192;
+
+String MakeResponse(const String &status, const String &content_type, const String &body) {
+    return fmt::format("HTTP/1.1 {}\r\nContent-Type: {}\r\nContent-Length: {}\r\nConnection: close\r\n\r\n{}",
+                       status,
+                       content_type,
+                       body.size(),
+                       body);
+}
+
+} // namespace
+
+void HttpServer::Init(const String &listen_address, u16 port) {
+    boost::system::error_code error;
+    boost::asio::ip::address address = boost::asio::ip::make_address(listen_address, error);
+    if (error) {
+        LOG_ERROR(fmt::format("HTTP server: {} isn't a valid address", listen_address));
+        return;
+    }
+    boost::asio::ip::tcp::endpoint endpoint(address, port);
+    auto acceptor_ptr = MakeUnique<boost::asio::ip::tcp::acceptor>(io_service_);
+    acceptor_ptr->open(endpoint.protocol(), error);
+    if (!error) {
+        acceptor_ptr->set_option(boost::asio::ip::tcp::acceptor::reuse_address(true), error);
+    }
+    if (!error) {
+        acceptor_ptr->bind(endpoint, error);
+    }
+    if (!error) {
+        acceptor_ptr->listen(boost::asio::socket_base::max_listen_connections, error);
+    }
+    if (error) {
+        // metrics are not essential, the server keeps running without them
+        LOG_ERROR(fmt::format("HTTP server can't listen on {}:{}: {}", listen_address, port, error.message()));
+        return;
+    }
+    acceptor_ptr_ = std::move(acceptor_ptr);
+    fmt::print("HTTP server listen on: {}:{}, metrics: http://{}:{}/metrics\n", listen_address, port, listen_address, port);
+}
+
+void HttpServer::Start() {
+    if (acceptor_ptr_ == nullptr) {
+        return;
+    }
+    AsyncAccept();
+    io_service_.run();
+}
+
+void HttpServer::Shutdown() {
+    io_service_.stop();
+    if (acceptor_ptr_ != nullptr) {
+        boost::system::error_code error;
+        acceptor_ptr_->close(error);
+    }
+}
+
+void HttpServer::AsyncAccept() {
+    auto socket = MakeShared<boost::asio::ip::tcp::socket>(io_service_);
+    acceptor_ptr_->async_accept(*socket, [this, socket](const boost::system::error_code &error) {
+        if (error) {
+            // acceptor is closed
+            return;
+        }
+        HandleConnection(*socket);
+        AsyncAccept();
+    });
+}
+
+void HttpServer::HandleConnection(boost::asio::ip::tcp::socket &socket) {
+    // a stalled client must not block the following scrapes
+    timeval timeout{1, 0};
+    setsockopt(socket.native_handle(), SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    setsockopt(socket.native_handle(), SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+    boost::system::error_code error;
+    String request;
+    Array<char, 1024> read_buffer;
+    while (request.find("\r\n\r\n") == String::npos) {
+        SizeT read_size = socket.read_some(boost::asio::buffer(read_buffer), error);
+        if (error) {
+            return;
+        }
+        request.append(read_buffer.data(), read_size);
+        if (request.size() > kMaxRequestHeaderSize) {
+            String response = MakeResponse("431 Request Header Fields Too Large", "text/plain", "");
+            boost::asio::write(socket, boost::asio::buffer(response), error);
+            return;
+        }
+    }
+
+    // request line: METHOD SP TARGET SP VERSION
+    const SizeT method_end = request.find(' ');
+    const SizeT target_end = method_end == String::npos ? String::npos : request.find(' ', method_end + 1);
+    String response;
+    if (target_end == String::npos) {
+        response = MakeResponse("400 Bad Request", "text/plain", "");
+    } else {
+        const String method = request.substr(0, method_end);
+        String target = request.substr(method_end + 1, target_end - method_end - 1);
+        target = target.substr(0, target.find('?'));
+        if (target != "/metrics") {
+            response = MakeResponse("404 Not Found", "text/plain", "");
+        } else if (method != "GET") {
+            response = MakeResponse("405 Method Not Allowed", "text/plain", "");
+        } else {
+            response = MakeResponse("200 OK", "text/plain; version=0.0.4; charset=utf-8", RenderMetrics());
+        }
+    }
+    boost::asio::write(socket, boost::asio::buffer(response), error);
+    socket.shutdown(boost::asio::ip::tcp::socket::shutdown_both, error);
+    socket.close(error);
+}
+
+String HttpServer::RenderMetrics() {
+    String output;
+    Metrics::instance().Render(output);
+
+    BufferManager *buffer_mgr = InfinityContext::instance().storage()->buffer_manager();
+    AppendMetricHeader(output, "infinity_buffer_pool_memory_bytes", "gauge", "Memory held by the loaded buffer objects.");
+    AppendMetricSample(output, "infinity_buffer_pool_memory_bytes", "", buffer_mgr->memory_usage());
+    AppendMetricHeader(output, "infinity_buffer_pool_memory_limit_bytes", "gauge", "Memory limit of the buffer pool.");
+    AppendMetricSample(output, "infinity_buffer_pool_memory_limit_bytes", "", buffer_mgr->memory_limit());
+
+    Vector<u64> workloads = InfinityContext::instance().task_scheduler()->WorkerWorkloads();
+    AppendMetricHeader(output, "infinity_scheduler_worker_tasks", "gauge", "Fragment tasks queued or running on each worker.");
+    for (SizeT worker_id = 0; worker_id < workloads.size(); ++worker_id) {
+        AppendMetricSample(output, "infinity_scheduler_worker_tasks", fmt::format("worker=\"{}\"", worker_id), workloads[worker_id]);
+    }
+    return output;
+}
+
+} // namespace infinity
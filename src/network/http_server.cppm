@@ -0,0 +1,47 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+export module http_server;
+
+import stl;
+import boost;
+
+namespace infinity {
+
+// Minimal HTTP listener on the http port. It answers `GET /metrics` with the server metrics in Prometheus text format,
+// requests are served one by one on the thread which runs Start().
+export class HttpServer {
+public:
+    void Init(const String &listen_address, u16 port);
+
+    void Start();
+
+    void Shutdown();
+
+    // Body of `GET /metrics`
+    static String RenderMetrics();
+
+private:
+    void AsyncAccept();
+
+    void HandleConnection(boost::asio::ip::tcp::socket &socket);
+
+    boost::asio::io_service io_service_{};
+    UniquePtr<boost::asio::ip::tcp::acceptor> acceptor_ptr_{};
+};
+
+} // namespace infinity
@@ -29,6 +29,7 @@ class InfinityServiceIf {
   virtual void CreateTable(CommonResponse& _return, const CreateTableRequest& request) = 0;
   virtual void DropTable(CommonResponse& _return, const DropTableRequest& request) = 0;
   virtual void Insert(CommonResponse& _return, const InsertRequest& request) = 0;
+  virtual void BulkInsert(CommonResponse& _return, const BulkInsertRequest& request) = 0;
   virtual void Import(CommonResponse& _return, const ImportRequest& request) = 0;
   virtual void Select(SelectResponse& _return, const SelectRequest& request) = 0;
   virtual void Explain(SelectResponse& _return, const ExplainRequest& request) = 0;
@@ -95,6 +96,9 @@ class InfinityServiceNull : virtual public InfinityServiceIf {
   void Insert(CommonResponse& /* _return */, const InsertRequest& /* request */) override {
     return;
   }
+  void BulkInsert(CommonResponse& /* _return */, const BulkInsertRequest& /* request */) override {
+    return;
+  }
   void Import(CommonResponse& /* _return */, const ImportRequest& /* request */) override {
     return;
   }
@@ -861,6 +865,110 @@ class InfinityService_Insert_presult {
 
 };
 
+typedef struct _InfinityService_BulkInsert_args__isset {
+  _InfinityService_BulkInsert_args__isset() : request(false) {}
+  bool request :1;
+} _InfinityService_BulkInsert_args__isset;
+
+class InfinityService_BulkInsert_args {
+ public:
+
+  InfinityService_BulkInsert_args(const InfinityService_BulkInsert_args&);
+  InfinityService_BulkInsert_args& operator=(const InfinityService_BulkInsert_args&);
+  InfinityService_BulkInsert_args() noexcept {
+  }
+
+  virtual ~InfinityService_BulkInsert_args() noexcept;
+  BulkInsertRequest request;
+
+  _InfinityService_BulkInsert_args__isset __isset;
+
+  void __set_request(const BulkInsertRequest& val);
+
+  bool operator == (const InfinityService_BulkInsert_args & rhs) const
+  {
+    if (!(request == rhs.request))
+      return false;
+    return true;
+  }
+  bool operator != (const InfinityService_BulkInsert_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const InfinityService_BulkInsert_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class InfinityService_BulkInsert_pargs {
+ public:
+
+
+  virtual ~InfinityService_BulkInsert_pargs() noexcept;
+  const BulkInsertRequest* request;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _InfinityService_BulkInsert_result__isset {
+  _InfinityService_BulkInsert_result__isset() : success(false) {}
+  bool success :1;
+} _InfinityService_BulkInsert_result__isset;
+
+class InfinityService_BulkInsert_result {
+ public:
+
+  InfinityService_BulkInsert_result(const InfinityService_BulkInsert_result&);
+  InfinityService_BulkInsert_result& operator=(const InfinityService_BulkInsert_result&);
+  InfinityService_BulkInsert_result() noexcept {
+  }
+
+  virtual ~InfinityService_BulkInsert_result() noexcept;
+  CommonResponse success;
+
+  _InfinityService_BulkInsert_result__isset __isset;
+
+  void __set_success(const CommonResponse& val);
+
+  bool operator == (const InfinityService_BulkInsert_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    return true;
+  }
+  bool operator != (const InfinityService_BulkInsert_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const InfinityService_BulkInsert_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _InfinityService_BulkInsert_presult__isset {
+  _InfinityService_BulkInsert_presult__isset() : success(false) {}
+  bool success :1;
+} _InfinityService_BulkInsert_presult__isset;
+
+class InfinityService_BulkInsert_presult {
+ public:
+
+
+  virtual ~InfinityService_BulkInsert_presult() noexcept;
+  CommonResponse* success;
+
+  _InfinityService_BulkInsert_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
 typedef struct _InfinityService_Import_args__isset {
   _InfinityService_Import_args__isset() : request(false) {}
   bool request :1;
@@ -2571,6 +2679,9 @@ class InfinityServiceClient : virtual public InfinityServiceIf {
   void Insert(CommonResponse& _return, const InsertRequest& request) override;
   void send_Insert(const InsertRequest& request);
   void recv_Insert(CommonResponse& _return);
+  void BulkInsert(CommonResponse& _return, const BulkInsertRequest& request) override;
+  void send_BulkInsert(const BulkInsertRequest& request);
+  void recv_BulkInsert(CommonResponse& _return);
   void Import(CommonResponse& _return, const ImportRequest& request) override;
   void send_Import(const ImportRequest& request);
   void recv_Import(CommonResponse& _return);
@@ -2641,6 +2752,7 @@ class InfinityServiceProcessor : public ::apache::thrift::TDispatchProcessor {
   void process_CreateTable(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_DropTable(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_Insert(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_BulkInsert(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_Import(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_Select(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_Explain(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
@@ -2667,6 +2779,7 @@ class InfinityServiceProcessor : public ::apache::thrift::TDispatchProcessor {
     processMap_["CreateTable"] = &InfinityServiceProcessor::process_CreateTable;
     processMap_["DropTable"] = &InfinityServiceProcessor::process_DropTable;
     processMap_["Insert"] = &InfinityServiceProcessor::process_Insert;
+    processMap_["BulkInsert"] = &InfinityServiceProcessor::process_BulkInsert;
     processMap_["Import"] = &InfinityServiceProcessor::process_Import;
     processMap_["Select"] = &InfinityServiceProcessor::process_Select;
     processMap_["Explain"] = &InfinityServiceProcessor::process_Explain;
@@ -2781,6 +2894,16 @@ class InfinityServiceMultiface : virtual public InfinityServiceIf {
     return;
   }
 
+  void BulkInsert(CommonResponse& _return, const BulkInsertRequest& request) override {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->BulkInsert(_return, request);
+    }
+    ifaces_[i]->BulkInsert(_return, request);
+    return;
+  }
+
   void Import(CommonResponse& _return, const ImportRequest& request) override {
     size_t sz = ifaces_.size();
     size_t i = 0;
@@ -2994,6 +3117,9 @@ class InfinityServiceConcurrentClient : virtual public InfinityServiceIf {
   void Insert(CommonResponse& _return, const InsertRequest& request) override;
   int32_t send_Insert(const InsertRequest& request);
   void recv_Insert(CommonResponse& _return, const int32_t seqid);
+  void BulkInsert(CommonResponse& _return, const BulkInsertRequest& request) override;
+  int32_t send_BulkInsert(const BulkInsertRequest& request);
+  void recv_BulkInsert(CommonResponse& _return, const int32_t seqid);
   void Import(CommonResponse& _return, const ImportRequest& request) override;
   int32_t send_Import(const ImportRequest& request);
   void recv_Import(CommonResponse& _return, const int32_t seqid);
@@ -242,14 +242,16 @@ std::string to_string(const KnnDistanceType::type& val) {
 int _kCopyFileTypeValues[] = {
   CopyFileType::CSV,
   CopyFileType::JSON,
-  CopyFileType::FVECS
+  CopyFileType::FVECS,
+  CopyFileType::PARQUET
 };
 const char* _kCopyFileTypeNames[] = {
   "CSV",
   "JSON",
-  "FVECS"
+  "FVECS",
+  "PARQUET"
 };
-const std::map<int, const char*> _CopyFileType_VALUES_TO_NAMES(::apache::thrift::TEnumIterator(3, _kCopyFileTypeValues, _kCopyFileTypeNames), ::apache::thrift::TEnumIterator(-1, nullptr, nullptr));
+const std::map<int, const char*> _CopyFileType_VALUES_TO_NAMES(::apache::thrift::TEnumIterator(4, _kCopyFileTypeValues, _kCopyFileTypeNames), ::apache::thrift::TEnumIterator(-1, nullptr, nullptr));
 
 std::ostream& operator<<(std::ostream& out, const CopyFileType::type& val) {
   std::map<int, const char*>::const_iterator it = _CopyFileType_VALUES_TO_NAMES.find(val);
@@ -3813,6 +3815,11 @@ void ColumnField::__set_column_vectors(const std::vector<std::string> & val) {
 void ColumnField::__set_column_name(const std::string& val) {
   this->column_name = val;
 }
+
+void ColumnField::__set_element_type(const ElementType::type val) {
+  this->element_type = val;
+__isset.element_type = true;
+}
 std::ostream& operator<<(std::ostream& out, const ColumnField& obj)
 {
   obj.printTo(out);
@@ -3879,6 +3886,16 @@ uint32_t ColumnField::read(::apache::thrift::protocol::TProtocol* iprot) {
           xfer += iprot->skip(ftype);
         }
         break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          int32_t ecast155;
+          xfer += iprot->readI32(ecast155);
+          this->element_type = static_cast<ElementType::type>(ecast155);
+          this->__isset.element_type = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -3916,6 +3933,11 @@ uint32_t ColumnField::write(::apache::thrift::protocol::TProtocol* oprot) const
   xfer += oprot->writeString(this->column_name);
   xfer += oprot->writeFieldEnd();
 
+  if (this->__isset.element_type) {
+    xfer += oprot->writeFieldBegin("element_type", ::apache::thrift::protocol::T_I32, 4);
+    xfer += oprot->writeI32(static_cast<int32_t>(this->element_type));
+    xfer += oprot->writeFieldEnd();
+  }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
@@ -3926,6 +3948,7 @@ void swap(ColumnField &a, ColumnField &b) {
   swap(a.column_type, b.column_type);
   swap(a.column_vectors, b.column_vectors);
   swap(a.column_name, b.column_name);
+  swap(a.element_type, b.element_type);
   swap(a.__isset, b.__isset);
 }
 
@@ -3933,12 +3956,14 @@ ColumnField::ColumnField(const ColumnField& other156) {
   column_type = other156.column_type;
   column_vectors = other156.column_vectors;
   column_name = other156.column_name;
+  element_type = other156.element_type;
   __isset = other156.__isset;
 }
 ColumnField& ColumnField::operator=(const ColumnField& other157) {
   column_type = other157.column_type;
   column_vectors = other157.column_vectors;
   column_name = other157.column_name;
+  element_type = other157.element_type;
   __isset = other157.__isset;
   return *this;
 }
@@ -3948,6 +3973,7 @@ void ColumnField::printTo(std::ostream& out) const {
   out << "column_type=" << to_string(column_type);
   out << ", " << "column_vectors=" << to_string(column_vectors);
   out << ", " << "column_name=" << to_string(column_name);
+  out << ", " << "element_type="; (__isset.element_type ? (out << to_string(element_type)) : (out << "<null>"));
   out << ")";
 }
 
@@ -7142,6 +7168,198 @@ void InsertRequest::printTo(std::ostream& out) const {
 }
 
 
+BulkInsertRequest::~BulkInsertRequest() noexcept {
+}
+
+
+void BulkInsertRequest::__set_db_name(const std::string& val) {
+  this->db_name = val;
+}
+
+void BulkInsertRequest::__set_table_name(const std::string& val) {
+  this->table_name = val;
+}
+
+void BulkInsertRequest::__set_column_fields(const std::vector<ColumnField> & val) {
+  this->column_fields = val;
+}
+
+void BulkInsertRequest::__set_row_count(const int64_t val) {
+  this->row_count = val;
+}
+
+void BulkInsertRequest::__set_session_id(const int64_t val) {
+  this->session_id = val;
+}
+std::ostream& operator<<(std::ostream& out, const BulkInsertRequest& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+
+uint32_t BulkInsertRequest::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->db_name);
+          this->__isset.db_name = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->table_name);
+          this->__isset.table_name = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->column_fields.clear();
+            uint32_t _size246;
+            ::apache::thrift::protocol::TType _etype249;
+            xfer += iprot->readListBegin(_etype249, _size246);
+            this->column_fields.resize(_size246);
+            uint32_t _i250;
+            for (_i250 = 0; _i250 < _size246; ++_i250)
+            {
+              xfer += this->column_fields[_i250].read(iprot);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.column_fields = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->row_count);
+          this->__isset.row_count = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 5:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->session_id);
+          this->__isset.session_id = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t BulkInsertRequest::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("BulkInsertRequest");
+
+  xfer += oprot->writeFieldBegin("db_name", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString(this->db_name);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("table_name", ::apache::thrift::protocol::T_STRING, 2);
+  xfer += oprot->writeString(this->table_name);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("column_fields", ::apache::thrift::protocol::T_LIST, 3);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->column_fields.size()));
+    std::vector<ColumnField> ::const_iterator _iter251;
+    for (_iter251 = this->column_fields.begin(); _iter251 != this->column_fields.end(); ++_iter251)
+    {
+      xfer += (*_iter251).write(oprot);
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("row_count", ::apache::thrift::protocol::T_I64, 4);
+  xfer += oprot->writeI64(this->row_count);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("session_id", ::apache::thrift::protocol::T_I64, 5);
+  xfer += oprot->writeI64(this->session_id);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(BulkInsertRequest &a, BulkInsertRequest &b) {
+  using ::std::swap;
+  swap(a.db_name, b.db_name);
+  swap(a.table_name, b.table_name);
+  swap(a.column_fields, b.column_fields);
+  swap(a.row_count, b.row_count);
+  swap(a.session_id, b.session_id);
+  swap(a.__isset, b.__isset);
+}
+
+BulkInsertRequest::BulkInsertRequest(const BulkInsertRequest& other252) {
+  db_name = other252.db_name;
+  table_name = other252.table_name;
+  column_fields = other252.column_fields;
+  row_count = other252.row_count;
+  session_id = other252.session_id;
+  __isset = other252.__isset;
+}
+BulkInsertRequest& BulkInsertRequest::operator=(const BulkInsertRequest& other253) {
+  db_name = other253.db_name;
+  table_name = other253.table_name;
+  column_fields = other253.column_fields;
+  row_count = other253.row_count;
+  session_id = other253.session_id;
+  __isset = other253.__isset;
+  return *this;
+}
+void BulkInsertRequest::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "BulkInsertRequest(";
+  out << "db_name=" << to_string(db_name);
+  out << ", " << "table_name=" << to_string(table_name);
+  out << ", " << "column_fields=" << to_string(column_fields);
+  out << ", " << "row_count=" << to_string(row_count);
+  out << ", " << "session_id=" << to_string(session_id);
+  out << ")";
+}
+
+
 ImportRequest::~ImportRequest() noexcept {
 }
 
@@ -129,7 +129,8 @@ struct CopyFileType {
   enum type {
     CSV = 0,
     JSON = 1,
-    FVECS = 2
+    FVECS = 2,
+    PARQUET = 3
   };
 };
 
@@ -286,6 +287,8 @@ class DropTableRequest;
 
 class InsertRequest;
 
+class BulkInsertRequest;
+
 class ImportRequest;
 
 class FileChunk;
@@ -1608,10 +1611,11 @@ void swap(Field &a, Field &b);
 std::ostream& operator<<(std::ostream& out, const Field& obj);
 
 typedef struct _ColumnField__isset {
-  _ColumnField__isset() : column_type(false), column_vectors(true), column_name(false) {}
+  _ColumnField__isset() : column_type(false), column_vectors(true), column_name(false), element_type(false) {}
   bool column_type :1;
   bool column_vectors :1;
   bool column_name :1;
+  bool element_type :1;
 } _ColumnField__isset;
 
 class ColumnField : public virtual ::apache::thrift::TBase {
@@ -1621,7 +1625,8 @@ class ColumnField : public virtual ::apache::thrift::TBase {
   ColumnField& operator=(const ColumnField&);
   ColumnField() noexcept
               : column_type(static_cast<ColumnType::type>(0)),
-                column_name() {
+                column_name(),
+                element_type(static_cast<ElementType::type>(0)) {
 
   }
 
@@ -1633,6 +1638,11 @@ class ColumnField : public virtual ::apache::thrift::TBase {
   ColumnType::type column_type;
   std::vector<std::string>  column_vectors;
   std::string column_name;
+  /**
+   * 
+   * @see ElementType
+   */
+  ElementType::type element_type;
 
   _ColumnField__isset __isset;
 
@@ -1642,6 +1652,8 @@ class ColumnField : public virtual ::apache::thrift::TBase {
 
   void __set_column_name(const std::string& val);
 
+  void __set_element_type(const ElementType::type val);
+
   bool operator == (const ColumnField & rhs) const
   {
     if (!(column_type == rhs.column_type))
@@ -1650,6 +1662,10 @@ class ColumnField : public virtual ::apache::thrift::TBase {
       return false;
     if (!(column_name == rhs.column_name))
       return false;
+    if (__isset.element_type != rhs.__isset.element_type)
+      return false;
+    else if (__isset.element_type && !(element_type == rhs.element_type))
+      return false;
     return true;
   }
   bool operator != (const ColumnField &rhs) const {
@@ -2976,6 +2992,78 @@ void swap(InsertRequest &a, InsertRequest &b);
 
 std::ostream& operator<<(std::ostream& out, const InsertRequest& obj);
 
+typedef struct _BulkInsertRequest__isset {
+  _BulkInsertRequest__isset() : db_name(false), table_name(false), column_fields(true), row_count(false), session_id(false) {}
+  bool db_name :1;
+  bool table_name :1;
+  bool column_fields :1;
+  bool row_count :1;
+  bool session_id :1;
+} _BulkInsertRequest__isset;
+
+class BulkInsertRequest : public virtual ::apache::thrift::TBase {
+ public:
+
+  BulkInsertRequest(const BulkInsertRequest&);
+  BulkInsertRequest& operator=(const BulkInsertRequest&);
+  BulkInsertRequest() noexcept
+                    : db_name(),
+                      table_name(),
+                      row_count(0),
+                      session_id(0) {
+
+
+  }
+
+  virtual ~BulkInsertRequest() noexcept;
+  std::string db_name;
+  std::string table_name;
+  std::vector<ColumnField>  column_fields;
+  int64_t row_count;
+  int64_t session_id;
+
+  _BulkInsertRequest__isset __isset;
+
+  void __set_db_name(const std::string& val);
+
+  void __set_table_name(const std::string& val);
+
+  void __set_column_fields(const std::vector<ColumnField> & val);
+
+  void __set_row_count(const int64_t val);
+
+  void __set_session_id(const int64_t val);
+
+  bool operator == (const BulkInsertRequest & rhs) const
+  {
+    if (!(db_name == rhs.db_name))
+      return false;
+    if (!(table_name == rhs.table_name))
+      return false;
+    if (!(column_fields == rhs.column_fields))
+      return false;
+    if (!(row_count == rhs.row_count))
+      return false;
+    if (!(session_id == rhs.session_id))
+      return false;
+    return true;
+  }
+  bool operator != (const BulkInsertRequest &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const BulkInsertRequest & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot) override;
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const override;
+
+  virtual void printTo(std::ostream& out) const;
+};
+
+void swap(BulkInsertRequest &a, BulkInsertRequest &b);
+
+std::ostream& operator<<(std::ostream& out, const BulkInsertRequest& obj);
+
 typedef struct _ImportRequest__isset {
   _ImportRequest__isset() : db_name(false), table_name(false), file_name(false), file_content(false), import_option(false), session_id(false) {}
   bool db_name :1;
@@ -193,6 +193,40 @@ public:
         ProcessCommonResult(response, result);
     }
 
+    void BulkInsert(infinity_thrift_rpc::CommonResponse &response, const infinity_thrift_rpc::BulkInsertRequest &request) override {
+        auto infinity = GetInfinityBySessionID(request.session_id);
+        auto database = infinity->GetDatabase(request.db_name);
+        auto table = database->GetTable(request.table_name);
+
+        // Column buffers use the same layout as select responses, so they are handed over without copying.
+        Vector<BulkInsertColumn> columns;
+        columns.reserve(request.column_fields.size());
+        for (auto &column_field : request.column_fields) {
+            if (column_field.column_vectors.size() != 1) {
+                response.__set_success(false);
+                response.__set_error_msg(fmt::format("Column {} should be sent as a single buffer", column_field.column_name));
+                return;
+            }
+            BulkInsertColumn column;
+            column.column_name_ = column_field.column_name;
+            column.logical_type_ = GetLogicalTypeFromProtoColumnType(column_field.column_type);
+            if (column_field.__isset.element_type) {
+                if (column_field.element_type < infinity_thrift_rpc::ElementType::ElementBit ||
+                    column_field.element_type > infinity_thrift_rpc::ElementType::ElementFloat64) {
+                    response.__set_success(false);
+                    response.__set_error_msg(fmt::format("Column {} has an invalid element type", column_field.column_name));
+                    return;
+                }
+                column.embedding_data_type_ = GetEmbeddingDataTypeFromProto(column_field.element_type);
+            }
+            column.data_ = column_field.column_vectors[0];
+            columns.emplace_back(std::move(column));
+        }
+
+        auto result = table->BulkInsert(columns, request.row_count);
+        ProcessCommonResult(response, result);
+    }
+
     CopyFileType GetCopyFileType(infinity_thrift_rpc::CopyFileType::type copy_file_type) {
         switch (copy_file_type) {
             case infinity_thrift_rpc::CopyFileType::CSV:
@@ -201,6 +235,8 @@ public:
                 return CopyFileType::kJSON;
             case infinity_thrift_rpc::CopyFileType::FVECS:
                 return CopyFileType::kFVECS;
+            case infinity_thrift_rpc::CopyFileType::PARQUET:
+                return CopyFileType::kParquet;
             default: {
                 UnrecoverableError("Not implemented copy file type");
             }
@@ -1112,6 +1148,33 @@ private:
         return infinity_thrift_rpc::ColumnType::ColumnInvalid;
     }
 
+    static LogicalType GetLogicalTypeFromProtoColumnType(infinity_thrift_rpc::ColumnType::type column_type) {
+        switch (column_type) {
+            case infinity_thrift_rpc::ColumnType::ColumnBool:
+                return LogicalType::kBoolean;
+            case infinity_thrift_rpc::ColumnType::ColumnInt8:
+                return LogicalType::kTinyInt;
+            case infinity_thrift_rpc::ColumnType::ColumnInt16:
+                return LogicalType::kSmallInt;
+            case infinity_thrift_rpc::ColumnType::ColumnInt32:
+                return LogicalType::kInteger;
+            case infinity_thrift_rpc::ColumnType::ColumnInt64:
+                return LogicalType::kBigInt;
+            case infinity_thrift_rpc::ColumnType::ColumnFloat32:
+                return LogicalType::kFloat;
+            case infinity_thrift_rpc::ColumnType::ColumnFloat64:
+                return LogicalType::kDouble;
+            case infinity_thrift_rpc::ColumnType::ColumnVarchar:
+                return LogicalType::kVarchar;
+            case infinity_thrift_rpc::ColumnType::ColumnEmbedding:
+                return LogicalType::kEmbedding;
+            case infinity_thrift_rpc::ColumnType::ColumnRowID:
+                return LogicalType::kRowID;
+            default:
+                return LogicalType::kInvalid;
+        }
+    }
+
     UniquePtr<infinity_thrift_rpc::DataType> DataTypeToProtoDataType(const SharedPtr<DataType> &data_type) {
         switch (data_type->type()) {
             case LogicalType::kBoolean: {
@@ -719,18 +719,18 @@ union yyalloc
 #endif /* !YYCOPY_NEEDED */
 
 /* YYFINAL -- State number of the termination state.  */
-#define YYFINAL  83
+#define YYFINAL  84
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   906
+#define YYLAST   897
 
 /* YYNTOKENS -- Number of terminals.  */
 #define YYNTOKENS  177
 /* YYNNTS -- Number of nonterminals.  */
 #define YYNNTS  94
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  347
+#define YYNRULES  348
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  676
+#define YYNSTATES  677
 
 /* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   416
@@ -813,23 +813,23 @@ static const yytype_int16 yyrline[] =
     1325,  1328,  1331,  1334,  1342,  1345,  1360,  1360,  1362,  1376,
     1385,  1390,  1399,  1404,  1409,  1415,  1422,  1425,  1429,  1432,
     1437,  1449,  1456,  1470,  1473,  1476,  1479,  1482,  1485,  1488,
-    1494,  1498,  1502,  1506,  1510,  1514,  1518,  1522,  1529,  1540,
-    1551,  1563,  1576,  1591,  1595,  1599,  1607,  1622,  1628,  1633,
-    1639,  1645,  1653,  1659,  1665,  1671,  1677,  1685,  1691,  1697,
-    1713,  1717,  1722,  1726,  1753,  1759,  1763,  1764,  1765,  1766,
-    1767,  1769,  1772,  1778,  1781,  1782,  1783,  1784,  1785,  1786,
-    1787,  1788,  1790,  1957,  1965,  1976,  1982,  1991,  1997,  2007,
-    2011,  2015,  2019,  2023,  2027,  2031,  2035,  2040,  2048,  2056,
-    2065,  2072,  2079,  2086,  2093,  2100,  2108,  2116,  2124,  2132,
-    2140,  2148,  2156,  2164,  2172,  2180,  2188,  2196,  2226,  2234,
-    2243,  2251,  2260,  2268,  2274,  2281,  2287,  2294,  2299,  2306,
-    2313,  2321,  2345,  2351,  2357,  2364,  2372,  2379,  2386,  2391,
-    2401,  2406,  2411,  2416,  2421,  2426,  2431,  2436,  2441,  2446,
-    2449,  2452,  2455,  2459,  2462,  2466,  2470,  2475,  2480,  2484,
-    2489,  2494,  2500,  2506,  2512,  2518,  2524,  2530,  2536,  2542,
-    2548,  2554,  2560,  2571,  2575,  2580,  2602,  2612,  2618,  2622,
-    2623,  2625,  2626,  2628,  2629,  2641,  2649,  2653,  2656,  2660,
-    2664,  2669,  2674,  2682,  2689,  2700,  2748,  2797
+    1494,  1498,  1502,  1506,  1510,  1514,  1518,  1522,  1529,  1541,
+    1552,  1563,  1575,  1588,  1603,  1607,  1611,  1619,  1634,  1640,
+    1645,  1651,  1657,  1665,  1671,  1677,  1683,  1689,  1697,  1703,
+    1709,  1725,  1729,  1734,  1738,  1765,  1771,  1775,  1776,  1777,
+    1778,  1779,  1781,  1784,  1790,  1793,  1794,  1795,  1796,  1797,
+    1798,  1799,  1800,  1802,  1969,  1977,  1988,  1994,  2003,  2009,
+    2019,  2023,  2027,  2031,  2035,  2039,  2043,  2047,  2052,  2060,
+    2068,  2077,  2084,  2091,  2098,  2105,  2112,  2120,  2128,  2136,
+    2144,  2152,  2160,  2168,  2176,  2184,  2192,  2200,  2208,  2238,
+    2246,  2255,  2263,  2272,  2280,  2286,  2293,  2299,  2306,  2311,
+    2318,  2325,  2333,  2357,  2363,  2369,  2376,  2384,  2391,  2398,
+    2403,  2413,  2418,  2423,  2428,  2433,  2438,  2443,  2448,  2453,
+    2458,  2461,  2464,  2467,  2471,  2474,  2478,  2482,  2487,  2492,
+    2496,  2501,  2506,  2512,  2518,  2524,  2530,  2536,  2542,  2548,
+    2554,  2560,  2566,  2572,  2583,  2587,  2592,  2617,  2627,  2633,
+    2637,  2638,  2640,  2641,  2643,  2644,  2656,  2664,  2668,  2671,
+    2675,  2679,  2684,  2689,  2697,  2704,  2715,  2763,  2814
 };
 #endif
 
@@ -905,12 +905,12 @@ yysymbol_name (yysymbol_kind_t yysymbol)
 }
 #endif
 
-#define YYPACT_NINF (-597)
+#define YYPACT_NINF (-582)
 
 #define yypact_value_is_default(Yyn) \
   ((Yyn) == YYPACT_NINF)
 
-#define YYTABLE_NINF (-337)
+#define YYTABLE_NINF (-338)
 
 #define yytable_value_is_error(Yyn) \
   ((Yyn) == YYTABLE_NINF)
@@ -919,74 +919,74 @@ yysymbol_name (yysymbol_kind_t yysymbol)
    STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-     215,   174,    53,   207,    98,    49,    98,    65,   342,   156,
-      37,    75,   182,   127,    98,   129,    43,   -51,   165,    18,
-    -597,  -597,  -597,  -597,  -597,  -597,  -597,  -597,   230,  -597,
-    -597,   172,  -597,  -597,  -597,  -597,   142,   142,   142,   142,
-      45,    98,   149,   149,   149,   149,   149,    24,   209,    98,
-     160,   218,   242,  -597,  -597,  -597,  -597,  -597,  -597,  -597,
-     682,  -597,  -597,  -597,    95,    97,  -597,  -597,   261,    98,
-     211,    98,  -597,  -597,  -597,  -597,  -597,   224,   102,  -597,
-     288,   147,   148,  -597,    38,  -597,   307,  -597,  -597,    -1,
-     274,  -597,   291,   271,   356,    98,    98,    98,   357,   305,
-     193,   301,   385,    98,    98,    98,   388,   392,   411,   352,
-     421,   421,    13,    29,  -597,  -597,  -597,  -597,  -597,  -597,
-    -597,   230,  -597,  -597,  -597,  -597,  -597,  -597,  -597,  -597,
-     436,  -597,  -597,   280,   129,   421,  -597,  -597,  -597,  -597,
-      -1,  -597,  -597,  -597,   452,   393,   395,   390,  -597,   -15,
-    -597,   193,  -597,    98,   459,     8,  -597,  -597,  -597,  -597,
-    -597,   404,  -597,   302,   -48,  -597,   452,  -597,  -597,   394,
-     399,  -597,  -597,  -597,  -597,  -597,  -597,  -597,  -597,  -597,
-    -597,   417,   172,  -597,  -597,   303,   304,   309,  -597,  -597,
-     412,   486,   310,   312,   313,   471,   482,   483,   490,  -597,
-    -597,   489,   324,   325,   326,   327,   328,   584,   584,  -597,
-     282,   347,   -52,  -597,    15,   627,  -597,  -597,  -597,  -597,
-    -597,  -597,  -597,  -597,  -597,  -597,  -597,   329,  -597,  -597,
-       6,  -597,    41,  -597,   452,   452,   435,  -597,   -51,    17,
-     450,   332,  -597,     0,   336,  -597,    98,   452,   411,  -597,
-     175,   337,   338,   509,   343,  -597,  -597,   203,  -597,  -597,
-    -597,  -597,  -597,  -597,  -597,  -597,  -597,  -597,  -597,  -597,
-     584,   339,   700,   443,   452,   452,    -3,   195,  -597,  -597,
-    -597,  -597,   412,  -597,   516,   452,   517,   520,   521,   179,
-     179,  -597,  -597,   354,   -50,     2,   452,   369,   525,   452,
-     452,   -42,   358,   -14,   584,   584,   584,   584,   584,   584,
-     584,   584,   584,   584,   584,   584,   584,   584,     5,  -597,
-     523,  -597,   527,   370,  -597,   -45,   175,   452,  -597,   230,
-     794,   432,   376,    11,  -597,  -597,  -597,   -51,   459,   381,
-    -597,   551,   452,   379,  -597,   175,  -597,   353,   353,  -597,
-    -597,   452,  -597,    26,   443,   416,   386,    21,   -28,   201,
-    -597,   452,   452,   487,   -79,   387,    71,   116,  -597,  -597,
-     -51,   398,   345,  -597,    28,  -597,  -597,    32,   352,  -597,
-    -597,   422,   396,   584,   347,   445,  -597,   709,   709,   272,
-     272,   637,   709,   709,   272,   272,   179,   179,  -597,  -597,
-    -597,  -597,  -597,  -597,  -597,   452,  -597,  -597,  -597,   175,
-    -597,  -597,  -597,  -597,  -597,  -597,  -597,  -597,  -597,  -597,
-    -597,   397,  -597,  -597,  -597,  -597,  -597,  -597,  -597,  -597,
-    -597,  -597,   405,   406,    69,   407,   459,  -597,    17,   230,
-     122,   459,  -597,   123,   408,   560,   563,  -597,   135,  -597,
-     167,   169,  -597,   403,  -597,   794,   452,  -597,   452,   -55,
-     -24,   584,   400,   577,  -597,   578,  -597,   587,    -9,     2,
-     538,  -597,  -597,  -597,  -597,  -597,  -597,   540,  -597,   592,
-    -597,  -597,  -597,  -597,  -597,   420,   548,   347,   709,   426,
-     181,  -597,   584,  -597,   594,   173,   245,   484,   488,  -597,
-    -597,    69,  -597,   459,   198,  -597,   455,   213,  -597,   452,
-    -597,  -597,  -597,   353,  -597,  -597,  -597,   431,   175,   -41,
-    -597,   452,   505,   433,  -597,  -597,   220,   440,   441,    28,
-     345,     2,     2,   444,    32,   558,   564,   447,   231,  -597,
-    -597,   700,   243,   449,   453,   454,   457,   458,   460,   461,
-     462,   467,   472,   473,   474,   479,   481,   485,   499,  -597,
-    -597,  -597,   247,  -597,   618,   512,   251,  -597,  -597,  -597,
-     175,  -597,   622,  -597,   624,  -597,  -597,  -597,  -597,   572,
-     459,  -597,  -597,  -597,  -597,   452,   452,  -597,  -597,  -597,
-    -597,   629,   654,   656,   658,   660,   670,   671,   673,   674,
-     679,   680,   681,   684,   694,   695,   705,   706,  -597,   613,
-     710,  -597,   539,   541,   452,   275,   542,   175,   543,   544,
-     546,   547,   549,   550,   553,   554,   555,   556,   559,   561,
-     562,   565,   566,   567,   568,   552,  -597,   613,   717,  -597,
-     175,  -597,  -597,  -597,  -597,  -597,  -597,  -597,  -597,  -597,
-    -597,  -597,  -597,  -597,  -597,  -597,  -597,  -597,  -597,   728,
-    -597,   557,   574,   277,  -597,   731,   153,  -597,   728,   573,
-    -597,  -597,  -597,  -597,   613,  -597
+     604,   185,    23,   214,   116,    -5,   116,    82,   471,    31,
+      58,    91,   279,   124,   116,   128,     5,   -54,   175,    86,
+    -582,  -582,  -582,  -582,  -582,  -582,  -582,  -582,   177,  -582,
+    -582,   158,  -582,  -582,  -582,  -582,   112,   112,   112,   112,
+      20,   116,   121,   121,   121,   121,   121,    27,   254,   116,
+     144,   200,   271,  -582,  -582,  -582,  -582,  -582,  -582,  -582,
+     654,  -582,  -582,  -582,  -582,   125,   129,  -582,  -582,   293,
+     116,   206,   116,  -582,  -582,  -582,  -582,  -582,   275,   155,
+    -582,   327,   170,   172,  -582,    38,  -582,   335,  -582,  -582,
+      -1,   301,  -582,   307,   317,   374,   116,   116,   116,   387,
+     332,   225,   340,   395,   116,   116,   116,   409,   415,   416,
+     379,   439,   439,    13,    36,  -582,  -582,  -582,  -582,  -582,
+    -582,  -582,   177,  -582,  -582,  -582,  -582,  -582,  -582,  -582,
+    -582,   438,  -582,  -582,   274,   128,   439,  -582,  -582,  -582,
+    -582,    -1,  -582,  -582,  -582,   434,   400,   380,   386,  -582,
+     -16,  -582,   225,  -582,   116,   448,    26,  -582,  -582,  -582,
+    -582,  -582,   404,  -582,   297,   -43,  -582,   434,  -582,  -582,
+     389,   391,  -582,  -582,  -582,  -582,  -582,  -582,  -582,  -582,
+    -582,  -582,   420,   158,  -582,  -582,   296,   299,   298,  -582,
+    -582,   193,   488,   312,   315,   295,   469,   484,   485,   486,
+    -582,  -582,   489,   328,   329,   330,   331,   344,   592,   592,
+    -582,   284,   377,   -40,  -582,    19,   648,  -582,  -582,  -582,
+    -582,  -582,  -582,  -582,  -582,  -582,  -582,  -582,   325,  -582,
+    -582,   -46,  -582,     7,  -582,   434,   434,   446,  -582,   -54,
+      12,   465,   347,  -582,   -99,   348,  -582,   116,   434,   416,
+    -582,   165,   350,   352,   515,   353,  -582,  -582,   188,  -582,
+    -582,  -582,  -582,  -582,  -582,  -582,  -582,  -582,  -582,  -582,
+    -582,   592,   355,   686,   450,   434,   434,    15,   167,  -582,
+    -582,  -582,  -582,   193,  -582,   524,   434,   525,   526,   534,
+     -64,   -64,  -582,  -582,   366,    69,     2,   434,   383,   538,
+     434,   434,   -49,   373,   -33,   592,   592,   592,   592,   592,
+     592,   592,   592,   592,   592,   592,   592,   592,   592,     6,
+    -582,   540,  -582,   543,   375,  -582,   -42,   165,   434,  -582,
+     177,   785,   435,   384,    90,  -582,  -582,  -582,   -54,   448,
+     385,  -582,   549,   434,   388,  -582,   165,  -582,   349,   349,
+    -582,  -582,   434,  -582,   130,   450,   418,   390,    21,   -48,
+     180,  -582,   434,   434,   492,    65,   392,   159,   164,  -582,
+    -582,   -54,   394,   425,  -582,    28,  -582,  -582,    53,   379,
+    -582,  -582,   422,   399,   592,   377,   445,  -582,   700,   700,
+      70,    70,   266,   700,   700,    70,    70,   -64,   -64,  -582,
+    -582,  -582,  -582,  -582,  -582,  -582,   434,  -582,  -582,  -582,
+     165,  -582,  -582,  -582,  -582,  -582,  -582,  -582,  -582,  -582,
+    -582,  -582,   401,  -582,  -582,  -582,  -582,  -582,  -582,  -582,
+    -582,  -582,  -582,   402,   405,   -31,   406,   448,  -582,    12,
+     177,   166,   448,  -582,   168,   407,   562,   569,  -582,   176,
+    -582,   186,   191,  -582,   403,  -582,   785,   434,  -582,   434,
+      -2,   -28,   592,   411,   578,  -582,   579,  -582,   585,    -9,
+       2,   530,  -582,  -582,  -582,  -582,  -582,  -582,   536,  -582,
+     588,  -582,  -582,  -582,  -582,  -582,   426,   554,   377,   700,
+     432,   196,  -582,   592,  -582,   606,   135,   189,   493,   506,
+    -582,  -582,   -31,  -582,   448,   197,  -582,   475,   202,  -582,
+     434,  -582,  -582,  -582,   349,  -582,  -582,  -582,   452,   165,
+      37,  -582,   434,   580,   447,  -582,  -582,   212,   453,   454,
+      28,   425,     2,     2,   461,    53,   586,   584,   464,   213,
+    -582,  -582,   686,   223,   462,   463,   466,   467,   468,   473,
+     476,   480,   481,   483,   496,   499,   500,   501,   507,   508,
+    -582,  -582,  -582,   231,  -582,   637,   494,   233,  -582,  -582,
+    -582,   165,  -582,   641,  -582,   647,  -582,  -582,  -582,  -582,
+     610,   448,  -582,  -582,  -582,  -582,   434,   434,  -582,  -582,
+    -582,  -582,   679,   680,   681,   682,   687,   688,   689,   690,
+     691,   693,   694,   695,   696,   697,   698,   699,   701,  -582,
+     631,   705,  -582,   533,   537,   434,   237,   545,   165,   546,
+     550,   551,   552,   553,   555,   557,   558,   559,   561,   563,
+     564,   566,   567,   568,   581,   587,   589,  -582,   631,   723,
+    -582,   165,  -582,  -582,  -582,  -582,  -582,  -582,  -582,  -582,
+    -582,  -582,  -582,  -582,  -582,  -582,  -582,  -582,  -582,  -582,
+     732,  -582,   591,   601,   244,  -582,   759,   289,  -582,   732,
+     595,  -582,  -582,  -582,  -582,   631,  -582
 };
 
 /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
@@ -995,103 +995,103 @@ static const yytype_int16 yypact[] =
 static const yytype_int16 yydefact[] =
 {
      167,     0,     0,     0,     0,     0,     0,     0,   103,     0,
-       0,     0,     0,     0,     0,     0,     0,   167,     0,   334,
+       0,     0,     0,     0,     0,     0,     0,   167,     0,   335,
        3,     5,    10,    12,    13,    11,     6,     7,     9,   116,
-     115,     0,     8,    14,    15,    16,   332,   332,   332,   332,
-     332,     0,   330,   330,   330,   330,   330,   160,     0,     0,
+     115,     0,     8,    14,    15,    16,   333,   333,   333,   333,
+     333,     0,   331,   331,   331,   331,   331,   160,     0,     0,
        0,     0,     0,    97,   101,    98,    99,   100,   102,    96,
-     167,   181,   182,   180,     0,     0,   183,   184,     0,     0,
-     188,     0,   193,   194,   195,   197,   196,     0,   166,   168,
-       0,     0,     0,     1,   167,     2,   150,   152,   153,     0,
-     139,   121,   127,     0,     0,     0,     0,     0,     0,     0,
-      94,     0,     0,     0,     0,     0,     0,     0,     0,   145,
-       0,     0,     0,     0,    95,    17,    22,    24,    23,    18,
-      19,    21,    20,    25,    26,    27,   185,   186,   187,   192,
-       0,   189,   209,     0,     0,     0,   120,   119,     4,   151,
-       0,   117,   118,   138,     0,     0,   135,     0,    28,     0,
-      29,    94,   335,     0,     0,   167,   329,   108,   110,   109,
-     111,     0,   161,     0,   145,   105,     0,    90,   328,     0,
-       0,   201,   203,   202,   199,   200,   206,   208,   207,   204,
-     205,   190,     0,   169,   198,     0,     0,   286,   290,   293,
-     294,     0,     0,     0,     0,     0,     0,     0,     0,   291,
-     292,     0,     0,     0,     0,     0,     0,     0,     0,   288,
-       0,   167,   141,   210,   215,   216,   228,   229,   230,   231,
-     225,   220,   219,   218,   226,   227,   217,   224,   223,   301,
-       0,   302,     0,   300,     0,     0,   137,   331,   167,     0,
-       0,     0,    88,     0,     0,    92,     0,     0,     0,   104,
-     144,     0,     0,     0,     0,   124,   123,     0,   312,   311,
-     314,   313,   316,   315,   318,   317,   320,   319,   322,   321,
-       0,     0,   252,   167,     0,     0,     0,     0,   295,   296,
-     297,   298,     0,   299,     0,     0,     0,     0,     0,   254,
-     253,   309,   306,     0,     0,     0,     0,   143,     0,     0,
+     167,   188,   181,   182,   180,     0,     0,   183,   184,     0,
+       0,   189,     0,   194,   195,   196,   198,   197,     0,   166,
+     168,     0,     0,     0,     1,   167,     2,   150,   152,   153,
+       0,   139,   121,   127,     0,     0,     0,     0,     0,     0,
+       0,    94,     0,     0,     0,     0,     0,     0,     0,     0,
+     145,     0,     0,     0,     0,    95,    17,    22,    24,    23,
+      18,    19,    21,    20,    25,    26,    27,   185,   186,   187,
+     193,     0,   190,   210,     0,     0,     0,   120,   119,     4,
+     151,     0,   117,   118,   138,     0,     0,   135,     0,    28,
+       0,    29,    94,   336,     0,     0,   167,   330,   108,   110,
+     109,   111,     0,   161,     0,   145,   105,     0,    90,   329,
+       0,     0,   202,   204,   203,   200,   201,   207,   209,   208,
+     205,   206,   191,     0,   169,   199,     0,     0,   287,   291,
+     294,   295,     0,     0,     0,     0,     0,     0,     0,     0,
+     292,   293,     0,     0,     0,     0,     0,     0,     0,     0,
+     289,     0,   167,   141,   211,   216,   217,   229,   230,   231,
+     232,   226,   221,   220,   219,   227,   228,   218,   225,   224,
+     302,     0,   303,     0,   301,     0,     0,   137,   332,   167,
+       0,     0,     0,    88,     0,     0,    92,     0,     0,     0,
+     104,   144,     0,     0,     0,     0,   124,   123,     0,   313,
+     312,   315,   314,   317,   316,   319,   318,   321,   320,   323,
+     322,     0,     0,   253,   167,     0,     0,     0,     0,   296,
+     297,   298,   299,     0,   300,     0,     0,     0,     0,     0,
+     255,   254,   310,   307,     0,     0,     0,     0,   143,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   305,
-       0,   308,     0,   126,   128,   133,   134,     0,   122,    31,
-       0,     0,     0,     0,    34,    36,    37,   167,     0,    33,
-      93,     0,     0,    91,   112,   107,   106,     0,     0,   191,
-     170,     0,   247,     0,   167,     0,     0,     0,     0,     0,
-     277,     0,     0,     0,     0,     0,     0,     0,   222,   221,
-     167,   140,   154,   156,   165,   157,   211,     0,   145,   214,
-     270,   271,     0,     0,   167,     0,   251,   261,   262,   265,
-     266,     0,   268,   260,   263,   264,   256,   255,   257,   258,
-     259,   287,   289,   307,   310,     0,   131,   132,   130,   136,
-      40,    43,    44,    41,    42,    45,    46,    60,    47,    49,
-      48,    63,    50,    51,    52,    53,    54,    55,    56,    57,
-      58,    59,     0,     0,    38,     0,     0,    30,     0,    32,
-       0,     0,    89,     0,     0,     0,     0,   327,     0,   323,
-       0,     0,   248,     0,   282,     0,     0,   275,     0,     0,
-       0,     0,     0,     0,   235,     0,   237,     0,     0,     0,
-       0,   174,   175,   176,   177,   173,   178,     0,   163,     0,
-     158,   239,   240,   241,   242,   142,   149,   167,   269,     0,
-       0,   250,     0,   129,     0,     0,     0,     0,     0,    83,
-      84,    39,    80,     0,     0,    35,   347,     0,   212,     0,
-     326,   325,   114,     0,   113,   249,   283,     0,   279,     0,
-     278,     0,     0,     0,   303,   304,     0,     0,     0,   165,
-     155,     0,     0,   162,     0,     0,   147,     0,     0,   284,
-     273,   272,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    85,
-      82,    81,     0,    87,     0,     0,     0,   324,   281,   276,
-     280,   267,     0,   233,     0,   236,   238,   159,   171,     0,
-       0,   243,   244,   245,   246,     0,     0,   125,   285,   274,
-      62,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    86,   338,
-       0,   213,     0,     0,     0,     0,   148,   146,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   345,   338,     0,   234,
-     172,   164,    61,    67,    68,    65,    66,    69,    70,    71,
-      64,    75,    76,    73,    74,    77,    78,    79,    72,     0,
-     346,     0,   341,     0,   339,     0,     0,   337,     0,     0,
-     342,   344,   343,   340,   338,   232
+     306,     0,   309,     0,   126,   128,   133,   134,     0,   122,
+      31,     0,     0,     0,     0,    34,    36,    37,   167,     0,
+      33,    93,     0,     0,    91,   112,   107,   106,     0,     0,
+     192,   170,     0,   248,     0,   167,     0,     0,     0,     0,
+       0,   278,     0,     0,     0,     0,     0,     0,     0,   223,
+     222,   167,   140,   154,   156,   165,   157,   212,     0,   145,
+     215,   271,   272,     0,     0,   167,     0,   252,   262,   263,
+     266,   267,     0,   269,   261,   264,   265,   257,   256,   258,
+     259,   260,   288,   290,   308,   311,     0,   131,   132,   130,
+     136,    40,    43,    44,    41,    42,    45,    46,    60,    47,
+      49,    48,    63,    50,    51,    52,    53,    54,    55,    56,
+      57,    58,    59,     0,     0,    38,     0,     0,    30,     0,
+      32,     0,     0,    89,     0,     0,     0,     0,   328,     0,
+     324,     0,     0,   249,     0,   283,     0,     0,   276,     0,
+       0,     0,     0,     0,     0,   236,     0,   238,     0,     0,
+       0,     0,   174,   175,   176,   177,   173,   178,     0,   163,
+       0,   158,   240,   241,   242,   243,   142,   149,   167,   270,
+       0,     0,   251,     0,   129,     0,     0,     0,     0,     0,
+      83,    84,    39,    80,     0,     0,    35,   348,     0,   213,
+       0,   327,   326,   114,     0,   113,   250,   284,     0,   280,
+       0,   279,     0,     0,     0,   304,   305,     0,     0,     0,
+     165,   155,     0,     0,   162,     0,     0,   147,     0,     0,
+     285,   274,   273,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      85,    82,    81,     0,    87,     0,     0,     0,   325,   282,
+     277,   281,   268,     0,   234,     0,   237,   239,   159,   171,
+       0,     0,   244,   245,   246,   247,     0,     0,   125,   286,
+     275,    62,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    86,
+     339,     0,   214,     0,     0,     0,     0,   148,   146,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   346,   339,     0,
+     235,   172,   164,    61,    67,    68,    65,    66,    69,    70,
+      71,    64,    75,    76,    73,    74,    77,    78,    79,    72,
+       0,   347,     0,   342,     0,   340,     0,     0,   338,     0,
+       0,   343,   345,   344,   341,   339,   233
 };
 
 /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -597,  -597,  -597,   663,  -597,   688,  -597,   314,  -597,   298,
-    -597,   257,  -597,  -334,   699,   707,   609,  -597,  -597,   708,
-    -597,   518,   715,   718,   -57,   760,   -17,   598,   641,   -32,
-    -597,  -597,   377,  -597,  -597,  -597,  -597,  -597,  -597,  -158,
-    -597,  -597,  -597,  -597,   315,  -225,    22,   254,  -597,  -597,
-     651,  -597,  -597,   726,   727,   737,   738,  -255,  -597,   492,
-    -165,  -164,  -368,  -367,  -366,  -364,  -597,  -597,  -597,  -597,
-    -597,  -597,   531,  -597,  -597,  -597,  -597,  -597,   346,  -597,
-     348,  -597,   608,   463,   299,   -43,    31,   232,  -597,  -597,
-    -596,  -597,   145,  -597
+    -582,  -582,  -582,   684,  -582,   710,  -582,   333,  -582,   318,
+    -582,   269,  -582,  -335,   713,   715,   625,  -582,  -582,   718,
+    -582,   531,   719,   721,   -57,   770,   -17,   605,   650,   -60,
+    -582,  -582,   393,  -582,  -582,  -582,  -582,  -582,  -582,  -159,
+    -582,  -582,  -582,  -582,   319,  -182,    18,   262,  -582,  -582,
+     658,  -582,  -582,   734,   735,   736,   737,  -256,  -582,   503,
+    -166,  -165,  -370,  -368,  -367,  -365,  -582,  -582,  -582,  -582,
+    -582,  -582,   521,  -582,  -582,  -582,  -582,  -582,   338,  -582,
+     339,  -582,   607,   457,   294,    -4,   227,   273,  -582,  -582,
+    -581,  -582,   134,  -582
 };
 
 /* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
-       0,    18,    19,    20,   114,    21,   333,   334,   335,   434,
-     501,   502,   336,   243,    22,    23,   155,    24,    60,    25,
-     164,   165,    26,    27,    28,    29,    30,    91,   141,    92,
-     146,   323,   324,   408,   236,   328,   144,   297,   378,   167,
-     587,   536,    89,   371,   372,   373,   374,   480,    31,    78,
-      79,   375,   477,    32,    33,    34,    35,   212,   343,   213,
-     214,   215,   216,   217,   218,   219,   485,   220,   221,   222,
-     223,   224,   277,   225,   226,   227,   228,   523,   229,   230,
-     231,   232,   233,   448,   449,   169,   102,    94,    85,    99,
-     636,   663,   664,   339
+       0,    18,    19,    20,   115,    21,   334,   335,   336,   435,
+     502,   503,   337,   244,    22,    23,   156,    24,    60,    25,
+     165,   166,    26,    27,    28,    29,    30,    92,   142,    93,
+     147,   324,   325,   409,   237,   329,   145,   298,   379,   168,
+     588,   537,    90,   372,   373,   374,   375,   481,    31,    79,
+      80,   376,   478,    32,    33,    34,    35,   213,   344,   214,
+     215,   216,   217,   218,   219,   220,   486,   221,   222,   223,
+     224,   225,   278,   226,   227,   228,   229,   524,   230,   231,
+     232,   233,   234,   449,   450,   170,   103,    95,    86,   100,
+     637,   664,   665,   340
 };
 
 /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
@@ -1099,192 +1099,190 @@ static const yytype_int16 yydefgoto[] =
    number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
-      82,   250,   353,   121,   440,    47,   249,    90,   401,   481,
-     482,   483,    86,   484,    87,   166,    88,   171,   172,   173,
-     330,   295,   406,   407,    15,   520,    48,   272,    50,   276,
-     382,   478,    70,   176,   177,   178,    76,   238,  -333,   569,
-      47,   660,   244,   289,   290,     1,   294,     2,     3,     4,
-       5,     6,     7,     8,     9,   456,   385,   142,    10,   521,
-     299,   300,    11,   100,    12,    13,    14,   298,   170,   325,
-     326,   109,   174,   455,   103,   104,   105,   106,   675,    69,
-     479,   275,   345,    15,   299,   300,    41,   443,   179,   299,
-     300,   129,   184,   132,   299,   300,   451,   462,   299,   300,
-     383,    47,   504,   386,  -336,    71,   272,   507,   186,   357,
-     358,   299,   300,    15,    93,   299,   300,   149,   150,   151,
-     364,    17,    49,   369,   296,   158,   159,   160,   248,   490,
-      75,   331,    77,   332,   380,   381,   299,   300,   245,   497,
-     387,   388,   389,   390,   391,   392,   393,   394,   395,   396,
-     397,   398,   399,   400,   299,   300,   670,   239,   671,   672,
-     299,   300,   409,   175,   529,    83,   581,   582,   583,   562,
-     584,   140,   402,   340,   370,   241,   341,   319,   203,   180,
-      90,   329,   320,   498,   437,   499,   500,   438,    61,    16,
-     204,   205,   206,    84,   293,    80,   459,   460,   107,   452,
-      62,    63,   296,    36,    37,    38,   187,   188,   189,   190,
-      17,    93,   321,    51,    52,    39,    40,   322,   101,   488,
-     486,   112,     1,   108,     2,     3,     4,     5,     6,     7,
-       8,     9,   538,   110,   111,    10,    42,    43,    44,    11,
-     325,    12,    13,    14,   464,   113,   615,   465,    45,    46,
-     126,    86,   127,    87,   566,    88,   356,   130,   131,   543,
-     544,   545,   546,   547,   128,   351,   548,   549,   344,    95,
-      96,    97,    98,   191,   192,   360,   133,   361,   134,   362,
-     439,   457,   193,   458,   194,   362,   550,   291,   292,   466,
-      15,   518,   467,   519,   135,   506,   508,   522,   341,   296,
-     195,   196,   197,   198,    64,    65,   578,   579,   512,    66,
-      67,   513,    68,   468,   299,   300,   187,   188,   189,   190,
-     136,   137,   199,   200,   201,    72,    73,    74,   541,   139,
-     616,   551,   552,   553,   554,   555,   143,   453,   556,   557,
-     514,   147,   515,   513,   202,   296,   315,   316,   317,   203,
-     187,   188,   189,   190,   540,   145,   570,   296,   558,   148,
-     152,   204,   205,   206,   153,   154,    16,   489,   207,   208,
-     209,   563,   156,   210,   341,   211,   352,    53,    54,    55,
-      56,    57,    58,   191,   192,    59,   565,    17,   157,   341,
-     303,   161,   193,   573,   194,   162,   574,   275,   470,  -179,
-     471,   472,   473,   474,   589,   475,   476,   296,  -337,  -337,
-     195,   196,   197,   198,   163,   166,   590,   191,   192,   591,
-     608,   617,    15,   341,   611,   168,   193,   296,   194,   445,
-     446,   447,   199,   200,   201,  -337,  -337,   313,   314,   315,
-     316,   317,   181,   234,   195,   196,   197,   198,   641,   640,
-     667,   341,   182,   668,   202,   187,   188,   189,   190,   203,
-     235,   237,   242,   246,   247,   253,   199,   200,   201,   251,
-     537,   204,   205,   206,   252,   278,   255,   256,   207,   208,
-     209,   257,   273,   210,   274,   211,   279,   280,   202,   187,
-     188,   189,   190,   203,   281,   282,   284,   285,   286,   287,
-     288,   327,   337,   318,   338,   204,   205,   206,   342,   347,
-     348,   354,   207,   208,   209,   349,   350,   210,    15,   211,
-     363,   365,   191,   192,   366,   367,   377,   368,   379,   403,
-     384,   193,   404,   194,   258,   259,   260,   261,   262,   263,
-     264,   265,   266,   267,   268,   269,   405,   435,   436,   195,
-     196,   197,   198,   441,   442,   444,   270,   271,   383,   454,
-     461,   299,   491,   463,   510,   193,   511,   194,   487,   494,
-     210,   199,   200,   201,   469,   355,   516,   495,   496,   503,
-     509,   526,   527,   195,   196,   197,   198,   187,   188,   189,
-     190,   528,   531,   202,   532,   533,   534,   535,   203,   539,
-     542,   559,   564,   560,   568,   199,   200,   201,   585,   572,
-     204,   205,   206,   575,   576,   586,   580,   207,   208,   209,
-     588,   609,   210,   303,   211,   592,   612,   202,   613,   593,
-     594,   614,   203,   595,   596,   618,   597,   598,   599,   304,
-     305,   306,   307,   600,   204,   205,   206,   309,   601,   602,
-     603,   207,   208,   209,   270,   604,   210,   605,   211,   610,
-     619,   606,   620,   193,   621,   194,   622,   310,   311,   312,
-     313,   314,   315,   316,   317,   607,   623,   624,   571,   625,
-     626,   195,   196,   197,   198,   627,   628,   629,   635,     1,
-     630,     2,     3,     4,     5,     6,     7,   301,     9,   302,
-     631,   632,    10,   199,   200,   201,    11,   355,    12,    13,
-      14,   633,   634,   637,   639,   638,   642,   643,   296,   644,
-     645,   661,   646,   647,   659,   202,   648,   649,   650,   651,
-     203,   662,   652,   665,   653,   654,   666,   669,   655,   656,
-     657,   658,   204,   205,   206,   303,   674,   138,   115,   207,
-     208,   209,   505,   517,   210,   303,   211,    15,   561,   116,
-     240,   304,   305,   306,   307,   308,   346,   117,   118,   309,
-     355,   304,   305,   306,   307,   119,   492,    81,   120,   309,
-     254,   185,   493,   577,   530,   183,   122,   123,   376,   310,
-     311,   312,   313,   314,   315,   316,   317,   124,   125,   310,
-     311,   312,   313,   314,   315,   316,   317,   359,   524,   283,
-     525,   450,   567,   673,     0,     0,     0,     0,   303,     0,
-       0,     0,     0,     0,     0,     0,     0,   303,     0,     0,
-       0,     0,     0,    16,   304,   305,   306,   307,     0,     0,
-       0,     0,   309,  -337,  -337,   306,   307,     0,     0,     0,
-       0,  -337,     0,     0,    17,     0,     0,     0,     0,     0,
-       0,     0,   310,   311,   312,   313,   314,   315,   316,   317,
-       0,  -337,   311,   312,   313,   314,   315,   316,   317,   410,
+      83,   251,   354,   122,   441,    47,   250,    91,   482,   402,
+     483,   484,    87,   485,    88,   331,    89,   172,   173,   174,
+     167,    15,    48,   383,    50,   407,   408,   273,    71,   277,
+     143,   479,    77,   296,    61,   457,   239,   386,  -334,   498,
+     177,   178,   179,   290,   291,     1,   295,     2,     3,     4,
+       5,     6,     7,     8,     9,   522,    41,   661,    10,   101,
+     245,    47,    11,    62,    12,    13,    14,   110,    49,   326,
+     327,   299,   175,   456,   341,    63,    64,   342,   521,  -337,
+     480,   187,   346,   499,   387,   500,   501,   444,   130,    94,
+     133,   300,   301,   384,   676,   180,   452,   300,   301,   276,
+      70,    15,   505,   316,   317,   318,   273,   508,   171,   358,
+     359,   300,   301,    15,   150,   151,   152,   570,    17,    47,
+     365,    72,   159,   160,   161,   320,   332,    76,   333,   491,
+     321,    78,   185,   249,   381,   382,   297,   300,   301,   246,
+     388,   389,   390,   391,   392,   393,   394,   395,   396,   397,
+     398,   399,   400,   401,   300,   301,   240,    81,   300,   301,
+     300,   301,   410,   176,   530,   582,    91,   583,   584,   563,
+     585,   141,   242,   403,   371,    84,   300,   301,   322,    65,
+      66,    94,   330,   323,    67,    68,   181,    69,   304,    16,
+     102,   188,   189,   190,   191,   294,   460,   461,    87,   204,
+      88,   108,    89,   113,   300,   301,  -338,  -338,   300,   301,
+      17,   205,   206,   207,    36,    37,    38,   111,   112,   489,
+     487,   544,   545,   546,   547,   548,    39,    40,   549,   550,
+      51,    52,   539,  -338,  -338,   314,   315,   316,   317,   318,
+     326,   463,   370,    42,    43,    44,   616,   361,   551,   362,
+     352,   363,   131,   132,   567,    45,    46,   357,   192,   193,
+     458,    85,   459,   438,   363,   345,   439,   194,   109,   195,
+     104,   105,   106,   107,   114,   552,   553,   554,   555,   556,
+     127,   440,   557,   558,   128,   196,   197,   198,   199,   292,
+     293,   519,   671,   520,   672,   673,   129,   523,   188,   189,
+     190,   191,   559,   453,   300,   301,   297,   200,   201,   202,
+      96,    97,    98,    99,   469,   259,   260,   261,   262,   263,
+     264,   265,   266,   267,   268,   269,   270,   134,   542,   203,
+     617,   135,   465,   136,   204,   466,   356,   467,   454,   507,
+     468,   509,   342,   137,   297,   138,   205,   206,   207,   513,
+     579,   580,   514,   208,   209,   210,   571,   140,   211,   515,
+     212,   353,   514,   144,   516,   192,   193,   297,   490,   541,
+     564,   146,   297,   342,   194,   566,   195,   149,   342,   276,
+     188,   189,   190,   191,   304,   574,   590,   148,   575,   297,
+     153,   154,   196,   197,   198,   199,   591,   155,   158,   592,
+     305,   306,   307,   308,   609,   493,   612,   342,   310,   297,
+     642,   157,   162,   342,   200,   201,   202,   668,   163,   164,
+     669,   618,    73,    74,    75,   446,   447,   448,   311,   312,
+     313,   314,   315,   316,   317,   318,   203,   188,   189,   190,
+     191,   204,   167,   169,   182,   236,   183,   192,   193,   641,
+     235,   243,    15,   205,   206,   207,   194,   238,   195,   248,
+     208,   209,   210,   247,   252,   211,   253,   212,   254,   256,
+     258,   538,   257,   279,   196,   197,   198,   199,   471,  -179,
+     472,   473,   474,   475,   274,   476,   477,   275,   280,   281,
+     282,   188,   189,   190,   191,   283,   200,   201,   202,   319,
+     285,   286,   287,   288,   192,   193,    53,    54,    55,    56,
+      57,    58,   328,   194,    59,   195,   289,   338,   203,   339,
+     343,   350,   348,   204,   349,    15,   351,   355,   364,   366,
+     367,   196,   197,   198,   199,   205,   206,   207,   368,   369,
+     378,   380,   208,   209,   210,   385,   404,   211,   405,   212,
+     436,   406,   443,   200,   201,   202,   437,   442,   271,   272,
+     384,   300,   492,   455,   445,   462,   511,   194,   464,   195,
+     470,   488,   512,   495,   496,   203,   517,   497,   504,   510,
+     204,   211,   527,   528,   532,   196,   197,   198,   199,   529,
+     533,   534,   205,   206,   207,   188,   189,   190,   191,   208,
+     209,   210,   535,   536,   211,   540,   212,   200,   201,   202,
+     560,     1,   543,     2,     3,     4,     5,     6,     7,     8,
+       9,   561,   565,   573,    10,   569,   576,   577,    11,   203,
+      12,    13,    14,   581,   204,   587,   586,   589,   593,   594,
+     610,   611,   595,   596,   597,   613,   205,   206,   207,   598,
+     356,   614,   599,   208,   209,   210,   600,   601,   211,   602,
+     212,     1,   271,     2,     3,     4,     5,     6,     7,   615,
+       9,   194,   603,   195,    10,   604,   605,   606,    11,    15,
+      12,    13,    14,   607,   608,   619,   620,   621,   622,   196,
+     197,   198,   199,   623,   624,   625,   626,   627,   304,   628,
+     629,   630,   631,   632,   633,   634,   636,   635,   638,   639,
+     640,   200,   201,   202,   305,   306,   307,   308,   302,   643,
+     303,   297,   310,   644,   645,   646,   647,   662,   648,    15,
+     649,   650,   651,   203,   652,   663,   653,   654,   204,   655,
+     656,   657,   311,   312,   313,   314,   315,   316,   317,   318,
+     205,   206,   207,   572,   658,    16,   356,   208,   209,   210,
+     659,   660,   211,   667,   212,   670,   304,   666,   675,   139,
+     116,   562,   506,   117,   518,   118,    17,   241,   119,   120,
+     347,   121,   305,   306,   307,   308,   309,    82,   255,   531,
+     310,   186,   578,   184,   123,   124,   125,   126,   360,   494,
+     377,   525,   526,   674,   304,    16,   451,     0,   568,   284,
+     311,   312,   313,   314,   315,   316,   317,   318,   304,     0,
+     305,   306,   307,   308,     0,     0,    17,     0,   310,     0,
+       0,     0,     0,     0,  -338,  -338,   307,   308,     0,     0,
+       0,     0,  -338,     0,     0,     0,     0,     0,   311,   312,
+     313,   314,   315,   316,   317,   318,     0,     0,     0,     0,
+       0,     0,  -338,   312,   313,   314,   315,   316,   317,   318,
      411,   412,   413,   414,   415,   416,   417,   418,   419,   420,
      421,   422,   423,   424,   425,   426,   427,   428,   429,   430,
-       0,     0,   431,     0,     0,   432,   433
+     431,     0,     0,   432,     0,     0,   433,   434
 };
 
 static const yytype_int16 yycheck[] =
 {
-      17,   166,   257,    60,   338,     3,   164,     8,     3,   377,
-     377,   377,    21,   377,    23,    63,    25,     4,     5,     6,
-       3,    73,    67,    68,    75,    80,     4,   191,     6,   194,
-      72,     3,    10,     4,     5,     6,    14,    52,     0,    80,
-       3,   637,    34,   207,   208,     7,   211,     9,    10,    11,
-      12,    13,    14,    15,    16,    83,    70,    89,    20,    83,
-     139,   140,    24,    41,    26,    27,    28,    52,   111,   234,
-     235,    49,    59,    52,    43,    44,    45,    46,   674,    42,
-      52,    84,   247,    75,   139,   140,    33,   342,    59,   139,
-     140,    69,   135,    71,   139,   140,   351,   176,   139,   140,
-     142,     3,   436,   117,    59,    30,   270,   441,   140,   274,
-     275,   139,   140,    75,    69,   139,   140,    95,    96,    97,
-     285,   172,    73,   173,   176,   103,   104,   105,   176,   384,
-       3,   114,     3,   116,   299,   300,   139,   140,   155,    70,
-     304,   305,   306,   307,   308,   309,   310,   311,   312,   313,
-     314,   315,   316,   317,   139,   140,     3,   172,     5,     6,
-     139,   140,   327,   150,   173,     0,   534,   534,   534,   503,
-     534,   172,   167,   173,   172,   153,   176,   171,   146,   150,
-       8,   238,   176,   114,   173,   116,   117,   176,    32,   151,
-     158,   159,   160,   175,   211,   152,   361,   362,   174,   173,
-      44,    45,   176,    29,    30,    31,     3,     4,     5,     6,
-     172,    69,   171,   148,   149,    41,    42,   176,    69,   383,
-     378,     3,     7,    14,     9,    10,    11,    12,    13,    14,
-      15,    16,   487,    73,    74,    20,    29,    30,    31,    24,
-     405,    26,    27,    28,   173,     3,   580,   176,    41,    42,
-     155,    21,   155,    23,   509,    25,   273,    46,    47,    86,
-      87,    88,    89,    90,     3,    62,    93,    94,   246,    37,
-      38,    39,    40,    70,    71,    80,    52,    82,   176,    84,
-     337,    80,    79,    82,    81,    84,   113,     5,     6,   173,
-      75,   456,   176,   458,     6,   173,   173,   461,   176,   176,
-      97,    98,    99,   100,   148,   149,   531,   532,   173,   153,
-     154,   176,   156,   370,   139,   140,     3,     4,     5,     6,
-     173,   173,   119,   120,   121,   143,   144,   145,   492,    22,
-     585,    86,    87,    88,    89,    90,    62,   354,    93,    94,
-     173,    70,   173,   176,   141,   176,   167,   168,   169,   146,
-       3,     4,     5,     6,   173,    64,   521,   176,   113,     3,
-       3,   158,   159,   160,    59,   172,   151,   384,   165,   166,
-     167,   173,    71,   170,   176,   172,   173,    35,    36,    37,
-      38,    39,    40,    70,    71,    43,   173,   172,     3,   176,
-     118,     3,    79,   173,    81,     3,   176,    84,    53,    54,
-      55,    56,    57,    58,   173,    60,    61,   176,   136,   137,
-      97,    98,    99,   100,     3,    63,   173,    70,    71,   176,
-     173,   586,    75,   176,   173,     4,    79,   176,    81,    76,
-      77,    78,   119,   120,   121,   163,   164,   165,   166,   167,
-     168,   169,     6,    50,    97,    98,    99,   100,   173,   614,
-     173,   176,   172,   176,   141,     3,     4,     5,     6,   146,
-      65,    71,     3,    59,   162,    48,   119,   120,   121,    75,
-     487,   158,   159,   160,    75,     4,   173,   173,   165,   166,
-     167,   172,   172,   170,   172,   172,     4,     4,   141,     3,
-       4,     5,     6,   146,     4,     6,   172,   172,   172,   172,
-     172,    66,    52,   174,   172,   158,   159,   160,   172,   172,
-     172,   172,   165,   166,   167,     6,   173,   170,    75,   172,
-       4,     4,    70,    71,     4,     4,   157,   173,     3,     6,
-     172,    79,     5,    81,   122,   123,   124,   125,   126,   127,
-     128,   129,   130,   131,   132,   133,   176,   115,   172,    97,
-      98,    99,   100,   172,     3,   176,    70,    71,   142,   173,
-      73,   139,   117,   176,     4,    79,     3,    81,   172,   172,
-     170,   119,   120,   121,   176,    70,   173,   172,   172,   172,
-     172,     4,     4,    97,    98,    99,   100,     3,     4,     5,
-       6,     4,    54,   141,    54,     3,   176,    49,   146,   173,
-       6,   117,   147,   115,   173,   119,   120,   121,    50,   176,
-     158,   159,   160,   173,   173,    51,   172,   165,   166,   167,
-     173,     3,   170,   118,   172,   176,     4,   141,     4,   176,
-     176,    59,   146,   176,   176,     6,   176,   176,   176,   134,
-     135,   136,   137,   176,   158,   159,   160,   142,   176,   176,
-     176,   165,   166,   167,    70,   176,   170,   176,   172,   147,
-       6,   176,     6,    79,     6,    81,     6,   162,   163,   164,
-     165,   166,   167,   168,   169,   176,     6,     6,   173,     6,
-       6,    97,    98,    99,   100,     6,     6,     6,    75,     7,
-       6,     9,    10,    11,    12,    13,    14,    70,    16,    72,
-       6,     6,    20,   119,   120,   121,    24,    70,    26,    27,
-      28,     6,     6,     3,   173,   176,   173,   173,   176,   173,
-     173,     4,   173,   173,   172,   141,   173,   173,   173,   173,
-     146,     3,   173,   176,   173,   173,   162,     6,   173,   173,
-     173,   173,   158,   159,   160,   118,   173,    84,    60,   165,
-     166,   167,   438,   455,   170,   118,   172,    75,   501,    60,
-     151,   134,   135,   136,   137,   138,   248,    60,    60,   142,
-      70,   134,   135,   136,   137,    60,   139,    17,    60,   142,
-     182,   140,   405,   529,   469,   134,    60,    60,   296,   162,
-     163,   164,   165,   166,   167,   168,   169,    60,    60,   162,
-     163,   164,   165,   166,   167,   168,   169,   276,   462,   201,
-     462,   348,   513,   668,    -1,    -1,    -1,    -1,   118,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   118,    -1,    -1,
-      -1,    -1,    -1,   151,   134,   135,   136,   137,    -1,    -1,
-      -1,    -1,   142,   134,   135,   136,   137,    -1,    -1,    -1,
-      -1,   142,    -1,    -1,   172,    -1,    -1,    -1,    -1,    -1,
+      17,   167,   258,    60,   339,     3,   165,     8,   378,     3,
+     378,   378,    21,   378,    23,     3,    25,     4,     5,     6,
+      63,    75,     4,    72,     6,    67,    68,   192,    10,   195,
+      90,     3,    14,    73,     3,    83,    52,    70,     0,    70,
+       4,     5,     6,   208,   209,     7,   212,     9,    10,    11,
+      12,    13,    14,    15,    16,    83,    33,   638,    20,    41,
+      34,     3,    24,    32,    26,    27,    28,    49,    73,   235,
+     236,    52,    59,    52,   173,    44,    45,   176,    80,    59,
+      52,   141,   248,   114,   117,   116,   117,   343,    70,    69,
+      72,   139,   140,   142,   675,    59,   352,   139,   140,    84,
+      42,    75,   437,   167,   168,   169,   271,   442,   112,   275,
+     276,   139,   140,    75,    96,    97,    98,    80,   172,     3,
+     286,    30,   104,   105,   106,   171,   114,     3,   116,   385,
+     176,     3,   136,   176,   300,   301,   176,   139,   140,   156,
+     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
+     315,   316,   317,   318,   139,   140,   172,   152,   139,   140,
+     139,   140,   328,   150,   173,   535,     8,   535,   535,   504,
+     535,   172,   154,   167,   172,     0,   139,   140,   171,   148,
+     149,    69,   239,   176,   153,   154,   150,   156,   118,   151,
+      69,     3,     4,     5,     6,   212,   362,   363,    21,   146,
+      23,   174,    25,     3,   139,   140,   136,   137,   139,   140,
+     172,   158,   159,   160,    29,    30,    31,    73,    74,   384,
+     379,    86,    87,    88,    89,    90,    41,    42,    93,    94,
+     148,   149,   488,   163,   164,   165,   166,   167,   168,   169,
+     406,   176,   173,    29,    30,    31,   581,    80,   113,    82,
+      62,    84,    46,    47,   510,    41,    42,   274,    70,    71,
+      80,   175,    82,   173,    84,   247,   176,    79,    14,    81,
+      43,    44,    45,    46,     3,    86,    87,    88,    89,    90,
+     155,   338,    93,    94,   155,    97,    98,    99,   100,     5,
+       6,   457,     3,   459,     5,     6,     3,   462,     3,     4,
+       5,     6,   113,   173,   139,   140,   176,   119,   120,   121,
+      37,    38,    39,    40,   371,   122,   123,   124,   125,   126,
+     127,   128,   129,   130,   131,   132,   133,    52,   493,   141,
+     586,   176,   173,     6,   146,   176,    70,   173,   355,   173,
+     176,   173,   176,   173,   176,   173,   158,   159,   160,   173,
+     532,   533,   176,   165,   166,   167,   522,    22,   170,   173,
+     172,   173,   176,    62,   173,    70,    71,   176,   385,   173,
+     173,    64,   176,   176,    79,   173,    81,     3,   176,    84,
+       3,     4,     5,     6,   118,   173,   173,    70,   176,   176,
+       3,    59,    97,    98,    99,   100,   173,   172,     3,   176,
+     134,   135,   136,   137,   173,   139,   173,   176,   142,   176,
+     173,    71,     3,   176,   119,   120,   121,   173,     3,     3,
+     176,   587,   143,   144,   145,    76,    77,    78,   162,   163,
+     164,   165,   166,   167,   168,   169,   141,     3,     4,     5,
+       6,   146,    63,     4,     6,    65,   172,    70,    71,   615,
+      50,     3,    75,   158,   159,   160,    79,    71,    81,   162,
+     165,   166,   167,    59,    75,   170,    75,   172,    48,   173,
+     172,   488,   173,     4,    97,    98,    99,   100,    53,    54,
+      55,    56,    57,    58,   172,    60,    61,   172,     4,     4,
+       4,     3,     4,     5,     6,     6,   119,   120,   121,   174,
+     172,   172,   172,   172,    70,    71,    35,    36,    37,    38,
+      39,    40,    66,    79,    43,    81,   172,    52,   141,   172,
+     172,     6,   172,   146,   172,    75,   173,   172,     4,     4,
+       4,    97,    98,    99,   100,   158,   159,   160,     4,   173,
+     157,     3,   165,   166,   167,   172,     6,   170,     5,   172,
+     115,   176,     3,   119,   120,   121,   172,   172,    70,    71,
+     142,   139,   117,   173,   176,    73,     4,    79,   176,    81,
+     176,   172,     3,   172,   172,   141,   173,   172,   172,   172,
+     146,   170,     4,     4,    54,    97,    98,    99,   100,     4,
+      54,     3,   158,   159,   160,     3,     4,     5,     6,   165,
+     166,   167,   176,    49,   170,   173,   172,   119,   120,   121,
+     117,     7,     6,     9,    10,    11,    12,    13,    14,    15,
+      16,   115,   147,   176,    20,   173,   173,   173,    24,   141,
+      26,    27,    28,   172,   146,    51,    50,   173,   176,   176,
+       3,   147,   176,   176,   176,     4,   158,   159,   160,   176,
+      70,     4,   176,   165,   166,   167,   176,   176,   170,   176,
+     172,     7,    70,     9,    10,    11,    12,    13,    14,    59,
+      16,    79,   176,    81,    20,   176,   176,   176,    24,    75,
+      26,    27,    28,   176,   176,     6,     6,     6,     6,    97,
+      98,    99,   100,     6,     6,     6,     6,     6,   118,     6,
+       6,     6,     6,     6,     6,     6,    75,     6,     3,   176,
+     173,   119,   120,   121,   134,   135,   136,   137,    70,   173,
+      72,   176,   142,   173,   173,   173,   173,     4,   173,    75,
+     173,   173,   173,   141,   173,     3,   173,   173,   146,   173,
+     173,   173,   162,   163,   164,   165,   166,   167,   168,   169,
+     158,   159,   160,   173,   173,   151,    70,   165,   166,   167,
+     173,   172,   170,   162,   172,     6,   118,   176,   173,    85,
+      60,   502,   439,    60,   456,    60,   172,   152,    60,    60,
+     249,    60,   134,   135,   136,   137,   138,    17,   183,   470,
+     142,   141,   530,   135,    60,    60,    60,    60,   277,   406,
+     297,   463,   463,   669,   118,   151,   349,    -1,   514,   202,
+     162,   163,   164,   165,   166,   167,   168,   169,   118,    -1,
+     134,   135,   136,   137,    -1,    -1,   172,    -1,   142,    -1,
+      -1,    -1,    -1,    -1,   134,   135,   136,   137,    -1,    -1,
+      -1,    -1,   142,    -1,    -1,    -1,    -1,    -1,   162,   163,
+     164,   165,   166,   167,   168,   169,    -1,    -1,    -1,    -1,
       -1,    -1,   162,   163,   164,   165,   166,   167,   168,   169,
-      -1,   162,   163,   164,   165,   166,   167,   168,   169,    85,
-      86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
-      96,    97,    98,    99,   100,   101,   102,   103,   104,   105,
-      -1,    -1,   108,    -1,    -1,   111,   112
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,    -1,    -1,   108,    -1,    -1,   111,   112
 };
 
 /* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
@@ -1297,68 +1295,68 @@ static const yytype_int16 yystos[] =
      203,   225,   230,   231,   232,   233,    29,    30,    31,    41,
       42,    33,    29,    30,    31,    41,    42,     3,   223,    73,
      223,   148,   149,    35,    36,    37,    38,    39,    40,    43,
-     195,    32,    44,    45,   148,   149,   153,   154,   156,    42,
-     223,    30,   143,   144,   145,     3,   223,     3,   226,   227,
-     152,   202,   203,     0,   175,   265,    21,    23,    25,   219,
-       8,   204,   206,    69,   264,   264,   264,   264,   264,   266,
-     223,    69,   263,   263,   263,   263,   263,   174,    14,   223,
-      73,    74,     3,     3,   181,   182,   191,   192,   196,   199,
-     200,   201,   230,   231,   232,   233,   155,   155,     3,   223,
-      46,    47,   223,    52,   176,     6,   173,   173,   180,    22,
-     172,   205,   206,    62,   213,    64,   207,    70,     3,   223,
-     223,   223,     3,    59,   172,   193,    71,     3,   223,   223,
-     223,     3,     3,     3,   197,   198,    63,   216,     4,   262,
-     262,     4,     5,     6,    59,   150,     4,     5,     6,    59,
-     150,     6,   172,   227,   262,   205,   206,     3,     4,     5,
-       6,    70,    71,    79,    81,    97,    98,    99,   100,   119,
-     120,   121,   141,   146,   158,   159,   160,   165,   166,   167,
-     170,   172,   234,   236,   237,   238,   239,   240,   241,   242,
-     244,   245,   246,   247,   248,   250,   251,   252,   253,   255,
-     256,   257,   258,   259,    50,    65,   211,    71,    52,   172,
-     193,   223,     3,   190,    34,   203,    59,   162,   176,   216,
-     237,    75,    75,    48,   204,   173,   173,   172,   122,   123,
-     124,   125,   126,   127,   128,   129,   130,   131,   132,   133,
-      70,    71,   238,   172,   172,    84,   237,   249,     4,     4,
-       4,     4,     6,   259,   172,   172,   172,   172,   172,   238,
-     238,     5,     6,   203,   237,    73,   176,   214,    52,   139,
-     140,    70,    72,   118,   134,   135,   136,   137,   138,   142,
-     162,   163,   164,   165,   166,   167,   168,   169,   174,   171,
-     176,   171,   176,   208,   209,   237,   237,    66,   212,   201,
-       3,   114,   116,   183,   184,   185,   189,    52,   172,   270,
-     173,   176,   172,   235,   223,   237,   198,   172,   172,     6,
-     173,    62,   173,   234,   172,    70,   203,   237,   237,   249,
-      80,    82,    84,     4,   237,     4,     4,     4,   173,   173,
-     172,   220,   221,   222,   223,   228,   236,   157,   215,     3,
-     237,   237,    72,   142,   172,    70,   117,   238,   238,   238,
+     195,     3,    32,    44,    45,   148,   149,   153,   154,   156,
+      42,   223,    30,   143,   144,   145,     3,   223,     3,   226,
+     227,   152,   202,   203,     0,   175,   265,    21,    23,    25,
+     219,     8,   204,   206,    69,   264,   264,   264,   264,   264,
+     266,   223,    69,   263,   263,   263,   263,   263,   174,    14,
+     223,    73,    74,     3,     3,   181,   182,   191,   192,   196,
+     199,   200,   201,   230,   231,   232,   233,   155,   155,     3,
+     223,    46,    47,   223,    52,   176,     6,   173,   173,   180,
+      22,   172,   205,   206,    62,   213,    64,   207,    70,     3,
+     223,   223,   223,     3,    59,   172,   193,    71,     3,   223,
+     223,   223,     3,     3,     3,   197,   198,    63,   216,     4,
+     262,   262,     4,     5,     6,    59,   150,     4,     5,     6,
+      59,   150,     6,   172,   227,   262,   205,   206,     3,     4,
+       5,     6,    70,    71,    79,    81,    97,    98,    99,   100,
+     119,   120,   121,   141,   146,   158,   159,   160,   165,   166,
+     167,   170,   172,   234,   236,   237,   238,   239,   240,   241,
+     242,   244,   245,   246,   247,   248,   250,   251,   252,   253,
+     255,   256,   257,   258,   259,    50,    65,   211,    71,    52,
+     172,   193,   223,     3,   190,    34,   203,    59,   162,   176,
+     216,   237,    75,    75,    48,   204,   173,   173,   172,   122,
+     123,   124,   125,   126,   127,   128,   129,   130,   131,   132,
+     133,    70,    71,   238,   172,   172,    84,   237,   249,     4,
+       4,     4,     4,     6,   259,   172,   172,   172,   172,   172,
+     238,   238,     5,     6,   203,   237,    73,   176,   214,    52,
+     139,   140,    70,    72,   118,   134,   135,   136,   137,   138,
+     142,   162,   163,   164,   165,   166,   167,   168,   169,   174,
+     171,   176,   171,   176,   208,   209,   237,   237,    66,   212,
+     201,     3,   114,   116,   183,   184,   185,   189,    52,   172,
+     270,   173,   176,   172,   235,   223,   237,   198,   172,   172,
+       6,   173,    62,   173,   234,   172,    70,   203,   237,   237,
+     249,    80,    82,    84,     4,   237,     4,     4,     4,   173,
+     173,   172,   220,   221,   222,   223,   228,   236,   157,   215,
+       3,   237,   237,    72,   142,   172,    70,   117,   238,   238,
      238,   238,   238,   238,   238,   238,   238,   238,   238,   238,
-     238,     3,   167,     6,     5,   176,    67,    68,   210,   237,
-      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
-      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
-     105,   108,   111,   112,   186,   115,   172,   173,   176,   201,
-     190,   172,     3,   234,   176,    76,    77,    78,   260,   261,
-     260,   234,   173,   203,   173,    52,    83,    80,    82,   237,
-     237,    73,   176,   176,   173,   176,   173,   176,   201,   176,
-      53,    55,    56,    57,    58,    60,    61,   229,     3,    52,
-     224,   239,   240,   241,   242,   243,   216,   172,   238,   203,
-     234,   117,   139,   209,   172,   172,   172,    70,   114,   116,
-     117,   187,   188,   172,   190,   184,   173,   190,   173,   172,
-       4,     3,   173,   176,   173,   173,   173,   186,   237,   237,
-      80,    83,   238,   254,   255,   257,     4,     4,     4,   173,
-     221,    54,    54,     3,   176,    49,   218,   203,   234,   173,
-     173,   238,     6,    86,    87,    88,    89,    90,    93,    94,
-     113,    86,    87,    88,    89,    90,    93,    94,   113,   117,
-     115,   188,   190,   173,   147,   173,   234,   261,   173,    80,
-     237,   173,   176,   173,   176,   173,   173,   224,   222,   222,
-     172,   239,   240,   241,   242,    50,    51,   217,   173,   173,
-     173,   176,   176,   176,   176,   176,   176,   176,   176,   176,
-     176,   176,   176,   176,   176,   176,   176,   176,   173,     3,
-     147,   173,     4,     4,    59,   190,   234,   237,     6,     6,
+     238,   238,     3,   167,     6,     5,   176,    67,    68,   210,
+     237,    85,    86,    87,    88,    89,    90,    91,    92,    93,
+      94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
+     104,   105,   108,   111,   112,   186,   115,   172,   173,   176,
+     201,   190,   172,     3,   234,   176,    76,    77,    78,   260,
+     261,   260,   234,   173,   203,   173,    52,    83,    80,    82,
+     237,   237,    73,   176,   176,   173,   176,   173,   176,   201,
+     176,    53,    55,    56,    57,    58,    60,    61,   229,     3,
+      52,   224,   239,   240,   241,   242,   243,   216,   172,   238,
+     203,   234,   117,   139,   209,   172,   172,   172,    70,   114,
+     116,   117,   187,   188,   172,   190,   184,   173,   190,   173,
+     172,     4,     3,   173,   176,   173,   173,   173,   186,   237,
+     237,    80,    83,   238,   254,   255,   257,     4,     4,     4,
+     173,   221,    54,    54,     3,   176,    49,   218,   203,   234,
+     173,   173,   238,     6,    86,    87,    88,    89,    90,    93,
+      94,   113,    86,    87,    88,    89,    90,    93,    94,   113,
+     117,   115,   188,   190,   173,   147,   173,   234,   261,   173,
+      80,   237,   173,   176,   173,   176,   173,   173,   224,   222,
+     222,   172,   239,   240,   241,   242,    50,    51,   217,   173,
+     173,   173,   176,   176,   176,   176,   176,   176,   176,   176,
+     176,   176,   176,   176,   176,   176,   176,   176,   176,   173,
+       3,   147,   173,     4,     4,    59,   190,   234,   237,     6,
        6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
-       6,     6,     6,     6,     6,    75,   267,     3,   176,   173,
-     237,   173,   173,   173,   173,   173,   173,   173,   173,   173,
-     173,   173,   173,   173,   173,   173,   173,   173,   173,   172,
-     267,     4,     3,   268,   269,   176,   162,   173,   176,     6,
-       3,     5,     6,   269,   173,   267
+       6,     6,     6,     6,     6,     6,    75,   267,     3,   176,
+     173,   237,   173,   173,   173,   173,   173,   173,   173,   173,
+     173,   173,   173,   173,   173,   173,   173,   173,   173,   173,
+     172,   267,     4,     3,   268,   269,   176,   162,   173,   176,
+       6,     3,     5,     6,   269,   173,   267
 };
 
 /* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
@@ -1383,22 +1381,22 @@ static const yytype_int16 yyr1[] =
      223,   223,   224,   224,   224,   224,   225,   225,   226,   226,
      227,   228,   228,   229,   229,   229,   229,   229,   229,   229,
      230,   230,   230,   230,   230,   230,   230,   230,   230,   230,
-     230,   230,   230,   231,   231,   231,   232,   233,   233,   233,
+     230,   230,   230,   230,   231,   231,   231,   232,   233,   233,
      233,   233,   233,   233,   233,   233,   233,   233,   233,   233,
-     234,   234,   235,   235,   236,   236,   237,   237,   237,   237,
-     237,   238,   238,   238,   238,   238,   238,   238,   238,   238,
-     238,   238,   239,   240,   240,   241,   241,   242,   242,   243,
-     243,   243,   243,   243,   243,   243,   243,   244,   244,   244,
+     233,   234,   234,   235,   235,   236,   236,   237,   237,   237,
+     237,   237,   238,   238,   238,   238,   238,   238,   238,   238,
+     238,   238,   238,   239,   240,   240,   241,   241,   242,   242,
+     243,   243,   243,   243,   243,   243,   243,   243,   244,   244,
      244,   244,   244,   244,   244,   244,   244,   244,   244,   244,
      244,   244,   244,   244,   244,   244,   244,   244,   244,   244,
-     245,   245,   246,   247,   247,   248,   248,   248,   248,   249,
-     249,   250,   251,   251,   251,   251,   252,   252,   252,   252,
-     253,   253,   253,   253,   253,   253,   253,   253,   253,   253,
-     253,   253,   253,   254,   254,   255,   256,   256,   257,   258,
-     258,   259,   259,   259,   259,   259,   259,   259,   259,   259,
-     259,   259,   259,   260,   260,   261,   261,   261,   262,   263,
-     263,   264,   264,   265,   265,   266,   266,   267,   267,   268,
-     268,   269,   269,   269,   269,   270,   270,   270
+     244,   245,   245,   246,   247,   247,   248,   248,   248,   248,
+     249,   249,   250,   251,   251,   251,   251,   252,   252,   252,
+     252,   253,   253,   253,   253,   253,   253,   253,   253,   253,
+     253,   253,   253,   253,   254,   254,   255,   256,   256,   257,
+     258,   258,   259,   259,   259,   259,   259,   259,   259,   259,
+     259,   259,   259,   259,   260,   260,   261,   261,   261,   262,
+     263,   263,   264,   264,   265,   265,   266,   266,   267,   267,
+     268,   268,   269,   269,   269,   269,   270,   270,   270
 };
 
 /* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
@@ -1422,23 +1420,23 @@ static const yytype_int8 yyr2[] =
        1,     2,     1,     1,     1,     3,     1,     1,     2,     4,
        1,     3,     2,     1,     5,     0,     2,     0,     1,     3,
        5,     4,     6,     1,     1,     1,     1,     1,     1,     0,
-       2,     2,     2,     2,     2,     3,     3,     3,     2,     3,
-       4,     6,     3,     2,     2,     2,     2,     2,     4,     4,
-       4,     4,     4,     4,     4,     4,     4,     4,     4,     3,
-       1,     3,     3,     5,     3,     1,     1,     1,     1,     1,
-       1,     3,     3,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,    13,     6,     8,     4,     6,     4,     6,     1,
-       1,     1,     1,     3,     3,     3,     3,     3,     4,     5,
-       4,     3,     2,     2,     2,     3,     3,     3,     3,     3,
-       3,     3,     3,     3,     3,     3,     3,     6,     3,     4,
-       3,     3,     5,     5,     6,     4,     6,     3,     5,     4,
-       5,     6,     4,     5,     5,     6,     1,     3,     1,     3,
-       1,     1,     1,     1,     1,     2,     2,     2,     2,     2,
-       1,     1,     1,     1,     1,     2,     2,     3,     2,     2,
-       3,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     1,     3,     2,     2,     1,     1,     2,
-       0,     3,     0,     1,     0,     2,     0,     4,     0,     1,
-       3,     1,     3,     3,     3,     6,     7,     3
+       2,     2,     2,     2,     2,     3,     3,     3,     2,     2,
+       3,     4,     6,     3,     2,     2,     2,     2,     2,     4,
+       4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
+       3,     1,     3,     3,     5,     3,     1,     1,     1,     1,
+       1,     1,     3,     3,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,    13,     6,     8,     4,     6,     4,     6,
+       1,     1,     1,     1,     3,     3,     3,     3,     3,     4,
+       5,     4,     3,     2,     2,     2,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     6,     3,
+       4,     3,     3,     5,     5,     6,     4,     6,     3,     5,
+       4,     5,     6,     4,     5,     5,     6,     1,     3,     1,
+       3,     1,     1,     1,     1,     1,     2,     2,     2,     2,
+       2,     1,     1,     1,     1,     1,     2,     2,     3,     2,
+       2,     3,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     1,     3,     2,     2,     1,     1,
+       2,     0,     3,     0,     1,     0,     2,     0,     4,     0,
+       1,     3,     1,     3,     3,     3,     6,     7,     3
 };
 
 
@@ -2006,7 +2004,7 @@ yydestruct (const char *yymsg,
             {
     free(((*yyvaluep).str_value));
 }
-#line 2010 "parser.cpp"
+#line 2008 "parser.cpp"
         break;
 
     case YYSYMBOL_STRING: /* STRING  */
@@ -2014,7 +2012,7 @@ yydestruct (const char *yymsg,
             {
     free(((*yyvaluep).str_value));
 }
-#line 2018 "parser.cpp"
+#line 2016 "parser.cpp"
         break;
 
     case YYSYMBOL_statement_list: /* statement_list  */
@@ -2028,7 +2026,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).stmt_array));
     }
 }
-#line 2032 "parser.cpp"
+#line 2030 "parser.cpp"
         break;
 
     case YYSYMBOL_table_element_array: /* table_element_array  */
@@ -2042,7 +2040,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).table_element_array_t));
     }
 }
-#line 2046 "parser.cpp"
+#line 2044 "parser.cpp"
         break;
 
     case YYSYMBOL_column_constraints: /* column_constraints  */
@@ -2053,7 +2051,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).column_constraints_t));
     }
 }
-#line 2057 "parser.cpp"
+#line 2055 "parser.cpp"
         break;
 
     case YYSYMBOL_identifier_array: /* identifier_array  */
@@ -2062,7 +2060,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy identifier array\n");
     delete (((*yyvaluep).identifier_array_t));
 }
-#line 2066 "parser.cpp"
+#line 2064 "parser.cpp"
         break;
 
     case YYSYMBOL_optional_identifier_array: /* optional_identifier_array  */
@@ -2071,7 +2069,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy identifier array\n");
     delete (((*yyvaluep).identifier_array_t));
 }
-#line 2075 "parser.cpp"
+#line 2073 "parser.cpp"
         break;
 
     case YYSYMBOL_update_expr_array: /* update_expr_array  */
@@ -2085,7 +2083,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).update_expr_array_t));
     }
 }
-#line 2089 "parser.cpp"
+#line 2087 "parser.cpp"
         break;
 
     case YYSYMBOL_update_expr: /* update_expr  */
@@ -2096,7 +2094,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).update_expr_t);
     }
 }
-#line 2100 "parser.cpp"
+#line 2098 "parser.cpp"
         break;
 
     case YYSYMBOL_select_statement: /* select_statement  */
@@ -2106,7 +2104,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2110 "parser.cpp"
+#line 2108 "parser.cpp"
         break;
 
     case YYSYMBOL_select_with_paren: /* select_with_paren  */
@@ -2116,7 +2114,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2120 "parser.cpp"
+#line 2118 "parser.cpp"
         break;
 
     case YYSYMBOL_select_without_paren: /* select_without_paren  */
@@ -2126,7 +2124,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2130 "parser.cpp"
+#line 2128 "parser.cpp"
         break;
 
     case YYSYMBOL_select_clause_with_modifier: /* select_clause_with_modifier  */
@@ -2136,7 +2134,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2140 "parser.cpp"
+#line 2138 "parser.cpp"
         break;
 
     case YYSYMBOL_select_clause_without_modifier_paren: /* select_clause_without_modifier_paren  */
@@ -2146,7 +2144,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2150 "parser.cpp"
+#line 2148 "parser.cpp"
         break;
 
     case YYSYMBOL_select_clause_without_modifier: /* select_clause_without_modifier  */
@@ -2156,7 +2154,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2160 "parser.cpp"
+#line 2158 "parser.cpp"
         break;
 
     case YYSYMBOL_order_by_clause: /* order_by_clause  */
@@ -2170,7 +2168,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).order_by_expr_list_t));
     }
 }
-#line 2174 "parser.cpp"
+#line 2172 "parser.cpp"
         break;
 
     case YYSYMBOL_order_by_expr_list: /* order_by_expr_list  */
@@ -2184,7 +2182,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).order_by_expr_list_t));
     }
 }
-#line 2188 "parser.cpp"
+#line 2186 "parser.cpp"
         break;
 
     case YYSYMBOL_order_by_expr: /* order_by_expr  */
@@ -2194,7 +2192,7 @@ yydestruct (const char *yymsg,
     delete ((*yyvaluep).order_by_expr_t)->expr_;
     delete ((*yyvaluep).order_by_expr_t);
 }
-#line 2198 "parser.cpp"
+#line 2196 "parser.cpp"
         break;
 
     case YYSYMBOL_limit_expr: /* limit_expr  */
@@ -2202,7 +2200,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2206 "parser.cpp"
+#line 2204 "parser.cpp"
         break;
 
     case YYSYMBOL_offset_expr: /* offset_expr  */
@@ -2210,7 +2208,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2214 "parser.cpp"
+#line 2212 "parser.cpp"
         break;
 
     case YYSYMBOL_from_clause: /* from_clause  */
@@ -2219,7 +2217,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2223 "parser.cpp"
+#line 2221 "parser.cpp"
         break;
 
     case YYSYMBOL_search_clause: /* search_clause  */
@@ -2227,7 +2225,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2231 "parser.cpp"
+#line 2229 "parser.cpp"
         break;
 
     case YYSYMBOL_where_clause: /* where_clause  */
@@ -2235,7 +2233,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2239 "parser.cpp"
+#line 2237 "parser.cpp"
         break;
 
     case YYSYMBOL_having_clause: /* having_clause  */
@@ -2243,7 +2241,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2247 "parser.cpp"
+#line 2245 "parser.cpp"
         break;
 
     case YYSYMBOL_group_by_clause: /* group_by_clause  */
@@ -2257,7 +2255,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).expr_array_t));
     }
 }
-#line 2261 "parser.cpp"
+#line 2259 "parser.cpp"
         break;
 
     case YYSYMBOL_table_reference: /* table_reference  */
@@ -2266,7 +2264,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2270 "parser.cpp"
+#line 2268 "parser.cpp"
         break;
 
     case YYSYMBOL_table_reference_unit: /* table_reference_unit  */
@@ -2275,7 +2273,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2279 "parser.cpp"
+#line 2277 "parser.cpp"
         break;
 
     case YYSYMBOL_table_reference_name: /* table_reference_name  */
@@ -2284,7 +2282,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2288 "parser.cpp"
+#line 2286 "parser.cpp"
         break;
 
     case YYSYMBOL_table_name: /* table_name  */
@@ -2297,7 +2295,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).table_name_t));
     }
 }
-#line 2301 "parser.cpp"
+#line 2299 "parser.cpp"
         break;
 
     case YYSYMBOL_table_alias: /* table_alias  */
@@ -2306,7 +2304,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table alias\n");
     delete (((*yyvaluep).table_alias_t));
 }
-#line 2310 "parser.cpp"
+#line 2308 "parser.cpp"
         break;
 
     case YYSYMBOL_with_clause: /* with_clause  */
@@ -2320,7 +2318,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).with_expr_list_t));
     }
 }
-#line 2324 "parser.cpp"
+#line 2322 "parser.cpp"
         break;
 
     case YYSYMBOL_with_expr_list: /* with_expr_list  */
@@ -2334,7 +2332,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).with_expr_list_t));
     }
 }
-#line 2338 "parser.cpp"
+#line 2336 "parser.cpp"
         break;
 
     case YYSYMBOL_with_expr: /* with_expr  */
@@ -2344,7 +2342,7 @@ yydestruct (const char *yymsg,
     delete ((*yyvaluep).with_expr_t)->select_;
     delete ((*yyvaluep).with_expr_t);
 }
-#line 2348 "parser.cpp"
+#line 2346 "parser.cpp"
         break;
 
     case YYSYMBOL_join_clause: /* join_clause  */
@@ -2353,7 +2351,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2357 "parser.cpp"
+#line 2355 "parser.cpp"
         break;
 
     case YYSYMBOL_expr_array: /* expr_array  */
@@ -2367,7 +2365,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).expr_array_t));
     }
 }
-#line 2371 "parser.cpp"
+#line 2369 "parser.cpp"
         break;
 
     case YYSYMBOL_expr_array_list: /* expr_array_list  */
@@ -2384,7 +2382,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).expr_array_list_t));
     }
 }
-#line 2388 "parser.cpp"
+#line 2386 "parser.cpp"
         break;
 
     case YYSYMBOL_expr_alias: /* expr_alias  */
@@ -2392,7 +2390,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2396 "parser.cpp"
+#line 2394 "parser.cpp"
         break;
 
     case YYSYMBOL_expr: /* expr  */
@@ -2400,7 +2398,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2404 "parser.cpp"
+#line 2402 "parser.cpp"
         break;
 
     case YYSYMBOL_operand: /* operand  */
@@ -2408,7 +2406,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2412 "parser.cpp"
+#line 2410 "parser.cpp"
         break;
 
     case YYSYMBOL_knn_expr: /* knn_expr  */
@@ -2416,7 +2414,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2420 "parser.cpp"
+#line 2418 "parser.cpp"
         break;
 
     case YYSYMBOL_match_expr: /* match_expr  */
@@ -2424,7 +2422,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2428 "parser.cpp"
+#line 2426 "parser.cpp"
         break;
 
     case YYSYMBOL_query_expr: /* query_expr  */
@@ -2432,7 +2430,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2436 "parser.cpp"
+#line 2434 "parser.cpp"
         break;
 
     case YYSYMBOL_fusion_expr: /* fusion_expr  */
@@ -2440,7 +2438,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2444 "parser.cpp"
+#line 2442 "parser.cpp"
         break;
 
     case YYSYMBOL_sub_search_array: /* sub_search_array  */
@@ -2454,7 +2452,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).expr_array_t));
     }
 }
-#line 2458 "parser.cpp"
+#line 2456 "parser.cpp"
         break;
 
     case YYSYMBOL_function_expr: /* function_expr  */
@@ -2462,7 +2460,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2466 "parser.cpp"
+#line 2464 "parser.cpp"
         break;
 
     case YYSYMBOL_conjunction_expr: /* conjunction_expr  */
@@ -2470,7 +2468,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2474 "parser.cpp"
+#line 2472 "parser.cpp"
         break;
 
     case YYSYMBOL_between_expr: /* between_expr  */
@@ -2478,7 +2476,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2482 "parser.cpp"
+#line 2480 "parser.cpp"
         break;
 
     case YYSYMBOL_in_expr: /* in_expr  */
@@ -2486,7 +2484,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2490 "parser.cpp"
+#line 2488 "parser.cpp"
         break;
 
     case YYSYMBOL_case_expr: /* case_expr  */
@@ -2494,7 +2492,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2498 "parser.cpp"
+#line 2496 "parser.cpp"
         break;
 
     case YYSYMBOL_case_check_array: /* case_check_array  */
@@ -2507,7 +2505,7 @@ yydestruct (const char *yymsg,
         }
     }
 }
-#line 2511 "parser.cpp"
+#line 2509 "parser.cpp"
         break;
 
     case YYSYMBOL_cast_expr: /* cast_expr  */
@@ -2515,7 +2513,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2519 "parser.cpp"
+#line 2517 "parser.cpp"
         break;
 
     case YYSYMBOL_subquery_expr: /* subquery_expr  */
@@ -2523,7 +2521,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2527 "parser.cpp"
+#line 2525 "parser.cpp"
         break;
 
     case YYSYMBOL_column_expr: /* column_expr  */
@@ -2531,7 +2529,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2535 "parser.cpp"
+#line 2533 "parser.cpp"
         break;
 
     case YYSYMBOL_constant_expr: /* constant_expr  */
@@ -2539,7 +2537,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2543 "parser.cpp"
+#line 2541 "parser.cpp"
         break;
 
     case YYSYMBOL_array_expr: /* array_expr  */
@@ -2547,7 +2545,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2551 "parser.cpp"
+#line 2549 "parser.cpp"
         break;
 
     case YYSYMBOL_long_array_expr: /* long_array_expr  */
@@ -2555,7 +2553,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2559 "parser.cpp"
+#line 2557 "parser.cpp"
         break;
 
     case YYSYMBOL_unclosed_long_array_expr: /* unclosed_long_array_expr  */
@@ -2563,7 +2561,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2567 "parser.cpp"
+#line 2565 "parser.cpp"
         break;
 
     case YYSYMBOL_double_array_expr: /* double_array_expr  */
@@ -2571,7 +2569,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2575 "parser.cpp"
+#line 2573 "parser.cpp"
         break;
 
     case YYSYMBOL_unclosed_double_array_expr: /* unclosed_double_array_expr  */
@@ -2579,7 +2577,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2583 "parser.cpp"
+#line 2581 "parser.cpp"
         break;
 
     case YYSYMBOL_interval_expr: /* interval_expr  */
@@ -2587,7 +2585,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2591 "parser.cpp"
+#line 2589 "parser.cpp"
         break;
 
     case YYSYMBOL_file_path: /* file_path  */
@@ -2595,7 +2593,7 @@ yydestruct (const char *yymsg,
             {
     free(((*yyvaluep).str_value));
 }
-#line 2599 "parser.cpp"
+#line 2597 "parser.cpp"
         break;
 
     case YYSYMBOL_if_not_exists_info: /* if_not_exists_info  */
@@ -2606,7 +2604,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).if_not_exists_info_t));
     }
 }
-#line 2610 "parser.cpp"
+#line 2608 "parser.cpp"
         break;
 
     case YYSYMBOL_with_index_param_list: /* with_index_param_list  */
@@ -2620,7 +2618,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).with_index_param_list_t));
     }
 }
-#line 2624 "parser.cpp"
+#line 2622 "parser.cpp"
         break;
 
     case YYSYMBOL_index_info_list: /* index_info_list  */
@@ -2634,7 +2632,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).index_info_list_t));
     }
 }
-#line 2638 "parser.cpp"
+#line 2636 "parser.cpp"
         break;
 
       default:
@@ -2742,7 +2740,7 @@ YYLTYPE yylloc = yyloc_default;
   yylloc.string_length = 0;
 }
 
-#line 2746 "parser.cpp"
+#line 2744 "parser.cpp"
 
   yylsp[0] = yylloc;
   goto yysetstate;
@@ -2957,7 +2955,7 @@ yyreduce:
                                          {
     result->statements_ptr_ = (yyvsp[-1].stmt_array);
 }
-#line 2961 "parser.cpp"
+#line 2959 "parser.cpp"
     break;
 
   case 3: /* statement_list: statement  */
@@ -2968,7 +2966,7 @@ yyreduce:
     (yyval.stmt_array) = new std::vector<infinity::BaseStatement*>();
     (yyval.stmt_array)->push_back((yyvsp[0].base_stmt));
 }
-#line 2972 "parser.cpp"
+#line 2970 "parser.cpp"
     break;
 
   case 4: /* statement_list: statement_list ';' statement  */
@@ -2979,145 +2977,145 @@ yyreduce:
     (yyvsp[-2].stmt_array)->push_back((yyvsp[0].base_stmt));
     (yyval.stmt_array) = (yyvsp[-2].stmt_array);
 }
-#line 2983 "parser.cpp"
+#line 2981 "parser.cpp"
     break;
 
   case 5: /* statement: create_statement  */
 #line 490 "parser.y"
                              { (yyval.base_stmt) = (yyvsp[0].create_stmt); }
-#line 2989 "parser.cpp"
+#line 2987 "parser.cpp"
     break;
 
   case 6: /* statement: drop_statement  */
 #line 491 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].drop_stmt); }
-#line 2995 "parser.cpp"
+#line 2993 "parser.cpp"
     break;
 
   case 7: /* statement: copy_statement  */
 #line 492 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].copy_stmt); }
-#line 3001 "parser.cpp"
+#line 2999 "parser.cpp"
     break;
 
   case 8: /* statement: show_statement  */
 #line 493 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].show_stmt); }
-#line 3007 "parser.cpp"
+#line 3005 "parser.cpp"
     break;
 
   case 9: /* statement: select_statement  */
 #line 494 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].select_stmt); }
-#line 3013 "parser.cpp"
+#line 3011 "parser.cpp"
     break;
 
   case 10: /* statement: delete_statement  */
 #line 495 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].delete_stmt); }
-#line 3019 "parser.cpp"
+#line 3017 "parser.cpp"
     break;
 
   case 11: /* statement: update_statement  */
 #line 496 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].update_stmt); }
-#line 3025 "parser.cpp"
+#line 3023 "parser.cpp"
     break;
 
   case 12: /* statement: insert_statement  */
 #line 497 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].insert_stmt); }
-#line 3031 "parser.cpp"
+#line 3029 "parser.cpp"
     break;
 
   case 13: /* statement: explain_statement  */
 #line 498 "parser.y"
                     { (yyval.base_stmt) = (yyvsp[0].explain_stmt); }
-#line 3037 "parser.cpp"
+#line 3035 "parser.cpp"
     break;
 
   case 14: /* statement: flush_statement  */
 #line 499 "parser.y"
                   { (yyval.base_stmt) = (yyvsp[0].flush_stmt); }
-#line 3043 "parser.cpp"
+#line 3041 "parser.cpp"
     break;
 
   case 15: /* statement: optimize_statement  */
 #line 500 "parser.y"
                      { (yyval.base_stmt) = (yyvsp[0].optimize_stmt); }
-#line 3049 "parser.cpp"
+#line 3047 "parser.cpp"
     break;
 
   case 16: /* statement: command_statement  */
 #line 501 "parser.y"
                     { (yyval.base_stmt) = (yyvsp[0].command_stmt); }
-#line 3055 "parser.cpp"
+#line 3053 "parser.cpp"
     break;
 
   case 17: /* explainable_statement: create_statement  */
 #line 503 "parser.y"
                                          { (yyval.base_stmt) = (yyvsp[0].create_stmt); }
-#line 3061 "parser.cpp"
+#line 3059 "parser.cpp"
     break;
 
   case 18: /* explainable_statement: drop_statement  */
 #line 504 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].drop_stmt); }
-#line 3067 "parser.cpp"
+#line 3065 "parser.cpp"
     break;
 
   case 19: /* explainable_statement: copy_statement  */
 #line 505 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].copy_stmt); }
-#line 3073 "parser.cpp"
+#line 3071 "parser.cpp"
     break;
 
   case 20: /* explainable_statement: show_statement  */
 #line 506 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].show_stmt); }
-#line 3079 "parser.cpp"
+#line 3077 "parser.cpp"
     break;
 
   case 21: /* explainable_statement: select_statement  */
 #line 507 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].select_stmt); }
-#line 3085 "parser.cpp"
+#line 3083 "parser.cpp"
     break;
 
   case 22: /* explainable_statement: delete_statement  */
 #line 508 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].delete_stmt); }
-#line 3091 "parser.cpp"
+#line 3089 "parser.cpp"
     break;
 
   case 23: /* explainable_statement: update_statement  */
 #line 509 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].update_stmt); }
-#line 3097 "parser.cpp"
+#line 3095 "parser.cpp"
     break;
 
   case 24: /* explainable_statement: insert_statement  */
 #line 510 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].insert_stmt); }
-#line 3103 "parser.cpp"
+#line 3101 "parser.cpp"
     break;
 
   case 25: /* explainable_statement: flush_statement  */
 #line 511 "parser.y"
                   { (yyval.base_stmt) = (yyvsp[0].flush_stmt); }
-#line 3109 "parser.cpp"
+#line 3107 "parser.cpp"
     break;
 
   case 26: /* explainable_statement: optimize_statement  */
 #line 512 "parser.y"
                      { (yyval.base_stmt) = (yyvsp[0].optimize_stmt); }
-#line 3115 "parser.cpp"
+#line 3113 "parser.cpp"
     break;
 
   case 27: /* explainable_statement: command_statement  */
 #line 513 "parser.y"
                     { (yyval.base_stmt) = (yyvsp[0].command_stmt); }
-#line 3121 "parser.cpp"
+#line 3119 "parser.cpp"
     break;
 
   case 28: /* create_statement: CREATE DATABASE if_not_exists IDENTIFIER  */
@@ -3137,7 +3135,7 @@ yyreduce:
     (yyval.create_stmt)->create_info_ = create_schema_info;
     (yyval.create_stmt)->create_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
 }
-#line 3141 "parser.cpp"
+#line 3139 "parser.cpp"
     break;
 
   case 29: /* create_statement: CREATE COLLECTION if_not_exists table_name  */
@@ -3155,7 +3153,7 @@ yyreduce:
     (yyval.create_stmt)->create_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     delete (yyvsp[0].table_name_t);
 }
-#line 3159 "parser.cpp"
+#line 3157 "parser.cpp"
     break;
 
   case 30: /* create_statement: CREATE TABLE if_not_exists table_name '(' table_element_array ')'  */
@@ -3183,7 +3181,7 @@ yyreduce:
     (yyval.create_stmt)->create_info_ = create_table_info;
     (yyval.create_stmt)->create_info_->conflict_type_ = (yyvsp[-4].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
 }
-#line 3187 "parser.cpp"
+#line 3185 "parser.cpp"
     break;
 
   case 31: /* create_statement: CREATE TABLE if_not_exists table_name AS select_statement  */
@@ -3203,7 +3201,7 @@ yyreduce:
     create_table_info->select_ = (yyvsp[0].select_stmt);
     (yyval.create_stmt)->create_info_ = create_table_info;
 }
-#line 3207 "parser.cpp"
+#line 3205 "parser.cpp"
     break;
 
   case 32: /* create_statement: CREATE VIEW if_not_exists table_name optional_identifier_array AS select_statement  */
@@ -3224,7 +3222,7 @@ yyreduce:
     create_view_info->conflict_type_ = (yyvsp[-4].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     (yyval.create_stmt)->create_info_ = create_view_info;
 }
-#line 3228 "parser.cpp"
+#line 3226 "parser.cpp"
     break;
 
   case 33: /* create_statement: CREATE INDEX if_not_exists_info ON table_name index_info_list  */
@@ -3257,7 +3255,7 @@ yyreduce:
     (yyval.create_stmt) = new infinity::CreateStatement();
     (yyval.create_stmt)->create_info_ = create_index_info;
 }
-#line 3261 "parser.cpp"
+#line 3259 "parser.cpp"
     break;
 
   case 34: /* table_element_array: table_element  */
@@ -3266,7 +3264,7 @@ yyreduce:
     (yyval.table_element_array_t) = new std::vector<infinity::TableElement*>();
     (yyval.table_element_array_t)->push_back((yyvsp[0].table_element_t));
 }
-#line 3270 "parser.cpp"
+#line 3268 "parser.cpp"
     break;
 
   case 35: /* table_element_array: table_element_array ',' table_element  */
@@ -3275,7 +3273,7 @@ yyreduce:
     (yyvsp[-2].table_element_array_t)->push_back((yyvsp[0].table_element_t));
     (yyval.table_element_array_t) = (yyvsp[-2].table_element_array_t);
 }
-#line 3279 "parser.cpp"
+#line 3277 "parser.cpp"
     break;
 
   case 36: /* table_element: table_column  */
@@ -3283,7 +3281,7 @@ yyreduce:
                              {
     (yyval.table_element_t) = (yyvsp[0].table_column_t);
 }
-#line 3287 "parser.cpp"
+#line 3285 "parser.cpp"
     break;
 
   case 37: /* table_element: table_constraint  */
@@ -3291,7 +3289,7 @@ yyreduce:
                    {
     (yyval.table_element_t) = (yyvsp[0].table_constraint_t);
 }
-#line 3295 "parser.cpp"
+#line 3293 "parser.cpp"
     break;
 
   case 38: /* table_column: IDENTIFIER column_type  */
@@ -3331,7 +3329,7 @@ yyreduce:
     }
     */
 }
-#line 3335 "parser.cpp"
+#line 3333 "parser.cpp"
     break;
 
   case 39: /* table_column: IDENTIFIER column_type column_constraints  */
@@ -3368,247 +3366,247 @@ yyreduce:
     }
     */
 }
-#line 3372 "parser.cpp"
+#line 3370 "parser.cpp"
     break;
 
   case 40: /* column_type: BOOLEAN  */
 #line 727 "parser.y"
         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kBoolean, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3378 "parser.cpp"
+#line 3376 "parser.cpp"
     break;
 
   case 41: /* column_type: TINYINT  */
 #line 728 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTinyInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3384 "parser.cpp"
+#line 3382 "parser.cpp"
     break;
 
   case 42: /* column_type: SMALLINT  */
 #line 729 "parser.y"
            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSmallInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3390 "parser.cpp"
+#line 3388 "parser.cpp"
     break;
 
   case 43: /* column_type: INTEGER  */
 #line 730 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kInteger, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3396 "parser.cpp"
+#line 3394 "parser.cpp"
     break;
 
   case 44: /* column_type: INT  */
 #line 731 "parser.y"
       { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kInteger, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3402 "parser.cpp"
+#line 3400 "parser.cpp"
     break;
 
   case 45: /* column_type: BIGINT  */
 #line 732 "parser.y"
          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kBigInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3408 "parser.cpp"
+#line 3406 "parser.cpp"
     break;
 
   case 46: /* column_type: HUGEINT  */
 #line 733 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kHugeInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3414 "parser.cpp"
+#line 3412 "parser.cpp"
     break;
 
   case 47: /* column_type: FLOAT  */
 #line 734 "parser.y"
         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kFloat, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3420 "parser.cpp"
+#line 3418 "parser.cpp"
     break;
 
   case 48: /* column_type: REAL  */
 #line 735 "parser.y"
         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kFloat, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3426 "parser.cpp"
+#line 3424 "parser.cpp"
     break;
 
   case 49: /* column_type: DOUBLE  */
 #line 736 "parser.y"
          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDouble, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3432 "parser.cpp"
+#line 3430 "parser.cpp"
     break;
 
   case 50: /* column_type: DATE  */
 #line 737 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDate, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3438 "parser.cpp"
+#line 3436 "parser.cpp"
     break;
 
   case 51: /* column_type: TIME  */
 #line 738 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTime, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3444 "parser.cpp"
+#line 3442 "parser.cpp"
     break;
 
   case 52: /* column_type: DATETIME  */
 #line 739 "parser.y"
            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDateTime, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3450 "parser.cpp"
+#line 3448 "parser.cpp"
     break;
 
   case 53: /* column_type: TIMESTAMP  */
 #line 740 "parser.y"
             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTimestamp, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3456 "parser.cpp"
+#line 3454 "parser.cpp"
     break;
 
   case 54: /* column_type: UUID  */
 #line 741 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kUuid, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3462 "parser.cpp"
+#line 3460 "parser.cpp"
     break;
 
   case 55: /* column_type: POINT  */
 #line 742 "parser.y"
         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kPoint, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3468 "parser.cpp"
+#line 3466 "parser.cpp"
     break;
 
   case 56: /* column_type: LINE  */
 #line 743 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kLine, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3474 "parser.cpp"
+#line 3472 "parser.cpp"
     break;
 
   case 57: /* column_type: LSEG  */
 #line 744 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kLineSeg, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3480 "parser.cpp"
+#line 3478 "parser.cpp"
     break;
 
   case 58: /* column_type: BOX  */
 #line 745 "parser.y"
       { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kBox, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3486 "parser.cpp"
+#line 3484 "parser.cpp"
     break;
 
   case 59: /* column_type: CIRCLE  */
 #line 748 "parser.y"
          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kCircle, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3492 "parser.cpp"
+#line 3490 "parser.cpp"
     break;
 
   case 60: /* column_type: VARCHAR  */
 #line 750 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kVarchar, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3498 "parser.cpp"
+#line 3496 "parser.cpp"
     break;
 
   case 61: /* column_type: DECIMAL '(' LONG_VALUE ',' LONG_VALUE ')'  */
 #line 751 "parser.y"
                                             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDecimal, 0, (yyvsp[-3].long_value), (yyvsp[-1].long_value), infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3504 "parser.cpp"
+#line 3502 "parser.cpp"
     break;
 
   case 62: /* column_type: DECIMAL '(' LONG_VALUE ')'  */
 #line 752 "parser.y"
                              { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDecimal, 0, (yyvsp[-1].long_value), 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3510 "parser.cpp"
+#line 3508 "parser.cpp"
     break;
 
   case 63: /* column_type: DECIMAL  */
 #line 753 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDecimal, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3516 "parser.cpp"
+#line 3514 "parser.cpp"
     break;
 
   case 64: /* column_type: EMBEDDING '(' BIT ',' LONG_VALUE ')'  */
 #line 756 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemBit}; }
-#line 3522 "parser.cpp"
+#line 3520 "parser.cpp"
     break;
 
   case 65: /* column_type: EMBEDDING '(' TINYINT ',' LONG_VALUE ')'  */
 #line 757 "parser.y"
                                            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt8}; }
-#line 3528 "parser.cpp"
+#line 3526 "parser.cpp"
     break;
 
   case 66: /* column_type: EMBEDDING '(' SMALLINT ',' LONG_VALUE ')'  */
 #line 758 "parser.y"
                                             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt16}; }
-#line 3534 "parser.cpp"
+#line 3532 "parser.cpp"
     break;
 
   case 67: /* column_type: EMBEDDING '(' INTEGER ',' LONG_VALUE ')'  */
 #line 759 "parser.y"
                                            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 3540 "parser.cpp"
+#line 3538 "parser.cpp"
     break;
 
   case 68: /* column_type: EMBEDDING '(' INT ',' LONG_VALUE ')'  */
 #line 760 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 3546 "parser.cpp"
+#line 3544 "parser.cpp"
     break;
 
   case 69: /* column_type: EMBEDDING '(' BIGINT ',' LONG_VALUE ')'  */
 #line 761 "parser.y"
                                           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt64}; }
-#line 3552 "parser.cpp"
+#line 3550 "parser.cpp"
     break;
 
   case 70: /* column_type: EMBEDDING '(' FLOAT ',' LONG_VALUE ')'  */
 #line 762 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemFloat}; }
-#line 3558 "parser.cpp"
+#line 3556 "parser.cpp"
     break;
 
   case 71: /* column_type: EMBEDDING '(' DOUBLE ',' LONG_VALUE ')'  */
 #line 763 "parser.y"
                                           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemDouble}; }
-#line 3564 "parser.cpp"
+#line 3562 "parser.cpp"
     break;
 
   case 72: /* column_type: VECTOR '(' BIT ',' LONG_VALUE ')'  */
 #line 764 "parser.y"
                                     { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemBit}; }
-#line 3570 "parser.cpp"
+#line 3568 "parser.cpp"
     break;
 
   case 73: /* column_type: VECTOR '(' TINYINT ',' LONG_VALUE ')'  */
 #line 765 "parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt8}; }
-#line 3576 "parser.cpp"
+#line 3574 "parser.cpp"
     break;
 
   case 74: /* column_type: VECTOR '(' SMALLINT ',' LONG_VALUE ')'  */
 #line 766 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt16}; }
-#line 3582 "parser.cpp"
+#line 3580 "parser.cpp"
     break;
 
   case 75: /* column_type: VECTOR '(' INTEGER ',' LONG_VALUE ')'  */
 #line 767 "parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 3588 "parser.cpp"
+#line 3586 "parser.cpp"
     break;
 
   case 76: /* column_type: VECTOR '(' INT ',' LONG_VALUE ')'  */
 #line 768 "parser.y"
                                     { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 3594 "parser.cpp"
+#line 3592 "parser.cpp"
     break;
 
   case 77: /* column_type: VECTOR '(' BIGINT ',' LONG_VALUE ')'  */
 #line 769 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt64}; }
-#line 3600 "parser.cpp"
+#line 3598 "parser.cpp"
     break;
 
   case 78: /* column_type: VECTOR '(' FLOAT ',' LONG_VALUE ')'  */
 #line 770 "parser.y"
                                       { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemFloat}; }
-#line 3606 "parser.cpp"
+#line 3604 "parser.cpp"
     break;
 
   case 79: /* column_type: VECTOR '(' DOUBLE ',' LONG_VALUE ')'  */
 #line 771 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemDouble}; }
-#line 3612 "parser.cpp"
+#line 3610 "parser.cpp"
     break;
 
   case 80: /* column_constraints: column_constraint  */
@@ -3617,7 +3615,7 @@ yyreduce:
     (yyval.column_constraints_t) = new std::unordered_set<infinity::ConstraintType>();
     (yyval.column_constraints_t)->insert((yyvsp[0].column_constraint_t));
 }
-#line 3621 "parser.cpp"
+#line 3619 "parser.cpp"
     break;
 
   case 81: /* column_constraints: column_constraints column_constraint  */
@@ -3631,7 +3629,7 @@ yyreduce:
     (yyvsp[-1].column_constraints_t)->insert((yyvsp[0].column_constraint_t));
     (yyval.column_constraints_t) = (yyvsp[-1].column_constraints_t);
 }
-#line 3635 "parser.cpp"
+#line 3633 "parser.cpp"
     break;
 
   case 82: /* column_constraint: PRIMARY KEY  */
@@ -3639,7 +3637,7 @@ yyreduce:
                                 {
     (yyval.column_constraint_t) = infinity::ConstraintType::kPrimaryKey;
 }
-#line 3643 "parser.cpp"
+#line 3641 "parser.cpp"
     break;
 
   case 83: /* column_constraint: UNIQUE  */
@@ -3647,7 +3645,7 @@ yyreduce:
          {
     (yyval.column_constraint_t) = infinity::ConstraintType::kUnique;
 }
-#line 3651 "parser.cpp"
+#line 3649 "parser.cpp"
     break;
 
   case 84: /* column_constraint: NULLABLE  */
@@ -3655,7 +3653,7 @@ yyreduce:
            {
     (yyval.column_constraint_t) = infinity::ConstraintType::kNull;
 }
-#line 3659 "parser.cpp"
+#line 3657 "parser.cpp"
     break;
 
   case 85: /* column_constraint: NOT NULLABLE  */
@@ -3663,7 +3661,7 @@ yyreduce:
                {
     (yyval.column_constraint_t) = infinity::ConstraintType::kNotNull;
 }
-#line 3667 "parser.cpp"
+#line 3665 "parser.cpp"
     break;
 
   case 86: /* table_constraint: PRIMARY KEY '(' identifier_array ')'  */
@@ -3673,7 +3671,7 @@ yyreduce:
     (yyval.table_constraint_t)->names_ptr_ = (yyvsp[-1].identifier_array_t);
     (yyval.table_constraint_t)->constraint_ = infinity::ConstraintType::kPrimaryKey;
 }
-#line 3677 "parser.cpp"
+#line 3675 "parser.cpp"
     break;
 
   case 87: /* table_constraint: UNIQUE '(' identifier_array ')'  */
@@ -3683,7 +3681,7 @@ yyreduce:
     (yyval.table_constraint_t)->names_ptr_ = (yyvsp[-1].identifier_array_t);
     (yyval.table_constraint_t)->constraint_ = infinity::ConstraintType::kUnique;
 }
-#line 3687 "parser.cpp"
+#line 3685 "parser.cpp"
     break;
 
   case 88: /* identifier_array: IDENTIFIER  */
@@ -3694,7 +3692,7 @@ yyreduce:
     (yyval.identifier_array_t)->emplace_back((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
 }
-#line 3698 "parser.cpp"
+#line 3696 "parser.cpp"
     break;
 
   case 89: /* identifier_array: identifier_array ',' IDENTIFIER  */
@@ -3705,7 +3703,7 @@ yyreduce:
     free((yyvsp[0].str_value));
     (yyval.identifier_array_t) = (yyvsp[-2].identifier_array_t);
 }
-#line 3709 "parser.cpp"
+#line 3707 "parser.cpp"
     break;
 
   case 90: /* delete_statement: DELETE FROM table_name where_clause  */
@@ -3722,7 +3720,7 @@ yyreduce:
     delete (yyvsp[-1].table_name_t);
     (yyval.delete_stmt)->where_expr_ = (yyvsp[0].expr_t);
 }
-#line 3726 "parser.cpp"
+#line 3724 "parser.cpp"
     break;
 
   case 91: /* insert_statement: INSERT INTO table_name optional_identifier_array VALUES expr_array_list  */
@@ -3761,7 +3759,7 @@ yyreduce:
     (yyval.insert_stmt)->columns_ = (yyvsp[-2].identifier_array_t);
     (yyval.insert_stmt)->values_ = (yyvsp[0].expr_array_list_t);
 }
-#line 3765 "parser.cpp"
+#line 3763 "parser.cpp"
     break;
 
   case 92: /* insert_statement: INSERT INTO table_name optional_identifier_array select_without_paren  */
@@ -3778,7 +3776,7 @@ yyreduce:
     (yyval.insert_stmt)->columns_ = (yyvsp[-1].identifier_array_t);
     (yyval.insert_stmt)->select_ = (yyvsp[0].select_stmt);
 }
-#line 3782 "parser.cpp"
+#line 3780 "parser.cpp"
     break;
 
   case 93: /* optional_identifier_array: '(' identifier_array ')'  */
@@ -3786,7 +3784,7 @@ yyreduce:
                                                     {
     (yyval.identifier_array_t) = (yyvsp[-1].identifier_array_t);
 }
-#line 3790 "parser.cpp"
+#line 3788 "parser.cpp"
     break;
 
   case 94: /* optional_identifier_array: %empty  */
@@ -3794,7 +3792,7 @@ yyreduce:
   {
     (yyval.identifier_array_t) = nullptr;
 }
-#line 3798 "parser.cpp"
+#line 3796 "parser.cpp"
     break;
 
   case 95: /* explain_statement: EXPLAIN explain_type explainable_statement  */
@@ -3804,7 +3802,7 @@ yyreduce:
     (yyval.explain_stmt)->type_ = (yyvsp[-1].explain_type_t);
     (yyval.explain_stmt)->statement_ = (yyvsp[0].base_stmt);
 }
-#line 3808 "parser.cpp"
+#line 3806 "parser.cpp"
     break;
 
   case 96: /* explain_type: ANALYZE  */
@@ -3812,7 +3810,7 @@ yyreduce:
                       {
     (yyval.explain_type_t) = infinity::ExplainType::kAnalyze;
 }
-#line 3816 "parser.cpp"
+#line 3814 "parser.cpp"
     break;
 
   case 97: /* explain_type: AST  */
@@ -3820,7 +3818,7 @@ yyreduce:
       {
     (yyval.explain_type_t) = infinity::ExplainType::kAst;
 }
-#line 3824 "parser.cpp"
+#line 3822 "parser.cpp"
     break;
 
   case 98: /* explain_type: RAW  */
@@ -3828,7 +3826,7 @@ yyreduce:
       {
     (yyval.explain_type_t) = infinity::ExplainType::kUnOpt;
 }
-#line 3832 "parser.cpp"
+#line 3830 "parser.cpp"
     break;
 
   case 99: /* explain_type: LOGICAL  */
@@ -3836,7 +3834,7 @@ yyreduce:
           {
     (yyval.explain_type_t) = infinity::ExplainType::kOpt;
 }
-#line 3840 "parser.cpp"
+#line 3838 "parser.cpp"
     break;
 
   case 100: /* explain_type: PHYSICAL  */
@@ -3844,7 +3842,7 @@ yyreduce:
            {
     (yyval.explain_type_t) = infinity::ExplainType::kPhysical;
 }
-#line 3848 "parser.cpp"
+#line 3846 "parser.cpp"
     break;
 
   case 101: /* explain_type: PIPELINE  */
@@ -3852,7 +3850,7 @@ yyreduce:
            {
     (yyval.explain_type_t) = infinity::ExplainType::kPipeline;
 }
-#line 3856 "parser.cpp"
+#line 3854 "parser.cpp"
     break;
 
   case 102: /* explain_type: FRAGMENT  */
@@ -3860,7 +3858,7 @@ yyreduce:
            {
     (yyval.explain_type_t) = infinity::ExplainType::kFragment;
 }
-#line 3864 "parser.cpp"
+#line 3862 "parser.cpp"
     break;
 
   case 103: /* explain_type: %empty  */
@@ -3868,7 +3866,7 @@ yyreduce:
   {
     (yyval.explain_type_t) = infinity::ExplainType::kPhysical;
 }
-#line 3872 "parser.cpp"
+#line 3870 "parser.cpp"
     break;
 
   case 104: /* update_statement: UPDATE table_name SET update_expr_array where_clause  */
@@ -3885,7 +3883,7 @@ yyreduce:
     (yyval.update_stmt)->where_expr_ = (yyvsp[0].expr_t);
     (yyval.update_stmt)->update_expr_array_ = (yyvsp[-1].update_expr_array_t);
 }
-#line 3889 "parser.cpp"
+#line 3887 "parser.cpp"
     break;
 
   case 105: /* update_expr_array: update_expr  */
@@ -3894,7 +3892,7 @@ yyreduce:
     (yyval.update_expr_array_t) = new std::vector<infinity::UpdateExpr*>();
     (yyval.update_expr_array_t)->emplace_back((yyvsp[0].update_expr_t));
 }
-#line 3898 "parser.cpp"
+#line 3896 "parser.cpp"
     break;
 
   case 106: /* update_expr_array: update_expr_array ',' update_expr  */
@@ -3903,7 +3901,7 @@ yyreduce:
     (yyvsp[-2].update_expr_array_t)->emplace_back((yyvsp[0].update_expr_t));
     (yyval.update_expr_array_t) = (yyvsp[-2].update_expr_array_t);
 }
-#line 3907 "parser.cpp"
+#line 3905 "parser.cpp"
     break;
 
   case 107: /* update_expr: IDENTIFIER '=' expr  */
@@ -3915,7 +3913,7 @@ yyreduce:
     free((yyvsp[-2].str_value));
     (yyval.update_expr_t)->value = (yyvsp[0].expr_t);
 }
-#line 3919 "parser.cpp"
+#line 3917 "parser.cpp"
     break;
 
   case 108: /* drop_statement: DROP DATABASE if_exists IDENTIFIER  */
@@ -3931,7 +3929,7 @@ yyreduce:
     (yyval.drop_stmt)->drop_info_ = drop_schema_info;
     (yyval.drop_stmt)->drop_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
 }
-#line 3935 "parser.cpp"
+#line 3933 "parser.cpp"
     break;
 
   case 109: /* drop_statement: DROP COLLECTION if_exists table_name  */
@@ -3949,7 +3947,7 @@ yyreduce:
     (yyval.drop_stmt)->drop_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     delete (yyvsp[0].table_name_t);
 }
-#line 3953 "parser.cpp"
+#line 3951 "parser.cpp"
     break;
 
   case 110: /* drop_statement: DROP TABLE if_exists table_name  */
@@ -3967,7 +3965,7 @@ yyreduce:
     (yyval.drop_stmt)->drop_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     delete (yyvsp[0].table_name_t);
 }
-#line 3971 "parser.cpp"
+#line 3969 "parser.cpp"
     break;
 
   case 111: /* drop_statement: DROP VIEW if_exists table_name  */
@@ -3985,7 +3983,7 @@ yyreduce:
     (yyval.drop_stmt)->drop_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     delete (yyvsp[0].table_name_t);
 }
-#line 3989 "parser.cpp"
+#line 3987 "parser.cpp"
     break;
 
   case 112: /* drop_statement: DROP INDEX if_exists IDENTIFIER ON table_name  */
@@ -4008,7 +4006,7 @@ yyreduce:
     free((yyvsp[0].table_name_t)->table_name_ptr_);
     delete (yyvsp[0].table_name_t);
 }
-#line 4012 "parser.cpp"
+#line 4010 "parser.cpp"
     break;
 
   case 113: /* copy_statement: COPY table_name TO file_path WITH '(' copy_option_list ')'  */
@@ -4054,7 +4052,7 @@ yyreduce:
     }
     delete (yyvsp[-1].copy_option_array);
 }
-#line 4058 "parser.cpp"
+#line 4056 "parser.cpp"
     break;
 
   case 114: /* copy_statement: COPY table_name FROM file_path WITH '(' copy_option_list ')'  */
@@ -4100,7 +4098,7 @@ yyreduce:
     }
     delete (yyvsp[-1].copy_option_array);
 }
-#line 4104 "parser.cpp"
+#line 4102 "parser.cpp"
     break;
 
   case 115: /* select_statement: select_without_paren  */
@@ -4108,7 +4106,7 @@ yyreduce:
                                         {
     (yyval.select_stmt) = (yyvsp[0].select_stmt);
 }
-#line 4112 "parser.cpp"
+#line 4110 "parser.cpp"
     break;
 
   case 116: /* select_statement: select_with_paren  */
@@ -4116,7 +4114,7 @@ yyreduce:
                     {
     (yyval.select_stmt) = (yyvsp[0].select_stmt);
 }
-#line 4120 "parser.cpp"
+#line 4118 "parser.cpp"
     break;
 
   case 117: /* select_statement: select_statement set_operator select_clause_without_modifier_paren  */
@@ -4130,7 +4128,7 @@ yyreduce:
     node->nested_select_ = (yyvsp[0].select_stmt);
     (yyval.select_stmt) = (yyvsp[-2].select_stmt);
 }
-#line 4134 "parser.cpp"
+#line 4132 "parser.cpp"
     break;
 
   case 118: /* select_statement: select_statement set_operator select_clause_without_modifier  */
@@ -4144,7 +4142,7 @@ yyreduce:
     node->nested_select_ = (yyvsp[0].select_stmt);
     (yyval.select_stmt) = (yyvsp[-2].select_stmt);
 }
-#line 4148 "parser.cpp"
+#line 4146 "parser.cpp"
     break;
 
   case 119: /* select_with_paren: '(' select_without_paren ')'  */
@@ -4152,7 +4150,7 @@ yyreduce:
                                                  {
     (yyval.select_stmt) = (yyvsp[-1].select_stmt);
 }
-#line 4156 "parser.cpp"
+#line 4154 "parser.cpp"
     break;
 
   case 120: /* select_with_paren: '(' select_with_paren ')'  */
@@ -4160,7 +4158,7 @@ yyreduce:
                             {
     (yyval.select_stmt) = (yyvsp[-1].select_stmt);
 }
-#line 4164 "parser.cpp"
+#line 4162 "parser.cpp"
     break;
 
   case 121: /* select_without_paren: with_clause select_clause_with_modifier  */
@@ -4169,7 +4167,7 @@ yyreduce:
     (yyvsp[0].select_stmt)->with_exprs_ = (yyvsp[-1].with_expr_list_t);
     (yyval.select_stmt) = (yyvsp[0].select_stmt);
 }
-#line 4173 "parser.cpp"
+#line 4171 "parser.cpp"
     break;
 
   case 122: /* select_clause_with_modifier: select_clause_without_modifier order_by_clause limit_expr offset_expr  */
@@ -4195,7 +4193,7 @@ yyreduce:
     (yyvsp[-3].select_stmt)->offset_expr_ = (yyvsp[0].expr_t);
     (yyval.select_stmt) = (yyvsp[-3].select_stmt);
 }
-#line 4199 "parser.cpp"
+#line 4197 "parser.cpp"
     break;
 
   case 123: /* select_clause_without_modifier_paren: '(' select_clause_without_modifier ')'  */
@@ -4203,7 +4201,7 @@ yyreduce:
                                                                              {
   (yyval.select_stmt) = (yyvsp[-1].select_stmt);
 }
-#line 4207 "parser.cpp"
+#line 4205 "parser.cpp"
     break;
 
   case 124: /* select_clause_without_modifier_paren: '(' select_clause_without_modifier_paren ')'  */
@@ -4211,7 +4209,7 @@ yyreduce:
                                                {
     (yyval.select_stmt) = (yyvsp[-1].select_stmt);
 }
-#line 4215 "parser.cpp"
+#line 4213 "parser.cpp"
     break;
 
   case 125: /* select_clause_without_modifier: SELECT distinct expr_array from_clause search_clause where_clause group_by_clause having_clause  */
@@ -4231,7 +4229,7 @@ yyreduce:
         YYERROR;
     }
 }
-#line 4235 "parser.cpp"
+#line 4233 "parser.cpp"
     break;
 
   case 126: /* order_by_clause: ORDER BY order_by_expr_list  */
@@ -4239,7 +4237,7 @@ yyreduce:
                                               {
     (yyval.order_by_expr_list_t) = (yyvsp[0].order_by_expr_list_t);
 }
-#line 4243 "parser.cpp"
+#line 4241 "parser.cpp"
     break;
 
   case 127: /* order_by_clause: %empty  */
@@ -4247,7 +4245,7 @@ yyreduce:
                        {
     (yyval.order_by_expr_list_t) = nullptr;
 }
-#line 4251 "parser.cpp"
+#line 4249 "parser.cpp"
     break;
 
   case 128: /* order_by_expr_list: order_by_expr  */
@@ -4256,7 +4254,7 @@ yyreduce:
     (yyval.order_by_expr_list_t) = new std::vector<infinity::OrderByExpr*>();
     (yyval.order_by_expr_list_t)->emplace_back((yyvsp[0].order_by_expr_t));
 }
-#line 4260 "parser.cpp"
+#line 4258 "parser.cpp"
     break;
 
   case 129: /* order_by_expr_list: order_by_expr_list ',' order_by_expr  */
@@ -4265,7 +4263,7 @@ yyreduce:
     (yyvsp[-2].order_by_expr_list_t)->emplace_back((yyvsp[0].order_by_expr_t));
     (yyval.order_by_expr_list_t) = (yyvsp[-2].order_by_expr_list_t);
 }
-#line 4269 "parser.cpp"
+#line 4267 "parser.cpp"
     break;
 
   case 130: /* order_by_expr: expr order_by_type  */
@@ -4275,7 +4273,7 @@ yyreduce:
     (yyval.order_by_expr_t)->expr_ = (yyvsp[-1].expr_t);
     (yyval.order_by_expr_t)->type_ = (yyvsp[0].order_by_type_t);
 }
-#line 4279 "parser.cpp"
+#line 4277 "parser.cpp"
     break;
 
   case 131: /* order_by_type: ASC  */
@@ -4283,7 +4281,7 @@ yyreduce:
                    {
     (yyval.order_by_type_t) = infinity::kAsc;
 }
-#line 4287 "parser.cpp"
+#line 4285 "parser.cpp"
     break;
 
   case 132: /* order_by_type: DESC  */
@@ -4291,7 +4289,7 @@ yyreduce:
        {
     (yyval.order_by_type_t) = infinity::kDesc;
 }
-#line 4295 "parser.cpp"
+#line 4293 "parser.cpp"
     break;
 
   case 133: /* order_by_type: %empty  */
@@ -4299,7 +4297,7 @@ yyreduce:
   {
     (yyval.order_by_type_t) = infinity::kAsc;
 }
-#line 4303 "parser.cpp"
+#line 4301 "parser.cpp"
     break;
 
   case 134: /* limit_expr: LIMIT expr  */
@@ -4307,13 +4305,13 @@ yyreduce:
                        {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 4311 "parser.cpp"
+#line 4309 "parser.cpp"
     break;
 
   case 135: /* limit_expr: %empty  */
 #line 1273 "parser.y"
 {   (yyval.expr_t) = nullptr; }
-#line 4317 "parser.cpp"
+#line 4315 "parser.cpp"
     break;
 
   case 136: /* offset_expr: OFFSET expr  */
@@ -4321,13 +4319,13 @@ yyreduce:
                          {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 4325 "parser.cpp"
+#line 4323 "parser.cpp"
     break;
 
   case 137: /* offset_expr: %empty  */
 #line 1279 "parser.y"
 {   (yyval.expr_t) = nullptr; }
-#line 4331 "parser.cpp"
+#line 4329 "parser.cpp"
     break;
 
   case 138: /* distinct: DISTINCT  */
@@ -4335,7 +4333,7 @@ yyreduce:
                     {
     (yyval.bool_value) = true;
 }
-#line 4339 "parser.cpp"
+#line 4337 "parser.cpp"
     break;
 
   case 139: /* distinct: %empty  */
@@ -4343,7 +4341,7 @@ yyreduce:
   {
     (yyval.bool_value) = false;
 }
-#line 4347 "parser.cpp"
+#line 4345 "parser.cpp"
     break;
 
   case 140: /* from_clause: FROM table_reference  */
@@ -4351,7 +4349,7 @@ yyreduce:
                                   {
     (yyval.table_reference_t) = (yyvsp[0].table_reference_t);
 }
-#line 4355 "parser.cpp"
+#line 4353 "parser.cpp"
     break;
 
   case 141: /* from_clause: %empty  */
@@ -4359,7 +4357,7 @@ yyreduce:
                        {
     (yyval.table_reference_t) = nullptr;
 }
-#line 4363 "parser.cpp"
+#line 4361 "parser.cpp"
     break;
 
   case 142: /* search_clause: SEARCH sub_search_array  */
@@ -4369,7 +4367,7 @@ yyreduce:
     search_expr->SetExprs((yyvsp[0].expr_array_t));
     (yyval.expr_t) = search_expr;
 }
-#line 4373 "parser.cpp"
+#line 4371 "parser.cpp"
     break;
 
   case 143: /* search_clause: %empty  */
@@ -4377,7 +4375,7 @@ yyreduce:
                          {
     (yyval.expr_t) = nullptr;
 }
-#line 4381 "parser.cpp"
+#line 4379 "parser.cpp"
     break;
 
   case 144: /* where_clause: WHERE expr  */
@@ -4385,7 +4383,7 @@ yyreduce:
                          {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 4389 "parser.cpp"
+#line 4387 "parser.cpp"
     break;
 
   case 145: /* where_clause: %empty  */
@@ -4393,7 +4391,7 @@ yyreduce:
                         {
     (yyval.expr_t) = nullptr;
 }
-#line 4397 "parser.cpp"
+#line 4395 "parser.cpp"
     break;
 
   case 146: /* having_clause: HAVING expr  */
@@ -4401,7 +4399,7 @@ yyreduce:
                            {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 4405 "parser.cpp"
+#line 4403 "parser.cpp"
     break;
 
   case 147: /* having_clause: %empty  */
@@ -4409,7 +4407,7 @@ yyreduce:
                         {
     (yyval.expr_t) = nullptr;
 }
-#line 4413 "parser.cpp"
+#line 4411 "parser.cpp"
     break;
 
   case 148: /* group_by_clause: GROUP BY expr_array  */
@@ -4417,7 +4415,7 @@ yyreduce:
                                      {
     (yyval.expr_array_t) = (yyvsp[0].expr_array_t);
 }
-#line 4421 "parser.cpp"
+#line 4419 "parser.cpp"
     break;
 
   case 149: /* group_by_clause: %empty  */
@@ -4425,7 +4423,7 @@ yyreduce:
   {
     (yyval.expr_array_t) = nullptr;
 }
-#line 4429 "parser.cpp"
+#line 4427 "parser.cpp"
     break;
 
   case 150: /* set_operator: UNION  */
@@ -4433,7 +4431,7 @@ yyreduce:
                      {
     (yyval.set_operator_t) = infinity::SetOperatorType::kUnion;
 }
-#line 4437 "parser.cpp"
+#line 4435 "parser.cpp"
     break;
 
   case 151: /* set_operator: UNION ALL  */
@@ -4441,7 +4439,7 @@ yyreduce:
             {
     (yyval.set_operator_t) = infinity::SetOperatorType::kUnionAll;
 }
-#line 4445 "parser.cpp"
+#line 4443 "parser.cpp"
     break;
 
   case 152: /* set_operator: INTERSECT  */
@@ -4449,7 +4447,7 @@ yyreduce:
             {
     (yyval.set_operator_t) = infinity::SetOperatorType::kIntersect;
 }
-#line 4453 "parser.cpp"
+#line 4451 "parser.cpp"
     break;
 
   case 153: /* set_operator: EXCEPT  */
@@ -4457,7 +4455,7 @@ yyreduce:
          {
     (yyval.set_operator_t) = infinity::SetOperatorType::kExcept;
 }
-#line 4461 "parser.cpp"
+#line 4459 "parser.cpp"
     break;
 
   case 154: /* table_reference: table_reference_unit  */
@@ -4465,7 +4463,7 @@ yyreduce:
                                        {
     (yyval.table_reference_t) = (yyvsp[0].table_reference_t);
 }
-#line 4469 "parser.cpp"
+#line 4467 "parser.cpp"
     break;
 
   case 155: /* table_reference: table_reference ',' table_reference_unit  */
@@ -4483,7 +4481,7 @@ yyreduce:
 
     (yyval.table_reference_t) = cross_product_ref;
 }
-#line 4487 "parser.cpp"
+#line 4485 "parser.cpp"
     break;
 
   case 158: /* table_reference_name: table_name table_alias  */
@@ -4501,7 +4499,7 @@ yyreduce:
     table_ref->alias_ = (yyvsp[0].table_alias_t);
     (yyval.table_reference_t) = table_ref;
 }
-#line 4505 "parser.cpp"
+#line 4503 "parser.cpp"
     break;
 
   case 159: /* table_reference_name: '(' select_statement ')' table_alias  */
@@ -4512,7 +4510,7 @@ yyreduce:
     subquery_reference->alias_ = (yyvsp[0].table_alias_t);
     (yyval.table_reference_t) = subquery_reference;
 }
-#line 4516 "parser.cpp"
+#line 4514 "parser.cpp"
     break;
 
   case 160: /* table_name: IDENTIFIER  */
@@ -4522,7 +4520,7 @@ yyreduce:
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.table_name_t)->table_name_ptr_ = (yyvsp[0].str_value);
 }
-#line 4526 "parser.cpp"
+#line 4524 "parser.cpp"
     break;
 
   case 161: /* table_name: IDENTIFIER '.' IDENTIFIER  */
@@ -4534,7 +4532,7 @@ yyreduce:
     (yyval.table_name_t)->schema_name_ptr_ = (yyvsp[-2].str_value);
     (yyval.table_name_t)->table_name_ptr_ = (yyvsp[0].str_value);
 }
-#line 4538 "parser.cpp"
+#line 4536 "parser.cpp"
     break;
 
   case 162: /* table_alias: AS IDENTIFIER  */
@@ -4544,7 +4542,7 @@ yyreduce:
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.table_alias_t)->alias_ = (yyvsp[0].str_value);
 }
-#line 4548 "parser.cpp"
+#line 4546 "parser.cpp"
     break;
 
   case 163: /* table_alias: IDENTIFIER  */
@@ -4554,7 +4552,7 @@ yyreduce:
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.table_alias_t)->alias_ = (yyvsp[0].str_value);
 }
-#line 4558 "parser.cpp"
+#line 4556 "parser.cpp"
     break;
 
   case 164: /* table_alias: AS IDENTIFIER '(' identifier_array ')'  */
@@ -4565,7 +4563,7 @@ yyreduce:
     (yyval.table_alias_t)->alias_ = (yyvsp[-3].str_value);
     (yyval.table_alias_t)->column_alias_array_ = (yyvsp[-1].identifier_array_t);
 }
-#line 4569 "parser.cpp"
+#line 4567 "parser.cpp"
     break;
 
   case 165: /* table_alias: %empty  */
@@ -4573,7 +4571,7 @@ yyreduce:
   {
     (yyval.table_alias_t) = nullptr;
 }
-#line 4577 "parser.cpp"
+#line 4575 "parser.cpp"
     break;
 
   case 166: /* with_clause: WITH with_expr_list  */
@@ -4581,7 +4579,7 @@ yyreduce:
                                   {
     (yyval.with_expr_list_t) = (yyvsp[0].with_expr_list_t);
 }
-#line 4585 "parser.cpp"
+#line 4583 "parser.cpp"
     break;
 
   case 167: /* with_clause: %empty  */
@@ -4589,7 +4587,7 @@ yyreduce:
                           {
     (yyval.with_expr_list_t) = nullptr;
 }
-#line 4593 "parser.cpp"
+#line 4591 "parser.cpp"
     break;
 
   case 168: /* with_expr_list: with_expr  */
@@ -4598,7 +4596,7 @@ yyreduce:
     (yyval.with_expr_list_t) = new std::vector<infinity::WithExpr*>();
     (yyval.with_expr_list_t)->emplace_back((yyvsp[0].with_expr_t));
 }
-#line 4602 "parser.cpp"
+#line 4600 "parser.cpp"
     break;
 
   case 169: /* with_expr_list: with_expr_list ',' with_expr  */
@@ -4607,7 +4605,7 @@ yyreduce:
     (yyvsp[-2].with_expr_list_t)->emplace_back((yyvsp[0].with_expr_t));
     (yyval.with_expr_list_t) = (yyvsp[-2].with_expr_list_t);
 }
-#line 4611 "parser.cpp"
+#line 4609 "parser.cpp"
     break;
 
   case 170: /* with_expr: IDENTIFIER AS '(' select_clause_with_modifier ')'  */
@@ -4619,7 +4617,7 @@ yyreduce:
     free((yyvsp[-4].str_value));
     (yyval.with_expr_t)->select_ = (yyvsp[-1].select_stmt);
 }
-#line 4623 "parser.cpp"
+#line 4621 "parser.cpp"
     break;
 
   case 171: /* join_clause: table_reference_unit NATURAL JOIN table_reference_name  */
@@ -4631,7 +4629,7 @@ yyreduce:
     join_reference->join_type_ = infinity::JoinType::kNatural;
     (yyval.table_reference_t) = join_reference;
 }
-#line 4635 "parser.cpp"
+#line 4633 "parser.cpp"
     break;
 
   case 172: /* join_clause: table_reference_unit join_type JOIN table_reference_name ON expr  */
@@ -4644,7 +4642,7 @@ yyreduce:
     join_reference->condition_ = (yyvsp[0].expr_t);
     (yyval.table_reference_t) = join_reference;
 }
-#line 4648 "parser.cpp"
+#line 4646 "parser.cpp"
     break;
 
   case 173: /* join_type: INNER  */
@@ -4652,7 +4650,7 @@ yyreduce:
                   {
     (yyval.join_type_t) = infinity::JoinType::kInner;
 }
-#line 4656 "parser.cpp"
+#line 4654 "parser.cpp"
     break;
 
   case 174: /* join_type: LEFT  */
@@ -4660,7 +4658,7 @@ yyreduce:
        {
     (yyval.join_type_t) = infinity::JoinType::kLeft;
 }
-#line 4664 "parser.cpp"
+#line 4662 "parser.cpp"
     break;
 
   case 175: /* join_type: RIGHT  */
@@ -4668,7 +4666,7 @@ yyreduce:
         {
     (yyval.join_type_t) = infinity::JoinType::kRight;
 }
-#line 4672 "parser.cpp"
+#line 4670 "parser.cpp"
     break;
 
   case 176: /* join_type: OUTER  */
@@ -4676,7 +4674,7 @@ yyreduce:
         {
     (yyval.join_type_t) = infinity::JoinType::kFull;
 }
-#line 4680 "parser.cpp"
+#line 4678 "parser.cpp"
     break;
 
   case 177: /* join_type: FULL  */
@@ -4684,7 +4682,7 @@ yyreduce:
        {
     (yyval.join_type_t) = infinity::JoinType::kFull;
 }
-#line 4688 "parser.cpp"
+#line 4686 "parser.cpp"
     break;
 
   case 178: /* join_type: CROSS  */
@@ -4692,14 +4690,14 @@ yyreduce:
         {
     (yyval.join_type_t) = infinity::JoinType::kCross;
 }
-#line 4696 "parser.cpp"
+#line 4694 "parser.cpp"
     break;
 
   case 179: /* join_type: %empty  */
 #line 1488 "parser.y"
                 {
 }
-#line 4703 "parser.cpp"
+#line 4701 "parser.cpp"
     break;
 
   case 180: /* show_statement: SHOW DATABASES  */
@@ -4708,7 +4706,7 @@ yyreduce:
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kDatabases;
 }
-#line 4712 "parser.cpp"
+#line 4710 "parser.cpp"
     break;
 
   case 181: /* show_statement: SHOW TABLES  */
@@ -4717,7 +4715,7 @@ yyreduce:
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kTables;
 }
-#line 4721 "parser.cpp"
+#line 4719 "parser.cpp"
     break;
 
   case 182: /* show_statement: SHOW VIEWS  */
@@ -4726,7 +4724,7 @@ yyreduce:
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kViews;
 }
-#line 4730 "parser.cpp"
+#line 4728 "parser.cpp"
     break;
 
   case 183: /* show_statement: SHOW CONFIGS  */
@@ -4735,7 +4733,7 @@ yyreduce:
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kConfigs;
 }
-#line 4739 "parser.cpp"
+#line 4737 "parser.cpp"
     break;
 
   case 184: /* show_statement: SHOW PROFILES  */
@@ -4744,7 +4742,7 @@ yyreduce:
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kProfiles;
 }
-#line 4748 "parser.cpp"
+#line 4746 "parser.cpp"
     break;
 
   case 185: /* show_statement: SHOW SESSION STATUS  */
@@ -4753,7 +4751,7 @@ yyreduce:
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kSessionStatus;
 }
-#line 4757 "parser.cpp"
+#line 4755 "parser.cpp"
     break;
 
   case 186: /* show_statement: SHOW GLOBAL STATUS  */
@@ -4762,7 +4760,7 @@ yyreduce:
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kGlobalStatus;
 }
-#line 4766 "parser.cpp"
+#line 4764 "parser.cpp"
     break;
 
   case 187: /* show_statement: SHOW VAR IDENTIFIER  */
@@ -4774,11 +4772,28 @@ yyreduce:
     (yyval.show_stmt)->var_name_ = std::string((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
 }
-#line 4778 "parser.cpp"
+#line 4776 "parser.cpp"
     break;
 
-  case 188: /* show_statement: DESCRIBE table_name  */
+  case 188: /* show_statement: SHOW IDENTIFIER  */
 #line 1529 "parser.y"
+                  {
+    // TASKS isn't a keyword, so that it can still be used as a name
+    ParserHelper::ToLower((yyvsp[0].str_value));
+    bool is_tasks = strcmp((yyvsp[0].str_value), "tasks") == 0;
+    free((yyvsp[0].str_value));
+    if(!is_tasks) {
+        yyerror(&yyloc, scanner, result, "Unknown show statement.");
+        YYERROR;
+    }
+    (yyval.show_stmt) = new infinity::ShowStatement();
+    (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kTasks;
+}
+#line 4793 "parser.cpp"
+    break;
+
+  case 189: /* show_statement: DESCRIBE table_name  */
+#line 1541 "parser.y"
                       {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kColumns;
@@ -4790,11 +4805,11 @@ yyreduce:
     free((yyvsp[0].table_name_t)->table_name_ptr_);
     delete (yyvsp[0].table_name_t);
 }
-#line 4794 "parser.cpp"
+#line 4809 "parser.cpp"
     break;
 
-  case 189: /* show_statement: DESCRIBE table_name SEGMENTS  */
-#line 1540 "parser.y"
+  case 190: /* show_statement: DESCRIBE table_name SEGMENTS  */
+#line 1552 "parser.y"
                                {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kSegments;
@@ -4806,11 +4821,11 @@ yyreduce:
     free((yyvsp[-1].table_name_t)->table_name_ptr_);
     delete (yyvsp[-1].table_name_t);
 }
-#line 4810 "parser.cpp"
+#line 4825 "parser.cpp"
     break;
 
-  case 190: /* show_statement: DESCRIBE table_name SEGMENT LONG_VALUE  */
-#line 1551 "parser.y"
+  case 191: /* show_statement: DESCRIBE table_name SEGMENT LONG_VALUE  */
+#line 1563 "parser.y"
                                          {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kSegments;
@@ -4823,11 +4838,11 @@ yyreduce:
     (yyval.show_stmt)->segment_id_ = (yyvsp[0].long_value);
     delete (yyvsp[-2].table_name_t);
 }
-#line 4827 "parser.cpp"
+#line 4842 "parser.cpp"
     break;
 
-  case 191: /* show_statement: DESCRIBE table_name SEGMENT LONG_VALUE BLOCK LONG_VALUE  */
-#line 1563 "parser.y"
+  case 192: /* show_statement: DESCRIBE table_name SEGMENT LONG_VALUE BLOCK LONG_VALUE  */
+#line 1575 "parser.y"
                                                           {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kSegments;
@@ -4841,11 +4856,11 @@ yyreduce:
     (yyval.show_stmt)->block_id_ = (yyvsp[0].long_value);
     delete (yyvsp[-4].table_name_t);
 }
-#line 4845 "parser.cpp"
+#line 4860 "parser.cpp"
     break;
 
-  case 192: /* show_statement: DESCRIBE INDEX table_name  */
-#line 1576 "parser.y"
+  case 193: /* show_statement: DESCRIBE INDEX table_name  */
+#line 1588 "parser.y"
                             {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kIndexes;
@@ -4857,38 +4872,38 @@ yyreduce:
     free((yyvsp[0].table_name_t)->table_name_ptr_);
     delete (yyvsp[0].table_name_t);
 }
-#line 4861 "parser.cpp"
+#line 4876 "parser.cpp"
     break;
 
-  case 193: /* flush_statement: FLUSH DATA  */
-#line 1591 "parser.y"
+  case 194: /* flush_statement: FLUSH DATA  */
+#line 1603 "parser.y"
                             {
     (yyval.flush_stmt) = new infinity::FlushStatement();
     (yyval.flush_stmt)->type_ = infinity::FlushType::kData;
 }
-#line 4870 "parser.cpp"
+#line 4885 "parser.cpp"
     break;
 
-  case 194: /* flush_statement: FLUSH LOG  */
-#line 1595 "parser.y"
+  case 195: /* flush_statement: FLUSH LOG  */
+#line 1607 "parser.y"
             {
     (yyval.flush_stmt) = new infinity::FlushStatement();
     (yyval.flush_stmt)->type_ = infinity::FlushType::kLog;
 }
-#line 4879 "parser.cpp"
+#line 4894 "parser.cpp"
     break;
 
-  case 195: /* flush_statement: FLUSH BUFFER  */
-#line 1599 "parser.y"
+  case 196: /* flush_statement: FLUSH BUFFER  */
+#line 1611 "parser.y"
                {
     (yyval.flush_stmt) = new infinity::FlushStatement();
     (yyval.flush_stmt)->type_ = infinity::FlushType::kBuffer;
 }
-#line 4888 "parser.cpp"
+#line 4903 "parser.cpp"
     break;
 
-  case 196: /* optimize_statement: OPTIMIZE table_name  */
-#line 1607 "parser.y"
+  case 197: /* optimize_statement: OPTIMIZE table_name  */
+#line 1619 "parser.y"
                                         {
     (yyval.optimize_stmt) = new infinity::OptimizeStatement();
     (yyval.optimize_stmt)->type_ = infinity::OptimizeType::kIRS;
@@ -4900,54 +4915,54 @@ yyreduce:
     free((yyvsp[0].table_name_t)->table_name_ptr_);
     delete (yyvsp[0].table_name_t);
 }
-#line 4904 "parser.cpp"
+#line 4919 "parser.cpp"
     break;
 
-  case 197: /* command_statement: USE IDENTIFIER  */
-#line 1622 "parser.y"
+  case 198: /* command_statement: USE IDENTIFIER  */
+#line 1634 "parser.y"
                                   {
     (yyval.command_stmt) = new infinity::CommandStatement();
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::UseCmd>((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
 }
-#line 4915 "parser.cpp"
+#line 4930 "parser.cpp"
     break;
 
-  case 198: /* command_statement: EXPORT PROFILE LONG_VALUE file_path  */
-#line 1628 "parser.y"
+  case 199: /* command_statement: EXPORT PROFILE LONG_VALUE file_path  */
+#line 1640 "parser.y"
                                       {
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::ExportCmd>((yyvsp[0].str_value), infinity::ExportType::kProfileRecord, (yyvsp[-1].long_value));
     free((yyvsp[0].str_value));
 }
-#line 4925 "parser.cpp"
+#line 4940 "parser.cpp"
     break;
 
-  case 199: /* command_statement: SET SESSION IDENTIFIER ON  */
-#line 1633 "parser.y"
+  case 200: /* command_statement: SET SESSION IDENTIFIER ON  */
+#line 1645 "parser.y"
                             {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kSession, infinity::SetVarType::kBool, (yyvsp[-1].str_value), true);
     free((yyvsp[-1].str_value));
 }
-#line 4936 "parser.cpp"
+#line 4951 "parser.cpp"
     break;
 
-  case 200: /* command_statement: SET SESSION IDENTIFIER OFF  */
-#line 1639 "parser.y"
+  case 201: /* command_statement: SET SESSION IDENTIFIER OFF  */
+#line 1651 "parser.y"
                              {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kSession, infinity::SetVarType::kBool, (yyvsp[-1].str_value), false);
     free((yyvsp[-1].str_value));
 }
-#line 4947 "parser.cpp"
+#line 4962 "parser.cpp"
     break;
 
-  case 201: /* command_statement: SET SESSION IDENTIFIER STRING  */
-#line 1645 "parser.y"
+  case 202: /* command_statement: SET SESSION IDENTIFIER STRING  */
+#line 1657 "parser.y"
                                 {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -4956,55 +4971,55 @@ yyreduce:
     free((yyvsp[-1].str_value));
     free((yyvsp[0].str_value));
 }
-#line 4960 "parser.cpp"
+#line 4975 "parser.cpp"
     break;
 
-  case 202: /* command_statement: SET SESSION IDENTIFIER LONG_VALUE  */
-#line 1653 "parser.y"
+  case 203: /* command_statement: SET SESSION IDENTIFIER LONG_VALUE  */
+#line 1665 "parser.y"
                                     {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kSession, infinity::SetVarType::kInteger, (yyvsp[-1].str_value), (yyvsp[0].long_value));
     free((yyvsp[-1].str_value));
 }
-#line 4971 "parser.cpp"
+#line 4986 "parser.cpp"
     break;
 
-  case 203: /* command_statement: SET SESSION IDENTIFIER DOUBLE_VALUE  */
-#line 1659 "parser.y"
+  case 204: /* command_statement: SET SESSION IDENTIFIER DOUBLE_VALUE  */
+#line 1671 "parser.y"
                                       {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kSession, infinity::SetVarType::kDouble, (yyvsp[-1].str_value), (yyvsp[0].double_value));
     free((yyvsp[-1].str_value));
 }
-#line 4982 "parser.cpp"
+#line 4997 "parser.cpp"
     break;
 
-  case 204: /* command_statement: SET GLOBAL IDENTIFIER ON  */
-#line 1665 "parser.y"
+  case 205: /* command_statement: SET GLOBAL IDENTIFIER ON  */
+#line 1677 "parser.y"
                            {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kGlobal, infinity::SetVarType::kBool, (yyvsp[-1].str_value), true);
     free((yyvsp[-1].str_value));
 }
-#line 4993 "parser.cpp"
+#line 5008 "parser.cpp"
     break;
 
-  case 205: /* command_statement: SET GLOBAL IDENTIFIER OFF  */
-#line 1671 "parser.y"
+  case 206: /* command_statement: SET GLOBAL IDENTIFIER OFF  */
+#line 1683 "parser.y"
                             {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kGlobal, infinity::SetVarType::kBool, (yyvsp[-1].str_value), false);
     free((yyvsp[-1].str_value));
 }
-#line 5004 "parser.cpp"
+#line 5019 "parser.cpp"
     break;
 
-  case 206: /* command_statement: SET GLOBAL IDENTIFIER STRING  */
-#line 1677 "parser.y"
+  case 207: /* command_statement: SET GLOBAL IDENTIFIER STRING  */
+#line 1689 "parser.y"
                                {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -5013,33 +5028,33 @@ yyreduce:
     free((yyvsp[-1].str_value));
     free((yyvsp[0].str_value));
 }
-#line 5017 "parser.cpp"
+#line 5032 "parser.cpp"
     break;
 
-  case 207: /* command_statement: SET GLOBAL IDENTIFIER LONG_VALUE  */
-#line 1685 "parser.y"
+  case 208: /* command_statement: SET GLOBAL IDENTIFIER LONG_VALUE  */
+#line 1697 "parser.y"
                                    {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kGlobal, infinity::SetVarType::kInteger, (yyvsp[-1].str_value), (yyvsp[0].long_value));
     free((yyvsp[-1].str_value));
 }
-#line 5028 "parser.cpp"
+#line 5043 "parser.cpp"
     break;
 
-  case 208: /* command_statement: SET GLOBAL IDENTIFIER DOUBLE_VALUE  */
-#line 1691 "parser.y"
+  case 209: /* command_statement: SET GLOBAL IDENTIFIER DOUBLE_VALUE  */
+#line 1703 "parser.y"
                                      {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kGlobal, infinity::SetVarType::kDouble, (yyvsp[-1].str_value), (yyvsp[0].double_value));
     free((yyvsp[-1].str_value));
 }
-#line 5039 "parser.cpp"
+#line 5054 "parser.cpp"
     break;
 
-  case 209: /* command_statement: COMPACT TABLE table_name  */
-#line 1697 "parser.y"
+  case 210: /* command_statement: COMPACT TABLE table_name  */
+#line 1709 "parser.y"
                            {
     (yyval.command_stmt) = new infinity::CommandStatement();
     if ((yyvsp[0].table_name_t)->schema_name_ptr_ != nullptr) {
@@ -5051,38 +5066,38 @@ yyreduce:
         free((yyvsp[0].table_name_t)->table_name_ptr_);
     } delete (yyvsp[0].table_name_t);
 }
-#line 5055 "parser.cpp"
+#line 5070 "parser.cpp"
     break;
 
-  case 210: /* expr_array: expr_alias  */
-#line 1713 "parser.y"
+  case 211: /* expr_array: expr_alias  */
+#line 1725 "parser.y"
                         {
     (yyval.expr_array_t) = new std::vector<infinity::ParsedExpr*>();
     (yyval.expr_array_t)->emplace_back((yyvsp[0].expr_t));
 }
-#line 5064 "parser.cpp"
+#line 5079 "parser.cpp"
     break;
 
-  case 211: /* expr_array: expr_array ',' expr_alias  */
-#line 1717 "parser.y"
+  case 212: /* expr_array: expr_array ',' expr_alias  */
+#line 1729 "parser.y"
                             {
     (yyvsp[-2].expr_array_t)->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_array_t) = (yyvsp[-2].expr_array_t);
 }
-#line 5073 "parser.cpp"
+#line 5088 "parser.cpp"
     break;
 
-  case 212: /* expr_array_list: '(' expr_array ')'  */
-#line 1722 "parser.y"
+  case 213: /* expr_array_list: '(' expr_array ')'  */
+#line 1734 "parser.y"
                                      {
     (yyval.expr_array_list_t) = new std::vector<std::vector<infinity::ParsedExpr*>*>();
     (yyval.expr_array_list_t)->push_back((yyvsp[-1].expr_array_t));
 }
-#line 5082 "parser.cpp"
+#line 5097 "parser.cpp"
     break;
 
-  case 213: /* expr_array_list: expr_array_list ',' '(' expr_array ')'  */
-#line 1726 "parser.y"
+  case 214: /* expr_array_list: expr_array_list ',' '(' expr_array ')'  */
+#line 1738 "parser.y"
                                          {
     if(!(yyvsp[-4].expr_array_list_t)->empty() && (yyvsp[-4].expr_array_list_t)->back()->size() != (yyvsp[-1].expr_array_t)->size()) {
         yyerror(&yyloc, scanner, result, "The expr_array in list shall have the same size.");
@@ -5098,57 +5113,57 @@ yyreduce:
     (yyvsp[-4].expr_array_list_t)->push_back((yyvsp[-1].expr_array_t));
     (yyval.expr_array_list_t) = (yyvsp[-4].expr_array_list_t);
 }
-#line 5102 "parser.cpp"
+#line 5117 "parser.cpp"
     break;
 
-  case 214: /* expr_alias: expr AS IDENTIFIER  */
-#line 1753 "parser.y"
+  case 215: /* expr_alias: expr AS IDENTIFIER  */
+#line 1765 "parser.y"
                                 {
     (yyval.expr_t) = (yyvsp[-2].expr_t);
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.expr_t)->alias_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 5113 "parser.cpp"
+#line 5128 "parser.cpp"
     break;
 
-  case 215: /* expr_alias: expr  */
-#line 1759 "parser.y"
+  case 216: /* expr_alias: expr  */
+#line 1771 "parser.y"
        {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 5121 "parser.cpp"
+#line 5136 "parser.cpp"
     break;
 
-  case 221: /* operand: '(' expr ')'  */
-#line 1769 "parser.y"
+  case 222: /* operand: '(' expr ')'  */
+#line 1781 "parser.y"
                       {
    (yyval.expr_t) = (yyvsp[-1].expr_t);
 }
-#line 5129 "parser.cpp"
+#line 5144 "parser.cpp"
     break;
 
-  case 222: /* operand: '(' select_without_paren ')'  */
-#line 1772 "parser.y"
+  case 223: /* operand: '(' select_without_paren ')'  */
+#line 1784 "parser.y"
                                {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kScalar;
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 5140 "parser.cpp"
+#line 5155 "parser.cpp"
     break;
 
-  case 223: /* operand: constant_expr  */
-#line 1778 "parser.y"
+  case 224: /* operand: constant_expr  */
+#line 1790 "parser.y"
                 {
     (yyval.expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 5148 "parser.cpp"
+#line 5163 "parser.cpp"
     break;
 
-  case 232: /* knn_expr: KNN '(' expr ',' array_expr ',' STRING ',' STRING ',' LONG_VALUE ')' with_index_param_list  */
-#line 1790 "parser.y"
+  case 233: /* knn_expr: KNN '(' expr ',' array_expr ',' STRING ',' STRING ',' LONG_VALUE ')' with_index_param_list  */
+#line 1802 "parser.y"
                                                                                                       {
     infinity::KnnExpr* knn_expr = new infinity::KnnExpr();
     (yyval.expr_t) = knn_expr;
@@ -5315,11 +5330,11 @@ yyreduce:
     knn_expr->topn_ = (yyvsp[-2].long_value);
     knn_expr->opt_params_ = (yyvsp[0].with_index_param_list_t);
 }
-#line 5319 "parser.cpp"
+#line 5334 "parser.cpp"
     break;
 
-  case 233: /* match_expr: MATCH '(' STRING ',' STRING ')'  */
-#line 1957 "parser.y"
+  case 234: /* match_expr: MATCH '(' STRING ',' STRING ')'  */
+#line 1969 "parser.y"
                                              {
     infinity::MatchExpr* match_expr = new infinity::MatchExpr();
     match_expr->fields_ = std::string((yyvsp[-3].str_value));
@@ -5328,11 +5343,11 @@ yyreduce:
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = match_expr;
 }
-#line 5332 "parser.cpp"
+#line 5347 "parser.cpp"
     break;
 
-  case 234: /* match_expr: MATCH '(' STRING ',' STRING ',' STRING ')'  */
-#line 1965 "parser.y"
+  case 235: /* match_expr: MATCH '(' STRING ',' STRING ',' STRING ')'  */
+#line 1977 "parser.y"
                                              {
     infinity::MatchExpr* match_expr = new infinity::MatchExpr();
     match_expr->fields_ = std::string((yyvsp[-5].str_value));
@@ -5343,22 +5358,22 @@ yyreduce:
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = match_expr;
 }
-#line 5347 "parser.cpp"
+#line 5362 "parser.cpp"
     break;
 
-  case 235: /* query_expr: QUERY '(' STRING ')'  */
-#line 1976 "parser.y"
+  case 236: /* query_expr: QUERY '(' STRING ')'  */
+#line 1988 "parser.y"
                                   {
     infinity::MatchExpr* match_expr = new infinity::MatchExpr();
     match_expr->matching_text_ = std::string((yyvsp[-1].str_value));
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = match_expr;
 }
-#line 5358 "parser.cpp"
+#line 5373 "parser.cpp"
     break;
 
-  case 236: /* query_expr: QUERY '(' STRING ',' STRING ')'  */
-#line 1982 "parser.y"
+  case 237: /* query_expr: QUERY '(' STRING ',' STRING ')'  */
+#line 1994 "parser.y"
                                   {
     infinity::MatchExpr* match_expr = new infinity::MatchExpr();
     match_expr->matching_text_ = std::string((yyvsp[-3].str_value));
@@ -5367,22 +5382,22 @@ yyreduce:
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = match_expr;
 }
-#line 5371 "parser.cpp"
+#line 5386 "parser.cpp"
     break;
 
-  case 237: /* fusion_expr: FUSION '(' STRING ')'  */
-#line 1991 "parser.y"
+  case 238: /* fusion_expr: FUSION '(' STRING ')'  */
+#line 2003 "parser.y"
                                     {
     infinity::FusionExpr* fusion_expr = new infinity::FusionExpr();
     fusion_expr->method_ = std::string((yyvsp[-1].str_value));
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = fusion_expr;
 }
-#line 5382 "parser.cpp"
+#line 5397 "parser.cpp"
     break;
 
-  case 238: /* fusion_expr: FUSION '(' STRING ',' STRING ')'  */
-#line 1997 "parser.y"
+  case 239: /* fusion_expr: FUSION '(' STRING ',' STRING ')'  */
+#line 2009 "parser.y"
                                    {
     infinity::FusionExpr* fusion_expr = new infinity::FusionExpr();
     fusion_expr->method_ = std::string((yyvsp[-3].str_value));
@@ -5391,83 +5406,83 @@ yyreduce:
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = fusion_expr;
 }
-#line 5395 "parser.cpp"
+#line 5410 "parser.cpp"
     break;
 
-  case 239: /* sub_search_array: knn_expr  */
-#line 2007 "parser.y"
+  case 240: /* sub_search_array: knn_expr  */
+#line 2019 "parser.y"
                             {
     (yyval.expr_array_t) = new std::vector<infinity::ParsedExpr*>();
     (yyval.expr_array_t)->emplace_back((yyvsp[0].expr_t));
 }
-#line 5404 "parser.cpp"
+#line 5419 "parser.cpp"
     break;
 
-  case 240: /* sub_search_array: match_expr  */
-#line 2011 "parser.y"
+  case 241: /* sub_search_array: match_expr  */
+#line 2023 "parser.y"
              {
     (yyval.expr_array_t) = new std::vector<infinity::ParsedExpr*>();
     (yyval.expr_array_t)->emplace_back((yyvsp[0].expr_t));
 }
-#line 5413 "parser.cpp"
+#line 5428 "parser.cpp"
     break;
 
-  case 241: /* sub_search_array: query_expr  */
-#line 2015 "parser.y"
+  case 242: /* sub_search_array: query_expr  */
+#line 2027 "parser.y"
              {
     (yyval.expr_array_t) = new std::vector<infinity::ParsedExpr*>();
     (yyval.expr_array_t)->emplace_back((yyvsp[0].expr_t));
 }
-#line 5422 "parser.cpp"
+#line 5437 "parser.cpp"
     break;
 
-  case 242: /* sub_search_array: fusion_expr  */
-#line 2019 "parser.y"
+  case 243: /* sub_search_array: fusion_expr  */
+#line 2031 "parser.y"
               {
     (yyval.expr_array_t) = new std::vector<infinity::ParsedExpr*>();
     (yyval.expr_array_t)->emplace_back((yyvsp[0].expr_t));
 }
-#line 5431 "parser.cpp"
+#line 5446 "parser.cpp"
     break;
 
-  case 243: /* sub_search_array: sub_search_array ',' knn_expr  */
-#line 2023 "parser.y"
+  case 244: /* sub_search_array: sub_search_array ',' knn_expr  */
+#line 2035 "parser.y"
                                 {
     (yyvsp[-2].expr_array_t)->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_array_t) = (yyvsp[-2].expr_array_t);
 }
-#line 5440 "parser.cpp"
+#line 5455 "parser.cpp"
     break;
 
-  case 244: /* sub_search_array: sub_search_array ',' match_expr  */
-#line 2027 "parser.y"
+  case 245: /* sub_search_array: sub_search_array ',' match_expr  */
+#line 2039 "parser.y"
                                   {
     (yyvsp[-2].expr_array_t)->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_array_t) = (yyvsp[-2].expr_array_t);
 }
-#line 5449 "parser.cpp"
+#line 5464 "parser.cpp"
     break;
 
-  case 245: /* sub_search_array: sub_search_array ',' query_expr  */
-#line 2031 "parser.y"
+  case 246: /* sub_search_array: sub_search_array ',' query_expr  */
+#line 2043 "parser.y"
                                   {
     (yyvsp[-2].expr_array_t)->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_array_t) = (yyvsp[-2].expr_array_t);
 }
-#line 5458 "parser.cpp"
+#line 5473 "parser.cpp"
     break;
 
-  case 246: /* sub_search_array: sub_search_array ',' fusion_expr  */
-#line 2035 "parser.y"
+  case 247: /* sub_search_array: sub_search_array ',' fusion_expr  */
+#line 2047 "parser.y"
                                    {
     (yyvsp[-2].expr_array_t)->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_array_t) = (yyvsp[-2].expr_array_t);
 }
-#line 5467 "parser.cpp"
+#line 5482 "parser.cpp"
     break;
 
-  case 247: /* function_expr: IDENTIFIER '(' ')'  */
-#line 2040 "parser.y"
+  case 248: /* function_expr: IDENTIFIER '(' ')'  */
+#line 2052 "parser.y"
                                    {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     ParserHelper::ToLower((yyvsp[-2].str_value));
@@ -5476,11 +5491,11 @@ yyreduce:
     func_expr->arguments_ = nullptr;
     (yyval.expr_t) = func_expr;
 }
-#line 5480 "parser.cpp"
+#line 5495 "parser.cpp"
     break;
 
-  case 248: /* function_expr: IDENTIFIER '(' expr_array ')'  */
-#line 2048 "parser.y"
+  case 249: /* function_expr: IDENTIFIER '(' expr_array ')'  */
+#line 2060 "parser.y"
                                 {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     ParserHelper::ToLower((yyvsp[-3].str_value));
@@ -5489,11 +5504,11 @@ yyreduce:
     func_expr->arguments_ = (yyvsp[-1].expr_array_t);
     (yyval.expr_t) = func_expr;
 }
-#line 5493 "parser.cpp"
+#line 5508 "parser.cpp"
     break;
 
-  case 249: /* function_expr: IDENTIFIER '(' DISTINCT expr_array ')'  */
-#line 2056 "parser.y"
+  case 250: /* function_expr: IDENTIFIER '(' DISTINCT expr_array ')'  */
+#line 2068 "parser.y"
                                          {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     ParserHelper::ToLower((yyvsp[-4].str_value));
@@ -5503,11 +5518,11 @@ yyreduce:
     func_expr->distinct_ = true;
     (yyval.expr_t) = func_expr;
 }
-#line 5507 "parser.cpp"
+#line 5522 "parser.cpp"
     break;
 
-  case 250: /* function_expr: operand IS NOT NULLABLE  */
-#line 2065 "parser.y"
+  case 251: /* function_expr: operand IS NOT NULLABLE  */
+#line 2077 "parser.y"
                           {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "is_not_null";
@@ -5515,11 +5530,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[-3].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5519 "parser.cpp"
+#line 5534 "parser.cpp"
     break;
 
-  case 251: /* function_expr: operand IS NULLABLE  */
-#line 2072 "parser.y"
+  case 252: /* function_expr: operand IS NULLABLE  */
+#line 2084 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "is_null";
@@ -5527,11 +5542,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[-2].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5531 "parser.cpp"
+#line 5546 "parser.cpp"
     break;
 
-  case 252: /* function_expr: NOT operand  */
-#line 2079 "parser.y"
+  case 253: /* function_expr: NOT operand  */
+#line 2091 "parser.y"
               {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "not";
@@ -5539,11 +5554,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5543 "parser.cpp"
+#line 5558 "parser.cpp"
     break;
 
-  case 253: /* function_expr: '-' operand  */
-#line 2086 "parser.y"
+  case 254: /* function_expr: '-' operand  */
+#line 2098 "parser.y"
               {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "-";
@@ -5551,11 +5566,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5555 "parser.cpp"
+#line 5570 "parser.cpp"
     break;
 
-  case 254: /* function_expr: '+' operand  */
-#line 2093 "parser.y"
+  case 255: /* function_expr: '+' operand  */
+#line 2105 "parser.y"
               {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "+";
@@ -5563,11 +5578,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5567 "parser.cpp"
+#line 5582 "parser.cpp"
     break;
 
-  case 255: /* function_expr: operand '-' operand  */
-#line 2100 "parser.y"
+  case 256: /* function_expr: operand '-' operand  */
+#line 2112 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "-";
@@ -5576,11 +5591,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5580 "parser.cpp"
+#line 5595 "parser.cpp"
     break;
 
-  case 256: /* function_expr: operand '+' operand  */
-#line 2108 "parser.y"
+  case 257: /* function_expr: operand '+' operand  */
+#line 2120 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "+";
@@ -5589,11 +5604,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5593 "parser.cpp"
+#line 5608 "parser.cpp"
     break;
 
-  case 257: /* function_expr: operand '*' operand  */
-#line 2116 "parser.y"
+  case 258: /* function_expr: operand '*' operand  */
+#line 2128 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "*";
@@ -5602,11 +5617,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5606 "parser.cpp"
+#line 5621 "parser.cpp"
     break;
 
-  case 258: /* function_expr: operand '/' operand  */
-#line 2124 "parser.y"
+  case 259: /* function_expr: operand '/' operand  */
+#line 2136 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "/";
@@ -5615,11 +5630,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5619 "parser.cpp"
+#line 5634 "parser.cpp"
     break;
 
-  case 259: /* function_expr: operand '%' operand  */
-#line 2132 "parser.y"
+  case 260: /* function_expr: operand '%' operand  */
+#line 2144 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "%";
@@ -5628,11 +5643,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5632 "parser.cpp"
+#line 5647 "parser.cpp"
     break;
 
-  case 260: /* function_expr: operand '=' operand  */
-#line 2140 "parser.y"
+  case 261: /* function_expr: operand '=' operand  */
+#line 2152 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "=";
@@ -5641,11 +5656,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5645 "parser.cpp"
+#line 5660 "parser.cpp"
     break;
 
-  case 261: /* function_expr: operand EQUAL operand  */
-#line 2148 "parser.y"
+  case 262: /* function_expr: operand EQUAL operand  */
+#line 2160 "parser.y"
                         {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "=";
@@ -5654,11 +5669,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5658 "parser.cpp"
+#line 5673 "parser.cpp"
     break;
 
-  case 262: /* function_expr: operand NOT_EQ operand  */
-#line 2156 "parser.y"
+  case 263: /* function_expr: operand NOT_EQ operand  */
+#line 2168 "parser.y"
                          {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "<>";
@@ -5667,11 +5682,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5671 "parser.cpp"
+#line 5686 "parser.cpp"
     break;
 
-  case 263: /* function_expr: operand '<' operand  */
-#line 2164 "parser.y"
+  case 264: /* function_expr: operand '<' operand  */
+#line 2176 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "<";
@@ -5680,11 +5695,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5684 "parser.cpp"
+#line 5699 "parser.cpp"
     break;
 
-  case 264: /* function_expr: operand '>' operand  */
-#line 2172 "parser.y"
+  case 265: /* function_expr: operand '>' operand  */
+#line 2184 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = ">";
@@ -5693,11 +5708,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5697 "parser.cpp"
+#line 5712 "parser.cpp"
     break;
 
-  case 265: /* function_expr: operand LESS_EQ operand  */
-#line 2180 "parser.y"
+  case 266: /* function_expr: operand LESS_EQ operand  */
+#line 2192 "parser.y"
                           {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "<=";
@@ -5706,11 +5721,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5710 "parser.cpp"
+#line 5725 "parser.cpp"
     break;
 
-  case 266: /* function_expr: operand GREATER_EQ operand  */
-#line 2188 "parser.y"
+  case 267: /* function_expr: operand GREATER_EQ operand  */
+#line 2200 "parser.y"
                              {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = ">=";
@@ -5719,11 +5734,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5723 "parser.cpp"
+#line 5738 "parser.cpp"
     break;
 
-  case 267: /* function_expr: EXTRACT '(' STRING FROM operand ')'  */
-#line 2196 "parser.y"
+  case 268: /* function_expr: EXTRACT '(' STRING FROM operand ')'  */
+#line 2208 "parser.y"
                                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     ParserHelper::ToLower((yyvsp[-3].str_value));
@@ -5754,11 +5769,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[-1].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5758 "parser.cpp"
+#line 5773 "parser.cpp"
     break;
 
-  case 268: /* function_expr: operand LIKE operand  */
-#line 2226 "parser.y"
+  case 269: /* function_expr: operand LIKE operand  */
+#line 2238 "parser.y"
                        {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "like";
@@ -5767,11 +5782,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5771 "parser.cpp"
+#line 5786 "parser.cpp"
     break;
 
-  case 269: /* function_expr: operand NOT LIKE operand  */
-#line 2234 "parser.y"
+  case 270: /* function_expr: operand NOT LIKE operand  */
+#line 2246 "parser.y"
                            {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "not_like";
@@ -5780,11 +5795,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5784 "parser.cpp"
+#line 5799 "parser.cpp"
     break;
 
-  case 270: /* conjunction_expr: expr AND expr  */
-#line 2243 "parser.y"
+  case 271: /* conjunction_expr: expr AND expr  */
+#line 2255 "parser.y"
                                 {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "and";
@@ -5793,11 +5808,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5797 "parser.cpp"
+#line 5812 "parser.cpp"
     break;
 
-  case 271: /* conjunction_expr: expr OR expr  */
-#line 2251 "parser.y"
+  case 272: /* conjunction_expr: expr OR expr  */
+#line 2263 "parser.y"
                {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "or";
@@ -5806,11 +5821,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5810 "parser.cpp"
+#line 5825 "parser.cpp"
     break;
 
-  case 272: /* between_expr: operand BETWEEN operand AND operand  */
-#line 2260 "parser.y"
+  case 273: /* between_expr: operand BETWEEN operand AND operand  */
+#line 2272 "parser.y"
                                                   {
     infinity::BetweenExpr* between_expr = new infinity::BetweenExpr();
     between_expr->value_ = (yyvsp[-4].expr_t);
@@ -5818,44 +5833,44 @@ yyreduce:
     between_expr->upper_bound_ = (yyvsp[0].expr_t);
     (yyval.expr_t) = between_expr;
 }
-#line 5822 "parser.cpp"
+#line 5837 "parser.cpp"
     break;
 
-  case 273: /* in_expr: operand IN '(' expr_array ')'  */
-#line 2268 "parser.y"
+  case 274: /* in_expr: operand IN '(' expr_array ')'  */
+#line 2280 "parser.y"
                                        {
     infinity::InExpr* in_expr = new infinity::InExpr(true);
     in_expr->left_ = (yyvsp[-4].expr_t);
     in_expr->arguments_ = (yyvsp[-1].expr_array_t);
     (yyval.expr_t) = in_expr;
 }
-#line 5833 "parser.cpp"
+#line 5848 "parser.cpp"
     break;
 
-  case 274: /* in_expr: operand NOT IN '(' expr_array ')'  */
-#line 2274 "parser.y"
+  case 275: /* in_expr: operand NOT IN '(' expr_array ')'  */
+#line 2286 "parser.y"
                                     {
     infinity::InExpr* in_expr = new infinity::InExpr(false);
     in_expr->left_ = (yyvsp[-5].expr_t);
     in_expr->arguments_ = (yyvsp[-1].expr_array_t);
     (yyval.expr_t) = in_expr;
 }
-#line 5844 "parser.cpp"
+#line 5859 "parser.cpp"
     break;
 
-  case 275: /* case_expr: CASE expr case_check_array END  */
-#line 2281 "parser.y"
+  case 276: /* case_expr: CASE expr case_check_array END  */
+#line 2293 "parser.y"
                                           {
     infinity::CaseExpr* case_expr = new infinity::CaseExpr();
     case_expr->expr_ = (yyvsp[-2].expr_t);
     case_expr->case_check_array_ = (yyvsp[-1].case_check_array_t);
     (yyval.expr_t) = case_expr;
 }
-#line 5855 "parser.cpp"
+#line 5870 "parser.cpp"
     break;
 
-  case 276: /* case_expr: CASE expr case_check_array ELSE expr END  */
-#line 2287 "parser.y"
+  case 277: /* case_expr: CASE expr case_check_array ELSE expr END  */
+#line 2299 "parser.y"
                                            {
     infinity::CaseExpr* case_expr = new infinity::CaseExpr();
     case_expr->expr_ = (yyvsp[-4].expr_t);
@@ -5863,32 +5878,32 @@ yyreduce:
     case_expr->else_expr_ = (yyvsp[-1].expr_t);
     (yyval.expr_t) = case_expr;
 }
-#line 5867 "parser.cpp"
+#line 5882 "parser.cpp"
     break;
 
-  case 277: /* case_expr: CASE case_check_array END  */
-#line 2294 "parser.y"
+  case 278: /* case_expr: CASE case_check_array END  */
+#line 2306 "parser.y"
                             {
     infinity::CaseExpr* case_expr = new infinity::CaseExpr();
     case_expr->case_check_array_ = (yyvsp[-1].case_check_array_t);
     (yyval.expr_t) = case_expr;
 }
-#line 5877 "parser.cpp"
+#line 5892 "parser.cpp"
     break;
 
-  case 278: /* case_expr: CASE case_check_array ELSE expr END  */
-#line 2299 "parser.y"
+  case 279: /* case_expr: CASE case_check_array ELSE expr END  */
+#line 2311 "parser.y"
                                       {
     infinity::CaseExpr* case_expr = new infinity::CaseExpr();
     case_expr->case_check_array_ = (yyvsp[-3].case_check_array_t);
     case_expr->else_expr_ = (yyvsp[-1].expr_t);
     (yyval.expr_t) = case_expr;
 }
-#line 5888 "parser.cpp"
+#line 5903 "parser.cpp"
     break;
 
-  case 279: /* case_check_array: WHEN expr THEN expr  */
-#line 2306 "parser.y"
+  case 280: /* case_check_array: WHEN expr THEN expr  */
+#line 2318 "parser.y"
                                       {
     (yyval.case_check_array_t) = new std::vector<infinity::WhenThen*>();
     infinity::WhenThen* when_then_ptr = new infinity::WhenThen();
@@ -5896,11 +5911,11 @@ yyreduce:
     when_then_ptr->then_ = (yyvsp[0].expr_t);
     (yyval.case_check_array_t)->emplace_back(when_then_ptr);
 }
-#line 5900 "parser.cpp"
+#line 5915 "parser.cpp"
     break;
 
-  case 280: /* case_check_array: case_check_array WHEN expr THEN expr  */
-#line 2313 "parser.y"
+  case 281: /* case_check_array: case_check_array WHEN expr THEN expr  */
+#line 2325 "parser.y"
                                        {
     infinity::WhenThen* when_then_ptr = new infinity::WhenThen();
     when_then_ptr->when_ = (yyvsp[-2].expr_t);
@@ -5908,11 +5923,11 @@ yyreduce:
     (yyvsp[-4].case_check_array_t)->emplace_back(when_then_ptr);
     (yyval.case_check_array_t) = (yyvsp[-4].case_check_array_t);
 }
-#line 5912 "parser.cpp"
+#line 5927 "parser.cpp"
     break;
 
-  case 281: /* cast_expr: CAST '(' expr AS column_type ')'  */
-#line 2321 "parser.y"
+  case 282: /* cast_expr: CAST '(' expr AS column_type ')'  */
+#line 2333 "parser.y"
                                             {
     std::shared_ptr<infinity::TypeInfo> type_info_ptr{nullptr};
     switch((yyvsp[-1].column_type_t).logical_type_) {
@@ -5936,33 +5951,33 @@ yyreduce:
     cast_expr->expr_ = (yyvsp[-3].expr_t);
     (yyval.expr_t) = cast_expr;
 }
-#line 5940 "parser.cpp"
+#line 5955 "parser.cpp"
     break;
 
-  case 282: /* subquery_expr: EXISTS '(' select_without_paren ')'  */
-#line 2345 "parser.y"
+  case 283: /* subquery_expr: EXISTS '(' select_without_paren ')'  */
+#line 2357 "parser.y"
                                                    {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kExists;
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 5951 "parser.cpp"
+#line 5966 "parser.cpp"
     break;
 
-  case 283: /* subquery_expr: NOT EXISTS '(' select_without_paren ')'  */
-#line 2351 "parser.y"
+  case 284: /* subquery_expr: NOT EXISTS '(' select_without_paren ')'  */
+#line 2363 "parser.y"
                                           {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kNotExists;
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 5962 "parser.cpp"
+#line 5977 "parser.cpp"
     break;
 
-  case 284: /* subquery_expr: operand IN '(' select_without_paren ')'  */
-#line 2357 "parser.y"
+  case 285: /* subquery_expr: operand IN '(' select_without_paren ')'  */
+#line 2369 "parser.y"
                                           {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kIn;
@@ -5970,11 +5985,11 @@ yyreduce:
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 5974 "parser.cpp"
+#line 5989 "parser.cpp"
     break;
 
-  case 285: /* subquery_expr: operand NOT IN '(' select_without_paren ')'  */
-#line 2364 "parser.y"
+  case 286: /* subquery_expr: operand NOT IN '(' select_without_paren ')'  */
+#line 2376 "parser.y"
                                               {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kNotIn;
@@ -5982,11 +5997,11 @@ yyreduce:
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 5986 "parser.cpp"
+#line 6001 "parser.cpp"
     break;
 
-  case 286: /* column_expr: IDENTIFIER  */
-#line 2372 "parser.y"
+  case 287: /* column_expr: IDENTIFIER  */
+#line 2384 "parser.y"
                          {
     infinity::ColumnExpr* column_expr = new infinity::ColumnExpr();
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -5994,11 +6009,11 @@ yyreduce:
     free((yyvsp[0].str_value));
     (yyval.expr_t) = column_expr;
 }
-#line 5998 "parser.cpp"
+#line 6013 "parser.cpp"
     break;
 
-  case 287: /* column_expr: column_expr '.' IDENTIFIER  */
-#line 2379 "parser.y"
+  case 288: /* column_expr: column_expr '.' IDENTIFIER  */
+#line 2391 "parser.y"
                              {
     infinity::ColumnExpr* column_expr = (infinity::ColumnExpr*)(yyvsp[-2].expr_t);
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -6006,21 +6021,21 @@ yyreduce:
     free((yyvsp[0].str_value));
     (yyval.expr_t) = column_expr;
 }
-#line 6010 "parser.cpp"
+#line 6025 "parser.cpp"
     break;
 
-  case 288: /* column_expr: '*'  */
-#line 2386 "parser.y"
+  case 289: /* column_expr: '*'  */
+#line 2398 "parser.y"
       {
     infinity::ColumnExpr* column_expr = new infinity::ColumnExpr();
     column_expr->star_ = true;
     (yyval.expr_t) = column_expr;
 }
-#line 6020 "parser.cpp"
+#line 6035 "parser.cpp"
     break;
 
-  case 289: /* column_expr: column_expr '.' '*'  */
-#line 2391 "parser.y"
+  case 290: /* column_expr: column_expr '.' '*'  */
+#line 2403 "parser.y"
                       {
     infinity::ColumnExpr* column_expr = (infinity::ColumnExpr*)(yyvsp[-2].expr_t);
     if(column_expr->star_) {
@@ -6030,353 +6045,353 @@ yyreduce:
     column_expr->star_ = true;
     (yyval.expr_t) = column_expr;
 }
-#line 6034 "parser.cpp"
+#line 6049 "parser.cpp"
     break;
 
-  case 290: /* constant_expr: STRING  */
-#line 2401 "parser.y"
+  case 291: /* constant_expr: STRING  */
+#line 2413 "parser.y"
                       {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kString);
     const_expr->str_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6044 "parser.cpp"
+#line 6059 "parser.cpp"
     break;
 
-  case 291: /* constant_expr: TRUE  */
-#line 2406 "parser.y"
+  case 292: /* constant_expr: TRUE  */
+#line 2418 "parser.y"
        {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kBoolean);
     const_expr->bool_value_ = true;
     (yyval.const_expr_t) = const_expr;
 }
-#line 6054 "parser.cpp"
+#line 6069 "parser.cpp"
     break;
 
-  case 292: /* constant_expr: FALSE  */
-#line 2411 "parser.y"
+  case 293: /* constant_expr: FALSE  */
+#line 2423 "parser.y"
         {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kBoolean);
     const_expr->bool_value_ = false;
     (yyval.const_expr_t) = const_expr;
 }
-#line 6064 "parser.cpp"
+#line 6079 "parser.cpp"
     break;
 
-  case 293: /* constant_expr: DOUBLE_VALUE  */
-#line 2416 "parser.y"
+  case 294: /* constant_expr: DOUBLE_VALUE  */
+#line 2428 "parser.y"
                {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDouble);
     const_expr->double_value_ = (yyvsp[0].double_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6074 "parser.cpp"
+#line 6089 "parser.cpp"
     break;
 
-  case 294: /* constant_expr: LONG_VALUE  */
-#line 2421 "parser.y"
+  case 295: /* constant_expr: LONG_VALUE  */
+#line 2433 "parser.y"
              {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInteger);
     const_expr->integer_value_ = (yyvsp[0].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6084 "parser.cpp"
+#line 6099 "parser.cpp"
     break;
 
-  case 295: /* constant_expr: DATE STRING  */
-#line 2426 "parser.y"
+  case 296: /* constant_expr: DATE STRING  */
+#line 2438 "parser.y"
               {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDate);
     const_expr->date_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6094 "parser.cpp"
+#line 6109 "parser.cpp"
     break;
 
-  case 296: /* constant_expr: TIME STRING  */
-#line 2431 "parser.y"
+  case 297: /* constant_expr: TIME STRING  */
+#line 2443 "parser.y"
               {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kTime);
     const_expr->date_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6104 "parser.cpp"
+#line 6119 "parser.cpp"
     break;
 
-  case 297: /* constant_expr: DATETIME STRING  */
-#line 2436 "parser.y"
+  case 298: /* constant_expr: DATETIME STRING  */
+#line 2448 "parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDateTime);
     const_expr->date_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6114 "parser.cpp"
+#line 6129 "parser.cpp"
     break;
 
-  case 298: /* constant_expr: TIMESTAMP STRING  */
-#line 2441 "parser.y"
+  case 299: /* constant_expr: TIMESTAMP STRING  */
+#line 2453 "parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kTimestamp);
     const_expr->date_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6124 "parser.cpp"
+#line 6139 "parser.cpp"
     break;
 
-  case 299: /* constant_expr: INTERVAL interval_expr  */
-#line 2446 "parser.y"
+  case 300: /* constant_expr: INTERVAL interval_expr  */
+#line 2458 "parser.y"
                          {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6132 "parser.cpp"
+#line 6147 "parser.cpp"
     break;
 
-  case 300: /* constant_expr: interval_expr  */
-#line 2449 "parser.y"
+  case 301: /* constant_expr: interval_expr  */
+#line 2461 "parser.y"
                 {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6140 "parser.cpp"
+#line 6155 "parser.cpp"
     break;
 
-  case 301: /* constant_expr: long_array_expr  */
-#line 2452 "parser.y"
+  case 302: /* constant_expr: long_array_expr  */
+#line 2464 "parser.y"
                   {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6148 "parser.cpp"
+#line 6163 "parser.cpp"
     break;
 
-  case 302: /* constant_expr: double_array_expr  */
-#line 2455 "parser.y"
+  case 303: /* constant_expr: double_array_expr  */
+#line 2467 "parser.y"
                     {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6156 "parser.cpp"
+#line 6171 "parser.cpp"
     break;
 
-  case 303: /* array_expr: long_array_expr  */
-#line 2459 "parser.y"
+  case 304: /* array_expr: long_array_expr  */
+#line 2471 "parser.y"
                             {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6164 "parser.cpp"
+#line 6179 "parser.cpp"
     break;
 
-  case 304: /* array_expr: double_array_expr  */
-#line 2462 "parser.y"
+  case 305: /* array_expr: double_array_expr  */
+#line 2474 "parser.y"
                     {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6172 "parser.cpp"
+#line 6187 "parser.cpp"
     break;
 
-  case 305: /* long_array_expr: unclosed_long_array_expr ']'  */
-#line 2466 "parser.y"
+  case 306: /* long_array_expr: unclosed_long_array_expr ']'  */
+#line 2478 "parser.y"
                                               {
     (yyval.const_expr_t) = (yyvsp[-1].const_expr_t);
 }
-#line 6180 "parser.cpp"
+#line 6195 "parser.cpp"
     break;
 
-  case 306: /* unclosed_long_array_expr: '[' LONG_VALUE  */
-#line 2470 "parser.y"
+  case 307: /* unclosed_long_array_expr: '[' LONG_VALUE  */
+#line 2482 "parser.y"
                                          {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kIntegerArray);
     const_expr->long_array_.emplace_back((yyvsp[0].long_value));
     (yyval.const_expr_t) = const_expr;
 }
-#line 6190 "parser.cpp"
+#line 6205 "parser.cpp"
     break;
 
-  case 307: /* unclosed_long_array_expr: unclosed_long_array_expr ',' LONG_VALUE  */
-#line 2475 "parser.y"
+  case 308: /* unclosed_long_array_expr: unclosed_long_array_expr ',' LONG_VALUE  */
+#line 2487 "parser.y"
                                           {
     (yyvsp[-2].const_expr_t)->long_array_.emplace_back((yyvsp[0].long_value));
     (yyval.const_expr_t) = (yyvsp[-2].const_expr_t);
 }
-#line 6199 "parser.cpp"
+#line 6214 "parser.cpp"
     break;
 
-  case 308: /* double_array_expr: unclosed_double_array_expr ']'  */
-#line 2480 "parser.y"
+  case 309: /* double_array_expr: unclosed_double_array_expr ']'  */
+#line 2492 "parser.y"
                                                   {
     (yyval.const_expr_t) = (yyvsp[-1].const_expr_t);
 }
-#line 6207 "parser.cpp"
+#line 6222 "parser.cpp"
     break;
 
-  case 309: /* unclosed_double_array_expr: '[' DOUBLE_VALUE  */
-#line 2484 "parser.y"
+  case 310: /* unclosed_double_array_expr: '[' DOUBLE_VALUE  */
+#line 2496 "parser.y"
                                              {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDoubleArray);
     const_expr->double_array_.emplace_back((yyvsp[0].double_value));
     (yyval.const_expr_t) = const_expr;
 }
-#line 6217 "parser.cpp"
+#line 6232 "parser.cpp"
     break;
 
-  case 310: /* unclosed_double_array_expr: unclosed_double_array_expr ',' DOUBLE_VALUE  */
-#line 2489 "parser.y"
+  case 311: /* unclosed_double_array_expr: unclosed_double_array_expr ',' DOUBLE_VALUE  */
+#line 2501 "parser.y"
                                               {
     (yyvsp[-2].const_expr_t)->double_array_.emplace_back((yyvsp[0].double_value));
     (yyval.const_expr_t) = (yyvsp[-2].const_expr_t);
 }
-#line 6226 "parser.cpp"
+#line 6241 "parser.cpp"
     break;
 
-  case 311: /* interval_expr: LONG_VALUE SECONDS  */
-#line 2494 "parser.y"
+  case 312: /* interval_expr: LONG_VALUE SECONDS  */
+#line 2506 "parser.y"
                                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kSecond;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6237 "parser.cpp"
+#line 6252 "parser.cpp"
     break;
 
-  case 312: /* interval_expr: LONG_VALUE SECOND  */
-#line 2500 "parser.y"
+  case 313: /* interval_expr: LONG_VALUE SECOND  */
+#line 2512 "parser.y"
                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kSecond;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6248 "parser.cpp"
+#line 6263 "parser.cpp"
     break;
 
-  case 313: /* interval_expr: LONG_VALUE MINUTES  */
-#line 2506 "parser.y"
+  case 314: /* interval_expr: LONG_VALUE MINUTES  */
+#line 2518 "parser.y"
                      {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMinute;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6259 "parser.cpp"
+#line 6274 "parser.cpp"
     break;
 
-  case 314: /* interval_expr: LONG_VALUE MINUTE  */
-#line 2512 "parser.y"
+  case 315: /* interval_expr: LONG_VALUE MINUTE  */
+#line 2524 "parser.y"
                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMinute;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6270 "parser.cpp"
+#line 6285 "parser.cpp"
     break;
 
-  case 315: /* interval_expr: LONG_VALUE HOURS  */
-#line 2518 "parser.y"
+  case 316: /* interval_expr: LONG_VALUE HOURS  */
+#line 2530 "parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kHour;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6281 "parser.cpp"
+#line 6296 "parser.cpp"
     break;
 
-  case 316: /* interval_expr: LONG_VALUE HOUR  */
-#line 2524 "parser.y"
+  case 317: /* interval_expr: LONG_VALUE HOUR  */
+#line 2536 "parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kHour;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6292 "parser.cpp"
+#line 6307 "parser.cpp"
     break;
 
-  case 317: /* interval_expr: LONG_VALUE DAYS  */
-#line 2530 "parser.y"
+  case 318: /* interval_expr: LONG_VALUE DAYS  */
+#line 2542 "parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kDay;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6303 "parser.cpp"
+#line 6318 "parser.cpp"
     break;
 
-  case 318: /* interval_expr: LONG_VALUE DAY  */
-#line 2536 "parser.y"
+  case 319: /* interval_expr: LONG_VALUE DAY  */
+#line 2548 "parser.y"
                  {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kDay;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6314 "parser.cpp"
+#line 6329 "parser.cpp"
     break;
 
-  case 319: /* interval_expr: LONG_VALUE MONTHS  */
-#line 2542 "parser.y"
+  case 320: /* interval_expr: LONG_VALUE MONTHS  */
+#line 2554 "parser.y"
                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMonth;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6325 "parser.cpp"
+#line 6340 "parser.cpp"
     break;
 
-  case 320: /* interval_expr: LONG_VALUE MONTH  */
-#line 2548 "parser.y"
+  case 321: /* interval_expr: LONG_VALUE MONTH  */
+#line 2560 "parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMonth;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6336 "parser.cpp"
+#line 6351 "parser.cpp"
     break;
 
-  case 321: /* interval_expr: LONG_VALUE YEARS  */
-#line 2554 "parser.y"
+  case 322: /* interval_expr: LONG_VALUE YEARS  */
+#line 2566 "parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kYear;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6347 "parser.cpp"
+#line 6362 "parser.cpp"
     break;
 
-  case 322: /* interval_expr: LONG_VALUE YEAR  */
-#line 2560 "parser.y"
+  case 323: /* interval_expr: LONG_VALUE YEAR  */
+#line 2572 "parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kYear;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6358 "parser.cpp"
+#line 6373 "parser.cpp"
     break;
 
-  case 323: /* copy_option_list: copy_option  */
-#line 2571 "parser.y"
+  case 324: /* copy_option_list: copy_option  */
+#line 2583 "parser.y"
                                {
     (yyval.copy_option_array) = new std::vector<infinity::CopyOption*>();
     (yyval.copy_option_array)->push_back((yyvsp[0].copy_option_t));
 }
-#line 6367 "parser.cpp"
+#line 6382 "parser.cpp"
     break;
 
-  case 324: /* copy_option_list: copy_option_list ',' copy_option  */
-#line 2575 "parser.y"
+  case 325: /* copy_option_list: copy_option_list ',' copy_option  */
+#line 2587 "parser.y"
                                    {
     (yyvsp[-2].copy_option_array)->push_back((yyvsp[0].copy_option_t));
     (yyval.copy_option_array) = (yyvsp[-2].copy_option_array);
 }
-#line 6376 "parser.cpp"
+#line 6391 "parser.cpp"
     break;
 
-  case 325: /* copy_option: FORMAT IDENTIFIER  */
-#line 2580 "parser.y"
+  case 326: /* copy_option: FORMAT IDENTIFIER  */
+#line 2592 "parser.y"
                                 {
     (yyval.copy_option_t) = new infinity::CopyOption();
     (yyval.copy_option_t)->option_type_ = infinity::CopyOptionType::kFormat;
@@ -6392,6 +6407,9 @@ yyreduce:
     } else if (strcasecmp((yyvsp[0].str_value), "fvecs") == 0) {
         (yyval.copy_option_t)->file_type_ = infinity::CopyFileType::kFVECS;
         free((yyvsp[0].str_value));
+    } else if (strcasecmp((yyvsp[0].str_value), "parquet") == 0) {
+        (yyval.copy_option_t)->file_type_ = infinity::CopyFileType::kParquet;
+        free((yyvsp[0].str_value));
     } else {
         free((yyvsp[0].str_value));
         delete (yyval.copy_option_t);
@@ -6399,11 +6417,11 @@ yyreduce:
         YYERROR;
     }
 }
-#line 6403 "parser.cpp"
+#line 6421 "parser.cpp"
     break;
 
-  case 326: /* copy_option: DELIMITER STRING  */
-#line 2602 "parser.y"
+  case 327: /* copy_option: DELIMITER STRING  */
+#line 2617 "parser.y"
                    {
     (yyval.copy_option_t) = new infinity::CopyOption();
     (yyval.copy_option_t)->option_type_ = infinity::CopyOptionType::kDelimiter;
@@ -6414,53 +6432,53 @@ yyreduce:
     }
     free((yyvsp[0].str_value));
 }
-#line 6418 "parser.cpp"
+#line 6436 "parser.cpp"
     break;
 
-  case 327: /* copy_option: HEADER  */
-#line 2612 "parser.y"
+  case 328: /* copy_option: HEADER  */
+#line 2627 "parser.y"
          {
     (yyval.copy_option_t) = new infinity::CopyOption();
     (yyval.copy_option_t)->option_type_ = infinity::CopyOptionType::kHeader;
     (yyval.copy_option_t)->header_ = true;
 }
-#line 6428 "parser.cpp"
+#line 6446 "parser.cpp"
     break;
 
-  case 328: /* file_path: STRING  */
-#line 2618 "parser.y"
+  case 329: /* file_path: STRING  */
+#line 2633 "parser.y"
                    {
     (yyval.str_value) = (yyvsp[0].str_value);
 }
-#line 6436 "parser.cpp"
+#line 6454 "parser.cpp"
     break;
 
-  case 329: /* if_exists: IF EXISTS  */
-#line 2622 "parser.y"
+  case 330: /* if_exists: IF EXISTS  */
+#line 2637 "parser.y"
                      { (yyval.bool_value) = true; }
-#line 6442 "parser.cpp"
+#line 6460 "parser.cpp"
     break;
 
-  case 330: /* if_exists: %empty  */
-#line 2623 "parser.y"
+  case 331: /* if_exists: %empty  */
+#line 2638 "parser.y"
   { (yyval.bool_value) = false; }
-#line 6448 "parser.cpp"
+#line 6466 "parser.cpp"
     break;
 
-  case 331: /* if_not_exists: IF NOT EXISTS  */
-#line 2625 "parser.y"
+  case 332: /* if_not_exists: IF NOT EXISTS  */
+#line 2640 "parser.y"
                               { (yyval.bool_value) = true; }
-#line 6454 "parser.cpp"
+#line 6472 "parser.cpp"
     break;
 
-  case 332: /* if_not_exists: %empty  */
-#line 2626 "parser.y"
+  case 333: /* if_not_exists: %empty  */
+#line 2641 "parser.y"
   { (yyval.bool_value) = false; }
-#line 6460 "parser.cpp"
+#line 6478 "parser.cpp"
     break;
 
-  case 335: /* if_not_exists_info: if_not_exists IDENTIFIER  */
-#line 2641 "parser.y"
+  case 336: /* if_not_exists_info: if_not_exists IDENTIFIER  */
+#line 2656 "parser.y"
                                               {
     (yyval.if_not_exists_info_t) = new infinity::IfNotExistsInfo();
     (yyval.if_not_exists_info_t)->exists_ = true;
@@ -6469,63 +6487,63 @@ yyreduce:
     (yyval.if_not_exists_info_t)->info_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 6473 "parser.cpp"
+#line 6491 "parser.cpp"
     break;
 
-  case 336: /* if_not_exists_info: %empty  */
-#line 2649 "parser.y"
+  case 337: /* if_not_exists_info: %empty  */
+#line 2664 "parser.y"
   {
     (yyval.if_not_exists_info_t) = new infinity::IfNotExistsInfo();
 }
-#line 6481 "parser.cpp"
+#line 6499 "parser.cpp"
     break;
 
-  case 337: /* with_index_param_list: WITH '(' index_param_list ')'  */
-#line 2653 "parser.y"
+  case 338: /* with_index_param_list: WITH '(' index_param_list ')'  */
+#line 2668 "parser.y"
                                                       {
     (yyval.with_index_param_list_t) = std::move((yyvsp[-1].index_param_list_t));
 }
-#line 6489 "parser.cpp"
+#line 6507 "parser.cpp"
     break;
 
-  case 338: /* with_index_param_list: %empty  */
-#line 2656 "parser.y"
+  case 339: /* with_index_param_list: %empty  */
+#line 2671 "parser.y"
   {
     (yyval.with_index_param_list_t) = new std::vector<infinity::InitParameter*>();
 }
-#line 6497 "parser.cpp"
+#line 6515 "parser.cpp"
     break;
 
-  case 339: /* index_param_list: index_param  */
-#line 2660 "parser.y"
+  case 340: /* index_param_list: index_param  */
+#line 2675 "parser.y"
                                {
     (yyval.index_param_list_t) = new std::vector<infinity::InitParameter*>();
     (yyval.index_param_list_t)->push_back((yyvsp[0].index_param_t));
 }
-#line 6506 "parser.cpp"
+#line 6524 "parser.cpp"
     break;
 
-  case 340: /* index_param_list: index_param_list ',' index_param  */
-#line 2664 "parser.y"
+  case 341: /* index_param_list: index_param_list ',' index_param  */
+#line 2679 "parser.y"
                                    {
     (yyvsp[-2].index_param_list_t)->push_back((yyvsp[0].index_param_t));
     (yyval.index_param_list_t) = (yyvsp[-2].index_param_list_t);
 }
-#line 6515 "parser.cpp"
+#line 6533 "parser.cpp"
     break;
 
-  case 341: /* index_param: IDENTIFIER  */
-#line 2669 "parser.y"
+  case 342: /* index_param: IDENTIFIER  */
+#line 2684 "parser.y"
                          {
     (yyval.index_param_t) = new infinity::InitParameter();
     (yyval.index_param_t)->param_name_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 6525 "parser.cpp"
+#line 6543 "parser.cpp"
     break;
 
-  case 342: /* index_param: IDENTIFIER '=' IDENTIFIER  */
-#line 2674 "parser.y"
+  case 343: /* index_param: IDENTIFIER '=' IDENTIFIER  */
+#line 2689 "parser.y"
                             {
     (yyval.index_param_t) = new infinity::InitParameter();
     (yyval.index_param_t)->param_name_ = (yyvsp[-2].str_value);
@@ -6534,11 +6552,11 @@ yyreduce:
     (yyval.index_param_t)->param_value_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 6538 "parser.cpp"
+#line 6556 "parser.cpp"
     break;
 
-  case 343: /* index_param: IDENTIFIER '=' LONG_VALUE  */
-#line 2682 "parser.y"
+  case 344: /* index_param: IDENTIFIER '=' LONG_VALUE  */
+#line 2697 "parser.y"
                             {
     (yyval.index_param_t) = new infinity::InitParameter();
     (yyval.index_param_t)->param_name_ = (yyvsp[-2].str_value);
@@ -6546,11 +6564,11 @@ yyreduce:
 
     (yyval.index_param_t)->param_value_ = std::to_string((yyvsp[0].long_value));
 }
-#line 6550 "parser.cpp"
+#line 6568 "parser.cpp"
     break;
 
-  case 344: /* index_param: IDENTIFIER '=' DOUBLE_VALUE  */
-#line 2689 "parser.y"
+  case 345: /* index_param: IDENTIFIER '=' DOUBLE_VALUE  */
+#line 2704 "parser.y"
                               {
     (yyval.index_param_t) = new infinity::InitParameter();
     (yyval.index_param_t)->param_name_ = (yyvsp[-2].str_value);
@@ -6558,11 +6576,11 @@ yyreduce:
 
     (yyval.index_param_t)->param_value_ = std::to_string((yyvsp[0].double_value));
 }
-#line 6562 "parser.cpp"
+#line 6580 "parser.cpp"
     break;
 
-  case 345: /* index_info_list: '(' identifier_array ')' USING IDENTIFIER with_index_param_list  */
-#line 2700 "parser.y"
+  case 346: /* index_info_list: '(' identifier_array ')' USING IDENTIFIER with_index_param_list  */
+#line 2715 "parser.y"
                                                                                   {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     infinity::IndexType index_type = infinity::IndexType::kInvalid;
@@ -6611,11 +6629,11 @@ yyreduce:
     }
     delete (yyvsp[-4].identifier_array_t);
 }
-#line 6615 "parser.cpp"
+#line 6633 "parser.cpp"
     break;
 
-  case 346: /* index_info_list: index_info_list '(' identifier_array ')' USING IDENTIFIER with_index_param_list  */
-#line 2748 "parser.y"
+  case 347: /* index_info_list: index_info_list '(' identifier_array ')' USING IDENTIFIER with_index_param_list  */
+#line 2763 "parser.y"
                                                                                   {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     infinity::IndexType index_type = infinity::IndexType::kInvalid;
@@ -6625,6 +6643,8 @@ yyreduce:
         index_type = infinity::IndexType::kHnsw;
     } else if (strcmp((yyvsp[-1].str_value), "ivfflat") == 0) {
         index_type = infinity::IndexType::kIVFFlat;
+    } else if (strcmp((yyvsp[-1].str_value), "bsi") == 0) {
+        index_type = infinity::IndexType::kBSI;
     } else {
         free((yyvsp[-1].str_value));
         delete (yyvsp[-4].identifier_array_t);
@@ -6665,11 +6685,11 @@ yyreduce:
     }
     delete (yyvsp[-4].identifier_array_t);
 }
-#line 6669 "parser.cpp"
+#line 6689 "parser.cpp"
     break;
 
-  case 347: /* index_info_list: '(' identifier_array ')'  */
-#line 2797 "parser.y"
+  case 348: /* index_info_list: '(' identifier_array ')'  */
+#line 2814 "parser.y"
                            {
     infinity::IndexType index_type = infinity::IndexType::kSecondary;
     size_t index_count = (yyvsp[-1].identifier_array_t)->size();
@@ -6683,11 +6703,11 @@ yyreduce:
     }
     delete (yyvsp[-1].identifier_array_t);
 }
-#line 6687 "parser.cpp"
+#line 6707 "parser.cpp"
     break;
 
 
-#line 6691 "parser.cpp"
+#line 6711 "parser.cpp"
 
       default: break;
     }
@@ -6916,7 +6936,7 @@ yyreturnlab:
   return yyresult;
 }
 
-#line 2811 "parser.y"
+#line 2828 "parser.y"
 
 
 void
@@ -1526,6 +1526,18 @@ show_statement: SHOW DATABASES {
     $$->var_name_ = std::string($3);
     free($3);
 }
+| SHOW IDENTIFIER {
+    // TASKS isn't a keyword, so that it can still be used as a name
+    ParserHelper::ToLower($2);
+    bool is_tasks = strcmp($2, "tasks") == 0;
+    free($2);
+    if(!is_tasks) {
+        yyerror(&yyloc, scanner, result, "Unknown show statement.");
+        YYERROR;
+    }
+    $$ = new infinity::ShowStatement();
+    $$->show_type_ = infinity::ShowStmtType::kTasks;
+}
 | DESCRIBE table_name {
     $$ = new infinity::ShowStatement();
     $$->show_type_ = infinity::ShowStmtType::kColumns;
@@ -2592,6 +2604,9 @@ copy_option : FORMAT IDENTIFIER {
     } else if (strcasecmp($2, "fvecs") == 0) {
         $$->file_type_ = infinity::CopyFileType::kFVECS;
         free($2);
+    } else if (strcasecmp($2, "parquet") == 0) {
+        $$->file_type_ = infinity::CopyFileType::kParquet;
+        free($2);
     } else {
         free($2);
         delete $$;
@@ -2754,6 +2769,8 @@ index_info_list : '(' identifier_array ')' USING IDENTIFIER with_index_param_lis
         index_type = infinity::IndexType::kHnsw;
     } else if (strcmp($6, "ivfflat") == 0) {
         index_type = infinity::IndexType::kIVFFlat;
+    } else if (strcmp($6, "bsi") == 0) {
+        index_type = infinity::IndexType::kBSI;
     } else {
         free($6);
         delete $3;
@@ -44,6 +44,10 @@ std::string CopyStatement::ToString() const {
             file_format = "JSONL";
             break;
         }
+        case CopyFileType::kParquet: {
+            file_format = "PARQUET";
+            break;
+        }
     }
 
     ss << "COPY: " << schema_name_ << "." << table_name_ << copy_direction << file_path_ << " WITH " << file_format << " delimiter: " << delimiter_;
@@ -26,6 +26,7 @@ enum class IndexType {
     kHnsw,
     kIRSFullText,
     kSecondary,
+    kBSI,
     kInvalid,
 };
 
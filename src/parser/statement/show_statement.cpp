@@ -68,6 +68,10 @@ std::string ShowStatement::ToString() const {
             ss << "Show variable";
             break;
         }
+        case ShowStmtType::kTasks: {
+            ss << "Show tasks";
+            break;
+        }
     }
     return ss.str();
 }
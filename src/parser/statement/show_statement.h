@@ -32,6 +32,7 @@ enum class ShowStmtType {
     kSessionStatus,
     kGlobalStatus,
     kVar,
+    kTasks,
 };
 
 class ShowStatement : public BaseStatement {
@@ -103,6 +103,25 @@ public:
         }
     }
 
+    // bit-sliced index keeps the bits of integer keys, so floating point types are excluded
+    [[nodiscard]] inline bool CanBuildBSIIndex() const {
+        switch (type_) {
+            case kTinyInt:
+            case kSmallInt:
+            case kInteger:
+            case kBigInt:
+            case kDate:
+            case kTime:
+            case kDateTime:
+            case kTimestamp: {
+                return true;
+            }
+            default: {
+                return false;
+            }
+        }
+    }
+
     inline void Reset() {
         type_ = LogicalType::kInvalid;
         type_info_.reset();
@@ -174,7 +174,8 @@ SharedPtr<LogicalNode> BoundSelectStatement::BuildPlan(QueryContext *query_conte
         }
 
         if (search_expr_->fusion_expr_.get() != nullptr) {
-            SharedPtr<LogicalNode> fusionNode = MakeShared<LogicalFusion>(bind_context->GetNewLogicalNodeId(), search_expr_->fusion_expr_);
+            auto fusionNode = MakeShared<LogicalFusion>(bind_context->GetNewLogicalNodeId(), search_expr_->fusion_expr_);
+            fusionNode->base_table_ref_ = static_pointer_cast<BaseTableRef>(table_ref_ptr_);
             fusionNode->set_left_node(match_knn_nodes[0]);
             if (match_knn_nodes.size() > 1)
                 fusionNode->set_right_node(match_knn_nodes[1]);
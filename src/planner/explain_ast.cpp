@@ -520,6 +520,10 @@ void ExplainAST::BuildShow(const ShowStatement *show_statement, SharedPtr<Vector
             result->emplace_back(MakeShared<String>("SHOW VARIABLES"));
             break;
         }
+        case ShowStmtType::kTasks: {
+            result->emplace_back(MakeShared<String>("SHOW TASKS"));
+            break;
+        }
     }
 }
 
@@ -590,6 +594,11 @@ void ExplainAST::BuildCopy(const CopyStatement *copy_statement, SharedPtr<Vector
             result->emplace_back(file_type);
             break;
         }
+        case CopyFileType::kParquet: {
+            SharedPtr<String> file_type = MakeShared<String>(String(intent_size, ' ') + "file type: PARQUET");
+            result->emplace_back(file_type);
+            break;
+        }
     }
 }
 } // namespace infinity
@@ -1440,6 +1440,24 @@ void ExplainLogicalPlan::Explain(const LogicalShow *show_node, SharedPtr<Vector<
             result->emplace_back(MakeShared<String>(output_columns_str));
             break;
         }
+        case ShowType::kShowTasks: {
+            String show_str;
+            if (intent_size != 0) {
+                show_str = String(intent_size - 2, ' ');
+                show_str += "-> SHOW TASKS ";
+            } else {
+                show_str = "SHOW TASKS ";
+            }
+            show_str += "(";
+            show_str += std::to_string(show_node->node_id());
+            show_str += ")";
+            result->emplace_back(MakeShared<String>(show_str));
+
+            String output_columns_str = String(intent_size, ' ');
+            output_columns_str += " - output columns: [task_id, task_class, task, status, elapsed_ms]";
+            result->emplace_back(MakeShared<String>(output_columns_str));
+            break;
+        }
         case ShowType::kInvalid: {
             UnrecoverableError("Invalid show type");
         }
@@ -1655,6 +1673,11 @@ void ExplainLogicalPlan::Explain(const LogicalImport *import_node, SharedPtr<Vec
             result->emplace_back(file_type);
             break;
         }
+        case CopyFileType::kParquet: {
+            SharedPtr<String> file_type = MakeShared<String>(fmt::format("{} - type: PARQUET", String(intent_size, ' ')));
+            result->emplace_back(file_type);
+            break;
+        }
     }
 
     if (import_node->left_node().get() != nullptr or import_node->right_node().get() != nullptr) {
@@ -1722,6 +1745,11 @@ void ExplainLogicalPlan::Explain(const LogicalExport *export_node, SharedPtr<Vec
             result->emplace_back(file_type);
             break;
         }
+        case CopyFileType::kParquet: {
+            SharedPtr<String> file_type = MakeShared<String>(fmt::format("{} - type: PARQUET", String(intent_size, ' ')));
+            result->emplace_back(file_type);
+            break;
+        }
     }
 
     if (export_node->left_node().get() != nullptr or export_node->right_node().get() != nullptr) {
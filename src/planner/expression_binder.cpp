@@ -37,6 +37,7 @@ import cast_expression;
 import case_expression;
 import function_expression;
 import value_expression;
+import expression_type;
 import fusion_expression;
 import search_expression;
 import match_expression;
@@ -387,13 +388,20 @@ SharedPtr<BaseExpression> ExpressionBinder::BuildCaseExpr(const CaseExpr &expr,
             arguments.emplace_back(left_expr_ptr);
             arguments.emplace_back(value_expr);
             ScalarFunction equal_function = scalar_function_set_ptr->GetMostMatchFunction(arguments);
+            for (SizeT idx = 0; idx < arguments.size(); ++idx) {
+                if (arguments[idx]->Type() != equal_function.parameter_types_[idx]) {
+                    arguments[idx] = CastExpression::AddCastToType(arguments[idx], equal_function.parameter_types_[idx]);
+                }
+            }
             SharedPtr<FunctionExpression> when_expr_ptr = MakeShared<FunctionExpression>(equal_function, arguments);
 
             // Construct then expression
             // SharedPtr<BaseExpression> then_expr
             SharedPtr<BaseExpression> then_expr_ptr = BuildExpression(*(when_then_expr->then_), bind_context_ptr, depth, false);
             case_expression_ptr->AddCaseCheck(when_expr_ptr, then_expr_ptr);
-            return_type.MaxDataType(then_expr_ptr->Type());
+            if (then_expr_ptr->Type().type() != LogicalType::kNull) {
+                return_type.MaxDataType(then_expr_ptr->Type());
+            }
         }
     } else {
         // Searched case
@@ -401,22 +409,41 @@ SharedPtr<BaseExpression> ExpressionBinder::BuildCaseExpr(const CaseExpr &expr,
             // Construct when expression: left_expr = value_expr
             // SharedPtr<BaseExpression> when_expr
             auto when_expr_ptr = BuildExpression(*(when_then_expr->when_), bind_context_ptr, depth, false);
+            if (when_expr_ptr->Type().type() != LogicalType::kBoolean) {
+                RecoverableError(Status::DataTypeMismatch("Boolean", when_expr_ptr->Type().ToString()));
+            }
 
             // Construct then expression
             // SharedPtr<BaseExpression> then_expr
             SharedPtr<BaseExpression> then_expr_ptr = BuildExpression(*(when_then_expr->then_), bind_context_ptr, depth, false);
             case_expression_ptr->AddCaseCheck(when_expr_ptr, then_expr_ptr);
-            return_type.MaxDataType(then_expr_ptr->Type());
+            if (then_expr_ptr->Type().type() != LogicalType::kNull) {
+                return_type.MaxDataType(then_expr_ptr->Type());
+            }
         }
     }
     // Construct else expression
     SharedPtr<BaseExpression> else_expr_ptr;
     if (expr.else_expr_ != nullptr) {
         else_expr_ptr = BuildExpression(*expr.else_expr_, bind_context_ptr, depth, false);
-        return_type.MaxDataType(else_expr_ptr->Type());
+        if (else_expr_ptr->Type().type() != LogicalType::kNull) {
+            return_type.MaxDataType(else_expr_ptr->Type());
+        }
     } else {
         else_expr_ptr = MakeShared<ValueExpression>(Value::MakeNull());
     }
+    if (return_type.type() == LogicalType::kInvalid) {
+        RecoverableError(Status::SyntaxError("All results of CASE expression are NULL."));
+    }
+    // All branches produce the return type, so the evaluator only moves values. NULL branches are left to it.
+    for (auto &case_check : case_expression_ptr->CaseExpr()) {
+        if (case_check.then_expr_->Type().type() != LogicalType::kNull and case_check.then_expr_->Type() != return_type) {
+            case_check.then_expr_ = CastExpression::AddCastToType(case_check.then_expr_, return_type);
+        }
+    }
+    if (else_expr_ptr->Type().type() != LogicalType::kNull and else_expr_ptr->Type() != return_type) {
+        else_expr_ptr = CastExpression::AddCastToType(else_expr_ptr, return_type);
+    }
     case_expression_ptr->AddElseExpr(else_expr_ptr);
 
     case_expression_ptr->SetReturnType(return_type);
@@ -430,10 +457,60 @@ SharedPtr<BaseExpression> ExpressionBinder::BuildInExpr(const InExpr &expr, Bind
     Vector<SharedPtr<BaseExpression>> arguments;
     arguments.reserve(argument_count);
 
+    // The list is compared in the common type of all operands. Integer literals are narrowed to an integer left operand instead,
+    // so that an integer column isn't cast row by row. A literal out of its range equals no row and is dropped.
+    const DataType left_type = bound_left_expr->Type();
+    DataType compare_type = left_type;
     for (SizeT idx = 0; idx < argument_count; ++idx) {
         auto bound_argument_expr = BuildExpression(*expr.arguments_->at(idx), bind_context_ptr, depth, false);
+        if (bound_argument_expr->type() == ExpressionType::kValue and bound_argument_expr->Type().type() == LogicalType::kBigInt) {
+            const BigIntT literal = std::static_pointer_cast<ValueExpression>(bound_argument_expr)->GetValue().value_.big_int;
+            Optional<Value> narrowed_value;
+            switch (left_type.type()) {
+                case LogicalType::kTinyInt: {
+                    if (literal >= std::numeric_limits<TinyIntT>::min() and literal <= std::numeric_limits<TinyIntT>::max()) {
+                        narrowed_value = Value::MakeTinyInt(static_cast<TinyIntT>(literal));
+                    }
+                    break;
+                }
+                case LogicalType::kSmallInt: {
+                    if (literal >= std::numeric_limits<SmallIntT>::min() and literal <= std::numeric_limits<SmallIntT>::max()) {
+                        narrowed_value = Value::MakeSmallInt(static_cast<SmallIntT>(literal));
+                    }
+                    break;
+                }
+                case LogicalType::kInteger: {
+                    if (literal >= std::numeric_limits<IntegerT>::min() and literal <= std::numeric_limits<IntegerT>::max()) {
+                        narrowed_value = Value::MakeInt(static_cast<IntegerT>(literal));
+                    }
+                    break;
+                }
+                case LogicalType::kBigInt: {
+                    narrowed_value = Value::MakeBigInt(literal);
+                    break;
+                }
+                default: {
+                    compare_type.MaxDataType(bound_argument_expr->Type());
+                    arguments.emplace_back(bound_argument_expr);
+                    continue;
+                }
+            }
+            if (narrowed_value.has_value()) {
+                arguments.emplace_back(MakeShared<ValueExpression>(std::move(*narrowed_value)));
+            }
+            continue;
+        }
+        compare_type.MaxDataType(bound_argument_expr->Type());
         arguments.emplace_back(bound_argument_expr);
     }
+    if (bound_left_expr->Type() != compare_type) {
+        bound_left_expr = CastExpression::AddCastToType(bound_left_expr, compare_type);
+    }
+    for (auto &argument : arguments) {
+        if (argument->Type() != compare_type) {
+            argument = CastExpression::AddCastToType(argument, compare_type);
+        }
+    }
 
     InType in_type{InType::kIn};
     if (expr.not_in_) {
@@ -69,6 +69,7 @@ import index_base;
 import index_ivfflat;
 import index_hnsw;
 import index_secondary;
+import index_bsi;
 import index_full_text;
 import base_table_ref;
 import table_ref;
@@ -589,6 +590,11 @@ Status LogicalPlanner::BuildCreateIndex(const CreateStatement *statement, Shared
                 base_index_ptr = IndexSecondary::Make(fmt::format("{}_{}", create_index_info->table_name_, *index_name), {index_info->column_name_});
                 break;
             }
+            case IndexType::kBSI: {
+                IndexBSI::ValidateColumnDataType(base_table_ref, index_info->column_name_); // may throw exception
+                base_index_ptr = IndexBSI::Make(fmt::format("{}_{}", create_index_info->table_name_, *index_name), {index_info->column_name_});
+                break;
+            }
             case IndexType::kInvalid: {
                 UnrecoverableError("Invalid index type.");
                 break;
@@ -763,12 +769,12 @@ Status LogicalPlanner::BuildExport(const CopyStatement *statement, SharedPtr<Bin
         RecoverableError(status);
     }
 
-    // Check the file existence
+    // The export file is created or truncated, only its directory has to exist
     LocalFileSystem fs;
 
-    String to_write_path;
-    if (!fs.Exists(statement->file_path_)) {
-        RecoverableError(Status::FileNotFound(statement->file_path_));
+    String parent_dir = Path(statement->file_path_).parent_path().string();
+    if (!parent_dir.empty() and !fs.Exists(parent_dir)) {
+        RecoverableError(Status::DirNotFound(parent_dir));
     }
 
     SharedPtr<LogicalNode> logical_export = MakeShared<LogicalExport>(bind_context_ptr->GetNewLogicalNodeId(),
@@ -914,6 +920,9 @@ Status LogicalPlanner::BuildShow(const ShowStatement *statement, SharedPtr<BindC
         case ShowStmtType::kVar: {
             return BuildShowVar(statement, bind_context_ptr);
         }
+        case ShowStmtType::kTasks: {
+            return BuildShowTasks(statement, bind_context_ptr);
+        }
         default: {
             UnrecoverableError("Unexpected show statement type.");
         }
@@ -1050,6 +1059,19 @@ Status LogicalPlanner::BuildShowVar(const ShowStatement *statement, SharedPtr<Bi
     return Status::OK();
 }
 
+Status LogicalPlanner::BuildShowTasks(const ShowStatement *statement, SharedPtr<BindContext> &bind_context_ptr) {
+    SharedPtr<LogicalNode> logical_show = MakeShared<LogicalShow>(bind_context_ptr->GetNewLogicalNodeId(),
+                                                                  ShowType::kShowTasks,
+                                                                  query_context_ptr_->schema_name(),
+                                                                  statement->table_name_,
+                                                                  bind_context_ptr->GenerateTableIndex(),
+                                                                  statement->segment_id_,
+                                                                  statement->block_id_);
+
+    this->logical_plan_ = logical_show;
+    return Status::OK();
+}
+
 Status LogicalPlanner::BuildFlush(const FlushStatement *statement, SharedPtr<BindContext> &bind_context_ptr) {
     switch (statement->type()) {
         case FlushType::kData: {
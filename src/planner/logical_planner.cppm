@@ -133,6 +133,8 @@ public:
 
     Status BuildShowGlobalStatus(const ShowStatement *statement, SharedPtr<BindContext> &bind_context_ptr);
 
+    Status BuildShowTasks(const ShowStatement *statement, SharedPtr<BindContext> &bind_context_ptr);
+
     Status BuildShowVar(const ShowStatement *statement, SharedPtr<BindContext> &bind_context_ptr);
 
     // Flush
@@ -59,6 +59,10 @@ String LogicalExport::ToString(i64 &space) const {
             ss << "(JSONL) ";
             break;
         }
+        case CopyFileType::kParquet: {
+            ss << "(PARQUET) ";
+            break;
+        }
     }
     ss << "to " << schema_name_ << '.' << table_name_;
 
@@ -33,6 +33,16 @@ LogicalFusion::LogicalFusion(u64 node_id,
                              SharedPtr<FusionExpression> fusion_expr)
     : LogicalNode(node_id, LogicalNodeType::kFusion), fusion_expr_(fusion_expr) {}
 
+Vector<ColumnBinding> LogicalFusion::GetColumnBindings() const {
+    Vector<ColumnBinding> result;
+    auto &column_ids = base_table_ref_->column_ids_;
+    result.reserve(column_ids.size());
+    for (SizeT col_id : column_ids) {
+        result.emplace_back(base_table_ref_->table_index_, col_id);
+    }
+    return result;
+}
+
 String LogicalFusion::ToString(i64 &space) const {
     std::stringstream ss;
     String arrow_str;
@@ -35,7 +35,8 @@ public:
     explicit LogicalFusion(u64 node_id,
                            SharedPtr<FusionExpression> fusion_expr);
 
-    Vector<ColumnBinding> GetColumnBindings() const final { return left_node_->GetColumnBindings(); };
+    // The columns of the table the inputs output, not the bindings of their scores.
+    Vector<ColumnBinding> GetColumnBindings() const final;
 
     SharedPtr<Vector<String>> GetOutputNames() const final { return left_node_->GetOutputNames(); };
 
@@ -46,6 +47,9 @@ public:
     inline String name() final { return "LogicalFusion"; }
 
     SharedPtr<FusionExpression> fusion_expr_{};
+
+    // The table all the inputs search. Its rows are output by row id and score, the operators above fusion load the other columns.
+    SharedPtr<BaseTableRef> base_table_ref_{};
 };
 
 } // namespace infinity
@@ -50,6 +50,8 @@ String ToString(ShowType type) {
             return "Show global status";
         case ShowType::kShowVar:
             return "Show variables";
+        case ShowType::kShowTasks:
+            return "Show tasks";
         case ShowType::kInvalid: {
             UnrecoverableError("Invalid chunk scan type");
         }
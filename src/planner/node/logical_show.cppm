@@ -38,6 +38,7 @@ export enum class ShowType {
     kShowSessionStatus,
     kShowGlobalStatus,
     kShowVar,
+    kShowTasks,
 };
 
 export String ToString(ShowType type);
@@ -23,6 +23,7 @@ import base_table_ref;
 import table_entry;
 import internal_types;
 import data_type;
+import secondary_index_scan_middle_expression;
 
 export module logical_table_scan;
 
@@ -51,6 +52,9 @@ public:
     SharedPtr<BaseTableRef> base_table_ref_{};
 
     bool add_row_id_;
+
+    // Filter on the scanned table in the form of BuildSecondaryIndexScanMiddleCommand, used to skip blocks by zone map
+    Vector<FilterEvaluatorElem> zone_map_filter_{};
 };
 
 } // namespace infinity
@@ -21,6 +21,9 @@ import column_remapper;
 import column_pruner;
 import lazy_load;
 import secondary_index_scan_builder;
+import zone_map_filter_builder;
+import predicate_push_down;
+import expression_rewriter;
 import explain_logical_plan;
 import optimizer_rule;
 import bound_delete_statement;
@@ -33,8 +36,10 @@ module optimizer;
 namespace infinity {
 
 Optimizer::Optimizer(QueryContext *query_context_ptr) : query_context_ptr_(query_context_ptr) {
-    // TODO: need an equivalent expression optimizer
+    AddRule(MakeUnique<PredicatePushDown>());
+    AddRule(MakeUnique<ExpressionRewriter>()); // before SecondaryIndexScanBuilder, so the index scan sees the simplified conditions
     AddRule(MakeUnique<SecondaryIndexScanBuilder>()); // put it before ColumnPruner, because some columns for index scan does not need to be loaded
+    AddRule(MakeUnique<ZoneMapFilterBuilder>()); // before ColumnRemapper, which rewrites the column ids of the filter
     AddRule(MakeUnique<ColumnPruner>());
     AddRule(MakeUnique<LazyLoad>());
     AddRule(MakeUnique<ColumnRemapper>());
@@ -0,0 +1,331 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+#include <algorithm>
+
+module expression_rewriter;
+
+import stl;
+import logical_node;
+import logical_node_type;
+import logical_node_visitor;
+import logical_filter;
+import logical_knn_scan;
+import query_context;
+import base_expression;
+import expression_type;
+import column_expression;
+import function_expression;
+import cast_expression;
+import case_expression;
+import in_expression;
+import value_expression;
+import expression_state;
+import expression_evaluator;
+import column_vector;
+import value;
+import data_type;
+import logical_type;
+import internal_types;
+import infinity_exception;
+import logger;
+import third_party;
+
+namespace infinity {
+
+namespace {
+
+bool IsBooleanValue(const SharedPtr<BaseExpression> &expression, bool &value) {
+    if (expression->type() != ExpressionType::kValue or expression->Type().type() != LogicalType::kBoolean) {
+        return false;
+    }
+    value = static_cast<ValueExpression &>(*expression).GetValue().GetValue<BooleanT>();
+    return true;
+}
+
+bool IsFunction(const SharedPtr<BaseExpression> &expression, const char *function_name) {
+    return expression->type() == ExpressionType::kFunction and static_cast<FunctionExpression &>(*expression).ScalarFunctionName() == function_name;
+}
+
+// the value types which ValueExpression can hold
+bool IsFoldableType(const DataType &data_type) {
+    switch (data_type.type()) {
+        case LogicalType::kBoolean:
+        case LogicalType::kTinyInt:
+        case LogicalType::kSmallInt:
+        case LogicalType::kInteger:
+        case LogicalType::kBigInt:
+        case LogicalType::kFloat:
+        case LogicalType::kDouble:
+        case LogicalType::kVarchar:
+        case LogicalType::kDate:
+        case LogicalType::kTime:
+        case LogicalType::kDateTime:
+        case LogicalType::kTimestamp:
+        case LogicalType::kInterval: {
+            return true;
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+void FlattenConjuncts(const SharedPtr<BaseExpression> &expression, Vector<SharedPtr<BaseExpression>> &conjuncts) {
+    if (IsFunction(expression, "AND")) {
+        for (const auto &argument : expression->arguments()) {
+            FlattenConjuncts(argument, conjuncts);
+        }
+        return;
+    }
+    conjuncts.emplace_back(expression);
+}
+
+f64 EstimateCost(const SharedPtr<BaseExpression> &expression) {
+    f64 cost = 0;
+    for (const auto &argument : expression->arguments()) {
+        cost += EstimateCost(argument);
+    }
+    switch (expression->type()) {
+        case ExpressionType::kColumn:
+        case ExpressionType::kReference:
+        case ExpressionType::kValue: {
+            return cost;
+        }
+        case ExpressionType::kIn: {
+            // the value list is probed as a set
+            return cost + EstimateCost(static_cast<InExpression &>(*expression).left_operand()) + 2;
+        }
+        case ExpressionType::kCase: {
+            auto &case_expression = static_cast<CaseExpression &>(*expression);
+            for (const auto &case_check : case_expression.CaseExpr()) {
+                cost += EstimateCost(case_check.when_expr_) + EstimateCost(case_check.then_expr_) + 1;
+            }
+            if (case_expression.ElseExpr().get() != nullptr) {
+                cost += EstimateCost(case_expression.ElseExpr());
+            }
+            return cost;
+        }
+        case ExpressionType::kFunction: {
+            const String &function_name = static_cast<FunctionExpression &>(*expression).ScalarFunctionName();
+            if (function_name == "like" or function_name == "not_like" or function_name == "ilike" or function_name == "not_ilike") {
+                return cost + 16;
+            }
+            for (const auto &argument : expression->arguments()) {
+                if (argument->Type().type() == LogicalType::kVarchar) {
+                    return cost + 4;
+                }
+            }
+            return cost + 1;
+        }
+        default: {
+            return cost + 1;
+        }
+    }
+}
+
+// fraction of the rows for which the condition is true, without statistics
+f64 EstimateSelectivity(const SharedPtr<BaseExpression> &expression) {
+    switch (expression->type()) {
+        case ExpressionType::kIn: {
+            auto &in_expression = static_cast<InExpression &>(*expression);
+            const f64 selectivity = std::min(0.1 * in_expression.arguments().size(), 0.5);
+            return in_expression.in_type() == InType::kIn ? selectivity : 1 - selectivity;
+        }
+        case ExpressionType::kFunction: {
+            const String &function_name = static_cast<FunctionExpression &>(*expression).ScalarFunctionName();
+            const auto &arguments = expression->arguments();
+            if (function_name == "AND") {
+                return EstimateSelectivity(arguments[0]) * EstimateSelectivity(arguments[1]);
+            }
+            if (function_name == "OR") {
+                const f64 left = EstimateSelectivity(arguments[0]);
+                const f64 right = EstimateSelectivity(arguments[1]);
+                return left + right - left * right;
+            }
+            if (function_name == "NOT") {
+                return 1 - EstimateSelectivity(arguments[0]);
+            }
+            if (function_name == "=") {
+                return 0.1;
+            }
+            if (function_name == "<>") {
+                return 0.9;
+            }
+            if (function_name == "<" or function_name == "<=" or function_name == ">" or function_name == ">=") {
+                return 0.33;
+            }
+            if (function_name == "like" or function_name == "ilike") {
+                return 0.25;
+            }
+            if (function_name == "not_like" or function_name == "not_ilike") {
+                return 0.75;
+            }
+            return 0.5;
+        }
+        default: {
+            return 0.5;
+        }
+    }
+}
+
+// Conjuncts with a lower cost per filtered row come first.
+SharedPtr<BaseExpression> ReorderConjuncts(const SharedPtr<BaseExpression> &expression) {
+    if (!IsFunction(expression, "AND")) {
+        return expression;
+    }
+    Vector<SharedPtr<BaseExpression>> conjuncts;
+    FlattenConjuncts(expression, conjuncts);
+    Vector<Pair<f64, SharedPtr<BaseExpression>>> ranked_conjuncts;
+    ranked_conjuncts.reserve(conjuncts.size());
+    for (auto &conjunct : conjuncts) {
+        const f64 filtered_fraction = std::max(1 - EstimateSelectivity(conjunct), 0.01);
+        ranked_conjuncts.emplace_back((EstimateCost(conjunct) + 1) / filtered_fraction, std::move(conjunct));
+    }
+    std::stable_sort(ranked_conjuncts.begin(), ranked_conjuncts.end(), [](const auto &left, const auto &right) { return left.first < right.first; });
+
+    const ScalarFunction &and_function = static_cast<FunctionExpression &>(*expression).func_;
+    SharedPtr<BaseExpression> result = ranked_conjuncts[0].second;
+    for (SizeT idx = 1; idx < ranked_conjuncts.size(); ++idx) {
+        Vector<SharedPtr<BaseExpression>> arguments{result, ranked_conjuncts[idx].second};
+        result = MakeShared<FunctionExpression>(and_function, std::move(arguments));
+    }
+    return result;
+}
+
+// Remove the filters with a TRUE condition and reorder the conjuncts of the others
+void RewriteFilters(SharedPtr<LogicalNode> &node) {
+    if (node.get() == nullptr) {
+        return;
+    }
+    RewriteFilters(node->left_node());
+    RewriteFilters(node->right_node());
+    switch (node->operator_type()) {
+        case LogicalNodeType::kFilter: {
+            auto &filter = static_cast<LogicalFilter &>(*node);
+            bool value = false;
+            if (IsBooleanValue(filter.expression(), value) and value) {
+                LOG_TRACE(fmt::format("ExpressionRewriter: remove filter {} whose condition is always true.", node->node_id()));
+                node = node->left_node();
+                return;
+            }
+            filter.expression() = ReorderConjuncts(filter.expression());
+            break;
+        }
+        case LogicalNodeType::kKnnScan: {
+            auto &knn_scan = static_cast<LogicalKnnScan &>(*node);
+            if (knn_scan.filter_expression_.get() == nullptr) {
+                break;
+            }
+            bool value = false;
+            if (IsBooleanValue(knn_scan.filter_expression_, value) and value) {
+                knn_scan.filter_expression_.reset();
+                break;
+            }
+            knn_scan.filter_expression_ = ReorderConjuncts(knn_scan.filter_expression_);
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+}
+
+} // namespace
+
+SharedPtr<BaseExpression> ConstantFoldingRule::Rewrite(const SharedPtr<BaseExpression> &expression) {
+    if (expression->type() != ExpressionType::kFunction and expression->type() != ExpressionType::kCast) {
+        return nullptr;
+    }
+    if (expression->arguments().empty()) {
+        return nullptr;
+    }
+    for (const auto &argument : expression->arguments()) {
+        if (argument->type() != ExpressionType::kValue) {
+            return nullptr;
+        }
+    }
+    const DataType result_type = expression->Type();
+    if (!IsFoldableType(result_type)) {
+        return nullptr;
+    }
+    auto result_column = MakeShared<ColumnVector>(MakeShared<DataType>(result_type));
+    result_column->Initialize(result_type.type() == LogicalType::kBoolean ? ColumnVectorType::kCompactBit : ColumnVectorType::kFlat);
+    try {
+        SharedPtr<BaseExpression> evaluated_expression = expression;
+        SharedPtr<ExpressionState> state = ExpressionState::CreateState(evaluated_expression);
+        ExpressionEvaluator evaluator;
+        evaluator.Init(nullptr);
+        evaluator.Execute(evaluated_expression, state, result_column);
+    } catch (RecoverableException &e) {
+        LOG_TRACE(fmt::format("ConstantFoldingRule: keep {}, {}", expression->Name(), e.what()));
+        return nullptr;
+    }
+    if (result_column->Size() == 0 or !result_column->nulls_ptr_->IsTrue(0)) {
+        return nullptr;
+    }
+    return MakeShared<ValueExpression>(result_column->GetValue(0));
+}
+
+SharedPtr<BaseExpression> BooleanSimplificationRule::Rewrite(const SharedPtr<BaseExpression> &expression) {
+    const bool is_and = IsFunction(expression, "AND");
+    if (!is_and and !IsFunction(expression, "OR")) {
+        return nullptr;
+    }
+    const auto &arguments = expression->arguments();
+    for (SizeT idx = 0; idx < 2; ++idx) {
+        bool value = false;
+        if (!IsBooleanValue(arguments[idx], value)) {
+            continue;
+        }
+        // TRUE is the identity of AND, FALSE of OR, the other one absorbs
+        return value == is_and ? arguments[1 - idx] : arguments[idx];
+    }
+    return nullptr;
+}
+
+void ExpressionRuleApplier::VisitNode(LogicalNode &op) {
+    VisitNodeExpression(op);
+    VisitNodeChildren(op);
+}
+
+SharedPtr<BaseExpression> ExpressionRuleApplier::Apply(const SharedPtr<BaseExpression> &expression) {
+    SharedPtr<BaseExpression> result = expression;
+    for (const auto &rule : rules_) {
+        SharedPtr<BaseExpression> rewritten = rule->Rewrite(result);
+        if (rewritten.get() != nullptr) {
+            LOG_TRACE(fmt::format("{}: {} is rewritten", rule->name(), result->Name()));
+            // keep the name, e.g. of a projected column
+            rewritten->alias_ = result->Name();
+            result = std::move(rewritten);
+        }
+    }
+    return result;
+}
+
+ExpressionRewriter::ExpressionRewriter() {
+    AddRule(MakeUnique<ConstantFoldingRule>());
+    AddRule(MakeUnique<BooleanSimplificationRule>());
+}
+
+void ExpressionRewriter::ApplyToPlan(QueryContext *, SharedPtr<LogicalNode> &logical_plan) {
+    ExpressionRuleApplier applier(rules_);
+    applier.VisitNode(*logical_plan);
+    RewriteFilters(logical_plan);
+}
+
+} // namespace infinity
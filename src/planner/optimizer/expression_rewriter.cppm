@@ -0,0 +1,97 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+export module expression_rewriter;
+
+import stl;
+import logical_node;
+import logical_node_visitor;
+import base_expression;
+import column_expression;
+import function_expression;
+import cast_expression;
+import query_context;
+import optimizer_rule;
+
+namespace infinity {
+
+// One rewrite of an expression whose arguments are already rewritten, returns nullptr if it doesn't apply.
+export class ExpressionRewriteRule {
+public:
+    virtual ~ExpressionRewriteRule() = default;
+
+    virtual SharedPtr<BaseExpression> Rewrite(const SharedPtr<BaseExpression> &expression) = 0;
+
+    virtual String name() const = 0;
+};
+
+// Functions and casts whose arguments are all values are evaluated once at plan time.
+// An expression whose evaluation fails or results in NULL is kept, so that it behaves as before when the query runs.
+export class ConstantFoldingRule final : public ExpressionRewriteRule {
+public:
+    SharedPtr<BaseExpression> Rewrite(const SharedPtr<BaseExpression> &expression) final;
+
+    String name() const final { return "Constant folding"; }
+};
+
+// x AND TRUE -> x, x AND FALSE -> FALSE, x OR TRUE -> TRUE, x OR FALSE -> x, all scalar functions have no side effect.
+export class BooleanSimplificationRule final : public ExpressionRewriteRule {
+public:
+    SharedPtr<BaseExpression> Rewrite(const SharedPtr<BaseExpression> &expression) final;
+
+    String name() const final { return "Boolean simplification"; }
+};
+
+class ExpressionRuleApplier final : public LogicalNodeVisitor {
+public:
+    explicit ExpressionRuleApplier(const Vector<UniquePtr<ExpressionRewriteRule>> &rules) : rules_(rules) {}
+
+    void VisitNode(LogicalNode &op) final;
+
+private:
+    SharedPtr<BaseExpression> Apply(const SharedPtr<BaseExpression> &expression);
+
+    SharedPtr<BaseExpression> VisitReplace(const SharedPtr<ColumnExpression> &expression) final { return expression; }
+
+    SharedPtr<BaseExpression> VisitReplace(const SharedPtr<FunctionExpression> &expression) final { return Apply(expression); }
+
+    SharedPtr<BaseExpression> VisitReplace(const SharedPtr<CastExpression> &expression) final { return Apply(expression); }
+
+    const Vector<UniquePtr<ExpressionRewriteRule>> &rules_;
+};
+
+// Applies the expression rewrite rules to all the expressions of the plan, bottom-up. Then:
+// 1. the filters whose condition became TRUE are removed, a KNN scan filter which became TRUE is dropped.
+// 2. the conjuncts of filter conditions are ordered by estimated selectivity and evaluation cost, the filter evaluates them in
+//    this order and skips the remaining ones once a block has no row left, see ExpressionSelector.
+export class ExpressionRewriter final : public OptimizerRule {
+public:
+    ExpressionRewriter();
+
+    ~ExpressionRewriter() override final = default;
+
+    void AddRule(UniquePtr<ExpressionRewriteRule> rule) { rules_.emplace_back(std::move(rule)); }
+
+    void ApplyToPlan(QueryContext *query_context_ptr, SharedPtr<LogicalNode> &logical_plan) override final;
+
+    String name() const override final { return "Rewrite expressions"; }
+
+private:
+    Vector<UniquePtr<ExpressionRewriteRule>> rules_{};
+};
+
+} // namespace infinity
@@ -14,6 +14,7 @@
 
 module;
 
+#include <algorithm>
 #include <vector>
 module lazy_load;
 
@@ -27,6 +28,7 @@ import logical_table_scan;
 import logical_index_scan;
 import logical_knn_scan;
 import logical_match;
+import logical_fusion;
 import base_table_ref;
 import load_meta;
 
@@ -128,17 +130,12 @@ void CleanScan::VisitNode(LogicalNode &op) {
             break;
         }
         case LogicalNodeType::kKnnScan: {
-            auto knn_scan = dynamic_cast<LogicalKnnScan &>(op);
-            // KnnScan base table ref has two parts:
-            // 1. the columns used by next operator
-            // 2. the columns used by filter expression in knn
+            // Late materialization: knn scan outputs the row ids and distances of its top k rows, and the columns its filter reads.
+            // The operator above it loads the other columns of those rows by row id.
+            auto &knn_scan = dynamic_cast<LogicalKnnScan &>(op);
             auto &knn_load_metas = *knn_scan.load_metas();
-            Vector<LoadMeta> knn_scan_columns = std::move(knn_load_metas);
+            Vector<SizeT> project_idxs = LoadedColumn(&knn_load_metas, knn_scan.base_table_ref_.get());
             knn_load_metas.clear(); // need to set load_metas of KnnScan to empty vector
-            auto &last_op_load_metas = *last_op_load_metas_;
-            knn_scan_columns.insert(knn_scan_columns.end(), last_op_load_metas.begin(), last_op_load_metas.end());
-            Vector<SizeT> project_idxs = LoadedColumn(&knn_scan_columns, knn_scan.base_table_ref_.get());
-            scan_table_indexes_.push_back(knn_scan.base_table_ref_->table_index_);
             knn_scan.base_table_ref_->RetainColumnByIndices(std::move(project_idxs));
             break;
         }
@@ -149,15 +146,32 @@ void CleanScan::VisitNode(LogicalNode &op) {
             break;
         }
         case LogicalNodeType::kMatch: {
-            auto match = dynamic_cast<LogicalMatch &>(op);
-            Vector<SizeT> project_idxs = LoadedColumn(last_op_load_metas_.get(), match.base_table_ref_.get());
-
-            scan_table_indexes_.push_back(match.base_table_ref_->table_index_);
+            // Late materialization: match outputs the row ids and scores of its top n rows only.
+            auto &match = dynamic_cast<LogicalMatch &>(op);
+            Vector<SizeT> project_idxs; // empty output
             match.base_table_ref_->RetainColumnByIndices(std::move(project_idxs));
             break;
         }
-        case LogicalNodeType::kLimit:
         case LogicalNodeType::kFusion: {
+            // The inputs of fusion output their row ids and scores, and the columns the knn filters read.
+            // Most rows are dropped by fusion, so the operator above it loads the projected columns of the rows kept.
+            auto &fusion = dynamic_cast<LogicalFusion &>(op);
+            Vector<LoadMeta> input_columns;
+            for (const auto &input : {op.left_node(), op.right_node()}) {
+                if (input.get() != nullptr and input->operator_type() == LogicalNodeType::kKnnScan) {
+                    auto &knn_load_metas = *input->load_metas();
+                    input_columns.insert(input_columns.end(), knn_load_metas.begin(), knn_load_metas.end());
+                    knn_load_metas.clear();
+                }
+            }
+            // the inputs share the table ref, retain the columns once
+            Vector<SizeT> project_idxs = LoadedColumn(&input_columns, fusion.base_table_ref_.get());
+            std::sort(project_idxs.begin(), project_idxs.end());
+            project_idxs.erase(std::unique(project_idxs.begin(), project_idxs.end()), project_idxs.end());
+            fusion.base_table_ref_->RetainColumnByIndices(std::move(project_idxs));
+            break;
+        }
+        case LogicalNodeType::kLimit: {
             // Skip
             VisitNodeChildren(op);
             VisitNodeExpression(op);
@@ -0,0 +1,205 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+module predicate_push_down;
+
+import stl;
+import logical_node;
+import logical_node_type;
+import logical_filter;
+import logical_project;
+import query_context;
+import base_expression;
+import expression_type;
+import column_expression;
+import function_expression;
+import in_expression;
+import case_expression;
+import scalar_function;
+import scalar_function_set;
+import catalog;
+import logger;
+import third_party;
+
+namespace infinity {
+
+namespace {
+
+void SplitConjuncts(const SharedPtr<BaseExpression> &expression, Vector<SharedPtr<BaseExpression>> &conjuncts) {
+    if (expression->type() == ExpressionType::kFunction and static_cast<FunctionExpression &>(*expression).ScalarFunctionName() == "AND") {
+        for (const auto &argument : expression->arguments()) {
+            SplitConjuncts(argument, conjuncts);
+        }
+        return;
+    }
+    conjuncts.emplace_back(expression);
+}
+
+// true if all the columns read by the expression are plain columns projected by the projection
+bool CanPushThrough(const SharedPtr<BaseExpression> &expression, const LogicalProject &project) {
+    switch (expression->type()) {
+        case ExpressionType::kColumn: {
+            const auto binding = static_cast<ColumnExpression &>(*expression).binding();
+            return binding.table_idx == project.table_index_ and binding.column_idx < project.expressions_.size() and
+                   project.expressions_[binding.column_idx]->type() == ExpressionType::kColumn;
+        }
+        case ExpressionType::kValue: {
+            return true;
+        }
+        case ExpressionType::kFunction:
+        case ExpressionType::kCast: {
+            break;
+        }
+        case ExpressionType::kIn: {
+            if (!CanPushThrough(static_cast<InExpression &>(*expression).left_operand(), project)) {
+                return false;
+            }
+            break;
+        }
+        case ExpressionType::kCase: {
+            auto &case_expression = static_cast<CaseExpression &>(*expression);
+            for (const auto &case_check : case_expression.CaseExpr()) {
+                if (!CanPushThrough(case_check.when_expr_, project) or !CanPushThrough(case_check.then_expr_, project)) {
+                    return false;
+                }
+            }
+            if (case_expression.ElseExpr().get() != nullptr and !CanPushThrough(case_expression.ElseExpr(), project)) {
+                return false;
+            }
+            break;
+        }
+        default: {
+            return false;
+        }
+    }
+    for (const auto &argument : expression->arguments()) {
+        if (!CanPushThrough(argument, project)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// replace the columns of the projection with the columns it projects, CanPushThrough() must be true
+void SubstituteColumns(SharedPtr<BaseExpression> &expression, const LogicalProject &project) {
+    switch (expression->type()) {
+        case ExpressionType::kColumn: {
+            const auto binding = static_cast<ColumnExpression &>(*expression).binding();
+            expression = MakeShared<ColumnExpression>(static_cast<ColumnExpression &>(*project.expressions_[binding.column_idx]));
+            return;
+        }
+        case ExpressionType::kIn: {
+            SubstituteColumns(static_cast<InExpression &>(*expression).left_operand(), project);
+            break;
+        }
+        case ExpressionType::kCase: {
+            auto &case_expression = static_cast<CaseExpression &>(*expression);
+            for (auto &case_check : case_expression.CaseExpr()) {
+                SubstituteColumns(case_check.when_expr_, project);
+                SubstituteColumns(case_check.then_expr_, project);
+            }
+            if (case_expression.ElseExpr().get() != nullptr) {
+                SubstituteColumns(case_expression.ElseExpr(), project);
+            }
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+    for (auto &argument : expression->arguments()) {
+        SubstituteColumns(argument, project);
+    }
+}
+
+} // namespace
+
+void PredicatePushDown::ApplyToPlan(QueryContext *query_context_ptr, SharedPtr<LogicalNode> &logical_plan) {
+    query_context_ = query_context_ptr;
+    PushDown(logical_plan);
+}
+
+void PredicatePushDown::PushDown(SharedPtr<LogicalNode> &node) {
+    if (node.get() == nullptr) {
+        return;
+    }
+    if (node->operator_type() == LogicalNodeType::kFilter) {
+        auto &filter = static_cast<LogicalFilter &>(*node);
+        SharedPtr<LogicalNode> &child = node->left_node();
+        switch (child->operator_type()) {
+            case LogicalNodeType::kFilter: {
+                auto &child_filter = static_cast<LogicalFilter &>(*child);
+                LOG_TRACE(fmt::format("PredicatePushDown: merge filter {} into filter {}.", filter.node_id(), child_filter.node_id()));
+                child_filter.expression() = MakeConjunction({child_filter.expression(), filter.expression()});
+                node = child;
+                PushDown(node);
+                return;
+            }
+            case LogicalNodeType::kProjection: {
+                auto &project = static_cast<LogicalProject &>(*child);
+                Vector<SharedPtr<BaseExpression>> conjuncts;
+                SplitConjuncts(filter.expression(), conjuncts);
+                Vector<SharedPtr<BaseExpression>> pushed_conjuncts;
+                Vector<SharedPtr<BaseExpression>> kept_conjuncts;
+                for (auto &conjunct : conjuncts) {
+                    if (CanPushThrough(conjunct, project)) {
+                        SubstituteColumns(conjunct, project);
+                        pushed_conjuncts.emplace_back(std::move(conjunct));
+                    } else {
+                        kept_conjuncts.emplace_back(std::move(conjunct));
+                    }
+                }
+                if (pushed_conjuncts.empty()) {
+                    break;
+                }
+                LOG_TRACE(fmt::format("PredicatePushDown: push {} condition(s) of filter {} below {}.",
+                                      pushed_conjuncts.size(),
+                                      filter.node_id(),
+                                      project.name()));
+                auto pushed_filter = MakeShared<LogicalFilter>(query_context_->GetNextNodeID(), MakeConjunction(std::move(pushed_conjuncts)));
+                pushed_filter->set_left_node(project.left_node());
+                project.set_left_node(pushed_filter);
+                if (kept_conjuncts.empty()) {
+                    node = child;
+                } else {
+                    filter.expression() = MakeConjunction(std::move(kept_conjuncts));
+                }
+                PushDown(node);
+                return;
+            }
+            default: {
+                break;
+            }
+        }
+    }
+    PushDown(node->left_node());
+    PushDown(node->right_node());
+}
+
+SharedPtr<BaseExpression> PredicatePushDown::MakeConjunction(Vector<SharedPtr<BaseExpression>> conjuncts) const {
+    auto and_function_set_ptr = NewCatalog::GetFunctionSetByName(query_context_->storage()->catalog(), "AND");
+    auto and_scalar_function_set_ptr = static_pointer_cast<ScalarFunctionSet>(and_function_set_ptr);
+    SharedPtr<BaseExpression> result = std::move(conjuncts[0]);
+    for (SizeT idx = 1; idx < conjuncts.size(); ++idx) {
+        Vector<SharedPtr<BaseExpression>> arguments{std::move(result), std::move(conjuncts[idx])};
+        ScalarFunction and_func = and_scalar_function_set_ptr->GetMostMatchFunction(arguments);
+        result = MakeShared<FunctionExpression>(std::move(and_func), std::move(arguments));
+    }
+    return result;
+}
+
+} // namespace infinity
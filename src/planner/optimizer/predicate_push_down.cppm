@@ -0,0 +1,48 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+export module predicate_push_down;
+
+import stl;
+import logical_node;
+import base_expression;
+import query_context;
+import optimizer_rule;
+
+namespace infinity {
+
+// Moves filter conditions closer to the scans:
+// 1. a filter directly above another filter is merged into it with AND.
+// 2. the conjuncts of a filter above a projection which only read projected columns are moved below the projection,
+//    e.g. the condition on a subquery in FROM, so that the index scan / zone map rules see them above the table scan.
+export class PredicatePushDown final : public OptimizerRule {
+public:
+    ~PredicatePushDown() override final = default;
+
+    void ApplyToPlan(QueryContext *query_context_ptr, SharedPtr<LogicalNode> &logical_plan) override final;
+
+    String name() const override final { return "Push down predicates"; }
+
+private:
+    void PushDown(SharedPtr<LogicalNode> &node);
+
+    SharedPtr<BaseExpression> MakeConjunction(Vector<SharedPtr<BaseExpression>> conjuncts) const;
+
+    QueryContext *query_context_{};
+};
+
+} // namespace infinity
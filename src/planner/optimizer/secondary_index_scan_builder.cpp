@@ -34,6 +34,7 @@ import expression_type;
 import conjunction_expression;
 import function_expression;
 import base_table_ref;
+import block_index;
 import logger;
 import third_party;
 import scalar_function;
@@ -41,6 +42,7 @@ import scalar_function_set;
 import catalog;
 import cast_expression;
 import column_expression;
+import in_expression;
 import secondary_index_scan_execute_expression;
 import column_index_entry;
 import create_index_info;
@@ -132,12 +134,18 @@ private:
             }
             auto &index_map = table_index_entry->column_index_map();
             for (auto &[column_id, column_index_entry] : index_map) {
-                if (column_index_entry->index_base_ptr()->index_type_ == IndexType::kSecondary) {
-                    if (candidate_column_index_map_.contains(column_id)) {
-                        LOG_TRACE(fmt::format("InitColumnIndexEntries(): Column {} has multiple secondary indexes. Skipping one.", column_id));
-                    } else {
-                        candidate_column_index_map_.emplace(column_id, column_index_entry);
-                    }
+                auto index_type = column_index_entry->index_base_ptr()->index_type_;
+                if (index_type != IndexType::kSecondary and index_type != IndexType::kBSI) {
+                    continue;
+                }
+                if (auto iter = candidate_column_index_map_.find(column_id); iter == candidate_column_index_map_.end()) {
+                    candidate_column_index_map_.emplace(column_id, column_index_entry);
+                } else if (index_type == IndexType::kBSI and iter->second->index_base_ptr()->index_type_ != IndexType::kBSI) {
+                    // bsi answers a range with a few bitmap operations, prefer it to the sorted secondary index
+                    LOG_TRACE(fmt::format("InitColumnIndexEntries(): Column {} has both bsi and secondary indexes. Use bsi index.", column_id));
+                    iter->second = column_index_entry;
+                } else {
+                    LOG_TRACE(fmt::format("InitColumnIndexEntries(): Column {} has multiple secondary indexes. Skipping one.", column_id));
                 }
             }
         }
@@ -145,6 +153,14 @@ private:
 
     inline void FindIndexFilterCandidates() {
         for (auto &expression : flatten_and_subexpressions_) {
+            if (expression->type() == ExpressionType::kIn) {
+                if (auto point_lookups = RewriteInExpression(expression); point_lookups and CanApplyIndexScan(point_lookups)) {
+                    index_filter_candidates_.emplace_back(std::move(point_lookups));
+                } else {
+                    index_filter_leftover_.emplace_back(std::move(expression));
+                }
+                continue;
+            }
             if (CanApplyIndexScan(expression)) {
                 index_filter_candidates_.emplace_back(std::move(expression));
             } else {
@@ -154,6 +170,47 @@ private:
         flatten_and_subexpressions_.clear();
     }
 
+    // "x IN (v1, ..., vn)" is looked up in the index as the points "x = v1" OR ... OR "x = vn".
+    // The "OR" tree is balanced, so that a list of thousands of keys doesn't build a deep expression.
+    // Returns nullptr if the expression isn't in this form, "NOT IN" is excluded like "NOT".
+    inline SharedPtr<BaseExpression> RewriteInExpression(const SharedPtr<BaseExpression> &expression) {
+        auto in_expression = std::static_pointer_cast<InExpression>(expression);
+        if (in_expression->in_type() != InType::kIn or in_expression->arguments().empty()) {
+            return nullptr;
+        }
+        const SharedPtr<BaseExpression> &left = in_expression->left_operand();
+        if (!IsColumnExpression(left, 1)) {
+            return nullptr;
+        }
+        for (auto &argument : in_expression->arguments()) {
+            if (!IsValueResultExpression(argument, 1)) {
+                return nullptr;
+            }
+        }
+        NewCatalog *catalog = query_context_->storage()->catalog();
+        auto equals_function_set_ptr = static_pointer_cast<ScalarFunctionSet>(NewCatalog::GetFunctionSetByName(catalog, "="));
+        auto or_function_set_ptr = static_pointer_cast<ScalarFunctionSet>(NewCatalog::GetFunctionSetByName(catalog, "OR"));
+        Vector<SharedPtr<BaseExpression>> point_expressions;
+        point_expressions.reserve(in_expression->arguments().size());
+        for (auto &argument : in_expression->arguments()) {
+            // the binder casts the list to the type of the left operand
+            Vector<SharedPtr<BaseExpression>> arguments{left, argument};
+            ScalarFunction equals_func = equals_function_set_ptr->GetMostMatchFunction(arguments);
+            point_expressions.emplace_back(MakeShared<FunctionExpression>(std::move(equals_func), std::move(arguments)));
+        }
+        // combine [begin, end) of point_expressions
+        auto combine = [&](auto &self, SizeT begin, SizeT end) -> SharedPtr<BaseExpression> {
+            if (end - begin == 1) {
+                return std::move(point_expressions[begin]);
+            }
+            const SizeT mid = begin + (end - begin) / 2;
+            Vector<SharedPtr<BaseExpression>> arguments{self(self, begin, mid), self(self, mid, end)};
+            ScalarFunction or_func = or_function_set_ptr->GetMostMatchFunction(arguments);
+            return MakeShared<FunctionExpression>(std::move(or_func), std::move(arguments));
+        };
+        return combine(combine, 0, point_expressions.size());
+    }
+
     // classification of subexpressions
     inline bool CanApplyIndexScan(const SharedPtr<BaseExpression> &expression) {
         // case 1. expression is a scalar expression containing only one column and the column has a secondary index
@@ -434,6 +491,9 @@ public:
                 UnrecoverableError("BuildSecondaryIndexScan: Logical filter node shouldn't have right child.");
             } else if (op->left_node()->operator_type() != LogicalNodeType::kTableScan) {
                 LOG_INFO("BuildSecondaryIndexScan: The left child of Logical filter is not table scan. Cannot push down filter. Need to fix.");
+            } else if (const BlockIndex *block_index = static_cast<LogicalTableScan &>(*(op->left_node())).base_table_ref_->block_index_.get();
+                       block_index->LocalBlockCount() > 0 or block_index->HasLocalDeletes()) {
+                LOG_INFO("BuildSecondaryIndexScan: The rows changed by the transaction aren't indexed yet. Keep the table scan.");
             } else {
                 auto &filter = static_cast<LogicalFilter &>(*op);
                 auto &filter_expression = filter.expression();
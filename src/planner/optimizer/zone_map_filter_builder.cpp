@@ -0,0 +1,175 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+module zone_map_filter_builder;
+
+import stl;
+import logical_node;
+import logical_node_type;
+import logical_filter;
+import logical_table_scan;
+import query_context;
+import infinity_exception;
+import base_expression;
+import expression_type;
+import function_expression;
+import column_expression;
+import logical_type;
+import data_type;
+import secondary_index_scan_middle_expression;
+import logger;
+import third_party;
+
+namespace infinity {
+
+// Same subexpression shapes as the secondary index filter push down, "[cast] x compare value_expr" combined with "and" / "or",
+// without the secondary index requirement on x.
+// Only the casts which can be unwound exactly are accepted, a float column compared with a double value is not pruned.
+class ZoneMapFilterCollector {
+public:
+    explicit ZoneMapFilterCollector(u64 table_index) : table_index_(table_index) {}
+
+    Vector<FilterEvaluatorElem> Solve(const SharedPtr<BaseExpression> &expression) {
+        FlattenAndExpression(expression);
+        Vector<FilterEvaluatorElem> result;
+        SizeT prunable_count = 0;
+        for (auto &subexpression : flatten_and_subexpressions_) {
+            if (!CanPrune(subexpression)) {
+                continue;
+            }
+            Vector<FilterEvaluatorElem> command = BuildSecondaryIndexScanMiddleCommand(subexpression);
+            result.insert(result.end(), std::make_move_iterator(command.begin()), std::make_move_iterator(command.end()));
+            if (++prunable_count > 1) {
+                result.emplace_back(BooleanCombineType::kAnd);
+            }
+        }
+        return result;
+    }
+
+private:
+    void FlattenAndExpression(const SharedPtr<BaseExpression> &expression) {
+        if (expression->type() == ExpressionType::kFunction) {
+            auto function_expression = std::static_pointer_cast<FunctionExpression>(expression);
+            if (function_expression->ScalarFunctionName() == "AND") {
+                for (auto &child_expression : expression->arguments()) {
+                    FlattenAndExpression(child_expression);
+                }
+                return;
+            }
+        }
+        flatten_and_subexpressions_.emplace_back(expression);
+    }
+
+    bool CanPrune(const SharedPtr<BaseExpression> &expression) const {
+        if (expression->type() != ExpressionType::kFunction or expression->arguments().size() != 2) {
+            return false;
+        }
+        auto function_expression = std::static_pointer_cast<FunctionExpression>(expression);
+        auto const &f_name = function_expression->ScalarFunctionName();
+        if (f_name == "AND" or f_name == "OR") {
+            return CanPrune(expression->arguments()[0]) and CanPrune(expression->arguments()[1]);
+        }
+        static constexpr std::array<const char *, 5> compare_function_names = {"<", ">", "<=", ">=", "="};
+        if (std::find(compare_function_names.begin(), compare_function_names.end(), f_name) == compare_function_names.end()) {
+            return false;
+        }
+        auto &left = expression->arguments()[0];
+        auto &right = expression->arguments()[1];
+        return IsZoneMapColumn(left, f_name != "=") and IsValueResultExpression(right) and left->Type() == right->Type();
+    }
+
+    bool IsZoneMapColumn(const SharedPtr<BaseExpression> &expression, bool allow_cast_to_double) const {
+        switch (expression->type()) {
+            case ExpressionType::kColumn: {
+                auto column_expression = std::static_pointer_cast<ColumnExpression>(expression);
+                return expression->Type().CanBuildSecondaryIndex() and column_expression->binding().table_idx == table_index_;
+            }
+            case ExpressionType::kCast: {
+                if (expression->arguments().size() != 1) {
+                    return false;
+                }
+                auto &source_expression = expression->arguments()[0];
+                LogicalType source_type = source_expression->Type().type();
+                LogicalType target_type = expression->Type().type();
+                bool can_unwind = false;
+                if (source_type == target_type) {
+                    can_unwind = true;
+                } else if (target_type == LogicalType::kBigInt) {
+                    can_unwind =
+                        source_type == LogicalType::kTinyInt or source_type == LogicalType::kSmallInt or source_type == LogicalType::kInteger;
+                } else if (target_type == LogicalType::kDouble and allow_cast_to_double) {
+                    can_unwind = source_type == LogicalType::kTinyInt or source_type == LogicalType::kSmallInt or
+                                 source_type == LogicalType::kInteger or source_type == LogicalType::kBigInt;
+                }
+                return can_unwind and IsZoneMapColumn(source_expression, allow_cast_to_double);
+            }
+            default: {
+                return false;
+            }
+        }
+    }
+
+    bool IsValueResultExpression(const SharedPtr<BaseExpression> &expression) const {
+        switch (expression->type()) {
+            case ExpressionType::kValue: {
+                return true;
+            }
+            case ExpressionType::kCast:
+            case ExpressionType::kFunction: {
+                for (auto &child_expression : expression->arguments()) {
+                    if (!IsValueResultExpression(child_expression)) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+            default: {
+                return false;
+            }
+        }
+    }
+
+    u64 table_index_{};
+    Vector<SharedPtr<BaseExpression>> flatten_and_subexpressions_;
+};
+
+class BuildZoneMapFilter {
+public:
+    void VisitNode(const SharedPtr<LogicalNode> &op) {
+        if (!op) {
+            return;
+        }
+        if (op->operator_type() == LogicalNodeType::kFilter and op->left_node().get() != nullptr and
+            op->left_node()->operator_type() == LogicalNodeType::kTableScan) {
+            auto &filter = static_cast<LogicalFilter &>(*op);
+            auto &table_scan = static_cast<LogicalTableScan &>(*(op->left_node()));
+            ZoneMapFilterCollector collector(table_scan.TableIndex());
+            table_scan.zone_map_filter_ = collector.Solve(filter.expression());
+            if (!table_scan.zone_map_filter_.empty()) {
+                LOG_TRACE(fmt::format("BuildZoneMapFilter: table scan {} prunes blocks by zone map.", table_scan.node_id()));
+            }
+        }
+        VisitNode(op->left_node());
+        VisitNode(op->right_node());
+    }
+};
+
+void ZoneMapFilterBuilder::ApplyToPlan(QueryContext *, SharedPtr<LogicalNode> &logical_plan) {
+    BuildZoneMapFilter visitor;
+    visitor.VisitNode(logical_plan);
+}
+
+} // namespace infinity
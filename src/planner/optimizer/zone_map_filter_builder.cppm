@@ -0,0 +1,37 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module zone_map_filter_builder;
+
+import stl;
+import logical_node;
+import query_context;
+import optimizer_rule;
+
+namespace infinity {
+
+// Copies the part of a filter which can be checked against block zone maps to the table scan below it.
+// The filter node is kept, the table scan only uses it to skip the blocks which can't match.
+export class ZoneMapFilterBuilder final : public OptimizerRule {
+public:
+    ~ZoneMapFilterBuilder() override final = default;
+
+    void ApplyToPlan(QueryContext *query_context_ptr, SharedPtr<LogicalNode> &logical_plan) override final;
+
+    String name() const override final { return "Build ZoneMap filter"; }
+};
+
+} // namespace infinity
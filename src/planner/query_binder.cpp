@@ -50,6 +50,8 @@ import cross_product_table_ref;
 
 import table_entry_type;
 import block_index;
+import txn;
+import txn_store;
 import cast_expression;
 import search_expression;
 import status;
@@ -427,6 +429,11 @@ SharedPtr<BaseTableRef> QueryBinder::BuildBaseTable(QueryContext *query_context,
     TxnTimeStamp begin_ts = query_context->GetTxn()->BeginTS();
 
     SharedPtr<BlockIndex> block_index = table_entry->GetBlockIndex(begin_ts);
+    // the transaction reads its own appended rows before commit
+    if (TxnTableStore *txn_store = query_context->GetTxn()->GetExistTxnTableStore(table_entry); txn_store != nullptr) {
+        block_index->InsertTxnLocalBlocks(txn_store->LocalBlocks());
+        block_index->InsertTxnLocalDeletes(txn_store->LocalDeletes());
+    }
 
     u64 table_index = bind_context_ptr_->GenerateTableIndex();
     auto table_ref = MakeShared<BaseTableRef>(table_entry, std::move(columns), block_index, alias, table_index, names_ptr, types_ptr);
@@ -38,6 +38,7 @@ import physical_create_index_prepare;
 import physical_create_index_do;
 import physical_sort;
 import physical_top;
+import physical_filter;
 import physical_merge_top;
 
 import global_block_id;
@@ -76,6 +77,15 @@ UniquePtr<OperatorState> MakeCreateIndexDoState(PhysicalCreateIndexDo *physical_
     return operator_state;
 }
 
+UniquePtr<OperatorState> MakeFusionState(FragmentContext *fragment_ctx) {
+    auto operator_state = MakeUnique<FusionOperatorState>();
+    // children fragments are added in the order of the fusion children: left, then right
+    for (const auto &child_fragment : fragment_ctx->fragment_ptr()->Children()) {
+        operator_state->input_fragment_ids_.push_back(child_fragment->FragmentID());
+    }
+    return operator_state;
+}
+
 UniquePtr<OperatorState> MakeTableScanState(PhysicalTableScan *physical_table_scan, FragmentTask *task) {
     SourceState *source_state = task->source_state_.get();
 
@@ -155,6 +165,12 @@ UniquePtr<OperatorState> MakeMergeKnnState(PhysicalMergeKnn *physical_merge_knn,
     return operator_state;
 }
 
+UniquePtr<OperatorState> MakeFilterState(PhysicalOperator *physical_op) {
+    auto operator_state = MakeUnique<FilterOperatorState>();
+    operator_state->condition_state_ = ExpressionState::CreateState((static_cast<PhysicalFilter *>(physical_op))->condition());
+    return operator_state;
+}
+
 UniquePtr<OperatorState> MakeSortState(PhysicalOperator *physical_op) {
     auto operator_state = MakeUnique<SortOperatorState>();
     auto &expr_states = operator_state->expr_states_;
@@ -224,7 +240,7 @@ MakeTaskState(SizeT operator_id, const Vector<PhysicalOperator *> &physical_ops,
             return MakeTaskStateTemplate<MergeParallelAggregateOperatorState>(physical_ops[operator_id]);
         }
         case PhysicalOperatorType::kFilter: {
-            return MakeTaskStateTemplate<FilterOperatorState>(physical_ops[operator_id]);
+            return MakeFilterState(physical_ops[operator_id]);
         }
         case PhysicalOperatorType::kIndexScan: {
             if (operator_id != physical_ops.size() - 1) {
@@ -339,7 +355,7 @@ MakeTaskState(SizeT operator_id, const Vector<PhysicalOperator *> &physical_ops,
             return MakeTaskStateTemplate<MatchOperatorState>(physical_ops[operator_id]);
         }
         case PhysicalOperatorType::kFusion: {
-            return MakeTaskStateTemplate<FusionOperatorState>(physical_ops[operator_id]);
+            return MakeFusionState(fragment_ctx);
         }
         default: {
             UnrecoverableError(fmt::format("Not support {} now", PhysicalOperatorToString(physical_ops[operator_id]->operator_type())));
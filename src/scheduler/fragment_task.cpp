@@ -34,6 +34,8 @@ import base_table_ref;
 import defer_op;
 import fragment_context;
 import status;
+import memory_tracker;
+import explain_analyze;
 
 namespace infinity {
 
@@ -65,15 +67,21 @@ void FragmentTask::OnExecute(i64) {
         // No source error
         Vector<PhysicalOperator *> &operator_refs = fragment_context->GetOperators();
 
-        bool enable_profiler = query_context->is_enable_profiling();
+        bool enable_profiler = query_context->is_profiling();
         TaskProfiler profiler(TaskBinding(), enable_profiler, operator_count_);
         HashMap<SizeT, SharedPtr<BaseTableRef>> table_refs;
         profiler.Begin();
         Status operator_status{};
         try {
+            // only the operators are charged, a sink must not fail after them
+            ScopedMemoryTracker scoped_memory_tracker(query_context->memory_tracker());
             for (i64 op_idx = operator_count_ - 1; op_idx >= 0; --op_idx) {
                 profiler.StartOperator(operator_refs[op_idx]);
-                DeferFn defer_fn([&]() { profiler.StopOperator(operator_states_[op_idx].get()); });
+                OperatorExecutionSample execution_sample(query_context->explain_analyzer(), operator_states_[op_idx].get());
+                DeferFn defer_fn([&]() {
+                    profiler.StopOperator(operator_states_[op_idx].get());
+                    execution_sample.Stop(operator_refs[op_idx], operator_states_[op_idx].get(), task_id_);
+                });
 
                 operator_refs[op_idx]->InputLoad(fragment_context->query_context(), operator_states_[op_idx].get(), table_refs);
                 execute_success = operator_refs[op_idx]->Execute(fragment_context->query_context(), operator_states_[op_idx].get());
@@ -157,6 +157,15 @@ void TaskScheduler::ScheduleTask(FragmentTask *task, u64 worker_id) {
     worker_array_[worker_id].queue_->Enqueue(task);
 }
 
+Vector<u64> TaskScheduler::WorkerWorkloads() const {
+    Vector<u64> workloads;
+    workloads.reserve(worker_workloads_.size());
+    for (const auto &workload : worker_workloads_) {
+        workloads.push_back(workload.load());
+    }
+    return workloads;
+}
+
 void TaskScheduler::WorkerLoop(FragmentTaskBlockQueue *task_queue, i64 worker_id) {
     List<FragmentTask *> task_lists;
     auto iter = task_lists.end();
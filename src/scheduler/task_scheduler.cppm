@@ -54,6 +54,9 @@ public:
 
     void DumpPlanFragment(PlanFragment *plan_fragment);
 
+    // Tasks assigned to each worker and not finished, queued or running
+    Vector<u64> WorkerWorkloads() const;
+
 private:
     u64 FindLeastWorkloadWorker();
 
@@ -12,76 +12,194 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+module;
+
 module backgroud_process;
 
 import stl;
 import bg_task;
 import compact_segments_task;
+import rate_limiter;
 import logger;
-import blocking_queue;
 import infinity_exception;
 import wal_manager;
 import third_party;
 
 namespace infinity {
 
-BGTaskProcessor::BGTaskProcessor(WalManager *wal_manager) : wal_manager_(wal_manager) {}
+BGTaskProcessor::BGTaskProcessor(WalManager *wal_manager, SizeT worker_count, SizeT compaction_concurrency, u64 compaction_io_rate_limit)
+    : worker_count_(std::max(worker_count, SizeT(1))), compaction_io_limiter_(compaction_io_rate_limit), wal_manager_(wal_manager) {
+    lanes_[static_cast<SizeT>(BGTaskClass::kCheckpoint)].concurrency_limit_ = 1;
+    lanes_[static_cast<SizeT>(BGTaskClass::kFlush)].concurrency_limit_ = 1;
+    lanes_[static_cast<SizeT>(BGTaskClass::kCompaction)].concurrency_limit_ = std::max(compaction_concurrency, SizeT(1));
+    lanes_[static_cast<SizeT>(BGTaskClass::kIndexBuild)].concurrency_limit_ = DEFAULT_BG_INDEX_BUILD_CONCURRENCY;
+}
 
 void BGTaskProcessor::Start() {
-    LOG_INFO("Start the background processor.");
-    processor_thread_ = Thread([this] { Process(); });
+    LOG_INFO(fmt::format("Start the background processor with {} workers.", worker_count_));
+    for (SizeT i = 0; i < worker_count_; ++i) {
+        workers_.emplace_back([this] { Process(); });
+    }
 }
 
 void BGTaskProcessor::Stop() {
-    SharedPtr<StopProcessorTask> stop_task = MakeShared<StopProcessorTask>();
-    task_queue_.Enqueue(stop_task);
-    stop_task->Wait();
-    processor_thread_.join();
+    {
+        std::unique_lock lock(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    for (auto &worker : workers_) {
+        worker.join();
+    }
+    workers_.clear();
     LOG_INFO("Shutdown the background processor.");
 }
 
-void BGTaskProcessor::Submit(SharedPtr<BGTask> bg_task) { task_queue_.Enqueue(std::move(bg_task)); }
-
-void BGTaskProcessor::Process() {
-    bool running{true};
-    while (running) {
-        SharedPtr<BGTask> bg_task = task_queue_.DequeueReturn();
-
-        switch (bg_task->type_) {
-            case BGTaskType::kTryCheckpoint: {
-                wal_manager_->Checkpoint();
-                break;
-            }
-            case BGTaskType::kForceCheckpoint: {
-                ForceCheckpointTask *force_ckp_task = static_cast<ForceCheckpointTask *>(bg_task.get());
-                wal_manager_->Checkpoint(force_ckp_task);
-                break;
-            }
-            case BGTaskType::kStopProcessor: {
-                running = false;
-                break;
+void BGTaskProcessor::Submit(SharedPtr<BGTask> bg_task) {
+    BGTaskClass task_class = GetBGTaskClass(bg_task->type_);
+    if (task_class == BGTaskClass::kInvalid) {
+        UnrecoverableError("Invalid background task");
+    }
+    {
+        std::unique_lock lock(mutex_);
+        auto &lane = lanes_[static_cast<SizeT>(task_class)];
+        if (bg_task->type_ == BGTaskType::kTryCheckpoint and bg_task->async_) {
+            // the timer submits one every second, it's enough to keep one in queue
+            for (const auto &entry : lane.queue_) {
+                if (entry.task_->type_ == BGTaskType::kTryCheckpoint) {
+                    return;
+                }
             }
-            case BGTaskType::kCatalogDeltaOpsMerge: {
-                CatalogDeltaOpsMergeTask *task = static_cast<CatalogDeltaOpsMergeTask *>(bg_task.get());
-                auto &local_catalog_ops = task->local_catalog_delta_entry_;
-                auto *catalog = task->catalog_;
-                catalog->global_catalog_delta_entry_->Merge(std::move(local_catalog_ops));
-                break;
+        }
+        lane.queue_.push_back(TaskEntry{next_task_id_++, std::move(bg_task), Clock::now()});
+    }
+    cv_.notify_one();
+}
+
+Vector<BGTaskInfo> BGTaskProcessor::ListTasks() const {
+    Vector<BGTaskInfo> task_infos;
+    std::unique_lock lock(mutex_);
+    auto now = Clock::now();
+    auto make_info = [&](BGTaskClass task_class, const TaskEntry &entry, bool running) {
+        u64 elapsed_ms = ChronoCast<MilliSeconds>(ElapsedFromStart(now, entry.time_)).count();
+        task_infos.push_back(BGTaskInfo{entry.task_id_, task_class, entry.task_->ToString(), running, elapsed_ms});
+    };
+    for (SizeT i = 0; i < BG_TASK_CLASS_COUNT; ++i) {
+        auto task_class = static_cast<BGTaskClass>(i);
+        for (const auto &entry : lanes_[i].running_) {
+            make_info(task_class, entry, true);
+        }
+        for (const auto &entry : lanes_[i].queue_) {
+            make_info(task_class, entry, false);
+        }
+    }
+    return task_infos;
+}
+
+bool BGTaskProcessor::PickTask(TaskEntry &entry) {
+    for (SizeT i = 0; i < BG_TASK_CLASS_COUNT; ++i) {
+        auto task_class = static_cast<BGTaskClass>(i);
+        auto &lane = lanes_[i];
+        if (lane.queue_.empty() or lane.running_.size() >= lane.concurrency_limit_) {
+            continue;
+        }
+        bool low_priority = task_class >= BGTaskClass::kCompaction;
+        if (low_priority and worker_count_ > 1 and low_priority_running_ + 1 >= worker_count_) {
+            continue;
+        }
+        if (task_class == BGTaskClass::kCheckpoint) {
+            const auto &flush_lane = lanes_[static_cast<SizeT>(BGTaskClass::kFlush)];
+            u64 task_id = lane.queue_.front().task_id_;
+            bool wait_flush = (!flush_lane.running_.empty() and flush_lane.running_.front().task_id_ < task_id) or
+                              (!flush_lane.queue_.empty() and flush_lane.queue_.front().task_id_ < task_id);
+            if (wait_flush) {
+                continue;
             }
-            case BGTaskType::kCompactSegments: {
-                auto *task = static_cast<CompactSegmentsTask *>(bg_task.get());
-                task->BeginTxn();
-                task->Execute();
-                task->CommitTxn();
-                break;
+        }
+        if (task_class == BGTaskClass::kFlush and !lanes_[static_cast<SizeT>(BGTaskClass::kCheckpoint)].running_.empty()) {
+            // the checkpoint swaps out the global catalog delta entry the flush merges into
+            continue;
+        }
+        entry = std::move(lane.queue_.front());
+        lane.queue_.pop_front();
+        entry.time_ = Clock::now();
+        lane.running_.push_back(entry);
+        if (low_priority) {
+            ++low_priority_running_;
+        }
+        return true;
+    }
+    return false;
+}
+
+bool BGTaskProcessor::HasTask() const {
+    for (const auto &lane : lanes_) {
+        if (!lane.queue_.empty()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void BGTaskProcessor::Process() {
+    while (true) {
+        TaskEntry entry;
+        {
+            std::unique_lock lock(mutex_);
+            while (!PickTask(entry)) {
+                if (stop_ and !HasTask()) {
+                    return;
+                }
+                cv_.wait(lock);
             }
-            case BGTaskType::kInvalid: {
-                UnrecoverableError("Invalid background task");
-                break;
+        }
+
+        ExecuteTask(entry.task_.get());
+
+        {
+            std::unique_lock lock(mutex_);
+            BGTaskClass task_class = GetBGTaskClass(entry.task_->type_);
+            lanes_[static_cast<SizeT>(task_class)].running_.remove_if([&](const TaskEntry &running) { return running.task_id_ == entry.task_id_; });
+            if (task_class >= BGTaskClass::kCompaction) {
+                --low_priority_running_;
             }
         }
+        entry.task_->Complete();
+        // a task waiting for the finished one may be runnable now
+        cv_.notify_all();
+    }
+}
 
-        bg_task->Complete();
+void BGTaskProcessor::ExecuteTask(BGTask *bg_task) {
+    switch (bg_task->type_) {
+        case BGTaskType::kTryCheckpoint: {
+            wal_manager_->Checkpoint();
+            break;
+        }
+        case BGTaskType::kForceCheckpoint: {
+            ForceCheckpointTask *force_ckp_task = static_cast<ForceCheckpointTask *>(bg_task);
+            wal_manager_->Checkpoint(force_ckp_task);
+            break;
+        }
+        case BGTaskType::kCatalogDeltaOpsMerge: {
+            CatalogDeltaOpsMergeTask *task = static_cast<CatalogDeltaOpsMergeTask *>(bg_task);
+            auto &local_catalog_ops = task->local_catalog_delta_entry_;
+            auto *catalog = task->catalog_;
+            catalog->global_catalog_delta_entry_->Merge(std::move(local_catalog_ops));
+            break;
+        }
+        case BGTaskType::kCompactSegments: {
+            auto *task = static_cast<CompactSegmentsTask *>(bg_task);
+            task->SetIOLimiter(&compaction_io_limiter_);
+            task->BeginTxn();
+            task->Execute();
+            task->CommitTxn();
+            break;
+        }
+        case BGTaskType::kInvalid: {
+            UnrecoverableError("Invalid background task");
+            break;
+        }
     }
 }
 
@@ -15,30 +15,85 @@
 module;
 
 import wal_manager;
-import blocking_queue;
 import bg_task;
+import rate_limiter;
+import default_values;
 import stl;
 
 export module backgroud_process;
 
 namespace infinity {
 
+// A background task queued or being run, listed by SHOW TASKS
+export struct BGTaskInfo {
+    u64 task_id_{};
+    BGTaskClass task_class_{BGTaskClass::kInvalid};
+    String task_text_{};
+    bool running_{false};
+    u64 elapsed_ms_{}; // since it is started if running, otherwise since it is submitted
+};
+
+// Background tasks are run by a pool of workers. A worker takes the oldest task of the highest priority class it may run:
+// - each class has a concurrency limit.
+// - checkpoints and flushes are run one at a time, a checkpoint waits for the flushes submitted before it so that it sees the
+//   catalog delta ops of the txns committed before.
+// - compactions and index builds leave at least one worker to checkpoints and flushes, so a long compaction doesn't delay
+//   checkpoints (and hence wal recycling).
+// The data compactions copy is throttled by compaction_io_limiter_.
 export class BGTaskProcessor {
 public:
-    explicit BGTaskProcessor(WalManager* wal_manager);
+    explicit BGTaskProcessor(WalManager *wal_manager,
+                             SizeT worker_count = DEFAULT_BG_WORKER_COUNT,
+                             SizeT compaction_concurrency = DEFAULT_BG_COMPACTION_CONCURRENCY,
+                             u64 compaction_io_rate_limit = DEFAULT_COMPACTION_IO_RATE_LIMIT);
     void Start();
+    // Run the tasks already submitted, then stop the workers
     void Stop();
 
 public:
     void Submit(SharedPtr<BGTask> bg_task);
 
+    Vector<BGTaskInfo> ListTasks() const;
+
+    [[nodiscard]] inline SizeT worker_count() const { return worker_count_; }
+
+    RateLimiter *compaction_io_limiter() { return &compaction_io_limiter_; }
+
 private:
+    struct TaskEntry {
+        u64 task_id_{};
+        SharedPtr<BGTask> task_{};
+        TimePoint<Clock> time_{}; // submitting time, reset to the starting time when it is run
+    };
+
+    struct TaskLane {
+        Deque<TaskEntry> queue_{};
+        List<TaskEntry> running_{};
+        SizeT concurrency_limit_{1};
+    };
+
     void Process();
 
-    BlockingQueue<SharedPtr<BGTask>> task_queue_;
-    Thread processor_thread_{};
+    // Pop the next task to run into entry, requires mutex_ held
+    bool PickTask(TaskEntry &entry);
+
+    bool HasTask() const;
+
+    void ExecuteTask(BGTask *bg_task);
+
+    mutable std::mutex mutex_{};
+    std::condition_variable cv_{};
+    bool stop_{false};
+    u64 next_task_id_{0};
+    Array<TaskLane, BG_TASK_CLASS_COUNT> lanes_{};
+    SizeT low_priority_running_{0}; // running compactions and index builds
+
+    const SizeT worker_count_{};
+    Vector<Thread> workers_{};
+
+    RateLimiter compaction_io_limiter_;
 
-    WalManager* wal_manager_{};
+    WalManager *wal_manager_{};
 };
 
-}
+} // namespace infinity
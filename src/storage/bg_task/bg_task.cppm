@@ -27,12 +27,60 @@ namespace infinity {
 export enum class BGTaskType {
     kTryCheckpoint,   // Periodically triggered by timer
     kForceCheckpoint, // Manually triggered by PhysicalImport
-    kStopProcessor,
     kCatalogDeltaOpsMerge, // Merge
     kCompactSegments,
     kInvalid
 };
 
+// Background tasks are scheduled by class, a class with a smaller value has a higher priority.
+export enum class BGTaskClass : i8 {
+    kCheckpoint,
+    kFlush, // flush the committed changes of a txn, e.g. merge its catalog delta ops into the global one
+    kCompaction,
+    kIndexBuild,
+    kInvalid,
+};
+
+export constexpr SizeT BG_TASK_CLASS_COUNT = static_cast<SizeT>(BGTaskClass::kInvalid);
+
+export inline BGTaskClass GetBGTaskClass(BGTaskType type) {
+    switch (type) {
+        case BGTaskType::kTryCheckpoint:
+        case BGTaskType::kForceCheckpoint: {
+            return BGTaskClass::kCheckpoint;
+        }
+        case BGTaskType::kCatalogDeltaOpsMerge: {
+            return BGTaskClass::kFlush;
+        }
+        case BGTaskType::kCompactSegments: {
+            return BGTaskClass::kCompaction;
+        }
+        default: {
+            return BGTaskClass::kInvalid;
+        }
+    }
+}
+
+export inline String BGTaskClassToString(BGTaskClass task_class) {
+    switch (task_class) {
+        case BGTaskClass::kCheckpoint: {
+            return "checkpoint";
+        }
+        case BGTaskClass::kFlush: {
+            return "flush";
+        }
+        case BGTaskClass::kCompaction: {
+            return "compaction";
+        }
+        case BGTaskClass::kIndexBuild: {
+            return "index build";
+        }
+        default: {
+            return "invalid";
+        }
+    }
+}
+
 export struct BGTask {
     BGTask(BGTaskType type, bool async) : type_(type), async_(async) {}
 
@@ -65,14 +113,6 @@ export struct BGTask {
     virtual String ToString() const = 0;
 };
 
-export struct StopProcessorTask final : public BGTask {
-    StopProcessorTask() : BGTask(BGTaskType::kStopProcessor, false) {}
-
-    ~StopProcessorTask() = default;
-
-    String ToString() const final { return "Stop Task"; }
-};
-
 export struct TryCheckpointTask final : public BGTask {
     explicit TryCheckpointTask(bool async) : BGTask(BGTaskType::kTryCheckpoint, async) {}
 
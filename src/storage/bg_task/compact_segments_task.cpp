@@ -38,6 +38,11 @@ import global_block_id;
 import block_index;
 import segment_iter;
 import block_entry;
+import segment_column_index_entry;
+import rate_limiter;
+import column_def;
+import data_type;
+import metrics;
 
 namespace infinity {
 
@@ -46,17 +51,35 @@ RowID RowIDRemapper::GetNewRowID(SegmentID segment_id, BlockID block_id, BlockOf
     auto iter = std::upper_bound(block_vec.begin(),
                                  block_vec.end(),
                                  block_offset,
-                                 [](BlockOffset block_offset, const Pair<BlockOffset, RowID> &pair) { return block_offset < pair.first; } // NOLINT
+                                 [](BlockOffset block_offset, const RowIDRange &range) { return block_offset < range.block_offset_; } // NOLINT
     );
     if (iter == block_vec.begin()) {
         UnrecoverableError("RowID not found");
     }
     --iter;
-    RowID rtn = iter->second;
-    rtn.segment_offset_ += iter->first - block_offset;
+    RowID rtn = iter->new_row_id_;
+    rtn.segment_offset_ += block_offset - iter->block_offset_;
     return rtn;
 }
 
+Vector<SegmentOffset> RowIDRemapper::GetNewSegmentOffsets(SegmentID segment_id, SegmentOffset row_count) const {
+    Vector<SegmentOffset> new_offsets(row_count, INVALID_SEGMENT_OFFSET);
+    const SizeT block_count = (row_count + block_capacity_ - 1) / block_capacity_;
+    for (BlockID block_id = 0; block_id < block_count; ++block_id) {
+        auto iter = row_id_map_.find(GlobalBlockID(segment_id, block_id));
+        if (iter == row_id_map_.end()) {
+            continue;
+        }
+        const SegmentOffset block_begin = block_id * block_capacity_;
+        for (const auto &[block_offset, range_row_count, new_row_id] : iter->second) {
+            for (BlockOffset i = 0; i < range_row_count and block_begin + block_offset + i < row_count; ++i) {
+                new_offsets[block_begin + block_offset + i] = new_row_id.segment_offset_ + i;
+            }
+        }
+    }
+    return new_offsets;
+}
+
 class GreedyCompactableSegmentsGenerator {
 public:
     GreedyCompactableSegmentsGenerator(const Vector<SegmentEntry *> &segments, SizeT max_segment_size) : max_segment_size_(max_segment_size) {
@@ -114,8 +137,9 @@ CompactSegmentsTask::CompactSegmentsTask(SharedPtr<BaseTableRef> table_ref, Txn
     : BGTask(BGTaskType::kCompactSegments, false), task_type_(type), table_ref_(table_ref), txn_(txn) {}
 
 void CompactSegmentsTask::Execute() {
+    ScopedLatency compaction_latency(Metrics::instance().compaction_duration_);
     auto state = CompactSegments();
-    CreateNewIndex(state.new_table_ref_.get());
+    CreateNewIndex(state);
     SaveSegmentsData(std::move(state.segment_data_));
     ApplyDeletes(state.remapper_);
 }
@@ -167,18 +191,29 @@ CompactSegmentsTaskState CompactSegmentsTask::CompactSegments() {
     return state;
 }
 
-void CompactSegmentsTask::CreateNewIndex(BaseTableRef *new_table_ref) {
+void CompactSegmentsTask::CreateNewIndex(const CompactSegmentsTaskState &state) {
+    BaseTableRef *new_table_ref = state.new_table_ref_.get();
     auto *table_entry = new_table_ref->table_entry_ptr_;
     TransactionID txn_id = txn_->TxnID();
     TxnTimeStamp begin_ts = txn_->BeginTS();
 
+    // where the rows of each new segment come from
+    HashMap<SegmentID, Vector<CompactedSegmentSource>> compacted_sources;
+    for (const auto &[new_segment, old_segments] : state.segment_data_) {
+        auto &sources = compacted_sources[new_segment->segment_id()];
+        for (auto *old_segment : old_segments) {
+            SegmentID old_segment_id = old_segment->segment_id();
+            sources.push_back(CompactedSegmentSource{old_segment_id, state.remapper_.GetNewSegmentOffsets(old_segment_id, old_segment->row_count())});
+        }
+    }
+
     for (auto &[index_name, table_index_meta] : table_entry->index_meta_map()) {
         auto [table_index_entry, status] = table_index_meta->GetEntry(txn_id, begin_ts);
         if (!status.ok()) {
             // Table index entry isn't found
             RecoverableError(status);
         }
-        txn_->CreateIndexPrepare(table_index_entry, new_table_ref, false, false);
+        txn_->CreateIndexPrepare(table_index_entry, new_table_ref, false, false, &compacted_sources);
     }
 }
 
@@ -241,6 +276,11 @@ SharedPtr<SegmentEntry> CompactSegmentsTask::CompactSegmentsToOne(RowIDRemapper
     BufferManager *buffer_mgr = txn_->buffer_manager();
 
     auto new_block = BlockEntry::NewBlockEntry(new_segment.get(), 0, 0, column_count, txn_);
+    // bytes of a row in column blocks, varchar heaps aren't counted
+    SizeT row_size = 0;
+    for (ColumnID column_id = 0; column_id < column_count; ++column_id) {
+        row_size += table_entry->GetColumnDefByID(column_id)->type()->Size();
+    }
     for (auto *old_segment : segments) {
         BlockEntryIter block_entry_iter(old_segment);
         for (auto *old_block = block_entry_iter.Next(); old_block != nullptr; old_block = block_entry_iter.Next()) {
@@ -258,9 +298,14 @@ SharedPtr<SegmentEntry> CompactSegmentsTask::CompactSegmentsToOne(RowIDRemapper
                 }
 
                 auto block_entry_append = [&](SizeT row_begin, SizeT read_size) {
+                    if (io_limiter_ != nullptr) {
+                        io_limiter_->Request(row_size * read_size);
+                    }
                     new_block->AppendBlock(input_column_vectors, row_begin, read_size, buffer_mgr);
+                    Metrics::instance().compacted_row_count_.Add(read_size);
+                    Metrics::instance().compacted_bytes_.Add(row_size * read_size);
                     RowID new_row_id(new_segment->segment_id(), new_block->block_id() * DEFAULT_BLOCK_CAPACITY + new_block->row_count());
-                    remapper.AddMap(old_segment->segment_id(), old_block->block_id(), row_begin, new_row_id);
+                    remapper.AddMap(old_segment->segment_id(), old_block->block_id(), row_begin, read_size, new_row_id);
                     read_offset = row_begin + read_size;
                 };
 
@@ -29,23 +29,33 @@ namespace infinity {
 
 class TableEntry;
 class SegmentEntry;
+class RateLimiter;
 
 class RowIDRemapper {
 private:
-    using RowIDMap = HashMap<GlobalBlockID, Vector<Pair<BlockOffset, RowID>>, GlobalBlockIDHash>;
+    struct RowIDRange {
+        BlockOffset block_offset_;
+        BlockOffset row_count_;
+        RowID new_row_id_;
+    };
+    using RowIDMap = HashMap<GlobalBlockID, Vector<RowIDRange>, GlobalBlockIDHash>;
 
 public:
     RowIDRemapper(SizeT block_capacity = DEFAULT_BLOCK_CAPACITY) : block_capacity_(block_capacity) {}
 
-    void AddMap(SegmentID segment_id, BlockID block_id, BlockOffset block_offset, RowID new_row_id) {
+    // rows [block_offset, block_offset + row_count) of the block are moved to [new_row_id, new_row_id + row_count)
+    void AddMap(SegmentID segment_id, BlockID block_id, BlockOffset block_offset, BlockOffset row_count, RowID new_row_id) {
         auto &block_vec = row_id_map_[GlobalBlockID(segment_id, block_id)];
-        block_vec.emplace_back(block_offset, new_row_id);
+        block_vec.push_back(RowIDRange{block_offset, row_count, new_row_id});
     }
 
     RowID GetNewRowID(SegmentID segment_id, BlockID block_id, BlockOffset block_offset) const;
 
+    // new segment offset of each row of the old segment, INVALID_SEGMENT_OFFSET for the rows not moved
+    Vector<SegmentOffset> GetNewSegmentOffsets(SegmentID segment_id, SegmentOffset row_count) const;
+
     void AddMap(RowID old_row_id, RowID new_row_id) {
-        AddMap(old_row_id.segment_id_, old_row_id.segment_offset_ / block_capacity_, old_row_id.segment_offset_ % block_capacity_, new_row_id);
+        AddMap(old_row_id.segment_id_, old_row_id.segment_offset_ / block_capacity_, old_row_id.segment_offset_ % block_capacity_, 1, new_row_id);
     }
 
     RowID GetNewRowID(RowID old_row_id) const {
@@ -97,6 +107,9 @@ public:
 
     void CommitTxn() { txn_->txn_mgr()->CommitTxn(txn_); };
 
+    // throttle the data copied into the new segments, the task isn't throttled if not set
+    void SetIOLimiter(RateLimiter *io_limiter) { io_limiter_ = io_limiter; }
+
     void Execute();
 
     // Called by `SegmentEntry::DeleteData` which is called by wal thread in
@@ -107,7 +120,8 @@ public:
     // these two are called by unit test. Do not use them directly.
     CompactSegmentsTaskState CompactSegments();
 
-    void CreateNewIndex(BaseTableRef *table_ref);
+    // Build the indexes of the new segments, hnsw indexes are merged from those of the old segments when possible
+    void CreateNewIndex(const CompactSegmentsTaskState &state);
 
     // Save new segment, set no_delete_ts, add compact wal cmd
     void SaveSegmentsData(Vector<Pair<SharedPtr<SegmentEntry>, Vector<SegmentEntry *>>> &&segment_data);
@@ -128,6 +142,8 @@ private:
 
     Txn *const txn_;
 
+    RateLimiter *io_limiter_{};
+
     std::mutex mutex_;
     Vector<ToDeleteInfo> to_deletes_;
 };
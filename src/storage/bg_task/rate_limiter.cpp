@@ -0,0 +1,66 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <thread>
+
+module rate_limiter;
+
+import stl;
+
+namespace infinity {
+
+RateLimiter::RateLimiter(u64 bytes_per_sec) : bytes_per_sec_(bytes_per_sec), last_refill_time_(Clock::now()) {}
+
+void RateLimiter::Request(u64 bytes) {
+    NanoSeconds wait_time{0};
+    {
+        std::unique_lock lock(mutex_);
+        total_bytes_ += bytes;
+        if (bytes_per_sec_ == 0) {
+            return;
+        }
+        auto now = Clock::now();
+        double refill = static_cast<double>(ElapsedFromStart(now, last_refill_time_).count()) * bytes_per_sec_ / 1e9;
+        available_ = std::min(available_ + refill, static_cast<double>(bytes_per_sec_));
+        last_refill_time_ = now;
+        available_ -= bytes;
+        if (available_ < 0) {
+            wait_time = NanoSeconds(static_cast<i64>(-available_ * 1e9 / bytes_per_sec_));
+        }
+    }
+    if (wait_time.count() > 0) {
+        std::this_thread::sleep_for(wait_time);
+    }
+}
+
+void RateLimiter::SetRate(u64 bytes_per_sec) {
+    std::unique_lock lock(mutex_);
+    bytes_per_sec_ = bytes_per_sec;
+    available_ = 0;
+    last_refill_time_ = Clock::now();
+}
+
+u64 RateLimiter::rate() const {
+    std::unique_lock lock(mutex_);
+    return bytes_per_sec_;
+}
+
+u64 RateLimiter::total_bytes() const {
+    std::unique_lock lock(mutex_);
+    return total_bytes_;
+}
+
+} // namespace infinity
@@ -0,0 +1,48 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module rate_limiter;
+
+import stl;
+
+namespace infinity {
+
+// Token bucket limiting the bytes per second a background job reads or writes.
+// Tokens are refilled continuously, up to one second worth of them. A request larger than the tokens left takes them in advance
+// and sleeps until they are refilled, so the requests of all threads sharing the limiter are queued behind each other.
+export class RateLimiter {
+public:
+    // bytes_per_sec 0 means unlimited
+    explicit RateLimiter(u64 bytes_per_sec);
+
+    void Request(u64 bytes);
+
+    void SetRate(u64 bytes_per_sec);
+
+    [[nodiscard]] u64 rate() const;
+
+    // bytes requested since creation
+    [[nodiscard]] u64 total_bytes() const;
+
+private:
+    mutable std::mutex mutex_{};
+    u64 bytes_per_sec_{};
+    double available_{}; // negative if the tokens are taken in advance
+    u64 total_bytes_{};
+    TimePoint<Clock> last_refill_time_{};
+};
+
+} // namespace infinity
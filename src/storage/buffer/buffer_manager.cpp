@@ -22,6 +22,7 @@ import logger;
 
 import infinity_exception;
 import buffer_obj;
+import metrics;
 
 module buffer_manager;
 
@@ -87,6 +88,8 @@ void BufferManager::RequestSpace(SizeT need_size, BufferObj *buffer_obj) {
             }
             if (buffer_obj1->Free()) {
                 current_memory_size_ -= buffer_obj1->GetBufferSize();
+                Metrics::instance().buffer_eviction_count_.Add();
+                Metrics::instance().buffer_evicted_bytes_.Add(buffer_obj1->GetBufferSize());
             }
         } else {
             UnrecoverableError("Out of memory.");
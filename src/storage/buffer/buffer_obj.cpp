@@ -28,6 +28,14 @@ module buffer_obj;
 
 namespace infinity {
 
+namespace {
+
+thread_local BufferLoadStats thread_buffer_load_stats{};
+
+} // namespace
+
+BufferLoadStats &ThreadBufferLoadStats() { return thread_buffer_load_stats; }
+
 BufferObj::BufferObj(BufferManager *buffer_mgr, bool is_ephemeral, UniquePtr<FileWorker> file_worker)
     : buffer_mgr_(buffer_mgr), file_worker_(std::move(file_worker)) {
     // Init other info
@@ -47,15 +55,16 @@ BufferObj::~BufferObj() = default;
 BufferHandle BufferObj::Load() {
     std::unique_lock<std::shared_mutex> w_locker(rw_locker_);
     switch (status_) {
-        case BufferStatus::kLoaded: {
-            break;
-        }
+        case BufferStatus::kLoaded:
         case BufferStatus::kUnloaded: {
+            ++thread_buffer_load_stats.hit_count_;
             break;
         }
         case BufferStatus::kFreed: {
             buffer_mgr_->RequestSpace(GetBufferSize(), this);
             file_worker_->ReadFromFile(type_ != BufferType::kPersistent);
+            ++thread_buffer_load_stats.miss_count_;
+            thread_buffer_load_stats.read_bytes_ += GetBufferSize();
             if (type_ == BufferType::kEphemeral) {
                 type_ = BufferType::kTemp;
             }
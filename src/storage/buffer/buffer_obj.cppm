@@ -37,6 +37,15 @@ export enum class BufferType {
     kTemp,
 };
 
+// Loads done by the current thread, a hit finds the buffer in memory, a miss reads it from its file.
+export struct BufferLoadStats {
+    u64 hit_count_{};
+    u64 miss_count_{};
+    u64 read_bytes_{};
+};
+
+export BufferLoadStats &ThreadBufferLoadStats();
+
 export class BufferObj {
 public:
     // called by BufferMgr::Get or BufferMgr::Allocate
@@ -0,0 +1,78 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+module bsi_index_file_worker;
+
+import stl;
+import index_file_worker;
+import file_worker;
+
+import logger;
+import bsi;
+import infinity_exception;
+import third_party;
+
+namespace infinity {
+
+BSIIndexFileWorker::~BSIIndexFileWorker() {
+    if (data_ != nullptr) {
+        FreeInMemory();
+        data_ = nullptr;
+    }
+}
+
+void BSIIndexFileWorker::AllocateInMemory() {
+    if (data_) [[unlikely]] {
+        UnrecoverableError("AllocateInMemory: Already allocated.");
+    } else if (auto &data_type = column_def_->type(); data_type->CanBuildBSIIndex()) [[likely]] {
+        data_ = static_cast<void *>(new BitSlicedIndex());
+    } else {
+        UnrecoverableError(fmt::format("Cannot build bsi index on data type: {}", data_type->ToString()));
+    }
+}
+
+void BSIIndexFileWorker::FreeInMemory() {
+    if (data_) [[likely]] {
+        auto index = static_cast<BitSlicedIndex *>(data_);
+        delete index;
+        data_ = nullptr;
+    } else {
+        UnrecoverableError("FreeInMemory: Data is not allocated.");
+    }
+}
+
+void BSIIndexFileWorker::WriteToFileImpl(bool &prepare_success) {
+    if (data_) [[likely]] {
+        auto index = static_cast<BitSlicedIndex *>(data_);
+        index->SaveIndexInner(*file_handler_);
+        prepare_success = true;
+        LOG_TRACE(fmt::format("Finished WriteToFileImpl(bool &prepare_success), bit depth: {}.", index->BitDepth()));
+    } else {
+        UnrecoverableError("WriteToFileImpl: data_ is nullptr");
+    }
+}
+
+void BSIIndexFileWorker::ReadFromFileImpl() {
+    if (!data_) [[likely]] {
+        auto index = new BitSlicedIndex();
+        index->ReadIndexInner(*file_handler_);
+        data_ = static_cast<void *>(index);
+    } else {
+        UnrecoverableError("ReadFromFileImpl: data_ is not nullptr");
+    }
+}
+
+} // namespace infinity
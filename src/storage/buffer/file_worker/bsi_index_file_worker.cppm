@@ -0,0 +1,51 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module bsi_index_file_worker;
+
+import stl;
+import index_file_worker;
+import file_worker;
+
+import index_base;
+import column_def;
+
+namespace infinity {
+
+export struct CreateBSIIndexParam : public CreateIndexParam {
+    CreateBSIIndexParam(const IndexBase *index_base, const ColumnDef *column_def) : CreateIndexParam(index_base, column_def) {}
+};
+
+// One BitSlicedIndex per segment, all slices are kept in one file
+export class BSIIndexFileWorker final : public IndexFileWorker {
+public:
+    explicit BSIIndexFileWorker(SharedPtr<String> file_dir, SharedPtr<String> file_name, const IndexBase *index_base, const ColumnDef *column_def)
+        : IndexFileWorker(file_dir, file_name, index_base, column_def) {}
+
+    virtual ~BSIIndexFileWorker() override final;
+
+public:
+    void AllocateInMemory() override final;
+
+    void FreeInMemory() override final;
+
+protected:
+    void WriteToFileImpl(bool &prepare_success) override final;
+
+    void ReadFromFileImpl() override final;
+};
+
+} // namespace infinity
@@ -274,6 +274,11 @@ void ColumnVector::Initialize(const ColumnVector &other, const Selection &input_
                 UnrecoverableError("Invalid data type");
             }
         }
+        if (!other.nulls_ptr_->IsAllTrue()) {
+            for (SizeT idx = 0; idx < tail_index_; ++idx) {
+                nulls_ptr_->Set(idx, other.nulls_ptr_->IsTrue(input_select[idx]));
+            }
+        }
     }
 }
 
@@ -1167,6 +1172,57 @@ void ColumnVector::AppendByPtr(const_ptr_t value_ptr) {
     }
 }
 
+void ColumnVector::AppendByRawBuffer(const_ptr_t raw_ptr, SizeT count) {
+    if (!initialized) {
+        UnrecoverableError("Column vector isn't initialized.");
+    }
+    if (vector_type_ == ColumnVectorType::kConstant) {
+        UnrecoverableError("Constant column vector can't be appended with raw buffer.");
+    }
+    if (tail_index_ + count > capacity_) {
+        UnrecoverableError(fmt::format("Exceed the column vector capacity.({}/{})", tail_index_ + count, capacity_));
+    }
+
+    switch (data_type_->type()) {
+        case kBoolean: {
+            const auto *bool_ptr = reinterpret_cast<const BooleanT *>(raw_ptr);
+            for (SizeT idx = 0; idx < count; ++idx) {
+                buffer_->SetCompactBit(tail_index_ + idx, bool_ptr[idx]);
+            }
+            break;
+        }
+        case kTinyInt:
+        case kSmallInt:
+        case kInteger:
+        case kBigInt:
+        case kHugeInt:
+        case kFloat:
+        case kDouble:
+        case kDecimal:
+        case kDate:
+        case kTime:
+        case kDateTime:
+        case kTimestamp:
+        case kInterval:
+        case kPoint:
+        case kLine:
+        case kLineSeg:
+        case kBox:
+        case kCircle:
+        case kUuid:
+        case kEmbedding:
+        case kRowID: {
+            SizeT type_size = data_type_->Size();
+            std::memcpy(data_ptr_ + tail_index_ * type_size, raw_ptr, count * type_size);
+            break;
+        }
+        default: {
+            UnrecoverableError(fmt::format("Attempt to append raw buffer into {} column vector", data_type_->ToString()));
+        }
+    }
+    tail_index_ += count;
+}
+
 namespace {
 Vector<std::string_view> SplitArrayElement(std::string_view data, char delimiter) {
     SizeT data_size = data.size();
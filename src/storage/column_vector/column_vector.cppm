@@ -164,6 +164,9 @@ public:
 
     void AppendByPtr(const_ptr_t value_ptr);
 
+    // Append `count` fixed width values laid out back to back in their in-memory representation (one byte per boolean).
+    void AppendByRawBuffer(const_ptr_t raw_ptr, SizeT count);
+
     void AppendByStringView(std::string_view sv, char delimiter);
 
     void AppendWith(const ColumnVector &other, SizeT start_row, SizeT count);
@@ -803,6 +806,8 @@ public:
         return *this;
     }
     auto &operator[](u32 index) { return SetIndex(index); }
+    [[nodiscard]] const VarcharT &GetValue() const { return data_ptr_[idx_]; }
+    [[nodiscard]] FixHeapManager *fix_heap_mgr() const { return fix_heap_mgr_; }
     // Does not check type.
     friend std::strong_ordering ThreeWayCompareReaderValue(const IteratorType &left, const IteratorType &right) {
         const VarcharT &left_value = left.data_ptr_[left.idx_];
@@ -21,6 +21,7 @@ import global_resource_usage;
 import heap_chunk;
 import fix_heap;
 import buffer_handle;
+import memory_tracker;
 
 namespace infinity {
 
@@ -89,6 +90,9 @@ private:
     SizeT data_size_{0};
     SizeT capacity_{0};
 
+    // charged to the query which allocates the buffer
+    TrackedMemory tracked_memory_{};
+
 public:
     VectorBufferType buffer_type_{VectorBufferType::kInvalid};
 
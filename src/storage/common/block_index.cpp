@@ -14,6 +14,8 @@
 
 module;
 
+#include <algorithm>
+
 module block_index;
 
 import stl;
@@ -57,4 +59,38 @@ BlockEntry *BlockIndex::GetBlockEntry(u32 segment_id, u16 block_id) const {
     return nullptr;
 }
 
+void BlockIndex::InsertTxnLocalBlocks(Vector<Pair<SharedPtr<DataBlock>, SizeT>> local_blocks) { local_blocks_ = std::move(local_blocks); }
+
+const DataBlock *BlockIndex::GetLocalBlock(u16 block_id, SizeT &row_count) const {
+    if (block_id >= local_blocks_.size()) {
+        return nullptr;
+    }
+    row_count = local_blocks_[block_id].second;
+    return local_blocks_[block_id].first.get();
+}
+
+void BlockIndex::InsertTxnLocalDeletes(const HashMap<SegmentID, HashMap<BlockID, Vector<BlockOffset>>> &local_deletes) {
+    local_deletes_ = local_deletes;
+    for (auto &[segment_id, block_deletes] : local_deletes_) {
+        for (auto &[block_id, block_offsets] : block_deletes) {
+            std::sort(block_offsets.begin(), block_offsets.end());
+            block_offsets.erase(std::unique(block_offsets.begin(), block_offsets.end()), block_offsets.end());
+        }
+    }
+}
+
+const Vector<BlockOffset> *BlockIndex::GetLocalDeletes(u32 segment_id, u16 block_id) const {
+    const HashMap<BlockID, Vector<BlockOffset>> *block_deletes = GetSegmentLocalDeletes(segment_id);
+    if (block_deletes == nullptr) {
+        return nullptr;
+    }
+    auto block_it = block_deletes->find(block_id);
+    return block_it == block_deletes->end() ? nullptr : &block_it->second;
+}
+
+const HashMap<BlockID, Vector<BlockOffset>> *BlockIndex::GetSegmentLocalDeletes(u32 segment_id) const {
+    auto seg_it = local_deletes_.find(segment_id);
+    return seg_it == local_deletes_.end() ? nullptr : &seg_it->second;
+}
+
 } // namespace infinity
@@ -23,6 +23,7 @@ namespace infinity {
 
 struct BlockEntry;
 struct SegmentEntry;
+class DataBlock;
 
 export struct BlockIndex {
     void Insert(SegmentEntry *segment_entry, TxnTimeStamp timestamp, bool check_ts = true);
@@ -35,10 +36,33 @@ export struct BlockIndex {
 
     BlockEntry *GetBlockEntry(u32 segment_id, u16 block_id) const;
 
+    // Blocks the querying transaction has appended but not committed, with the row counts visible to the query.
+    // Scans read them after the committed blocks, as segment TXN_LOCAL_SEGMENT_ID.
+    void InsertTxnLocalBlocks(Vector<Pair<SharedPtr<DataBlock>, SizeT>> local_blocks);
+
+    inline SizeT LocalBlockCount() const { return local_blocks_.size(); }
+
+    // nullptr if there is no such block
+    const DataBlock *GetLocalBlock(u16 block_id, SizeT &row_count) const;
+
+    // Rows of committed blocks the querying transaction has deleted but not committed, e.g. the old rows of its updates.
+    // Scans skip them like the rows deleted by committed transactions.
+    void InsertTxnLocalDeletes(const HashMap<SegmentID, HashMap<BlockID, Vector<BlockOffset>>> &local_deletes);
+
+    inline bool HasLocalDeletes() const { return !local_deletes_.empty(); }
+
+    // Sorted block offsets, nullptr if the transaction hasn't deleted rows of the block
+    const Vector<BlockOffset> *GetLocalDeletes(u32 segment_id, u16 block_id) const;
+
+    // nullptr if the transaction hasn't deleted rows of the segment
+    const HashMap<BlockID, Vector<BlockOffset>> *GetSegmentLocalDeletes(u32 segment_id) const;
+
     Vector<SegmentEntry *> segments_;
     HashMap<SegmentID, SegmentEntry *> segment_index_;
     HashMap<SegmentID, HashMap<BlockID, BlockEntry *>> segment_block_index_;
     Vector<GlobalBlockID> global_blocks_;
+    Vector<Pair<SharedPtr<DataBlock>, SizeT>> local_blocks_;
+    HashMap<SegmentID, HashMap<BlockID, Vector<BlockOffset>>> local_deletes_;
 };
 
 } // namespace infinity
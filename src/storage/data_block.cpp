@@ -55,6 +55,35 @@ void DataBlock::Init(const DataBlock *input, const SharedPtr<Selection> &input_s
 
 void DataBlock::Init(const SharedPtr<DataBlock> &input, const SharedPtr<Selection> &input_select) { Init(input.get(), input_select); }
 
+void DataBlock::InitShared(const DataBlock *input, const SharedPtr<Selection> &input_select) {
+    if (initialized) {
+        UnrecoverableError("Data block was initialized before.");
+    }
+    if (input == nullptr) {
+        UnrecoverableError("Invalid input data block");
+    }
+    column_count_ = input->column_count();
+    if (column_count_ == 0) {
+        UnrecoverableError("Empty column vectors.");
+    }
+    column_vectors = input->column_vectors;
+    capacity_ = input->capacity_;
+    row_count_ = input->row_count_;
+    if (input->selection_.get() == nullptr) {
+        selection_ = input_select;
+    } else if (input_select.get() == nullptr) {
+        selection_ = input->selection_;
+    } else {
+        selection_ = MakeShared<Selection>();
+        selection_->Initialize(input_select->Size());
+        for (SizeT idx = 0; idx < input_select->Size(); ++idx) {
+            selection_->Append(input->selection_->Get(input_select->Get(idx)));
+        }
+    }
+    initialized = true;
+    finalized = true;
+}
+
 void DataBlock::Init(const SharedPtr<DataBlock> &input, SizeT start_idx, SizeT end_idx) {
     if (initialized) {
         UnrecoverableError("Data block was initialized before.");
@@ -133,6 +162,7 @@ void DataBlock::UnInit() {
     column_vectors.clear();
 
     row_count_ = 0;
+    selection_.reset();
     initialized = false;
     finalized = false;
 }
@@ -153,6 +183,7 @@ void DataBlock::Reset() {
     }
 
     row_count_ = 0;
+    selection_.reset();
     finalized = false;
 }
 
@@ -171,6 +202,7 @@ void DataBlock::Reset(SizeT capacity) {
         column_vectors[i]->Initialize(old_vector_type, capacity);
     }
     row_count_ = 0;
+    selection_.reset();
     capacity_ = capacity;
     finalized = false;
 }
@@ -41,6 +41,10 @@ public:
 
     void Init(const SharedPtr<DataBlock> &input, const SharedPtr<Selection> &input_select);
 
+    // Share the column vectors of input instead of copying the selected rows, only the rows in input_select are valid.
+    // A null input_select means all rows are valid. If input has a selection too, input_select indexes its selected rows.
+    void InitShared(const DataBlock *input, const SharedPtr<Selection> &input_select);
+
     void Init(const SharedPtr<DataBlock> &input, SizeT start_idx, SizeT end_idx);
 
     static SharedPtr<DataBlock> MoveFrom(SharedPtr<DataBlock> &input);
@@ -108,6 +112,12 @@ public:
         return types;
     }
 
+    // Valid rows of a block made by InitShared, row_count() still counts all the rows of the shared column vectors.
+    // Only the operators which honor it are given such a block, see PhysicalFilter.
+    [[nodiscard]] inline const SharedPtr<Selection> &selection() const { return selection_; }
+
+    [[nodiscard]] inline SizeT selected_row_count() const { return selection_.get() == nullptr ? row_count() : selection_->Size(); }
+
     [[nodiscard]] inline SizeT capacity() const { return capacity_; }
     [[nodiscard]] inline SizeT available_capacity() const { return capacity_ - row_count_; }
 
@@ -125,6 +135,7 @@ public:
 
 private:
     u16 row_count_{0};
+    SharedPtr<Selection> selection_{};
     SizeT column_count_{0};
     SizeT capacity_{0};
     bool initialized = false;
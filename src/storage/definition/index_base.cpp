@@ -25,6 +25,7 @@ import index_ivfflat;
 import index_hnsw;
 import index_full_text;
 import index_secondary;
+import index_bsi;
 import third_party;
 
 import infinity_exception;
@@ -124,6 +125,10 @@ SharedPtr<IndexBase> IndexBase::ReadAdv(char *&ptr, int32_t maxbytes) {
             res = MakeShared<IndexSecondary>(std::move(file_name), std::move(column_names));
             break;
         }
+        case IndexType::kBSI: {
+            res = MakeShared<IndexBSI>(std::move(file_name), std::move(column_names));
+            break;
+        }
         case IndexType::kInvalid: {
             UnrecoverableError("Error index method while reading");
         }
@@ -193,6 +198,11 @@ SharedPtr<IndexBase> IndexBase::Deserialize(const nlohmann::json &index_def_json
             res = std::static_pointer_cast<IndexBase>(ptr);
             break;
         }
+        case IndexType::kBSI: {
+            auto ptr = MakeShared<IndexBSI>(std::move(file_name), std::move(column_names));
+            res = std::static_pointer_cast<IndexBase>(ptr);
+            break;
+        }
         case IndexType::kInvalid: {
             UnrecoverableError("Error index method while deserializing");
         }
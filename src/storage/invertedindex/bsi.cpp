@@ -1,283 +1,146 @@
-module;
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
 
-import stl;
+module;
 
-#include <roaring/roaring.hh>
+#include <algorithm>
+#include <bit>
 
 module bsi;
 
+import stl;
+import third_party;
+import file_system;
+import infinity_exception;
+
 namespace infinity {
 
-u32 float_to_u32(float v) {
-    u32 iv = 0;
-    memcpy(&iv, &v, sizeof(v));
-    if (v >= 0) {
-        iv |= (0x80000000);
-    } else {
-        iv = (~iv);
-    }
-    return iv;
-}
+namespace {
 
-float u32_to_float(u32 v) {
-    if ((v & 0x80000000) > 0) {
-        v &= (~0x80000000);
-    } else {
-        v = (~v);
-    }
-    float d;
-    memcpy(&d, &v, sizeof(v));
-    return d;
+void SaveBitmap(FileHandler &file_handler, const RoaringBitmap &bitmap) {
+    u64 size = bitmap.getSizeInBytes();
+    auto buffer = MakeUniqueForOverwrite<char[]>(size);
+    bitmap.write(buffer.get());
+    file_handler.Write(&size, sizeof(size));
+    file_handler.Write(buffer.get(), size);
 }
 
-u64 double_to_u64(double v) {
-    u64 iv = 0;
-    memcpy(&iv, &v, sizeof(v));
-    if (v >= 0) {
-        iv |= (0x8000000000000000ull);
-    } else {
-        iv = (~iv);
-    }
-    return iv;
-}
-
-double u64_to_double(u64 v) {
-    if ((v & 0x8000000000000000ull) > 0) {
-        v &= (~0x8000000000000000ull);
-    } else {
-        v = (~v);
-    }
-    double d;
-    memcpy(&d, &v, sizeof(v));
-    return d;
+RoaringBitmap ReadBitmap(FileHandler &file_handler) {
+    u64 size{};
+    file_handler.Read(&size, sizeof(size));
+    auto buffer = MakeUniqueForOverwrite<char[]>(size);
+    file_handler.Read(buffer.get(), size);
+    return RoaringBitmap::readSafe(buffer.get(), size);
 }
 
-BitSlicedIndex::BitSlicedIndex(u64 schema_id, u64 table_id, u64 column_id) : schema_id_(schema_id), table_id_(table_id), column_id_(column_id) {}
-
-BitSlicedIndex::~BitSlicedIndex() {}
-
-bool BitSlicedIndex::DoPut(u32 id, u64 val, u64 &old_val) {
-    bool inserted = bitmaps_[0]->addChecked(id); // set Not NULL bitmap
-    if (inserted) {
-        u64 set_val = val;
-        for (i8 i = 0; i < bit_depth_; i++) {
-            if (set_val & (1ull << i)) {
-                bitmaps_[i + 1]->add(id);
-            } else {
-                bitmaps_[i + 1]->remove(id);
-            }
-        }
-        return false;
-    } else {
-        old_val = 0;
-        u64 set_val = val;
-        for (i8 i = 0; i < bit_depth_; i++) {
-            if (bitmaps_[1 + i]->contains(id)) {
-                old_val += (1ull << i);
-            }
-            if (set_val & (1ull << i)) {
-                bitmaps_[1 + i]->add(id);
-            } else {
-                bitmaps_[1 + i]->remove(id);
+} // namespace
+
+void BitSlicedIndex::Build(const Vector<u32> &offsets, const Vector<i64> &keys, u32 segment_row_count) {
+    if (offsets.size() != keys.size()) {
+        UnrecoverableError("BitSlicedIndex::Build(): offsets and keys size mismatch.");
+    }
+    segment_row_count_ = segment_row_count;
+    existence_ = RoaringBitmap();
+    slices_.clear();
+    if (keys.empty()) {
+        return;
+    }
+    auto [min_iter, max_iter] = std::minmax_element(keys.begin(), keys.end());
+    min_key_ = *min_iter;
+    max_key_ = *max_iter;
+    existence_.addMany(offsets.size(), offsets.data());
+    existence_.runOptimize();
+    // keys are stored relative to min_key_, the subtraction can't overflow in u64
+    const u64 key_range = static_cast<u64>(max_key_) - static_cast<u64>(min_key_);
+    slices_.resize(std::bit_width(key_range));
+    Vector<u32> slice_offsets;
+    slice_offsets.reserve(offsets.size());
+    for (u32 bit = 0; bit < slices_.size(); ++bit) {
+        slice_offsets.clear();
+        for (SizeT i = 0; i < keys.size(); ++i) {
+            if (((static_cast<u64>(keys[i]) - static_cast<u64>(min_key_)) >> bit) & 1) {
+                slice_offsets.push_back(offsets[i]);
             }
         }
-        return true;
-    }
-}
-
-void BitSlicedIndex::DoRemove(u32 id, u64 val) {
-    bitmaps_[0]->remove(id);
-    u64 set_val = val;
-    for (i8 i = 0; i < bit_depth_; i++) {
-        if (set_val & (1ull << i)) {
-            bitmaps_[i + 1]->remove(id);
-        }
+        slices_[bit].addMany(slice_offsets.size(), slice_offsets.data());
+        slices_[bit].runOptimize();
     }
 }
 
-bool BitSlicedIndex::DoGet(u32 id, u64 &val) {
-    if (!bitmaps_[0]->contains(id)) {
-        return false;
-    }
-    val = 0;
-    for (i8 i = 0; i < bit_depth_; i++) {
-        if (bitmaps_[1 + i]->contains(id)) {
-            val += (1ull << i);
-        }
-    }
-    return true;
-}
-
-int BitSlicedIndex::DoRangeLT(u64 expect_val, bool allow_eq, UniquePtr<Roaring> &filter) {
-    if (filter->isEmpty()) {
-        (*filter) = (*bitmaps_[0]);
-    } else {
-        (*filter) &= (*bitmaps_[0]);
-    }
-    bool leading_zero = true;
-    UniquePtr<Roaring> keep = MakeUnique<Roaring>();
-    UniquePtr<Roaring> tmp = MakeUnique<Roaring>();
-    for (i8 i = bit_depth_ - 1; i >= 0; i--) {
-        u8 bit = (expect_val >> i) & 0x1;
-        if (leading_zero) {
-            if (bit == 0) {
-                (*filter) &= (*bitmaps_[1 + i]);
-                continue;
-            } else {
-                leading_zero = false;
-            }
-        }
-
-        if (i == 0 && !allow_eq) {
-            if (bit == 0) {
-                (*filter) = (*keep);
-                return 0;
-            } else {
-                (*keep) ^= (*bitmaps_[1 + i]);
-                (*keep) -= (*bitmaps_[1 + i]);
-                (*filter) -= (*keep);
-                return 0;
-            }
-        }
-
-        // If bit is zero then remove all set columns not in excluded bitmap.
-        if (bit == 0) {
-            (*tmp) = (*bitmaps_[1 + i]);
-            (*tmp) -= (*keep);
-            (*filter) -= (*tmp);
-            continue;
-        }
-
-        // If bit is set then add columns for set bits to exclude.
-        // Don't bother to compute this on the final iteration.
-        if (i > 0) {
-            (*tmp) = (*filter);
-            (*tmp) -= (*bitmaps_[1 + i]);
-            (*keep) |= (*tmp);
-        }
-    }
-    return 0;
-}
-
-int BitSlicedIndex::DoRangeGT(u64 expect_val, bool allow_eq, UniquePtr<Roaring> &filter) {
-    if (filter->isEmpty()) {
-        (*filter) = (*bitmaps_[0]);
-    } else {
-        (*filter) &= (*bitmaps_[0]);
-    }
-
-    UniquePtr<Roaring> keep = MakeUnique<Roaring>();
-    UniquePtr<Roaring> tmp = MakeUnique<Roaring>();
-    for (i8 i = bit_depth_ - 1; i >= 0; i--) {
-        u8 bit = (expect_val >> i) & 0x1;
-        // Handle last bit differently.
-        // If bit is one then return only already kept columns.
-        // If bit is zero then remove any unset columns.
-        if (i == 0 && !allow_eq) {
-            if (bit == 1) {
-                (*filter) = (*keep);
-                return 0;
-            }
-            (*tmp) = (*filter);
-            (*tmp) -= (*bitmaps_[1 + i]);
-            (*tmp) -= (*keep);
-            (*filter) -= (*tmp);
-            return 0;
-        }
-
-        // If bit is set then remove all unset columns not already kept.
-        if (bit == 1) {
-            (*tmp) = (*filter);
-            (*tmp) -= (*bitmaps_[1 + i]);
-            (*tmp) -= (*keep);
-            (*filter) -= (*tmp);
-            continue;
-        }
-        // If bit is unset then add columns with set bit to keep.
-        // Don't bother to compute this on the final iteration.
-        if (i > 0) {
-            (*tmp) = (*filter);
-            (*tmp) &= (*bitmaps_[1 + i]);
-            (*keep) |= (*tmp);
-        }
-    }
-    return 0;
-}
-
-int BitSlicedIndex::DoRangeEQ(u64 expect_val, UniquePtr<Roaring> &filter) {
-    if (filter->isEmpty()) {
-        (*filter) = (*bitmaps_[0]);
-    } else {
-        (*filter) &= (*bitmaps_[0]);
-    }
-    for (int32_t i = bit_depth_ - 1; i >= 0; i--) {
-        uint8_t bit = (expect_val >> i) & 0x1;
-        if (bit) {
-            (*filter) &= (*bitmaps_[1 + i]);
+void BitSlicedIndex::Compare(u64 value, RoaringBitmap &less, RoaringBitmap &greater) const {
+    // rows whose higher bits all equal those of value
+    RoaringBitmap equal = existence_;
+    for (u32 bit = slices_.size(); bit-- > 0 and !equal.isEmpty();) {
+        const RoaringBitmap &slice = slices_[bit];
+        if ((value >> bit) & 1) {
+            less |= equal - slice;
+            equal &= slice;
         } else {
-            (*filter) -= (*bitmaps_[1 + i]);
+            greater |= equal & slice;
+            equal -= slice;
         }
     }
-    return 0;
 }
 
-int BitSlicedIndex::DoRangeNEQ(u64 expect, UniquePtr<Roaring> &filter) {
-    (*filter) = (*bitmaps_[0]);
-    UniquePtr<Roaring> eq = MakeUnique<Roaring>();
-    DoRangeEQ(expect, eq);
-    (*filter) -= (*eq);
-    return 0;
+RoaringBitmap BitSlicedIndex::RangeBetween(i64 lower, i64 upper) const {
+    if (existence_.isEmpty() or lower > upper or upper < min_key_ or lower > max_key_) {
+        return RoaringBitmap();
+    }
+    const u64 stored_lower = static_cast<u64>(std::max(lower, min_key_)) - static_cast<u64>(min_key_);
+    const u64 stored_upper = static_cast<u64>(std::min(upper, max_key_)) - static_cast<u64>(min_key_);
+    const u64 stored_max = static_cast<u64>(max_key_) - static_cast<u64>(min_key_);
+    RoaringBitmap result = existence_;
+    if (stored_lower > 0) {
+        RoaringBitmap less, greater;
+        Compare(stored_lower, less, greater);
+        result -= less;
+    }
+    if (stored_upper < stored_max) {
+        RoaringBitmap less, greater;
+        Compare(stored_upper, less, greater);
+        result -= greater;
+    }
+    return result;
 }
 
-int BitSlicedIndex::DoRangeBetween(u64 expect_min, u64 expect_max, UniquePtr<Roaring> &filter) {
-    if (filter->isEmpty()) {
-        (*filter) = (*bitmaps_[0]);
-    } else {
-        (*filter) &= (*bitmaps_[0]);
+void BitSlicedIndex::SaveIndexInner(FileHandler &file_handler) const {
+    u32 bit_depth = slices_.size();
+    file_handler.Write(&segment_row_count_, sizeof(segment_row_count_));
+    file_handler.Write(&min_key_, sizeof(min_key_));
+    file_handler.Write(&max_key_, sizeof(max_key_));
+    file_handler.Write(&bit_depth, sizeof(bit_depth));
+    SaveBitmap(file_handler, existence_);
+    for (const auto &slice : slices_) {
+        SaveBitmap(file_handler, slice);
     }
+}
 
-    UniquePtr<Roaring> keep1 = MakeUnique<Roaring>();
-    UniquePtr<Roaring> keep2 = MakeUnique<Roaring>();
-    UniquePtr<Roaring> tmp = MakeUnique<Roaring>();
-
-    for (i8 i = bit_depth_ - 1; i >= 0; i--) {
-        auto row = bitmaps_[1 + i];
-        u8 bit1 = (expect_min >> i) & 0x1;
-        u8 bit2 = (expect_max >> i) & 0x1;
-        // GTE predicateMin
-        // If bit is set then remove all unset columns not already kept.
-        if (bit1 == 1) {
-            (*tmp) = (*filter);
-            (*tmp) -= (*row);
-            (*tmp) -= (*keep1);
-            (*filter) -= (*tmp);
-        } else {
-            // If bit is unset then add columns with set bit to keep.
-            // Don't bother to compute this on the final iteration.
-            if (i > 0) {
-                (*tmp) = (*filter);
-                (*tmp) -= (*row);
-                (*keep1) |= (*tmp);
-            }
-        }
-
-        // LTE predicateMax
-        // If bit is zero then remove all set bits not in excluded bitmap.
-        if (bit2 == 0) {
-            (*tmp) = (*row);
-            (*tmp) -= (*keep2);
-            (*filter) -= (*tmp);
-        } else {
-            // If bit is set then add columns for set bits to exclude.
-            // Don't bother to compute this on the final iteration.
-            if (i > 0) {
-                (*tmp) = (*filter);
-                (*tmp) -= (*row);
-                (*keep2) |= (*tmp);
-            }
-        }
+void BitSlicedIndex::ReadIndexInner(FileHandler &file_handler) {
+    u32 bit_depth{};
+    file_handler.Read(&segment_row_count_, sizeof(segment_row_count_));
+    file_handler.Read(&min_key_, sizeof(min_key_));
+    file_handler.Read(&max_key_, sizeof(max_key_));
+    file_handler.Read(&bit_depth, sizeof(bit_depth));
+    if (bit_depth > 64) {
+        UnrecoverableError(fmt::format("BitSlicedIndex::ReadIndexInner(): invalid bit depth: {}.", bit_depth));
+    }
+    existence_ = ReadBitmap(file_handler);
+    slices_.clear();
+    slices_.reserve(bit_depth);
+    for (u32 bit = 0; bit < bit_depth; ++bit) {
+        slices_.emplace_back(ReadBitmap(file_handler));
     }
-    return 0;
 }
 
-} // namespace infinity
\ No newline at end of file
+} // namespace infinity
@@ -1,44 +1,64 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
 module;
 
 export module bsi;
 
 import stl;
-
-namespace roaring {
-class Roaring;
-}
+import third_party;
+import file_system;
 
 namespace infinity {
 
-using Roaring = roaring::Roaring;
-
-class BitSlicedIndex {
+// Bit-sliced index of one integer column in one segment.
+// A key is stored as (key - min_key_), bit i of it is kept in slices_[i] as a bitmap of segment offsets.
+// Rows without key (null or deleted when the index is built) are not in existence_.
+// Range queries walk the slices from the highest bit, so they cost O(bit depth) bitmap operations whatever the selectivity.
+export class BitSlicedIndex {
 public:
-    BitSlicedIndex(u64 schema_id, u64 table_id, u64 column_id);
+    BitSlicedIndex() = default;
 
-    ~BitSlicedIndex();
+    // offsets must be ascending, keys[i] is the key of the row at offsets[i]
+    // segment_row_count: rows of the segment when the index is built, deleted rows included
+    void Build(const Vector<u32> &offsets, const Vector<i64> &keys, u32 segment_row_count);
 
-    bool DoPut(u32 id, u64 val, u64 &old_val);
+    // rows with lower <= key <= upper
+    RoaringBitmap RangeBetween(i64 lower, i64 upper) const;
 
-    void DoRemove(u32 id, u64 val);
+    RoaringBitmap RangeEqual(i64 key) const { return RangeBetween(key, key); }
 
-    bool DoGet(u32 id, u64 &val);
+    [[nodiscard]] inline u32 DataNum() const { return existence_.cardinality(); }
 
-    int DoRangeLT(u64 expect, bool allow_eq, UniquePtr<Roaring> &filter);
+    [[nodiscard]] inline u32 BitDepth() const { return slices_.size(); }
 
-    int DoRangeGT(u64 expect, bool allow_eq, UniquePtr<Roaring> &filter);
+    // rows after it are appended later and not in the index
+    [[nodiscard]] inline u32 SegmentRowCount() const { return segment_row_count_; }
 
-    int DoRangeEQ(u64 expect, UniquePtr<Roaring> &filter);
+    void SaveIndexInner(FileHandler &file_handler) const;
 
-    int DoRangeNEQ(u64 expect, UniquePtr<Roaring> &filter);
-
-    int DoRangeBetween(u64 min, u64 max, UniquePtr<Roaring> &filter);
+    void ReadIndexInner(FileHandler &file_handler);
 
 private:
-    u64 schema_id_;
-    u64 table_id_;
-    u64 column_id_;
-    Vector<SharedPtr<Roaring>> bitmaps_;
-    u8 bit_depth_ = 0;
+    // rows whose stored value is less than / greater than value
+    void Compare(u64 value, RoaringBitmap &less, RoaringBitmap &greater) const;
+
+    u32 segment_row_count_{};
+    i64 min_key_{};
+    i64 max_key_{};
+    RoaringBitmap existence_;
+    Vector<RoaringBitmap> slices_;
 };
-} // namespace infinity
\ No newline at end of file
+
+} // namespace infinity
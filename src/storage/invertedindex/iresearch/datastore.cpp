@@ -16,8 +16,11 @@ module;
 
 #include <atomic>
 #include <chrono>
+#include <cmath>
 #include <ctpl_stl.h>
 #include <filesystem>
+#include <future>
+#include <limits>
 
 #include "formats/formats.hpp"
 #include "index/segment_writer.hpp"
@@ -61,6 +64,7 @@ import local_file_system;
 import buffer_manager;
 import index_full_text;
 import infinity_exception;
+import status;
 import internal_types;
 import match_expr;
 import segment_iter;
@@ -449,7 +453,98 @@ const ViewSegment &ViewSnapshot::GetSegment(SizeT i) noexcept { return segments_
 
 enum class ExecutionMode { kAll, kStrictTop, kTop };
 
-int IRSDataStore::Search(IrsFilter *flt, const Map<String, String> &options, ScoredIds &sorted) {
+namespace {
+
+// the better result first, doc id breaks ties of the score
+bool BetterScoredId(const ScoredId &lhs, const ScoredId &rhs) noexcept {
+    return lhs.first > rhs.first || (lhs.first == rhs.first && lhs.second < rhs.second);
+}
+
+// The threads searching the index segments, shared by all the searches instead of a pool per search
+ThreadPool &SearchThreadPool() {
+    static ThreadPool pool(static_cast<int>(std::max<u32>(Thread::hardware_concurrency(), 1)));
+    return pool;
+}
+
+// The score of doc_id, if it is a result of the filter in the segment
+Optional<float> ScoreDoc(const irs::filter::prepared &filter,
+                         const IRSSubReader &segment,
+                         const irs::Scorers &order,
+                         const irs::WandContext &wand,
+                         u32 doc_id) {
+    auto docs = filter.execute(irs::ExecutionContext{.segment = segment, .scorers = order, .wand = wand});
+    IRS_ASSERT(docs);
+    if (docs->seek(doc_id) != doc_id) {
+        return None;
+    }
+    float_t score_value;
+    (*irs::get<irs::score>(*docs))(&score_value);
+    return score_value;
+}
+
+// Searches one segment into heap, a heap of at most heap_size results whose front is the worst result kept.
+// min_score is shared by the searches of all segments: once a heap is full its worst score is a lower bound of the final results,
+// so every search prunes docs below the best bound known by WAND.
+void SearchSegment(const irs::filter::prepared &filter,
+                   const IRSSubReader &segment,
+                   const irs::Scorers &order,
+                   const irs::WandContext &wand,
+                   const Optional<ScoredId> &after,
+                   const RoaringBitmap *deleted_docs,
+                   SizeT heap_size,
+                   Atomic<float> &min_score,
+                   ScoredIds &heap) {
+    auto docs = filter.execute(irs::ExecutionContext{.segment = segment, .scorers = order, .wand = wand});
+    IRS_ASSERT(docs);
+
+    const irs::document *doc = irs::get<irs::document>(*docs);
+    const irs::score *score = irs::get<irs::score>(*docs);
+    auto *threshold = irs::get_mutable<irs::score>(docs.get());
+    float applied_min_score = std::numeric_limits<float>::lowest();
+    auto raise_min_score = [&](float bound) {
+        float shared = min_score.load(std::memory_order_relaxed);
+        while (shared < bound && !min_score.compare_exchange_weak(shared, bound, std::memory_order_relaxed)) {
+        }
+    };
+
+    for (float_t score_value; docs->next();) {
+        if (float shared = min_score.load(std::memory_order_relaxed); threshold && shared > applied_min_score) {
+            // WAND skips the docs scoring up to the threshold, but a doc tied with the bound may still be kept for its doc id
+            threshold->Min(std::nextafter(shared, std::numeric_limits<float>::lowest()));
+            applied_min_score = shared;
+        }
+        if (deleted_docs != nullptr && deleted_docs->contains(doc->value)) {
+            continue;
+        }
+        (*score)(&score_value);
+        ScoredId candidate(score_value, doc->value);
+        if (after.has_value() && !BetterScoredId(after.value(), candidate)) {
+            // on the previous pages
+            continue;
+        }
+        if (heap.size() < heap_size) {
+            heap.push_back(candidate);
+            std::push_heap(std::begin(heap), std::end(heap), BetterScoredId);
+            if (heap.size() == heap_size) {
+                raise_min_score(heap.front().first);
+            }
+        } else if (BetterScoredId(candidate, heap.front())) {
+            std::pop_heap(std::begin(heap), std::end(heap), BetterScoredId);
+            heap.back() = candidate;
+            std::push_heap(std::begin(heap), std::end(heap), BetterScoredId);
+            raise_min_score(heap.front().first);
+        }
+    }
+}
+
+} // namespace
+
+int IRSDataStore::Search(IrsFilter *flt,
+                         const Map<String, String> &options,
+                         const SearchPage &page,
+                         SizeT parallelism,
+                         const RoaringBitmap *deleted_docs,
+                         ScoredIds &sorted) {
     irs::WandContext wand{.index = 0, .strict = false};
 
     String scorer(DEFAULT_SCORER);
@@ -476,63 +571,63 @@ int IRSDataStore::Search(IrsFilter *flt, const Map<String, String> &options, Sco
         .scorers = order,
     });
 
-    SizeT topn(DEFAULT_TOPN);
-    if (auto it = options.find("topn"); it != options.end()) {
-        topn = std::stoi(it->second);
+    const SizeT heap_size = page.offset_ + page.topn_;
+    Vector<const IRSSubReader *> segments;
+    segments.reserve(reader->size());
+    for (auto &segment : reader) {
+        segments.push_back(&segment);
     }
-
-    sorted.reserve(topn);
-    for (auto left = topn; auto &segment : reader) {
-        auto docs = filter->execute(irs::ExecutionContext{.segment = segment, .scorers = order, .wand = wand});
-        IRS_ASSERT(docs);
-
-        const irs::document *doc = irs::get<irs::document>(*docs);
-        const irs::score *score = irs::get<irs::score>(*docs);
-        auto *threshold = irs::get_mutable<irs::score>(docs.get());
-        if (!left && threshold) {
-            IRS_ASSERT(!sorted.empty());
-            IRS_ASSERT(std::is_heap(std::begin(sorted),
-                                    std::end(sorted),
-                                    [](const std::pair<float_t, irs::doc_id_t> &lhs, const std::pair<float_t, irs::doc_id_t> &rhs) noexcept {
-                                        return lhs.first > rhs.first;
-                                    }));
-            threshold->Min(sorted.front().first);
-        }
-
-        for (float_t score_value; docs->next();) {
-            (*score)(&score_value);
-            if (left) {
-                sorted.emplace_back(score_value, doc->value);
-                if (0 == --left) {
-                    std::make_heap(std::begin(sorted),
-                                   std::end(sorted),
-                                   [](const std::pair<float_t, irs::doc_id_t> &lhs, const std::pair<float_t, irs::doc_id_t> &rhs) noexcept {
-                                       return lhs.first > rhs.first;
-                                   });
-                    threshold->Min(sorted.front().first);
-                }
-            } else if (sorted.front().first < score_value) {
-                std::pop_heap(std::begin(sorted),
-                              std::end(sorted),
-                              [](const std::pair<float_t, irs::doc_id_t> &lhs, const std::pair<float_t, irs::doc_id_t> &rhs) noexcept {
-                                  return lhs.first > rhs.first;
-                              });
-                auto &[score, doc_id] = sorted.back();
-                score = score_value;
-                doc_id = doc->value;
-                std::push_heap(std::begin(sorted),
-                               std::end(sorted),
-                               [](const std::pair<float_t, irs::doc_id_t> &lhs, const std::pair<float_t, irs::doc_id_t> &rhs) noexcept {
-                                   return lhs.first > rhs.first;
-                               });
-                threshold->Min(sorted.front().first);
+    Optional<ScoredId> after;
+    if (page.after_doc_.has_value()) {
+        const u32 after_doc = page.after_doc_.value();
+        for (const IRSSubReader *segment : segments) {
+            if (Optional<float> after_score = ScoreDoc(*filter, *segment, order, wand, after_doc); after_score.has_value()) {
+                after = ScoredId(after_score.value(), after_doc);
+                break;
             }
         }
+        if (!after.has_value()) {
+            RecoverableError(
+                Status::SyntaxError(fmt::format("Match option after={} isn't a result of the query.", DocID2RowID(after_doc).ToUint64())));
+        }
+    }
+    Atomic<float> min_score{std::numeric_limits<float>::lowest()};
+    parallelism = std::clamp<SizeT>(parallelism, 1, std::max<SizeT>(segments.size(), 1));
+    // each worker takes the next segment not searched yet and keeps its own top-n heap, merged at last
+    Vector<ScoredIds> heaps(parallelism);
+    Atomic<SizeT> next_segment{0};
+    auto search_segments = [&](SizeT worker_idx) {
+        ScoredIds &heap = heaps[worker_idx];
+        heap.reserve(std::min<SizeT>(heap_size, DEFAULT_BLOCK_CAPACITY));
+        for (SizeT segment_idx = next_segment++; segment_idx < segments.size(); segment_idx = next_segment++) {
+            SearchSegment(*filter, *segments[segment_idx], order, wand, after, deleted_docs, heap_size, min_score, heap);
+        }
+    };
+    if (parallelism == 1) {
+        search_segments(0);
+    } else {
+        ThreadPool &pool = SearchThreadPool();
+        Vector<std::future<void>> futures;
+        for (SizeT worker_idx = 1; worker_idx < parallelism; ++worker_idx) {
+            futures.emplace_back(pool.push([&, worker_idx](int) { search_segments(worker_idx); }));
+        }
+        // the caller searches too, so the search goes on while the pool threads are busy with other searches
+        search_segments(0);
+        for (auto &future : futures) {
+            future.get();
+        }
+    }
+
+    sorted.clear();
+    for (auto &heap : heaps) {
+        sorted.insert(sorted.end(), heap.begin(), heap.end());
+    }
+    if (sorted.size() > heap_size) {
+        std::nth_element(std::begin(sorted), std::begin(sorted) + heap_size, std::end(sorted), BetterScoredId);
+        sorted.resize(heap_size);
     }
-    std::sort(
-        std::begin(sorted),
-        std::end(sorted),
-        [](const std::pair<float_t, irs::doc_id_t> &lhs, const std::pair<float_t, irs::doc_id_t> &rhs) noexcept { return lhs.first > rhs.first; });
+    std::sort(std::begin(sorted), std::end(sorted), BetterScoredId);
+    sorted.erase(std::begin(sorted), std::begin(sorted) + std::min(page.offset_, sorted.size()));
     return 0;
 }
 
@@ -48,6 +48,16 @@ export u32 RowID2DocID(u32 segment_id, u32 block_id, u32 block_offset) {
 
 export RowID DocID2RowID(u32 doc_id) { return RowID((doc_id - 1) >> SEGMENT_OFFSET_IN_DOCID, (doc_id - 1) & SEGMENT_MASK_IN_DOCID); }
 
+// The page of the results to return. Results are ordered by score descending and then doc id ascending, so pages don't overlap.
+export struct SearchPage {
+    SizeT topn_{DEFAULT_TOPN};
+    // the best offset_ results are skipped, they are still ranked
+    SizeT offset_{0};
+    // only the results ranked after this doc are returned, e.g. the last result of the previous page.
+    // The search scores the doc itself, so the cursor is exact however the score was printed.
+    Optional<u32> after_doc_{};
+};
+
 export struct ViewSegment {
     ViewSegment(const IRSSubReader &segment) : segment_(&segment) {}
     const IRSSubReader *segment_;
@@ -138,7 +148,15 @@ public:
 
     ViewSnapshot *GetViewSnapshot();
 
-    int Search(IrsFilter *flt, const Map<String, String> &options, ScoredIds &result);
+    // result: the page of the results, in order
+    // parallelism: at most so many threads search the index segments at the same time
+    // deleted_docs: docs to leave out, which the index doesn't know to be deleted yet, may be nullptr
+    int Search(IrsFilter *flt,
+               const Map<String, String> &options,
+               const SearchPage &page,
+               SizeT parallelism,
+               const RoaringBitmap *deleted_docs,
+               ScoredIds &result);
 
 private:
     String directory_;
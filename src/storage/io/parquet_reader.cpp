@@ -0,0 +1,1134 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "lz4.h"
+
+module parquet_reader;
+
+import stl;
+import status;
+import infinity_exception;
+import third_party;
+
+namespace infinity {
+
+namespace {
+
+// Thrift containers and schema groups nested deeper than this are rejected instead of recursing further
+constexpr SizeT kMaxNestingDepth = 64;
+
+// Pages with more values are rejected before their levels and indices are allocated, writers use a few thousand
+constexpr i32 kMaxPageValues = 1 << 24;
+
+// Upper bounds of the decompressed size per compressed byte, a snappy copy of 64 bytes takes 3 bytes and
+// lz4 can't expand one byte to more than 255
+constexpr SizeT kMaxSnappyRatio = 22;
+constexpr SizeT kMaxLz4Ratio = 255;
+
+void ParquetError(const String &detail) { RecoverableError(Status::ImportFileFormatError(fmt::format("Parquet: {}", detail))); }
+
+u32 LoadLE32(const u8 *data) { return u32(data[0]) | (u32(data[1]) << 8) | (u32(data[2]) << 16) | (u32(data[3]) << 24); }
+
+i32 BitWidth(u32 max_value) {
+    i32 bit_width = 0;
+    while (max_value != 0) {
+        ++bit_width;
+        max_value >>= 1;
+    }
+    return bit_width;
+}
+
+void PRead(i32 fd, u8 *buffer, SizeT size, i64 offset) {
+    SizeT read_n = 0;
+    while (read_n < size) {
+        ssize_t n = pread(fd, buffer + read_n, size - read_n, offset + read_n);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            RecoverableError(Status::IOError(strerror(errno)));
+        }
+        if (n == 0) {
+            ParquetError("unexpected end of file");
+        }
+        read_n += n;
+    }
+}
+
+// Thrift compact protocol, just enough to walk the file footer and the page headers
+class CompactReader {
+public:
+    enum : u8 {
+        kStop = 0,
+        kBoolTrue = 1,
+        kBoolFalse = 2,
+        kByte = 3,
+        kI16 = 4,
+        kI32 = 5,
+        kI64 = 6,
+        kDouble = 7,
+        kBinary = 8,
+        kList = 9,
+        kSet = 10,
+        kMap = 11,
+        kStruct = 12,
+    };
+
+    CompactReader(const u8 *data, SizeT size) : data_(data), end_(data + size) {}
+
+    inline const u8 *Position() const { return data_; }
+
+    u8 ReadByte() {
+        if (data_ >= end_) {
+            ParquetError("metadata is truncated");
+        }
+        return *data_++;
+    }
+
+    u64 ReadVarint() {
+        u64 result = 0;
+        for (i32 shift = 0; shift < 64; shift += 7) {
+            u8 byte = ReadByte();
+            result |= u64(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) {
+                return result;
+            }
+        }
+        ParquetError("varint is too long");
+        return 0;
+    }
+
+    i64 ReadZigzag() {
+        u64 n = ReadVarint();
+        return static_cast<i64>((n >> 1) ^ (~(n & 1) + 1));
+    }
+
+    i32 ReadI32() { return static_cast<i32>(ReadZigzag()); }
+
+    i64 ReadI64() { return ReadZigzag(); }
+
+    String ReadBinary() {
+        u64 length = ReadVarint();
+        Advance(length);
+        return String(reinterpret_cast<const char *>(data_ - length), length);
+    }
+
+    // Returns false at the end of a struct. field_id holds the id of the previous field of the same struct.
+    bool ReadFieldHeader(i16 &field_id, u8 &field_type) {
+        u8 byte = ReadByte();
+        if (byte == kStop) {
+            return false;
+        }
+        field_type = byte & 0x0F;
+        u8 delta = byte >> 4;
+        if (delta == 0) {
+            field_id = static_cast<i16>(ReadZigzag());
+        } else {
+            field_id = static_cast<i16>(field_id + delta);
+        }
+        return true;
+    }
+
+    // Every element takes at least one byte, so a size larger than the rest of the data is corrupted
+    SizeT ReadListHeader(u8 &element_type) {
+        u8 byte = ReadByte();
+        element_type = byte & 0x0F;
+        SizeT size = byte >> 4;
+        if (size == 15) {
+            size = ReadVarint();
+        }
+        if (size > static_cast<SizeT>(end_ - data_)) {
+            ParquetError("list size is out of range");
+        }
+        return size;
+    }
+
+    void Skip(u8 type, SizeT depth = 0) {
+        if (depth > kMaxNestingDepth) {
+            ParquetError("metadata is nested too deeply");
+        }
+        switch (type) {
+            case kBoolTrue:
+            case kBoolFalse: {
+                // a bool field is stored in the field header
+                break;
+            }
+            case kByte: {
+                ReadByte();
+                break;
+            }
+            case kI16:
+            case kI32:
+            case kI64: {
+                ReadVarint();
+                break;
+            }
+            case kDouble: {
+                Advance(8);
+                break;
+            }
+            case kBinary: {
+                Advance(ReadVarint());
+                break;
+            }
+            case kList:
+            case kSet: {
+                u8 element_type{};
+                SizeT size = ReadListHeader(element_type);
+                for (SizeT i = 0; i < size; ++i) {
+                    SkipElement(element_type, depth + 1);
+                }
+                break;
+            }
+            case kMap: {
+                SizeT size = ReadVarint();
+                if (size == 0) {
+                    break;
+                }
+                u8 types = ReadByte();
+                if (size > static_cast<SizeT>(end_ - data_)) {
+                    ParquetError("map size is out of range");
+                }
+                for (SizeT i = 0; i < size; ++i) {
+                    SkipElement(types >> 4, depth + 1);
+                    SkipElement(types & 0x0F, depth + 1);
+                }
+                break;
+            }
+            case kStruct: {
+                i16 field_id = 0;
+                u8 field_type{};
+                while (ReadFieldHeader(field_id, field_type)) {
+                    Skip(field_type, depth + 1);
+                }
+                break;
+            }
+            default: {
+                ParquetError(fmt::format("unknown thrift type {}", type));
+            }
+        }
+    }
+
+private:
+    void Advance(SizeT n) {
+        if (static_cast<SizeT>(end_ - data_) < n) {
+            ParquetError("metadata is truncated");
+        }
+        data_ += n;
+    }
+
+    // Inside containers a bool takes a whole byte
+    void SkipElement(u8 type, SizeT depth) {
+        if (type == kBoolTrue or type == kBoolFalse) {
+            ReadByte();
+        } else {
+            Skip(type, depth);
+        }
+    }
+
+    const u8 *data_{};
+    const u8 *end_{};
+};
+
+struct SchemaElement {
+    i32 type_{-1};
+    // 0: required, 1: optional, 2: repeated
+    i32 repetition_{0};
+    String name_{};
+    i32 num_children_{0};
+};
+
+SchemaElement ReadSchemaElement(CompactReader &reader) {
+    SchemaElement element;
+    i16 field_id = 0;
+    u8 field_type{};
+    while (reader.ReadFieldHeader(field_id, field_type)) {
+        switch (field_id) {
+            case 1: {
+                element.type_ = reader.ReadI32();
+                break;
+            }
+            case 3: {
+                element.repetition_ = reader.ReadI32();
+                break;
+            }
+            case 4: {
+                element.name_ = reader.ReadBinary();
+                break;
+            }
+            case 5: {
+                element.num_children_ = reader.ReadI32();
+                break;
+            }
+            default: {
+                reader.Skip(field_type);
+            }
+        }
+    }
+    return element;
+}
+
+ParquetColumnChunkMeta ReadColumnMetaData(CompactReader &reader) {
+    ParquetColumnChunkMeta meta;
+    i16 field_id = 0;
+    u8 field_type{};
+    while (reader.ReadFieldHeader(field_id, field_type)) {
+        switch (field_id) {
+            case 1: {
+                meta.type_ = static_cast<ParquetType>(reader.ReadI32());
+                break;
+            }
+            case 4: {
+                meta.codec_ = reader.ReadI32();
+                break;
+            }
+            case 5: {
+                meta.value_count_ = reader.ReadI64();
+                break;
+            }
+            case 7: {
+                meta.total_compressed_size_ = reader.ReadI64();
+                break;
+            }
+            case 9: {
+                meta.data_page_offset_ = reader.ReadI64();
+                break;
+            }
+            case 11: {
+                meta.dictionary_page_offset_ = reader.ReadI64();
+                break;
+            }
+            default: {
+                reader.Skip(field_type);
+            }
+        }
+    }
+    return meta;
+}
+
+ParquetColumnChunkMeta ReadColumnChunkMeta(CompactReader &reader) {
+    ParquetColumnChunkMeta meta;
+    bool has_meta = false;
+    i16 field_id = 0;
+    u8 field_type{};
+    while (reader.ReadFieldHeader(field_id, field_type)) {
+        switch (field_id) {
+            case 1: {
+                String file_path = reader.ReadBinary();
+                if (!file_path.empty()) {
+                    ParquetError(fmt::format("column chunks in external file {} aren't supported", file_path));
+                }
+                break;
+            }
+            case 3: {
+                meta = ReadColumnMetaData(reader);
+                has_meta = true;
+                break;
+            }
+            default: {
+                reader.Skip(field_type);
+            }
+        }
+    }
+    if (!has_meta) {
+        ParquetError("column chunk without metadata");
+    }
+    return meta;
+}
+
+ParquetRowGroup ReadRowGroup(CompactReader &reader) {
+    ParquetRowGroup row_group;
+    i16 field_id = 0;
+    u8 field_type{};
+    while (reader.ReadFieldHeader(field_id, field_type)) {
+        switch (field_id) {
+            case 1: {
+                u8 element_type{};
+                SizeT size = reader.ReadListHeader(element_type);
+                for (SizeT i = 0; i < size; ++i) {
+                    row_group.column_chunks_.emplace_back(ReadColumnChunkMeta(reader));
+                }
+                break;
+            }
+            case 3: {
+                row_group.row_count_ = reader.ReadI64();
+                break;
+            }
+            default: {
+                reader.Skip(field_type);
+            }
+        }
+    }
+    return row_group;
+}
+
+// Walks the depth first schema list and collects the leaves with their levels
+void CollectLeaves(const Vector<SchemaElement> &schema,
+                   SizeT &idx,
+                   SizeT depth,
+                   const String &top_name,
+                   i16 def_level,
+                   i16 rep_level,
+                   ParquetColumn &leaf,
+                   Vector<ParquetColumn> &columns) {
+    if (idx >= schema.size()) {
+        ParquetError("schema is truncated");
+    }
+    if (depth > kMaxNestingDepth) {
+        ParquetError("schema is nested too deeply");
+    }
+    const SchemaElement &element = schema[idx++];
+    if (element.repetition_ == 1) {
+        ++def_level;
+    } else if (element.repetition_ == 2) {
+        ++def_level;
+        ++rep_level;
+        leaf.repeated_def_level_ = def_level;
+    }
+    const String &name = top_name.empty() ? element.name_ : top_name;
+    if (element.num_children_ == 0) {
+        leaf.name_ = name;
+        leaf.type_ = static_cast<ParquetType>(element.type_);
+        leaf.max_def_level_ = def_level;
+        leaf.max_rep_level_ = rep_level;
+        leaf.is_list_ = rep_level > 0;
+        columns.emplace_back(leaf);
+        return;
+    }
+    for (i32 child_idx = 0; child_idx < element.num_children_; ++child_idx) {
+        ParquetColumn child_leaf = leaf;
+        CollectLeaves(schema, idx, depth + 1, name, def_level, rep_level, child_leaf, columns);
+    }
+}
+
+struct PageHeader {
+    // 0: data page, 1: index page, 2: dictionary page, 3: data page v2
+    i32 type_{-1};
+    i32 uncompressed_size_{};
+    i32 compressed_size_{};
+    i32 num_values_{};
+    i32 encoding_{};
+    i32 def_levels_byte_length_{};
+    i32 rep_levels_byte_length_{};
+    bool is_compressed_{true};
+};
+
+void ReadDataPageHeader(CompactReader &reader, PageHeader &page_header, bool v2) {
+    i16 field_id = 0;
+    u8 field_type{};
+    while (reader.ReadFieldHeader(field_id, field_type)) {
+        if (field_id == 1) {
+            page_header.num_values_ = reader.ReadI32();
+        } else if (!v2 and field_id == 2) {
+            page_header.encoding_ = reader.ReadI32();
+        } else if (v2 and field_id == 4) {
+            page_header.encoding_ = reader.ReadI32();
+        } else if (v2 and field_id == 5) {
+            page_header.def_levels_byte_length_ = reader.ReadI32();
+        } else if (v2 and field_id == 6) {
+            page_header.rep_levels_byte_length_ = reader.ReadI32();
+        } else if (v2 and field_id == 7) {
+            page_header.is_compressed_ = field_type == CompactReader::kBoolTrue;
+        } else {
+            reader.Skip(field_type);
+        }
+    }
+}
+
+PageHeader ReadPageHeader(CompactReader &reader) {
+    PageHeader page_header;
+    i16 field_id = 0;
+    u8 field_type{};
+    while (reader.ReadFieldHeader(field_id, field_type)) {
+        switch (field_id) {
+            case 1: {
+                page_header.type_ = reader.ReadI32();
+                break;
+            }
+            case 2: {
+                page_header.uncompressed_size_ = reader.ReadI32();
+                break;
+            }
+            case 3: {
+                page_header.compressed_size_ = reader.ReadI32();
+                break;
+            }
+            case 5: {
+                ReadDataPageHeader(reader, page_header, false);
+                break;
+            }
+            case 7: {
+                // dictionary page header shares the num_values / encoding field ids with data page v1
+                ReadDataPageHeader(reader, page_header, false);
+                break;
+            }
+            case 8: {
+                ReadDataPageHeader(reader, page_header, true);
+                break;
+            }
+            default: {
+                reader.Skip(field_type);
+            }
+        }
+    }
+    return page_header;
+}
+
+Vector<u8> Decompress(i32 codec, const u8 *data, SizeT size, SizeT uncompressed_size) {
+    switch (codec) {
+        case 0: {
+            // UNCOMPRESSED
+            return Vector<u8>(data, data + size);
+        }
+        case 1: {
+            // SNAPPY
+            Vector<u8> output = SnappyDecompress(data, size);
+            if (output.size() != uncompressed_size) {
+                ParquetError("snappy page size mismatch");
+            }
+            return output;
+        }
+        case 7: {
+            // LZ4_RAW
+            if (uncompressed_size > size * kMaxLz4Ratio) {
+                ParquetError("lz4 page size is out of range");
+            }
+            Vector<u8> output(uncompressed_size);
+            int n = LZ4_decompress_safe(reinterpret_cast<const char *>(data), reinterpret_cast<char *>(output.data()), size, uncompressed_size);
+            if (n < 0 or static_cast<SizeT>(n) != uncompressed_size) {
+                ParquetError("corrupted lz4 page");
+            }
+            return output;
+        }
+        default: {
+            ParquetError(fmt::format("compression codec {} isn't supported, use UNCOMPRESSED, SNAPPY or LZ4_RAW", codec));
+        }
+    }
+    return {};
+}
+
+SizeT FixedWidth(ParquetType type) {
+    switch (type) {
+        case ParquetType::kInt32:
+        case ParquetType::kFloat: {
+            return 4;
+        }
+        case ParquetType::kInt64:
+        case ParquetType::kDouble: {
+            return 8;
+        }
+        default: {
+            return 0;
+        }
+    }
+}
+
+void DecodePlain(ParquetType type, const u8 *data, SizeT size, SizeT count, ParquetColumnChunk &chunk) {
+    switch (type) {
+        case ParquetType::kBoolean: {
+            if (size * 8 < count) {
+                ParquetError("boolean page is truncated");
+            }
+            for (SizeT i = 0; i < count; ++i) {
+                chunk.data_.emplace_back((data[i / 8] >> (i % 8)) & 1);
+            }
+            break;
+        }
+        case ParquetType::kInt32:
+        case ParquetType::kInt64:
+        case ParquetType::kFloat:
+        case ParquetType::kDouble: {
+            SizeT byte_size = FixedWidth(type) * count;
+            if (size < byte_size) {
+                ParquetError("data page is truncated");
+            }
+            chunk.data_.insert(chunk.data_.end(), data, data + byte_size);
+            break;
+        }
+        case ParquetType::kByteArray: {
+            if (chunk.offsets_.empty()) {
+                chunk.offsets_.emplace_back(0);
+            }
+            const u8 *end = data + size;
+            for (SizeT i = 0; i < count; ++i) {
+                if (end - data < 4) {
+                    ParquetError("byte array page is truncated");
+                }
+                u32 length = LoadLE32(data);
+                data += 4;
+                if (static_cast<SizeT>(end - data) < length) {
+                    ParquetError("byte array page is truncated");
+                }
+                chunk.data_.insert(chunk.data_.end(), data, data + length);
+                chunk.offsets_.emplace_back(chunk.data_.size());
+                data += length;
+            }
+            break;
+        }
+        default: {
+            ParquetError(fmt::format("physical type {} isn't supported", ParquetTypeToString(type)));
+        }
+    }
+    chunk.value_count_ += count;
+}
+
+void DecodeDictionaryIndices(const ParquetColumnChunk &dictionary, const u8 *data, SizeT size, SizeT count, ParquetColumnChunk &chunk) {
+    if (count == 0) {
+        return;
+    }
+    if (size == 0) {
+        ParquetError("dictionary page is missing index bit width");
+    }
+    Vector<u32> indices(count);
+    RleBitPackedDecoder(data + 1, size - 1, data[0]).Decode(indices.data(), count);
+
+    SizeT width = FixedWidth(dictionary.type_);
+    if (dictionary.type_ == ParquetType::kByteArray and chunk.offsets_.empty()) {
+        chunk.offsets_.emplace_back(0);
+    }
+    for (u32 index : indices) {
+        if (index >= dictionary.value_count_) {
+            ParquetError("dictionary index is out of range");
+        }
+        switch (dictionary.type_) {
+            case ParquetType::kBoolean: {
+                chunk.data_.emplace_back(dictionary.data_[index]);
+                break;
+            }
+            case ParquetType::kByteArray: {
+                const u8 *value = dictionary.data_.data() + dictionary.offsets_[index];
+                chunk.data_.insert(chunk.data_.end(), value, dictionary.data_.data() + dictionary.offsets_[index + 1]);
+                chunk.offsets_.emplace_back(chunk.data_.size());
+                break;
+            }
+            default: {
+                const u8 *value = dictionary.data_.data() + index * width;
+                chunk.data_.insert(chunk.data_.end(), value, value + width);
+            }
+        }
+    }
+    chunk.value_count_ += count;
+}
+
+Vector<u32> DecodeLevels(const u8 *data, SizeT size, i16 max_level, SizeT count) {
+    Vector<u32> levels(count);
+    RleBitPackedDecoder(data, size, BitWidth(max_level)).Decode(levels.data(), count);
+    return levels;
+}
+
+// Applies the levels of one page to the chunk and returns how many values the page stores
+SizeT ApplyLevels(const ParquetColumn &column,
+                  const Vector<u32> &rep_levels,
+                  const Vector<u32> &def_levels,
+                  SizeT num_values,
+                  ParquetColumnChunk &chunk) {
+    if (column.max_def_level_ == 0 and column.max_rep_level_ == 0) {
+        return num_values;
+    }
+    SizeT present = 0;
+    for (SizeT i = 0; i < num_values; ++i) {
+        u32 def_level = column.max_def_level_ > 0 ? def_levels[i] : 0;
+        if (!column.is_list_) {
+            if (def_level == u32(column.max_def_level_)) {
+                ++present;
+            } else {
+                ++chunk.null_count_;
+            }
+            continue;
+        }
+
+        if (rep_levels[i] == 0) {
+            chunk.list_sizes_.emplace_back(0);
+        } else if (chunk.list_sizes_.empty()) {
+            ParquetError("list continues from a previous column chunk");
+        }
+        if (def_level == u32(column.max_def_level_)) {
+            ++chunk.list_sizes_.back();
+            ++present;
+        } else if (def_level >= u32(column.repeated_def_level_)) {
+            // null element inside a list
+            ++chunk.null_count_;
+        } else if (def_level + 1 < u32(column.repeated_def_level_)) {
+            // the list itself is null, one level below would be an empty list
+            ++chunk.null_count_;
+        }
+    }
+    return present;
+}
+
+void DecodeValues(i32 encoding,
+                  const ParquetColumn &column,
+                  const ParquetColumnChunk *dictionary,
+                  const u8 *data,
+                  SizeT size,
+                  SizeT count,
+                  ParquetColumnChunk &chunk) {
+    switch (encoding) {
+        case 0: {
+            // PLAIN
+            DecodePlain(column.type_, data, size, count, chunk);
+            break;
+        }
+        case 2:
+        case 8: {
+            // PLAIN_DICTIONARY, RLE_DICTIONARY
+            if (dictionary == nullptr) {
+                ParquetError("dictionary encoded page without dictionary page");
+            }
+            DecodeDictionaryIndices(*dictionary, data, size, count, chunk);
+            break;
+        }
+        case 3: {
+            // RLE, only used for booleans: 4 bytes length followed by the runs
+            if (column.type_ != ParquetType::kBoolean or size < 4) {
+                ParquetError("unexpected RLE encoded page");
+            }
+            Vector<u32> values(count);
+            RleBitPackedDecoder(data + 4, std::min<SizeT>(LoadLE32(data), size - 4), 1).Decode(values.data(), count);
+            for (u32 value : values) {
+                chunk.data_.emplace_back(value);
+            }
+            chunk.value_count_ += count;
+            break;
+        }
+        default: {
+            ParquetError(fmt::format("encoding {} isn't supported", encoding));
+        }
+    }
+}
+
+} // namespace
+
+String ParquetTypeToString(ParquetType type) {
+    switch (type) {
+        case ParquetType::kBoolean: {
+            return "BOOLEAN";
+        }
+        case ParquetType::kInt32: {
+            return "INT32";
+        }
+        case ParquetType::kInt64: {
+            return "INT64";
+        }
+        case ParquetType::kInt96: {
+            return "INT96";
+        }
+        case ParquetType::kFloat: {
+            return "FLOAT";
+        }
+        case ParquetType::kDouble: {
+            return "DOUBLE";
+        }
+        case ParquetType::kByteArray: {
+            return "BYTE_ARRAY";
+        }
+        case ParquetType::kFixedLenByteArray: {
+            return "FIXED_LEN_BYTE_ARRAY";
+        }
+    }
+    return "UNKNOWN";
+}
+
+Vector<u8> SnappyDecompress(const u8 *input, SizeT input_size) {
+    const u8 *data = input;
+    const u8 *end = input + input_size;
+
+    SizeT length = 0;
+    for (i32 shift = 0;; shift += 7) {
+        if (data >= end or shift > 28) {
+            ParquetError("corrupted snappy preamble");
+        }
+        u8 byte = *data++;
+        length |= SizeT(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            break;
+        }
+    }
+    if (length > input_size * kMaxSnappyRatio) {
+        ParquetError("snappy length is out of range");
+    }
+
+    Vector<u8> output;
+    output.reserve(length);
+    while (data < end) {
+        u8 tag = *data++;
+        SizeT copy_length = 0;
+        SizeT copy_offset = 0;
+        switch (tag & 3) {
+            case 0: {
+                // literal
+                SizeT literal_length = tag >> 2;
+                if (literal_length >= 60) {
+                    SizeT bytes = literal_length - 59;
+                    if (static_cast<SizeT>(end - data) < bytes) {
+                        ParquetError("corrupted snappy literal");
+                    }
+                    literal_length = 0;
+                    for (SizeT i = 0; i < bytes; ++i) {
+                        literal_length |= SizeT(data[i]) << (8 * i);
+                    }
+                    data += bytes;
+                }
+                literal_length += 1;
+                if (static_cast<SizeT>(end - data) < literal_length or output.size() + literal_length > length) {
+                    ParquetError("corrupted snappy literal");
+                }
+                output.insert(output.end(), data, data + literal_length);
+                data += literal_length;
+                continue;
+            }
+            case 1: {
+                if (data >= end) {
+                    ParquetError("corrupted snappy copy");
+                }
+                copy_length = 4 + ((tag >> 2) & 7);
+                copy_offset = (SizeT(tag >> 5) << 8) | *data++;
+                break;
+            }
+            case 2: {
+                if (end - data < 2) {
+                    ParquetError("corrupted snappy copy");
+                }
+                copy_length = 1 + (tag >> 2);
+                copy_offset = SizeT(data[0]) | (SizeT(data[1]) << 8);
+                data += 2;
+                break;
+            }
+            default: {
+                if (end - data < 4) {
+                    ParquetError("corrupted snappy copy");
+                }
+                copy_length = 1 + (tag >> 2);
+                copy_offset = LoadLE32(data);
+                data += 4;
+            }
+        }
+        if (copy_offset == 0 or copy_offset > output.size() or output.size() + copy_length > length) {
+            ParquetError("corrupted snappy copy");
+        }
+        // copies may overlap their own output
+        SizeT copy_from = output.size() - copy_offset;
+        for (SizeT i = 0; i < copy_length; ++i) {
+            output.emplace_back(output[copy_from + i]);
+        }
+    }
+    if (output.size() != length) {
+        ParquetError("snappy length mismatch");
+    }
+    return output;
+}
+
+RleBitPackedDecoder::RleBitPackedDecoder(const u8 *data, SizeT size, i32 bit_width) : data_(data), end_(data + size), bit_width_(bit_width) {
+    if (bit_width_ < 0 or bit_width_ > 32) {
+        ParquetError(fmt::format("bit width {} is out of range", bit_width_));
+    }
+}
+
+bool RleBitPackedDecoder::NextRun() {
+    if (data_ >= end_) {
+        return false;
+    }
+    u64 header = 0;
+    for (i32 shift = 0;; shift += 7) {
+        if (data_ >= end_ or shift > 35) {
+            return false;
+        }
+        u8 byte = *data_++;
+        header |= u64(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            break;
+        }
+    }
+    if (header & 1) {
+        // bit-packed run of groups of 8 values
+        SizeT group_count = header >> 1;
+        SizeT bytes = std::min<SizeT>(group_count * bit_width_, end_ - data_);
+        packed_data_ = data_;
+        packed_idx_ = 0;
+        packed_left_ = bit_width_ == 0 ? group_count * 8 : std::min<SizeT>(group_count * 8, bytes * 8 / bit_width_);
+        data_ += bytes;
+    } else {
+        rle_left_ = header >> 1;
+        SizeT bytes = (bit_width_ + 7) / 8;
+        if (static_cast<SizeT>(end_ - data_) < bytes) {
+            return false;
+        }
+        rle_value_ = 0;
+        for (SizeT i = 0; i < bytes; ++i) {
+            rle_value_ |= u32(data_[i]) << (8 * i);
+        }
+        data_ += bytes;
+    }
+    return true;
+}
+
+void RleBitPackedDecoder::Decode(u32 *output, SizeT count) {
+    SizeT idx = 0;
+    while (idx < count) {
+        if (rle_left_ == 0 and packed_left_ == 0) {
+            if (!NextRun()) {
+                ParquetError("not enough encoded levels or indices");
+            }
+            continue;
+        }
+        if (rle_left_ > 0) {
+            SizeT n = std::min(rle_left_, count - idx);
+            std::fill(output + idx, output + idx + n, rle_value_);
+            rle_left_ -= n;
+            idx += n;
+            continue;
+        }
+        for (; packed_left_ > 0 and idx < count; --packed_left_, ++packed_idx_) {
+            SizeT bit_pos = packed_idx_ * bit_width_;
+            u32 value = 0;
+            for (i32 bit = 0; bit < bit_width_; ++bit, ++bit_pos) {
+                value |= u32((packed_data_[bit_pos / 8] >> (bit_pos % 8)) & 1) << bit;
+            }
+            output[idx++] = value;
+        }
+    }
+}
+
+ParquetReader::ParquetReader(String file_path) : file_path_(std::move(file_path)) {
+    fd_ = open(file_path_.c_str(), O_RDONLY);
+    if (fd_ < 0) {
+        RecoverableError(Status::IOError(fmt::format("Can't open {}: {}", file_path_, strerror(errno))));
+    }
+    try {
+        file_size_ = lseek(fd_, 0, SEEK_END);
+        i64 file_size = file_size_;
+        if (file_size < 12) {
+            ParquetError(fmt::format("{} is too small to be a parquet file", file_path_));
+        }
+        u8 tail[8];
+        PRead(fd_, tail, sizeof(tail), file_size - 8);
+        if (std::memcmp(tail + 4, "PAR1", 4) != 0) {
+            ParquetError(fmt::format("{} doesn't end with the parquet magic", file_path_));
+        }
+        u32 footer_size = LoadLE32(tail);
+        if (footer_size > file_size - 12) {
+            ParquetError("footer size is out of range");
+        }
+        Vector<u8> footer(footer_size);
+        PRead(fd_, footer.data(), footer_size, file_size - 8 - footer_size);
+
+        // FileMetaData
+        CompactReader reader(footer.data(), footer.size());
+        Vector<SchemaElement> schema;
+        i16 field_id = 0;
+        u8 field_type{};
+        while (reader.ReadFieldHeader(field_id, field_type)) {
+            switch (field_id) {
+                case 2: {
+                    u8 element_type{};
+                    SizeT size = reader.ReadListHeader(element_type);
+                    for (SizeT i = 0; i < size; ++i) {
+                        schema.emplace_back(ReadSchemaElement(reader));
+                    }
+                    break;
+                }
+                case 4: {
+                    u8 element_type{};
+                    SizeT size = reader.ReadListHeader(element_type);
+                    for (SizeT i = 0; i < size; ++i) {
+                        row_groups_.emplace_back(ReadRowGroup(reader));
+                    }
+                    break;
+                }
+                default: {
+                    reader.Skip(field_type);
+                }
+            }
+        }
+
+        if (schema.empty()) {
+            ParquetError("schema is empty");
+        }
+        // schema[0] is the root, its children are the top level fields
+        SizeT schema_idx = 1;
+        for (i32 child_idx = 0; child_idx < schema[0].num_children_; ++child_idx) {
+            ParquetColumn leaf;
+            CollectLeaves(schema, schema_idx, 1, String(), 0, 0, leaf, columns_);
+        }
+        for (const auto &row_group : row_groups_) {
+            if (row_group.column_chunks_.size() != columns_.size()) {
+                ParquetError("row group column count doesn't match with schema");
+            }
+        }
+    } catch (...) {
+        close(fd_);
+        throw;
+    }
+}
+
+ParquetReader::~ParquetReader() {
+    if (fd_ >= 0) {
+        close(fd_);
+    }
+}
+
+i64 ParquetReader::FindColumn(const String &name) const {
+    i64 found = -1;
+    for (SizeT column_idx = 0; column_idx < columns_.size(); ++column_idx) {
+        if (columns_[column_idx].name_ != name) {
+            continue;
+        }
+        if (found != -1) {
+            ParquetError(fmt::format("column {} is a nested group, which isn't supported", name));
+        }
+        found = column_idx;
+    }
+    if (found != -1 and columns_[found].max_rep_level_ > 1) {
+        ParquetError(fmt::format("column {} is a nested list, which isn't supported", name));
+    }
+    return found;
+}
+
+ParquetColumnChunk ParquetReader::ReadColumnChunk(SizeT row_group_idx, SizeT column_idx) const {
+    const ParquetColumn &column = columns_[column_idx];
+    const ParquetColumnChunkMeta &meta = row_groups_[row_group_idx].column_chunks_[column_idx];
+
+    i64 chunk_offset = meta.data_page_offset_;
+    if (meta.dictionary_page_offset_ > 0) {
+        chunk_offset = std::min(chunk_offset, meta.dictionary_page_offset_);
+    }
+    if (chunk_offset < 0 or meta.total_compressed_size_ < 0 or chunk_offset > file_size_ or
+        meta.total_compressed_size_ > file_size_ - chunk_offset) {
+        ParquetError(fmt::format("column chunk of {} is out of the file", column.name_));
+    }
+    Vector<u8> buffer(meta.total_compressed_size_);
+    PRead(fd_, buffer.data(), buffer.size(), chunk_offset);
+
+    ParquetColumnChunk chunk;
+    chunk.type_ = column.type_;
+    ParquetColumnChunk dictionary;
+    bool has_dictionary = false;
+
+    const u8 *data = buffer.data();
+    const u8 *end = buffer.data() + buffer.size();
+    i64 level_count = 0;
+    while (level_count < meta.value_count_) {
+        if (data >= end) {
+            ParquetError(fmt::format("column chunk of {} is truncated", column.name_));
+        }
+        CompactReader header_reader(data, end - data);
+        PageHeader page_header = ReadPageHeader(header_reader);
+        data = header_reader.Position();
+        if (page_header.compressed_size_ < 0 or page_header.compressed_size_ > end - data) {
+            ParquetError(fmt::format("page of {} is truncated", column.name_));
+        }
+        if (page_header.uncompressed_size_ < 0 or page_header.num_values_ < 0 or page_header.def_levels_byte_length_ < 0 or
+            page_header.rep_levels_byte_length_ < 0) {
+            ParquetError(fmt::format("page header of {} has a negative size", column.name_));
+        }
+        if (page_header.num_values_ > kMaxPageValues or
+            ((page_header.type_ == 0 or page_header.type_ == 3) and page_header.num_values_ > meta.value_count_ - level_count)) {
+            ParquetError(fmt::format("page of {} has too many values", column.name_));
+        }
+        const u8 *page_data = data;
+        SizeT page_size = page_header.compressed_size_;
+        data += page_size;
+
+        switch (page_header.type_) {
+            case 2: {
+                // dictionary page
+                Vector<u8> page = Decompress(meta.codec_, page_data, page_size, page_header.uncompressed_size_);
+                dictionary = ParquetColumnChunk();
+                dictionary.type_ = column.type_;
+                DecodePlain(column.type_, page.data(), page.size(), page_header.num_values_, dictionary);
+                has_dictionary = true;
+                break;
+            }
+            case 0: {
+                // data page v1, levels and values are compressed together
+                Vector<u8> page = Decompress(meta.codec_, page_data, page_size, page_header.uncompressed_size_);
+                const u8 *page_pos = page.data();
+                const u8 *page_end = page.data() + page.size();
+                SizeT num_values = page_header.num_values_;
+                // each level section is prefixed with its 4 bytes length
+                auto read_levels = [&](i16 max_level) {
+                    if (page_end - page_pos < 4) {
+                        ParquetError(fmt::format("page of {} is truncated", column.name_));
+                    }
+                    SizeT levels_size = LoadLE32(page_pos);
+                    page_pos += 4;
+                    if (static_cast<SizeT>(page_end - page_pos) < levels_size) {
+                        ParquetError(fmt::format("page of {} is truncated", column.name_));
+                    }
+                    Vector<u32> levels = DecodeLevels(page_pos, levels_size, max_level, num_values);
+                    page_pos += levels_size;
+                    return levels;
+                };
+                Vector<u32> rep_levels;
+                Vector<u32> def_levels;
+                if (column.max_rep_level_ > 0) {
+                    rep_levels = read_levels(column.max_rep_level_);
+                }
+                if (column.max_def_level_ > 0) {
+                    def_levels = read_levels(column.max_def_level_);
+                }
+                SizeT value_count = ApplyLevels(column, rep_levels, def_levels, num_values, chunk);
+                const ParquetColumnChunk *dictionary_ptr = has_dictionary ? &dictionary : nullptr;
+                DecodeValues(page_header.encoding_, column, dictionary_ptr, page_pos, page_end - page_pos, value_count, chunk);
+                level_count += num_values;
+                break;
+            }
+            case 3: {
+                // data page v2, levels are never compressed
+                SizeT rep_size = page_header.rep_levels_byte_length_;
+                SizeT def_size = page_header.def_levels_byte_length_;
+                if (rep_size + def_size > page_size or rep_size + def_size > SizeT(page_header.uncompressed_size_)) {
+                    ParquetError(fmt::format("page of {} is truncated", column.name_));
+                }
+                SizeT num_values = page_header.num_values_;
+                Vector<u32> rep_levels;
+                Vector<u32> def_levels;
+                if (column.max_rep_level_ > 0) {
+                    rep_levels = DecodeLevels(page_data, rep_size, column.max_rep_level_, num_values);
+                }
+                if (column.max_def_level_ > 0) {
+                    def_levels = DecodeLevels(page_data + rep_size, def_size, column.max_def_level_, num_values);
+                }
+                SizeT value_count = ApplyLevels(column, rep_levels, def_levels, num_values, chunk);
+
+                const u8 *values_data = page_data + rep_size + def_size;
+                SizeT values_size = page_size - rep_size - def_size;
+                Vector<u8> values;
+                if (page_header.is_compressed_) {
+                    values = Decompress(meta.codec_, values_data, values_size, page_header.uncompressed_size_ - rep_size - def_size);
+                } else {
+                    values.assign(values_data, values_data + values_size);
+                }
+                const ParquetColumnChunk *dictionary_ptr = has_dictionary ? &dictionary : nullptr;
+                DecodeValues(page_header.encoding_, column, dictionary_ptr, values.data(), values.size(), value_count, chunk);
+                level_count += num_values;
+                break;
+            }
+            default: {
+                // index pages carry nothing needed for import
+                break;
+            }
+        }
+    }
+    return chunk;
+}
+
+} // namespace infinity
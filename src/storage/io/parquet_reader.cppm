@@ -0,0 +1,133 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module parquet_reader;
+
+import stl;
+
+namespace infinity {
+
+// Physical types of the parquet format, values match parquet.thrift
+export enum class ParquetType : i32 {
+    kBoolean = 0,
+    kInt32 = 1,
+    kInt64 = 2,
+    kInt96 = 3,
+    kFloat = 4,
+    kDouble = 5,
+    kByteArray = 6,
+    kFixedLenByteArray = 7,
+};
+
+export String ParquetTypeToString(ParquetType type);
+
+// One leaf column of the file schema. A top level field whose only leaf is repeated once is read as a list column,
+// which is how LIST and FixedSizeList fields are stored.
+export struct ParquetColumn {
+    String name_{};
+    ParquetType type_{ParquetType::kBoolean};
+    i16 max_def_level_{};
+    i16 max_rep_level_{};
+    // Definition level of the repeated node, below it the list itself is empty or null
+    i16 repeated_def_level_{};
+    bool is_list_{false};
+};
+
+// All values of one column in one row group, in the PLAIN layout: fixed width values are stored back to back,
+// booleans take one byte each and byte arrays are concatenated with their bounds in offsets_.
+export struct ParquetColumnChunk {
+    ParquetType type_{ParquetType::kBoolean};
+    SizeT value_count_{};
+    Vector<u8> data_{};
+    Vector<SizeT> offsets_{};
+    // Values or lists which are null
+    SizeT null_count_{};
+    // List columns only, number of elements in each row
+    Vector<u32> list_sizes_{};
+};
+
+struct ParquetColumnChunkMeta {
+    ParquetType type_{ParquetType::kBoolean};
+    i32 codec_{};
+    i64 value_count_{};
+    i64 data_page_offset_{};
+    i64 dictionary_page_offset_{-1};
+    i64 total_compressed_size_{};
+};
+
+struct ParquetRowGroup {
+    i64 row_count_{};
+    Vector<ParquetColumnChunkMeta> column_chunks_{};
+};
+
+// Minimal reader of the parquet format for import. It understands flat columns and single level lists, PLAIN and
+// dictionary encodings, data pages v1 and v2, and UNCOMPRESSED, SNAPPY and LZ4_RAW compression.
+// Column chunks are read with pread, so several row groups can be read concurrently.
+export class ParquetReader {
+public:
+    explicit ParquetReader(String file_path);
+
+    ~ParquetReader();
+
+    ParquetReader(const ParquetReader &) = delete;
+
+    ParquetReader &operator=(const ParquetReader &) = delete;
+
+    inline const Vector<ParquetColumn> &Columns() const { return columns_; }
+
+    inline SizeT RowGroupCount() const { return row_groups_.size(); }
+
+    inline SizeT RowGroupRowCount(SizeT row_group_idx) const { return row_groups_[row_group_idx].row_count_; }
+
+    // Index into Columns() of the column with the given top level name, -1 if there is none
+    i64 FindColumn(const String &name) const;
+
+    ParquetColumnChunk ReadColumnChunk(SizeT row_group_idx, SizeT column_idx) const;
+
+private:
+    String file_path_{};
+    i32 fd_{-1};
+    i64 file_size_{};
+    Vector<ParquetColumn> columns_{};
+    Vector<ParquetRowGroup> row_groups_{};
+};
+
+// Exposed for unit tests
+export Vector<u8> SnappyDecompress(const u8 *input, SizeT input_size);
+
+// Decodes the RLE / bit-packed hybrid encoding used by levels and dictionary indices
+export class RleBitPackedDecoder {
+public:
+    // Throws if the bit width is above 32
+    RleBitPackedDecoder(const u8 *data, SizeT size, i32 bit_width);
+
+    void Decode(u32 *output, SizeT count);
+
+private:
+    bool NextRun();
+
+    const u8 *data_{};
+    const u8 *end_{};
+    i32 bit_width_{};
+    // remaining values of the current run
+    SizeT rle_left_{};
+    u32 rle_value_{};
+    SizeT packed_left_{};
+    const u8 *packed_data_{};
+    SizeT packed_idx_{};
+};
+
+} // namespace infinity
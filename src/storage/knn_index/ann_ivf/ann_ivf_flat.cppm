@@ -29,6 +29,7 @@ import knn_result_handler;
 import bitmask;
 import knn_expr;
 import internal_types;
+import third_party;
 
 namespace infinity {
 
@@ -144,11 +145,8 @@ public:
         }
     }
 
-    void Search(const AnnIVFFlatIndexData<DistType> *base_ivf, u32 segment_id, u32 n_probes, Bitmask &bitmask) {
-        if (bitmask.IsAllTrue()) {
-            Search(base_ivf, segment_id, n_probes);
-            return;
-        }
+    // only the segment offsets in the bitmap are searched
+    void Search(const AnnIVFFlatIndexData<DistType> *base_ivf, u32 segment_id, u32 n_probes, const RoaringBitmap &bitmap) {
         // check metric type
         if (base_ivf->metric_ != metric) {
             UnrecoverableError("Metric type is invalid");
@@ -176,7 +174,7 @@ public:
                 const DistType *y_j = base_ivf->vectors_[selected_centroid].data();
                 for (u32 j = 0; j < contain_nums; j++, y_j += this->dimension_) {
                     auto segment_offset = base_ivf->ids_[selected_centroid][j];
-                    if (bitmask.IsTrue(segment_offset)) {
+                    if (bitmap.contains(segment_offset)) {
                         DistType distance = Distance(x_i, y_j, this->dimension_);
                         result_handler_->AddResult(i, distance, RowID(segment_id, segment_offset));
                     }
@@ -202,7 +200,7 @@ public:
                     const DistType *y_j = base_ivf->vectors_[selected_centroid].data();
                     for (u32 j = 0; j < contain_nums; j++, y_j += this->dimension_) {
                         auto segment_offset = base_ivf->ids_[selected_centroid][j];
-                        if (bitmask.IsTrue(segment_offset)) {
+                        if (bitmap.contains(segment_offset)) {
                             DistType distance = Distance(x_i, y_j, this->dimension_);
                             result_handler_->AddResult(i, distance, RowID(segment_id, segment_offset));
                         }
@@ -172,8 +172,18 @@ public:
         }
     }
 
+    // drop all vertices
+    void Reset() {
+        for (VertexType vertex_i = loaded_vertex_n_; vertex_i < VertexType(max_vertex_num_); ++vertex_i) {
+            delete[] GetLevel0(vertex_i).GetLayers().first;
+        }
+        Init();
+    }
+
     i32 max_layer() const { return max_layer_; }
 
+    LayerSize GetLayerN(VertexType vertex_i) const { return GetLevel0(vertex_i).GetLayers().second; }
+
     VertexType enterpoint() const { return enterpoint_; }
 
     Pair<const VertexType *, VertexListSize> GetNeighbors(VertexType vertex_i, i32 layer_i) const {
@@ -279,8 +279,6 @@ private:
         }
     }
 
-    LabelType GetLabel(VertexType vertex_i) const { return data_store_.GetLabel(vertex_i); }
-
     template <bool WithLock = false, FilterConcept<LabelType> Filter = NoneType>
     Tuple<SizeT, UniquePtr<DataType[]>, UniquePtr<VertexType[]>> KnnSearchInner(const DataType *q, SizeT k, const Filter &filter) const {
         auto query = data_store_.MakeQuery(q);
@@ -395,6 +393,146 @@ public:
 
     SizeT GetVertexNum() const { return data_store_.cur_vec_num(); }
 
+    LabelType GetLabel(VertexType vertex_i) const { return data_store_.GetLabel(vertex_i); }
+
+    // Build the graph of stored vertices from the graph of `other` instead of inserting them one by one.
+    // Vertex v of `other` is vertex vertex_map[v] here, or dropped if it is -1. A vertex which loses neighbors with the dropped ones
+    // chooses its neighbors again among the remaining ones and the neighbors of the dropped ones.
+    // If this index has a graph already, each grafted vertex is also linked to it by a search with a small ef, which only looks for
+    // the links across the two graphs: the links inside `other` are kept.
+    void GraftGraph(const This &other, const Vector<VertexType> &vertex_map) {
+        if (other.M_ != M_ || vertex_map.size() > other.GetVertexNum()) {
+            UnrecoverableError("Can't graft hnsw graph with different parameters.");
+        }
+        const i32 base_max_layer = graph_store_.max_layer();
+        const VertexType base_enterpoint = graph_store_.enterpoint();
+        Vector<bool> grafted(data_store_.cur_vec_num(), false);
+        for (VertexType vertex_o = 0; vertex_o < VertexType(vertex_map.size()); ++vertex_o) {
+            if (VertexType vertex_i = vertex_map[vertex_o]; vertex_i >= 0) {
+                graph_store_.AddVertex(vertex_i, other.graph_store_.GetLayerN(vertex_o));
+                grafted[vertex_i] = true;
+            }
+        }
+
+        // 1. copy the neighbors, repair those of the dropped vertices
+        Vector<VertexType> candidate_idxes;
+        for (VertexType vertex_o = 0; vertex_o < VertexType(vertex_map.size()); ++vertex_o) {
+            const VertexType vertex_i = vertex_map[vertex_o];
+            if (vertex_i < 0) {
+                continue;
+            }
+            StoreType query = data_store_.GetVec(vertex_i);
+            for (i32 layer_idx = other.graph_store_.GetLayerN(vertex_o); layer_idx >= 0; --layer_idx) {
+                candidate_idxes.clear();
+                bool lost = false;
+                const auto [o_neighbors_p, o_neighbor_size] = other.graph_store_.GetNeighbors(vertex_o, layer_idx);
+                for (int i = 0; i < o_neighbor_size; ++i) {
+                    if (VertexType n_idx = vertex_map[o_neighbors_p[i]]; n_idx >= 0) {
+                        candidate_idxes.push_back(n_idx);
+                        continue;
+                    }
+                    lost = true;
+                    const auto [d_neighbors_p, d_neighbor_size] = other.graph_store_.GetNeighbors(o_neighbors_p[i], layer_idx);
+                    for (int j = 0; j < d_neighbor_size; ++j) {
+                        if (VertexType n_idx = vertex_map[d_neighbors_p[j]]; n_idx >= 0 && n_idx != vertex_i) {
+                            candidate_idxes.push_back(n_idx);
+                        }
+                    }
+                }
+                auto [neighbors_p, neighbor_size_p] = graph_store_.GetNeighborsMut(vertex_i, layer_idx);
+                if (!lost) {
+                    std::copy(candidate_idxes.begin(), candidate_idxes.end(), neighbors_p);
+                    *neighbor_size_p = candidate_idxes.size();
+                    continue;
+                }
+                std::sort(candidate_idxes.begin(), candidate_idxes.end());
+                candidate_idxes.erase(std::unique(candidate_idxes.begin(), candidate_idxes.end()), candidate_idxes.end());
+                Vector<PDV> candidates;
+                candidates.reserve(candidate_idxes.size());
+                for (VertexType n_idx : candidate_idxes) {
+                    candidates.emplace_back(distance_(query, data_store_.GetVec(n_idx), data_store_), n_idx);
+                }
+                SelectNeighborsHeuristic(std::move(candidates), layer_idx == 0 ? Mmax0_ : Mmax_, neighbors_p, neighbor_size_p);
+            }
+        }
+        if (base_max_layer < 0) {
+            return;
+        }
+
+        // 2. link the grafted vertices to the vertices which were in the graph
+        const SizeT merge_ef = Mmax0_;
+        Vector<VertexType> link_idxes;
+        for (VertexType vertex_o = 0; vertex_o < VertexType(vertex_map.size()); ++vertex_o) {
+            const VertexType vertex_i = vertex_map[vertex_o];
+            if (vertex_i < 0) {
+                continue;
+            }
+            StoreType query = data_store_.GetVec(vertex_i);
+            const i32 q_layer = other.graph_store_.GetLayerN(vertex_o);
+            VertexType ep = base_enterpoint;
+            for (i32 cur_layer = base_max_layer; cur_layer > q_layer; --cur_layer) {
+                ep = SearchLayerNearest(ep, query, cur_layer);
+            }
+            for (i32 cur_layer = std::min(q_layer, base_max_layer); cur_layer >= 0; --cur_layer) {
+                auto [result_n, d_ptr, v_ptr] = SearchLayer(ep, query, cur_layer, merge_ef, None);
+                auto [neighbors_p, neighbor_size_p] = graph_store_.GetNeighborsMut(vertex_i, cur_layer);
+                Vector<PDV> candidates;
+                candidates.reserve(*neighbor_size_p + result_n);
+                for (int i = 0; i < *neighbor_size_p; ++i) {
+                    candidates.emplace_back(distance_(query, data_store_.GetVec(neighbors_p[i]), data_store_), neighbors_p[i]);
+                }
+                SizeT nearest_i = 0;
+                for (SizeT i = 0; i < result_n; ++i) {
+                    if (d_ptr[i] < d_ptr[nearest_i]) {
+                        nearest_i = i;
+                    }
+                    if (!grafted[v_ptr[i]]) {
+                        candidates.emplace_back(d_ptr[i], v_ptr[i]);
+                    }
+                }
+                if (result_n > 0) {
+                    ep = v_ptr[nearest_i];
+                }
+                SelectNeighborsHeuristic(std::move(candidates), cur_layer == 0 ? Mmax0_ : Mmax_, neighbors_p, neighbor_size_p);
+                link_idxes.clear();
+                for (int i = 0; i < *neighbor_size_p; ++i) {
+                    if (!grafted[neighbors_p[i]]) {
+                        link_idxes.push_back(neighbors_p[i]);
+                    }
+                }
+                ConnectNeighbors<false>(vertex_i, link_idxes.data(), link_idxes.size(), cur_layer);
+            }
+        }
+    }
+
+    // number of vertices reachable from the enterpoint in layer 0, to check the quality of a grafted graph
+    SizeT ReachableVertexNum() const {
+        const SizeT vertex_n = data_store_.cur_vec_num();
+        if (vertex_n == 0 || graph_store_.max_layer() < 0) {
+            return 0;
+        }
+        Vector<bool> visited(vertex_n, false);
+        Vector<VertexType> stack{graph_store_.enterpoint()};
+        visited[graph_store_.enterpoint()] = true;
+        SizeT reachable_n = 0;
+        while (!stack.empty()) {
+            VertexType vertex_i = stack.back();
+            stack.pop_back();
+            ++reachable_n;
+            const auto [neighbors_p, neighbor_size] = graph_store_.GetNeighbors(vertex_i, 0);
+            for (int i = 0; i < neighbor_size; ++i) {
+                if (!visited[neighbors_p[i]]) {
+                    visited[neighbors_p[i]] = true;
+                    stack.push_back(neighbors_p[i]);
+                }
+            }
+        }
+        return reachable_n;
+    }
+
+    // drop the graph, keep the stored vertices
+    void ResetGraph() { graph_store_.Reset(); }
+
     void Save(FileHandler &file_handler) {
         file_handler.Write(&M_, sizeof(M_));
         file_handler.Write(&ef_construction_, sizeof(ef_construction_));
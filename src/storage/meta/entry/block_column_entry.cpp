@@ -35,6 +35,7 @@ import data_file_worker;
 import catalog_delta_entry;
 import internal_types;
 import data_type;
+import zone_map;
 
 namespace infinity {
 
@@ -101,7 +102,17 @@ void BlockColumnEntry::Append(const ColumnVector *input_column_vector, u16 input
         UnrecoverableError("Not initialize buffer handle");
     }
     ColumnVector &&column_vector = GetColumnVector(buffer_mgr);
+    SizeT block_offset = column_vector.Size();
     column_vector.AppendWith(*input_column_vector, input_column_vector_offset, append_rows);
+    UpdateZoneMap(column_vector, block_offset, append_rows);
+}
+
+void BlockColumnEntry::UpdateZoneMap(const ColumnVector &column_vector, SizeT offset, SizeT row_count) {
+    if (!ZoneMap::Supported(*column_type_)) {
+        return;
+    }
+    std::unique_lock lock(mutex_);
+    zone_map_.Update(column_vector, offset, row_count);
 }
 
 void BlockColumnEntry::Flush(BlockColumnEntry *block_column_entry, SizeT checkpoint_row_count) {
@@ -178,6 +189,9 @@ nlohmann::json BlockColumnEntry::Serialize() {
     {
         std::shared_lock lock(mutex_);
         json_res["next_outline_idx"] = outline_buffers_.size();
+        if (zone_map_.row_count() > 0) {
+            json_res["zone_map"] = zone_map_.Serialize();
+        }
     }
 
     json_res["commit_ts"] = TxnTimeStamp(this->commit_ts_);
@@ -191,6 +205,9 @@ BlockColumnEntry::Deserialize(const nlohmann::json &column_data_json, BlockEntry
     ColumnID column_id = column_data_json["column_id"];
     UniquePtr<BlockColumnEntry> block_column_entry = NewReplayBlockColumnEntry(block_entry, column_id, buffer_mgr);
     block_column_entry->outline_buffers_.assign(SizeT(column_data_json["next_outline_idx"]), nullptr);
+    if (column_data_json.contains("zone_map")) {
+        block_column_entry->zone_map_ = ZoneMap::Deserialize(column_data_json["zone_map"]);
+    }
 
     block_column_entry->commit_ts_ = column_data_json["commit_ts"];
     block_column_entry->begin_ts_ = column_data_json["begin_ts"];
@@ -27,6 +27,7 @@ import vector_buffer;
 import txn;
 import internal_types;
 import base_entry;
+import zone_map;
 
 namespace infinity {
 
@@ -79,6 +80,14 @@ public:
         return outline_buffers_.size();
     }
 
+    ZoneMap GetZoneMap() const {
+        std::shared_lock lock(mutex_);
+        return zone_map_;
+    }
+
+    // Merges rows [offset, offset + row_count) of the block column into the zone map, for the rows written without Append
+    void UpdateZoneMap(const ColumnVector &column_vector, SizeT offset, SizeT row_count);
+
 public:
     void Append(const ColumnVector *input_column_vector, u16 input_offset, SizeT append_rows, BufferManager *buffer_mgr);
 
@@ -95,6 +104,7 @@ private:
 
     mutable std::shared_mutex mutex_{};
     Vector<BufferObj *> outline_buffers_{};
+    ZoneMap zone_map_{};
 };
 
 } // namespace infinity
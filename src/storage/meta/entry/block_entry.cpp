@@ -207,6 +207,11 @@ bool BlockEntry::CheckVisible(BlockOffset block_offset, TxnTimeStamp check_ts) c
     return deleted[block_offset] == 0 || deleted[block_offset] > check_ts;
 }
 
+BlockOffset BlockEntry::GetVisibleRowCount(TxnTimeStamp begin_ts) const {
+    std::shared_lock lock(rw_locker_);
+    return block_version_->GetRowCount(begin_ts);
+}
+
 void BlockEntry::SetDeleteBitmask(TxnTimeStamp query_ts, Bitmask &bitmask) const {
     BlockOffset read_offset = 0;
     while (true) {
@@ -225,6 +230,26 @@ void BlockEntry::SetDeleteBitmask(TxnTimeStamp query_ts, Bitmask &bitmask) const
     }
 }
 
+void BlockEntry::CollectDeletedRows(TxnTimeStamp query_ts, RoaringBitmap &deleted_rows) const {
+    std::shared_lock lock(rw_locker_);
+    const auto &deleted = block_version_->deleted_;
+    const SegmentOffset block_segment_offset = SegmentOffset(block_id_) * DEFAULT_BLOCK_CAPACITY;
+    auto is_deleted = [&](BlockOffset block_offset) { return deleted[block_offset] != 0 && deleted[block_offset] <= query_ts; };
+    for (BlockOffset block_offset = 0; block_offset < row_count_;) {
+        if (!is_deleted(block_offset)) {
+            ++block_offset;
+            continue;
+        }
+        // add the whole run of deleted rows at once
+        BlockOffset run_end = block_offset + 1;
+        while (run_end < row_count_ && is_deleted(run_end)) {
+            ++run_end;
+        }
+        deleted_rows.addRange(block_segment_offset + block_offset, block_segment_offset + run_end);
+        block_offset = run_end;
+    }
+}
+
 u16 BlockEntry::AppendData(TransactionID txn_id,
                            DataBlock *input_data_block,
                            BlockOffset input_block_offset,
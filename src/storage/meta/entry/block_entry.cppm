@@ -150,8 +150,14 @@ public:
 
     bool CheckVisible(BlockOffset block_offset, TxnTimeStamp check_ts) const;
 
+    // Count of the leading rows committed before begin_ts, deleted rows included
+    BlockOffset GetVisibleRowCount(TxnTimeStamp begin_ts) const;
+
     void SetDeleteBitmask(TxnTimeStamp query_ts, Bitmask &bitmask) const;
 
+    // Add the segment offsets of the rows deleted before query_ts
+    void CollectDeletedRows(TxnTimeStamp query_ts, RoaringBitmap &deleted_rows) const;
+
     i32 GetAvailableCapacity();
 
     const String &DirPath() { return *block_dir_; }
@@ -33,6 +33,8 @@ import catalog_delta_entry;
 import annivfflat_index_file_worker;
 import hnsw_file_worker;
 import secondary_index_file_worker;
+import bsi_index_file_worker;
+import secondary_index_delta;
 import logger;
 import embedding_info;
 import create_index_info;
@@ -228,6 +230,10 @@ Vector<UniquePtr<IndexFileWorker>> ColumnIndexEntry::CreateFileWorker(CreateInde
             }
             break;
         }
+        case IndexType::kBSI: {
+            file_worker = MakeUnique<BSIIndexFileWorker>(this->col_index_dir(), file_name, index_base, column_def);
+            break;
+        }
         default: {
             UniquePtr<String> err_msg =
                 MakeUnique<String>(fmt::format("File worker isn't implemented: {}", IndexInfo::IndexTypeToString(index_base->index_type_)));
@@ -252,7 +258,8 @@ Status ColumnIndexEntry::CreateIndexPrepare(TableEntry *table_entry,
                                             Txn *txn,
                                             bool prepare,
                                             bool is_replay,
-                                            bool check_ts) {
+                                            bool check_ts,
+                                            const HashMap<SegmentID, Vector<CompactedSegmentSource>> *compacted_sources) {
     const auto *column_def = table_entry->GetColumnDefByID(column_id);
     auto *txn_store = txn->GetTxnTableStore(table_entry);
 
@@ -263,14 +270,46 @@ Status ColumnIndexEntry::CreateIndexPrepare(TableEntry *table_entry,
         SharedPtr<SegmentColumnIndexEntry> segment_column_index_entry =
             SegmentColumnIndexEntry::NewIndexEntry(this, segment_id, txn, create_index_param.get());
         if (!is_replay) {
-            segment_column_index_entry->CreateIndexPrepare(index_base_.get(), column_id, column_def, segment_entry, txn, prepare, check_ts);
+            // indexes of the old segments if the segment is built by compaction
+            Vector<Pair<SegmentColumnIndexEntry *, const Vector<SegmentOffset> *>> merge_sources;
+            if (compacted_sources != nullptr) {
+                if (auto iter = compacted_sources->find(segment_id); iter != compacted_sources->end()) {
+                    for (const auto &source : iter->second) {
+                        if (auto old_iter = index_by_segment_.find(source.old_segment_id_); old_iter != index_by_segment_.end()) {
+                            merge_sources.emplace_back(old_iter->second.get(), &source.new_offsets_);
+                        }
+                    }
+                }
+            }
+            segment_column_index_entry
+                ->CreateIndexPrepare(index_base_.get(), column_id, column_def, segment_entry, txn, prepare, check_ts, merge_sources);
         }
         txn_store->CreateIndexFile(table_index_entry_, column_id, segment_id, segment_column_index_entry);
         index_by_segment_.emplace(segment_id, segment_column_index_entry);
+        {
+            // the rows appended so far are in the new index
+            std::lock_guard lock(delta_locker_);
+            delta_by_segment_.erase(segment_id);
+        }
     }
     return Status::OK();
 }
 
+SharedPtr<SecondaryIndexDelta> ColumnIndexEntry::GetSecondaryIndexDelta(SegmentID segment_id, SegmentOffset begin_offset, const DataType &data_type) {
+    std::lock_guard lock(delta_locker_);
+    SharedPtr<SecondaryIndexDelta> &delta = delta_by_segment_[segment_id];
+    // a delta beginning after begin_offset misses rows, one beginning before it only holds rows the index also has
+    if (delta.get() == nullptr or delta->BeginOffset() > begin_offset) {
+        delta = MakeSecondaryIndexDelta(data_type, begin_offset);
+    }
+    return delta;
+}
+
+void ColumnIndexEntry::DropSecondaryIndexDelta(SegmentID segment_id) {
+    std::lock_guard lock(delta_locker_);
+    delta_by_segment_.erase(segment_id);
+}
+
 Status ColumnIndexEntry::CreateIndexDo(const ColumnDef *column_def, HashMap<u32, atomic_u64> &create_index_idxes) {
     for (auto &[segment_id, segment_column_index_entry] : index_by_segment_) {
         atomic_u64 &create_index_idx = create_index_idxes.at(segment_id);
@@ -298,6 +337,9 @@ UniquePtr<CreateIndexParam> ColumnIndexEntry::GetCreateIndexParam(SizeT seg_row_
             u32 part_capacity = DEFAULT_BLOCK_CAPACITY;
             return MakeUnique<CreateSecondaryIndexParam>(index_base_.get(), column_def, seg_row_count, seg_actual_row_count, part_capacity);
         }
+        case IndexType::kBSI: {
+            return MakeUnique<CreateBSIIndexParam>(index_base_.get(), column_def);
+        }
         default: {
             UniquePtr<String> err_msg =
                 MakeUnique<String>(fmt::format("Invalid index type: {}", IndexInfo::IndexTypeToString(index_base_->index_type_)));
@@ -26,6 +26,7 @@ import status;
 import column_def;
 import base_entry;
 import segment_column_index_entry;
+import data_type;
 
 namespace infinity {
 
@@ -35,6 +36,7 @@ class BufferManager;
 struct TableEntry;
 class Txn;
 class BlockIndex;
+class SecondaryIndexDelta;
 
 export struct ColumnIndexEntry : public BaseEntry {
     friend struct TableEntry;
@@ -86,9 +88,21 @@ public:
 
     UniquePtr<CreateIndexParam> GetCreateIndexParam(SizeT seg_row_count, SizeT seg_actual_row_count, const ColumnDef *column_def);
 
+    // In-memory index of the rows appended to the segment after its index was built, i.e. rows [begin_offset, ...).
+    // Created on first use, dropped when the segment index is built again or the segment is compacted away.
+    SharedPtr<SecondaryIndexDelta> GetSecondaryIndexDelta(SegmentID segment_id, SegmentOffset begin_offset, const DataType &data_type);
+
+    void DropSecondaryIndexDelta(SegmentID segment_id);
+
 private:
-    Status
-    CreateIndexPrepare(TableEntry *table_entry, BlockIndex *block_index, ColumnID column_id, Txn *txn, bool prepare, bool is_replay, bool check_ts);
+    Status CreateIndexPrepare(TableEntry *table_entry,
+                              BlockIndex *block_index,
+                              ColumnID column_id,
+                              Txn *txn,
+                              bool prepare,
+                              bool is_replay,
+                              bool check_ts,
+                              const HashMap<SegmentID, Vector<CompactedSegmentSource>> *compacted_sources = nullptr);
 
     Status CreateIndexDo(const ColumnDef *column_def, HashMap<u32, atomic_u64> &create_index_idxes);
 
@@ -104,5 +118,8 @@ private:
     SharedPtr<String> col_index_dir_{};
     const SharedPtr<IndexBase> index_base_{};
     HashMap<SegmentID, SharedPtr<SegmentColumnIndexEntry>> index_by_segment_{};
+
+    std::mutex delta_locker_{};
+    HashMap<SegmentID, SharedPtr<SecondaryIndexDelta>> delta_by_segment_{};
 };
 } // namespace infinity
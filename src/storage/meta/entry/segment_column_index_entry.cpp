@@ -14,6 +14,7 @@
 
 module;
 
+#include <numeric>
 #include <vector>
 
 module segment_column_index_entry;
@@ -47,6 +48,9 @@ import column_def;
 import block_column_entry;
 import default_values;
 import segment_iter;
+import bsi;
+import internal_types;
+import data_type;
 
 namespace infinity {
 
@@ -126,6 +130,129 @@ UniquePtr<SegmentColumnIndexEntry> SegmentColumnIndexEntry::LoadIndexEntry(Colum
     return UniquePtr<SegmentColumnIndexEntry>(new SegmentColumnIndexEntry(column_index_entry, segment_id, std::move(vector_buffer)));
 }
 
+namespace {
+
+template <typename RawValueType, bool CheckTS>
+void BuildBSIIndexT(const SegmentEntry *segment_entry, BufferManager *buffer_mgr, ColumnID column_id, TxnTimeStamp begin_ts, BitSlicedIndex *index) {
+    OneColumnIterator<RawValueType, CheckTS> iter(segment_entry, buffer_mgr, column_id, begin_ts);
+    Vector<u32> offsets;
+    Vector<i64> keys;
+    offsets.reserve(segment_entry->actual_row_count());
+    keys.reserve(segment_entry->actual_row_count());
+    while (true) {
+        auto pair_opt = iter.Next();
+        if (!pair_opt) {
+            break;
+        }
+        auto &[val_ptr, offset] = pair_opt.value();
+        offsets.push_back(offset);
+        keys.push_back(ConvertToOrderedKeyValue<RawValueType>(*val_ptr));
+    }
+    index->Build(offsets, keys, segment_entry->row_count());
+}
+
+template <bool CheckTS>
+void BuildBSIIndex(const DataType &data_type,
+                   const SegmentEntry *segment_entry,
+                   BufferManager *buffer_mgr,
+                   ColumnID column_id,
+                   TxnTimeStamp begin_ts,
+                   BitSlicedIndex *index) {
+    switch (data_type.type()) {
+        case LogicalType::kTinyInt: {
+            return BuildBSIIndexT<TinyIntT, CheckTS>(segment_entry, buffer_mgr, column_id, begin_ts, index);
+        }
+        case LogicalType::kSmallInt: {
+            return BuildBSIIndexT<SmallIntT, CheckTS>(segment_entry, buffer_mgr, column_id, begin_ts, index);
+        }
+        case LogicalType::kInteger: {
+            return BuildBSIIndexT<IntegerT, CheckTS>(segment_entry, buffer_mgr, column_id, begin_ts, index);
+        }
+        case LogicalType::kBigInt: {
+            return BuildBSIIndexT<BigIntT, CheckTS>(segment_entry, buffer_mgr, column_id, begin_ts, index);
+        }
+        case LogicalType::kDate: {
+            return BuildBSIIndexT<DateT, CheckTS>(segment_entry, buffer_mgr, column_id, begin_ts, index);
+        }
+        case LogicalType::kTime: {
+            return BuildBSIIndexT<TimeT, CheckTS>(segment_entry, buffer_mgr, column_id, begin_ts, index);
+        }
+        case LogicalType::kDateTime: {
+            return BuildBSIIndexT<DateTimeT, CheckTS>(segment_entry, buffer_mgr, column_id, begin_ts, index);
+        }
+        case LogicalType::kTimestamp: {
+            return BuildBSIIndexT<TimestampT, CheckTS>(segment_entry, buffer_mgr, column_id, begin_ts, index);
+        }
+        default: {
+            UnrecoverableError(fmt::format("Cannot build bsi index on data type: {}", data_type.ToString()));
+        }
+    }
+}
+
+// Build the graph of hnsw_index, whose vertices are stored already, from the graphs of the old segments compacted into its segment.
+// The largest graph is kept as it is, the others are grafted to it, and the rows not in any old graph are inserted.
+// Rebuild the graph from scratch if the merged one has too many vertices unreachable.
+template <typename HnswIndex>
+void MergeHnswIndex(HnswIndex *hnsw_index,
+                    const Vector<Pair<SegmentColumnIndexEntry *, const Vector<SegmentOffset> *>> &merge_sources,
+                    SegmentOffset segment_row_count) {
+    const SizeT vertex_n = hnsw_index->GetVertexNum();
+    // the label of a vertex is its segment offset
+    Vector<VertexType> offset_to_vertex(segment_row_count, -1);
+    for (VertexType vertex_i = 0; vertex_i < VertexType(vertex_n); ++vertex_i) {
+        offset_to_vertex[hnsw_index->GetLabel(vertex_i)] = vertex_i;
+    }
+
+    Vector<Pair<BufferHandle, const HnswIndex *>> old_indexes;
+    for (const auto &[old_index_entry, new_offsets] : merge_sources) {
+        BufferHandle old_handle = old_index_entry->GetIndex();
+        auto *old_index = static_cast<const HnswIndex *>(old_handle.GetData());
+        old_indexes.emplace_back(std::move(old_handle), old_index);
+    }
+    Vector<SizeT> merge_order(merge_sources.size());
+    std::iota(merge_order.begin(), merge_order.end(), 0);
+    std::sort(merge_order.begin(), merge_order.end(), [&](SizeT a, SizeT b) {
+        return old_indexes[a].second->GetVertexNum() > old_indexes[b].second->GetVertexNum();
+    });
+
+    Vector<bool> grafted(vertex_n, false);
+    for (SizeT source_i : merge_order) {
+        const auto *old_index = old_indexes[source_i].second;
+        const Vector<SegmentOffset> &new_offsets = *merge_sources[source_i].second;
+        Vector<VertexType> vertex_map(old_index->GetVertexNum(), -1);
+        for (VertexType old_vertex = 0; old_vertex < VertexType(vertex_map.size()); ++old_vertex) {
+            SegmentOffset old_offset = old_index->GetLabel(old_vertex);
+            if (old_offset >= new_offsets.size() or new_offsets[old_offset] == INVALID_SEGMENT_OFFSET) {
+                // deleted before compaction
+                continue;
+            }
+            VertexType new_vertex = offset_to_vertex[new_offsets[old_offset]];
+            if (new_vertex >= 0) {
+                vertex_map[old_vertex] = new_vertex;
+                grafted[new_vertex] = true;
+            }
+        }
+        hnsw_index->GraftGraph(*old_index, vertex_map);
+    }
+    // rows appended to the old segments after their indexes were built
+    for (VertexType vertex_i = 0; vertex_i < VertexType(vertex_n); ++vertex_i) {
+        if (!grafted[vertex_i]) {
+            hnsw_index->Build(vertex_i);
+        }
+    }
+
+    const SizeT reachable_n = hnsw_index->ReachableVertexNum();
+    if (reachable_n < vertex_n * HNSW_MERGE_MIN_REACHABLE_RATIO) {
+        LOG_WARN(fmt::format("Merged hnsw graph has {} of {} vertices reachable, rebuild it.", reachable_n, vertex_n));
+        hnsw_index->ResetGraph();
+        for (VertexType vertex_i = 0; vertex_i < VertexType(vertex_n); ++vertex_i) {
+            hnsw_index->Build(vertex_i);
+        }
+    }
+}
+
+} // namespace
+
 BufferHandle SegmentColumnIndexEntry::GetIndex() { return vector_buffer_[0]->Load(); }
 
 BufferHandle SegmentColumnIndexEntry::GetIndexPartAt(u32 idx) { return vector_buffer_[idx + 1]->Load(); }
@@ -136,7 +263,8 @@ Status SegmentColumnIndexEntry::CreateIndexPrepare(const IndexBase *index_base,
                                                    const SegmentEntry *segment_entry,
                                                    Txn *txn,
                                                    bool prepare,
-                                                   bool check_ts) {
+                                                   bool check_ts,
+                                                   const Vector<Pair<SegmentColumnIndexEntry *, const Vector<SegmentOffset> *>> &merge_sources) {
     TxnTimeStamp begin_ts = txn->BeginTS();
 
     auto *buffer_mgr = txn->GetBufferMgr();
@@ -187,7 +315,11 @@ Status SegmentColumnIndexEntry::CreateIndexPrepare(const IndexBase *index_base,
 
             auto InsertHnsw = [&](auto &hnsw_index) {
                 auto InsertHnswInner = [&](auto &iter) {
-                    if (!prepare) {
+                    if (!prepare && !merge_sources.empty()) {
+                        // Single thread insert, reuse the graphs of the compacted segments
+                        hnsw_index->StoreData(iter, segment_entry->row_count());
+                        MergeHnswIndex(hnsw_index, merge_sources, segment_entry->row_count());
+                    } else if (!prepare) {
                         // Single thread insert
                         hnsw_index->InsertVecs(iter, segment_entry->row_count()); // estimate insert count
                     } else {
@@ -303,6 +435,18 @@ Status SegmentColumnIndexEntry::CreateIndexPrepare(const IndexBase *index_base,
             secondary_index_builder->EndOutput();
             break;
         }
+        case IndexType::kBSI: {
+            auto &data_type = column_def->type();
+            BufferHandle buffer_handle = GetIndex();
+            auto bsi_index = static_cast<BitSlicedIndex *>(buffer_handle.GetDataMut());
+            if (check_ts) {
+                BuildBSIIndex<true>(*data_type, segment_entry, buffer_mgr, column_id, begin_ts, bsi_index);
+            } else {
+                // Not check ts in uncommitted segment when compress segment
+                BuildBSIIndex<false>(*data_type, segment_entry, buffer_mgr, column_id, begin_ts, bsi_index);
+            }
+            break;
+        }
         default: {
             UniquePtr<String> err_msg =
                 MakeUnique<String>(fmt::format("Invalid index type: {}", IndexInfo::IndexTypeToString(index_base->index_type_)));
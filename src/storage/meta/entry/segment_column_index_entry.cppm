@@ -36,6 +36,13 @@ class BufferManager;
 class IndexDef;
 struct SegmentEntry;
 
+// Rows of an old segment compacted into a new segment: new_offsets_[i] is the offset of row i in the new segment,
+// INVALID_SEGMENT_OFFSET if the row is not moved.
+export struct CompactedSegmentSource {
+    SegmentID old_segment_id_{};
+    Vector<SegmentOffset> new_offsets_{};
+};
+
 export class SegmentColumnIndexEntry : public BaseEntry {
     friend ColumnIndexEntry;
 
@@ -86,13 +93,15 @@ private:
     static UniquePtr<SegmentColumnIndexEntry>
     LoadIndexEntry(ColumnIndexEntry *column_index_entry, u32 segment_id, BufferManager *buffer_manager, CreateIndexParam *create_index_param);
 
+    // merge_sources: indexes of the old segments compacted into the segment and the new offsets of their rows
     Status CreateIndexPrepare(const IndexBase *index_base,
                               ColumnID column_id,
                               const ColumnDef *column_def,
                               const SegmentEntry *segment_entry,
                               Txn *txn,
                               bool prepare,
-                              bool check_ts);
+                              bool check_ts,
+                              const Vector<Pair<SegmentColumnIndexEntry *, const Vector<SegmentOffset> *>> &merge_sources = {});
 
     Status CreateIndexDo(const IndexBase *index_base, const ColumnDef *column_def, atomic_u64 &create_index_idx);
 
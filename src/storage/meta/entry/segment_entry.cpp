@@ -173,6 +173,18 @@ bool SegmentEntry::CheckAnyDelete(TxnTimeStamp check_ts) const {
     return first_delete_ts_ < check_ts;
 }
 
+RoaringBitmap SegmentEntry::GetDeletedRows(TxnTimeStamp check_ts) const {
+    RoaringBitmap deleted_rows;
+    if (!CheckAnyDelete(check_ts)) {
+        return deleted_rows;
+    }
+    std::shared_lock lock(rw_locker_);
+    for (const auto &block_entry : block_entries_) {
+        block_entry->CollectDeletedRows(check_ts, deleted_rows);
+    }
+    return deleted_rows;
+}
+
 // called by one thread
 BlockID SegmentEntry::GetNextBlockID() const { return block_entries_.size(); }
 
@@ -109,6 +109,9 @@ public:
     // Check if the segment has any delete before check_ts
     bool CheckAnyDelete(TxnTimeStamp check_ts) const;
 
+    // Segment offsets of the rows deleted before check_ts
+    RoaringBitmap GetDeletedRows(TxnTimeStamp check_ts) const;
+
     // `this` is visible in one thread
     BlockID GetNextBlockID() const;
 
@@ -335,6 +335,9 @@ Status TableEntry::CommitCompact(TransactionID txn_id, TxnTimeStamp commit_ts, c
         std::unique_lock lock(this->rw_locker_);
         for (const auto &old_segment : old_segments) {
             old_segment->SetDeprecated(commit_ts);
+            for (auto &[_, table_index_meta] : this->index_meta_map_) {
+                table_index_meta->DropSecondaryIndexDelta(old_segment->segment_id());
+            }
         }
         ImportSegment(commit_ts, new_segment, true); // call the function with lock holding
     }
@@ -33,6 +33,8 @@ import iresearch_datastore;
 import extra_ddl_info;
 
 import txn;
+import table_index_entry;
+import column_index_entry;
 
 namespace infinity {
 
@@ -410,6 +412,18 @@ void TableIndexMeta::DeleteNewEntry(TransactionID txn_id, TxnManager *) {
     this->entry_list_.erase(removed_iter, this->entry_list_.end());
 }
 
+void TableIndexMeta::DropSecondaryIndexDelta(SegmentID segment_id) {
+    std::shared_lock<std::shared_mutex> r_locker(this->rw_locker_);
+    for (const auto &entry : this->entry_list_) {
+        if (entry->entry_type_ != EntryType::kTableIndex) {
+            continue;
+        }
+        for (auto &[_, column_index_entry] : static_cast<TableIndexEntry *>(entry.get())->column_index_map()) {
+            column_index_entry->DropSecondaryIndexDelta(segment_id);
+        }
+    }
+}
+
 void TableIndexMeta::MergeFrom(TableIndexMeta &other) {
     if (!IsEqual(*this->index_name_, *other.index_name_)) {
         UnrecoverableError("TableIndexMeta::MergeFrom requires index_name_ match");
@@ -69,6 +69,9 @@ private:
 
     void MergeFrom(TableIndexMeta &other);
 
+    // the segment is deprecated by compaction, its rows are scanned from the new segment
+    void DropSecondaryIndexDelta(SegmentID segment_id);
+
     Tuple<TableIndexEntry *, Status> CreateTableIndexEntryInternal(const SharedPtr<IndexDef> &index_def,
                                                                    TransactionID txn_id,
                                                                    TxnTimeStamp begin_ts,
@@ -0,0 +1,251 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cmath>
+
+module zone_map;
+
+import stl;
+import third_party;
+import column_vector;
+import value;
+import data_type;
+import logical_type;
+import internal_types;
+import infinity_exception;
+
+namespace infinity {
+
+namespace {
+
+template <typename T>
+inline i64 IntKey(const T &value) {
+    if constexpr (std::is_same_v<T, DateT> or std::is_same_v<T, TimeT>) {
+        return value.GetValue();
+    } else if constexpr (std::is_same_v<T, DateTimeT> or std::is_same_v<T, TimestampT>) {
+        return value.GetEpochTime();
+    } else {
+        return static_cast<i64>(value);
+    }
+}
+
+} // namespace
+
+bool ZoneMap::OrderKey(const Value &value, i64 &int_key, double &float_key, bool &is_float) {
+    is_float = false;
+    switch (value.type().type()) {
+        case kTinyInt: {
+            int_key = value.GetValue<TinyIntT>();
+            return true;
+        }
+        case kSmallInt: {
+            int_key = value.GetValue<SmallIntT>();
+            return true;
+        }
+        case kInteger: {
+            int_key = value.GetValue<IntegerT>();
+            return true;
+        }
+        case kBigInt: {
+            int_key = value.GetValue<BigIntT>();
+            return true;
+        }
+        case kDate: {
+            int_key = IntKey(value.GetValue<DateT>());
+            return true;
+        }
+        case kTime: {
+            int_key = IntKey(value.GetValue<TimeT>());
+            return true;
+        }
+        case kDateTime: {
+            int_key = IntKey(value.GetValue<DateTimeT>());
+            return true;
+        }
+        case kTimestamp: {
+            int_key = IntKey(value.GetValue<TimestampT>());
+            return true;
+        }
+        case kFloat: {
+            is_float = true;
+            float_key = value.GetValue<FloatT>();
+            return !std::isnan(float_key);
+        }
+        case kDouble: {
+            is_float = true;
+            float_key = value.GetValue<DoubleT>();
+            return !std::isnan(float_key);
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+template <typename T>
+void ZoneMap::UpdateKeys(const ColumnVector &column_vector, SizeT offset, SizeT row_count) {
+    const auto *data = reinterpret_cast<const T *>(column_vector.data());
+    const bool all_valid = column_vector.nulls_ptr_->IsAllTrue();
+    for (SizeT idx = offset; idx < offset + row_count; ++idx) {
+        if (!all_valid and !column_vector.nulls_ptr_->IsTrue(idx)) {
+            ++null_count_;
+            continue;
+        }
+        if constexpr (std::is_floating_point_v<T>) {
+            // NaN fails every comparison, so it can't make a filter match
+            if (std::isnan(data[idx])) {
+                continue;
+            }
+            MergeKey(static_cast<double>(data[idx]));
+        } else {
+            MergeKey(IntKey(data[idx]));
+        }
+    }
+}
+
+void ZoneMap::MergeKey(i64 key) {
+    if (!has_value_) {
+        min_int_ = max_int_ = key;
+        has_value_ = true;
+        return;
+    }
+    min_int_ = std::min(min_int_, key);
+    max_int_ = std::max(max_int_, key);
+}
+
+void ZoneMap::MergeKey(double key) {
+    if (!has_value_) {
+        min_float_ = max_float_ = key;
+        has_value_ = true;
+        return;
+    }
+    min_float_ = std::min(min_float_, key);
+    max_float_ = std::max(max_float_, key);
+}
+
+void ZoneMap::Update(const ColumnVector &column_vector, SizeT offset, SizeT row_count) {
+    if (column_vector.vector_type() != ColumnVectorType::kFlat) {
+        UnrecoverableError("Zone map can only be built from a flat column vector.");
+    }
+    switch (column_vector.data_type()->type()) {
+        case kTinyInt: {
+            UpdateKeys<TinyIntT>(column_vector, offset, row_count);
+            break;
+        }
+        case kSmallInt: {
+            UpdateKeys<SmallIntT>(column_vector, offset, row_count);
+            break;
+        }
+        case kInteger: {
+            UpdateKeys<IntegerT>(column_vector, offset, row_count);
+            break;
+        }
+        case kBigInt: {
+            UpdateKeys<BigIntT>(column_vector, offset, row_count);
+            break;
+        }
+        case kDate: {
+            UpdateKeys<DateT>(column_vector, offset, row_count);
+            break;
+        }
+        case kTime: {
+            UpdateKeys<TimeT>(column_vector, offset, row_count);
+            break;
+        }
+        case kDateTime: {
+            UpdateKeys<DateTimeT>(column_vector, offset, row_count);
+            break;
+        }
+        case kTimestamp: {
+            UpdateKeys<TimestampT>(column_vector, offset, row_count);
+            break;
+        }
+        case kFloat: {
+            is_float_ = true;
+            UpdateKeys<FloatT>(column_vector, offset, row_count);
+            break;
+        }
+        case kDouble: {
+            is_float_ = true;
+            UpdateKeys<DoubleT>(column_vector, offset, row_count);
+            break;
+        }
+        default: {
+            UnrecoverableError(fmt::format("Zone map isn't supported for {}", column_vector.data_type()->ToString()));
+        }
+    }
+    row_count_ += row_count;
+}
+
+bool ZoneMap::MayContainLessEqual(const Value &value) const {
+    i64 int_key{};
+    double float_key{};
+    bool is_float{};
+    if (!OrderKey(value, int_key, float_key, is_float) or is_float != is_float_) {
+        return true;
+    }
+    if (!has_value_) {
+        return false;
+    }
+    return is_float ? min_float_ <= float_key : min_int_ <= int_key;
+}
+
+bool ZoneMap::MayContainGreaterEqual(const Value &value) const {
+    i64 int_key{};
+    double float_key{};
+    bool is_float{};
+    if (!OrderKey(value, int_key, float_key, is_float) or is_float != is_float_) {
+        return true;
+    }
+    if (!has_value_) {
+        return false;
+    }
+    return is_float ? max_float_ >= float_key : max_int_ >= int_key;
+}
+
+nlohmann::json ZoneMap::Serialize() const {
+    nlohmann::json json_res;
+    json_res["row_count"] = row_count_;
+    json_res["null_count"] = null_count_;
+    json_res["has_value"] = has_value_;
+    json_res["is_float"] = is_float_;
+    if (is_float_) {
+        json_res["min"] = min_float_;
+        json_res["max"] = max_float_;
+    } else {
+        json_res["min"] = min_int_;
+        json_res["max"] = max_int_;
+    }
+    return json_res;
+}
+
+ZoneMap ZoneMap::Deserialize(const nlohmann::json &zone_map_json) {
+    ZoneMap zone_map;
+    zone_map.row_count_ = zone_map_json["row_count"];
+    zone_map.null_count_ = zone_map_json["null_count"];
+    zone_map.has_value_ = zone_map_json["has_value"];
+    zone_map.is_float_ = zone_map_json["is_float"];
+    if (zone_map.is_float_) {
+        zone_map.min_float_ = zone_map_json["min"];
+        zone_map.max_float_ = zone_map_json["max"];
+    } else {
+        zone_map.min_int_ = zone_map_json["min"];
+        zone_map.max_int_ = zone_map_json["max"];
+    }
+    return zone_map;
+}
+
+} // namespace infinity
@@ -0,0 +1,76 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module zone_map;
+
+import stl;
+import third_party;
+import column_vector;
+import value;
+import data_type;
+
+namespace infinity {
+
+// Min / max / null count of one column in one block, so that scans can skip the blocks which can't match a filter.
+// Kept for the types with an order that filters are pushed down for (see DataType::CanBuildSecondaryIndex).
+// Integers, date and time are compared as i64 keys, float and double as double keys.
+export class ZoneMap {
+public:
+    static bool Supported(const DataType &data_type) { return data_type.CanBuildSecondaryIndex(); }
+
+    // Merges rows [offset, offset + row_count) of the column vector. Rows must be merged in order, since row_count()
+    // tells a scan how many leading rows of the block the zone map covers.
+    void Update(const ColumnVector &column_vector, SizeT offset, SizeT row_count);
+
+    // Whether some row of the block may be less or equal / greater or equal / equal to the value
+    bool MayContainLessEqual(const Value &value) const;
+
+    bool MayContainGreaterEqual(const Value &value) const;
+
+    bool MayContainEqual(const Value &value) const { return MayContainLessEqual(value) and MayContainGreaterEqual(value); }
+
+    // The key a value is compared with as: i64 for integers, date and time, double for float and double.
+    // Returns false for the types zone maps aren't kept for and for NaN.
+    static bool OrderKey(const Value &value, i64 &int_key, double &float_key, bool &is_float);
+
+    inline SizeT row_count() const { return row_count_; }
+
+    inline SizeT null_count() const { return null_count_; }
+
+    nlohmann::json Serialize() const;
+
+    static ZoneMap Deserialize(const nlohmann::json &zone_map_json);
+
+private:
+    template <typename T>
+    void UpdateKeys(const ColumnVector &column_vector, SizeT offset, SizeT row_count);
+
+    void MergeKey(i64 key);
+
+    void MergeKey(double key);
+
+    SizeT row_count_{};
+    SizeT null_count_{};
+    // false when all the rows are null
+    bool has_value_{false};
+    bool is_float_{false};
+    i64 min_int_{};
+    i64 max_int_{};
+    double min_float_{};
+    double max_float_{};
+};
+
+} // namespace infinity
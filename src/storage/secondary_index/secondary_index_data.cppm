@@ -173,6 +173,7 @@ public:
 
     [[nodiscard]] u32 GetPartCapacity() const { return part_capacity_; }
     [[nodiscard]] u32 GetPartNum() const { return part_num_; }
+    [[nodiscard]] u32 GetFullDataNum() const { return full_data_num_; }
     [[nodiscard]] u32 GetDataNum() const { return data_num_; }
 
     [[nodiscard]] auto SearchPGM(const void *val_ptr) const {
@@ -0,0 +1,67 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+module secondary_index_delta;
+
+import stl;
+import third_party;
+import logical_type;
+import data_type;
+import internal_types;
+import infinity_exception;
+
+namespace infinity {
+
+SharedPtr<SecondaryIndexDelta> MakeSecondaryIndexDelta(const DataType &data_type, SegmentOffset begin_offset) {
+    switch (data_type.type()) {
+        case LogicalType::kTinyInt: {
+            return MakeShared<SecondaryIndexDeltaT<TinyIntT>>(begin_offset);
+        }
+        case LogicalType::kSmallInt: {
+            return MakeShared<SecondaryIndexDeltaT<SmallIntT>>(begin_offset);
+        }
+        case LogicalType::kInteger: {
+            return MakeShared<SecondaryIndexDeltaT<IntegerT>>(begin_offset);
+        }
+        case LogicalType::kBigInt: {
+            return MakeShared<SecondaryIndexDeltaT<BigIntT>>(begin_offset);
+        }
+        case LogicalType::kFloat: {
+            return MakeShared<SecondaryIndexDeltaT<FloatT>>(begin_offset);
+        }
+        case LogicalType::kDouble: {
+            return MakeShared<SecondaryIndexDeltaT<DoubleT>>(begin_offset);
+        }
+        case LogicalType::kDate: {
+            return MakeShared<SecondaryIndexDeltaT<DateT>>(begin_offset);
+        }
+        case LogicalType::kTime: {
+            return MakeShared<SecondaryIndexDeltaT<TimeT>>(begin_offset);
+        }
+        case LogicalType::kDateTime: {
+            return MakeShared<SecondaryIndexDeltaT<DateTimeT>>(begin_offset);
+        }
+        case LogicalType::kTimestamp: {
+            return MakeShared<SecondaryIndexDeltaT<TimestampT>>(begin_offset);
+        }
+        default: {
+            UnrecoverableError(fmt::format("Need to add secondary index delta support for data type: {}", data_type.ToString()));
+            return nullptr;
+        }
+    }
+}
+
+} // namespace infinity
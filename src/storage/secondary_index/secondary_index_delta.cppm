@@ -0,0 +1,155 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <algorithm>
+
+export module secondary_index_delta;
+
+import stl;
+import third_party;
+import buffer_manager;
+import segment_entry;
+import block_entry;
+import block_column_entry;
+import column_vector;
+import segment_iter;
+import secondary_index_data;
+import default_values;
+import data_type;
+import internal_types;
+
+namespace infinity {
+
+// Rows appended to a segment after its secondary index was built: [begin_offset, ...) of the segment.
+// Kept in memory only, as (key, offset) pairs sorted by key. Index scans read the newly committed rows into it before searching.
+// It is dropped when the segment index is built again (e.g. for the compacted segment), which folds these rows into the index.
+export class SecondaryIndexDelta {
+public:
+    explicit SecondaryIndexDelta(SegmentOffset begin_offset) : begin_offset_(begin_offset) {}
+
+    virtual ~SecondaryIndexDelta() = default;
+
+    // first segment offset which is not covered by the segment index
+    [[nodiscard]] inline SegmentOffset BeginOffset() const { return begin_offset_; }
+
+protected:
+    const SegmentOffset begin_offset_{};
+};
+
+export template <typename RawValueType>
+class SecondaryIndexDeltaT final : public SecondaryIndexDelta {
+public:
+    using KeyType = ConvertToOrderedType<RawValueType>;
+    using KeyOffsetPair = Pair<KeyType, SegmentOffset>;
+
+    explicit SecondaryIndexDeltaT(SegmentOffset begin_offset) : SecondaryIndexDelta(begin_offset) {}
+
+    // Add the offsets of the delta rows visible at begin_ts with lower <= key <= upper to result
+    void Search(const SegmentEntry *segment_entry,
+                BufferManager *buffer_mgr,
+                ColumnID column_id,
+                TxnTimeStamp begin_ts,
+                KeyType lower,
+                KeyType upper,
+                RoaringBitmap &result) {
+        // rows of each block visible to the caller, the delta may already hold rows committed later
+        Vector<SegmentOffset> visible_end;
+        {
+            std::unique_lock lock(rw_locker_);
+            BlockEntryIter block_iter(segment_entry);
+            for (auto *block_entry = block_iter.Next(); block_entry != nullptr; block_entry = block_iter.Next()) {
+                const BlockOffset row_count = block_entry->GetVisibleRowCount(begin_ts);
+                const SegmentOffset block_begin = SegmentOffset(block_entry->block_id()) * DEFAULT_BLOCK_CAPACITY;
+                visible_end.push_back(block_begin + row_count);
+                ReadBlock(block_entry, buffer_mgr, column_id, row_count);
+            }
+            MergeNewPairs();
+        }
+        if (lower > upper) {
+            return;
+        }
+        Vector<SegmentOffset> offsets;
+        {
+            std::shared_lock lock(rw_locker_);
+            auto first = std::lower_bound(sorted_pairs_.begin(), sorted_pairs_.end(), lower, [](const KeyOffsetPair &pair, const KeyType &key) {
+                return pair.first < key;
+            });
+            auto last = std::upper_bound(first, sorted_pairs_.end(), upper, [](const KeyType &key, const KeyOffsetPair &pair) {
+                return key < pair.first;
+            });
+            for (auto iter = first; iter != last; ++iter) {
+                const SegmentOffset offset = iter->second;
+                if (const SizeT block_idx = offset / DEFAULT_BLOCK_CAPACITY; block_idx < visible_end.size() and offset < visible_end[block_idx]) {
+                    offsets.push_back(offset);
+                }
+            }
+        }
+        std::sort(offsets.begin(), offsets.end());
+        result.addMany(offsets.size(), offsets.data());
+    }
+
+    [[nodiscard]] SizeT Size() const {
+        std::shared_lock lock(rw_locker_);
+        return sorted_pairs_.size();
+    }
+
+private:
+    // collect rows [covered, row_count) of the block into new_pairs_
+    void ReadBlock(BlockEntry *block_entry, BufferManager *buffer_mgr, ColumnID column_id, BlockOffset row_count) {
+        const BlockID block_id = block_entry->block_id();
+        if (block_covered_rows_.size() <= block_id) {
+            block_covered_rows_.resize(block_id + 1, 0);
+        }
+        const SegmentOffset block_begin = SegmentOffset(block_id) * DEFAULT_BLOCK_CAPACITY;
+        BlockOffset row_begin = block_covered_rows_[block_id];
+        if (begin_offset_ > block_begin) {
+            row_begin = std::max<BlockOffset>(row_begin, std::min<SegmentOffset>(begin_offset_ - block_begin, DEFAULT_BLOCK_CAPACITY));
+        }
+        if (row_count <= row_begin) {
+            return;
+        }
+        ColumnVector column_vector = block_entry->GetColumnBlockEntry(column_id)->GetColumnVector(buffer_mgr);
+        const auto *data = reinterpret_cast<const RawValueType *>(column_vector.data());
+        const bool all_valid = column_vector.nulls_ptr_->IsAllTrue();
+        for (BlockOffset row = row_begin; row < row_count; ++row) {
+            if (!all_valid and !column_vector.nulls_ptr_->IsTrue(row)) {
+                continue;
+            }
+            new_pairs_.emplace_back(ConvertToOrderedKeyValue<RawValueType>(data[row]), block_begin + row);
+        }
+        block_covered_rows_[block_id] = row_count;
+    }
+
+    void MergeNewPairs() {
+        if (new_pairs_.empty()) {
+            return;
+        }
+        std::sort(new_pairs_.begin(), new_pairs_.end());
+        const SizeT old_size = sorted_pairs_.size();
+        sorted_pairs_.insert(sorted_pairs_.end(), new_pairs_.begin(), new_pairs_.end());
+        std::inplace_merge(sorted_pairs_.begin(), sorted_pairs_.begin() + old_size, sorted_pairs_.end());
+        new_pairs_.clear();
+    }
+
+    mutable std::shared_mutex rw_locker_{};
+    Vector<BlockOffset> block_covered_rows_{}; // rows of each block already read into the delta (or covered by the index)
+    Vector<KeyOffsetPair> sorted_pairs_{};
+    Vector<KeyOffsetPair> new_pairs_{};
+};
+
+export SharedPtr<SecondaryIndexDelta> MakeSecondaryIndexDelta(const DataType &data_type, SegmentOffset begin_offset);
+
+} // namespace infinity
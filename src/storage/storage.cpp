@@ -63,7 +63,10 @@ void Storage::Init() {
     // Replay wal file wrap init catalog
     TxnTimeStamp system_start_ts = wal_mgr_->ReplayWalFile();
 
-    bg_processor_ = MakeUnique<BGTaskProcessor>(wal_mgr_.get());
+    bg_processor_ = MakeUnique<BGTaskProcessor>(wal_mgr_.get(),
+                                                config_ptr_->bg_worker_count(),
+                                                config_ptr_->compaction_concurrency(),
+                                                config_ptr_->compaction_io_rate_limit());
     // Construct txn manager
     txn_mgr_ = MakeUnique<TxnManager>(new_catalog_.get(),
                                       buffer_mgr_.get(),
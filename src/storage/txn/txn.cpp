@@ -30,6 +30,7 @@ import third_party;
 import logger;
 import data_block;
 import txn_store;
+import default_values;
 import txn_state;
 
 import meta_state;
@@ -111,6 +112,11 @@ Status Txn::Delete(const String &db_name, const String &table_name, const Vector
     if (!status.ok()) {
         return status;
     }
+    for (const auto &row_id : row_ids) {
+        if (row_id.segment_id_ == TXN_LOCAL_SEGMENT_ID) {
+            return Status::NotSupport("Delete or update the rows appended by the same transaction");
+        }
+    }
     if (check_conflict && table_entry->CheckDeleteConflict(row_ids, this)) {
         RecoverableError(Status::TxnRollback(TxnID()));
     }
@@ -156,6 +162,15 @@ TxnTableStore *Txn::GetTxnTableStore(TableEntry *table_entry) {
     return txn_table_store;
 }
 
+TxnTableStore *Txn::GetExistTxnTableStore(TableEntry *table_entry) {
+    std::unique_lock<std::mutex> lk(lock_);
+    auto txn_table_iter = txn_tables_store_.find(*table_entry->GetTableName());
+    if (txn_table_iter == txn_tables_store_.end() or txn_table_iter->second->table_entry_ != table_entry) {
+        return nullptr;
+    }
+    return txn_table_iter->second.get();
+}
+
 BufferManager *Txn::GetBufferMgr() const { return this->txn_mgr_->GetBufferMgr(); }
 
 Status Txn::CreateDatabase(const String &db_name, ConflictType conflict_type) {
@@ -316,9 +331,13 @@ Tuple<TableIndexEntry *, Status> Txn::CreateIndexDef(TableEntry *table_entry, co
     return {table_index_entry, index_status};
 }
 
-Status Txn::CreateIndexPrepare(TableIndexEntry *table_index_entry, BaseTableRef *table_ref, bool prepare, bool check_ts) {
+Status Txn::CreateIndexPrepare(TableIndexEntry *table_index_entry,
+                               BaseTableRef *table_ref,
+                               bool prepare,
+                               bool check_ts,
+                               const HashMap<SegmentID, Vector<CompactedSegmentSource>> *compacted_sources) {
     auto *table_entry = table_ref->table_entry_ptr_;
-    table_index_entry->CreateIndexPrepare(table_entry, table_ref->block_index_.get(), this, prepare, false, check_ts);
+    table_index_entry->CreateIndexPrepare(table_entry, table_ref->block_index_.get(), this, prepare, false, check_ts, compacted_sources);
 
     if (!prepare) {
         String index_dir = *table_index_entry->index_dir();
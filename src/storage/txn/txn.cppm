@@ -53,6 +53,7 @@ struct TableEntry;
 struct DBEntry;
 struct BaseEntry;
 struct TableIndexEntry;
+struct CompactedSegmentSource;
 struct SegmentEntry;
 struct WalEntry;
 struct WalCmd;
@@ -114,7 +115,12 @@ public:
     // operator. (called by `PhysicalCreateIndexDo`)
     Tuple<TableIndexEntry *, Status> CreateIndexDef(TableEntry *table_entry, const SharedPtr<IndexDef> &index_def, ConflictType conflict_type);
 
-    Status CreateIndexPrepare(TableIndexEntry *table_index_entry, BaseTableRef *table_ref, bool prepare, bool check_ts = true);
+    // compacted_sources: the old segments of each segment built by compaction, whose indexes may be merged
+    Status CreateIndexPrepare(TableIndexEntry *table_index_entry,
+                              BaseTableRef *table_ref,
+                              bool prepare,
+                              bool check_ts = true,
+                              const HashMap<SegmentID, Vector<CompactedSegmentSource>> *compacted_sources = nullptr);
 
     Status CreateIndexDo(BaseTableRef *table_ref, const String &index_name, HashMap<SegmentID, atomic_u64> &create_index_idxes);
 
@@ -167,6 +173,9 @@ public:
     // Create txn store if not exists
     TxnTableStore *GetTxnTableStore(TableEntry *table_entry);
 
+    // nullptr if the transaction hasn't changed the table
+    TxnTableStore *GetExistTxnTableStore(TableEntry *table_entry);
+
     void AddWalCmd(const SharedPtr<WalCmd> &cmd);
 
     void AddCatalogDeltaOperation(UniquePtr<CatalogDeltaOperation> operation);
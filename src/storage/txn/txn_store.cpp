@@ -129,7 +129,16 @@ Tuple<UniquePtr<String>, Status> TxnTableStore::Compact(Vector<Pair<SharedPtr<Se
     return {nullptr, Status::OK()};
 }
 
-void TxnTableStore::Scan(SharedPtr<DataBlock> &) {}
+Vector<Pair<SharedPtr<DataBlock>, SizeT>> TxnTableStore::LocalBlocks() const {
+    Vector<Pair<SharedPtr<DataBlock>, SizeT>> local_blocks;
+    local_blocks.reserve(blocks_.size());
+    for (const auto &block : blocks_) {
+        if (block->row_count() > 0) {
+            local_blocks.emplace_back(block, block->row_count());
+        }
+    }
+    return local_blocks;
+}
 
 void TxnTableStore::Rollback() {
     if (append_state_.get() != nullptr) {
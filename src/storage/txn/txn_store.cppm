@@ -75,7 +75,12 @@ public:
     Tuple<UniquePtr<String>, Status> Compact(Vector<Pair<SharedPtr<SegmentEntry>, Vector<SegmentEntry *>>> &&segment_data,
                                              CompactSegmentsTaskType type);
 
-    void Scan(SharedPtr<DataBlock> &output_block);
+    // The appended blocks which aren't committed yet, with their current row counts, for the scans of the transaction itself.
+    // A block keeps filling up after this, the row count is what a scan may read.
+    Vector<Pair<SharedPtr<DataBlock>, SizeT>> LocalBlocks() const;
+
+    // The rows of committed blocks deleted by the transaction, for its own scans
+    inline const HashMap<SegmentID, HashMap<BlockID, Vector<BlockOffset>>> &LocalDeletes() const { return delete_state_.rows_; }
 
     void Rollback();
 
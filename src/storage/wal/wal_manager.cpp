@@ -38,6 +38,7 @@ import infinity_exception;
 
 import block_entry;
 import segment_entry;
+import metrics;
 // #include "statement/extra/extra_ddl_info.h"
 
 module wal_manager;
@@ -170,6 +171,9 @@ void WalManager::Flush() {
         }
         auto [max_commit_ts, wal_size] = GetWalState();
         u64 ckp_commit_ts;
+        Metrics &metrics = Metrics::instance();
+        metrics.wal_batch_size_.Observe(que2_.size());
+        const auto write_begin = Clock::now();
         for (const auto &entry : que2_) {
             // Empty WalEntry (read-only transactions) shouldn't go into WalManager.
             if (entry->cmds_.empty()) {
@@ -187,11 +191,15 @@ void WalManager::Flush() {
             LOG_TRACE(fmt::format("WalManager::Flush done writing wal for txn_id {}, commit_ts {}", entry->txn_id_, entry->commit_ts_));
             max_commit_ts = entry->commit_ts_;
             wal_size += act_size;
+            metrics.wal_written_bytes_.Add(act_size);
             if (entry->IsCheckPoint()) {
                 ckp_commit_ts = entry->commit_ts_;
             }
         }
+        const auto flush_begin = Clock::now();
         ofs_.flush();
+        metrics.wal_write_latency_.Observe(ElapsedFromStart(flush_begin, write_begin).count());
+        metrics.wal_flush_latency_.Observe(ElapsedFromStart(Clock::now(), flush_begin).count());
 
         TxnManager *txn_mgr = storage_->txn_manager();
         // Commit sequentially so they get visible in the same order with wal.
@@ -263,6 +271,8 @@ void WalManager::Checkpoint() {
     }
 
     try {
+        ScopedLatency checkpoint_latency(is_full_checkpoint ? Metrics::instance().full_checkpoint_duration_
+                                                            : Metrics::instance().delta_checkpoint_duration_);
         TxnManager *txn_mgr = storage_->txn_manager();
         Txn *txn = txn_mgr->CreateTxn();
         txn->Begin();
@@ -298,6 +308,9 @@ void WalManager::Checkpoint(ForceCheckpointTask *ckp_task) {
 
     bool is_full_checkpoint = ckp_task->is_full_checkpoint_;
 
+    ScopedLatency checkpoint_latency(is_full_checkpoint ? Metrics::instance().full_checkpoint_duration_
+                                                        : Metrics::instance().delta_checkpoint_duration_);
+
     LOG_INFO(fmt::format("Force Checkpoint Task, txn_id: {}, begin_ts: {}, max_commit_ts {}",
                          ckp_task->txn_->TxnID(),
                          ckp_task->txn_->BeginTS(),
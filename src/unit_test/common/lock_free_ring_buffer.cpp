@@ -0,0 +1,82 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "unit_test/base_test.h"
+
+#include <thread>
+
+import stl;
+import lock_free_ring_buffer;
+
+using namespace infinity;
+
+class LockFreeRingBufferTest : public BaseTest {};
+
+TEST_F(LockFreeRingBufferTest, bounded) {
+    LockFreeRingBuffer<UniquePtr<i32>> ring_buffer(3);
+    EXPECT_EQ(ring_buffer.capacity(), 4u);
+    for (i32 i = 0; i < 4; ++i) {
+        EXPECT_TRUE(ring_buffer.TryEnqueue(MakeUnique<i32>(i)));
+    }
+    EXPECT_FALSE(ring_buffer.TryEnqueue(MakeUnique<i32>(4)));
+
+    UniquePtr<i32> item;
+    for (i32 i = 0; i < 4; ++i) {
+        EXPECT_TRUE(ring_buffer.TryDequeue(item));
+        EXPECT_EQ(*item, i);
+    }
+    EXPECT_FALSE(ring_buffer.TryDequeue(item));
+
+    // positions wrap around the ring
+    EXPECT_TRUE(ring_buffer.TryEnqueue(MakeUnique<i32>(5)));
+    EXPECT_TRUE(ring_buffer.TryDequeue(item));
+    EXPECT_EQ(*item, 5);
+}
+
+TEST_F(LockFreeRingBufferTest, concurrent) {
+    constexpr SizeT producer_count = 4;
+    constexpr SizeT item_count = 10000;
+    LockFreeRingBuffer<SizeT> ring_buffer(64);
+    Vector<Thread> producers;
+    for (SizeT p = 0; p < producer_count; ++p) {
+        producers.emplace_back([&ring_buffer, p] {
+            for (SizeT i = 0; i < item_count; ++i) {
+                SizeT item = p * item_count + i;
+                while (!ring_buffer.TryEnqueue(std::move(item))) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    // items of one producer come out in order, all of them exactly once
+    Vector<SizeT> next(producer_count, 0);
+    for (SizeT received = 0; received < producer_count * item_count;) {
+        SizeT item;
+        if (!ring_buffer.TryDequeue(item)) {
+            std::this_thread::yield();
+            continue;
+        }
+        SizeT p = item / item_count;
+        EXPECT_EQ(item % item_count, next[p]);
+        ++next[p];
+        ++received;
+    }
+    for (auto &producer : producers) {
+        producer.join();
+    }
+    for (SizeT p = 0; p < producer_count; ++p) {
+        EXPECT_EQ(next[p], item_count);
+    }
+}
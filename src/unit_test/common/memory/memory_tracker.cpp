@@ -0,0 +1,68 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "unit_test/base_test.h"
+
+import stl;
+import memory_tracker;
+import vector_buffer;
+import infinity_exception;
+
+using namespace infinity;
+
+class MemoryTrackerTest : public BaseTest {};
+
+TEST_F(MemoryTrackerTest, charge_and_release) {
+    auto tracker = MakeShared<QueryMemoryTracker>(1000);
+    tracker->Charge(600);
+    EXPECT_FALSE(tracker->TryCharge(500));
+    EXPECT_THROW(tracker->Charge(401), RecoverableException);
+    EXPECT_EQ(tracker->used(), 600u);
+    EXPECT_TRUE(tracker->TryCharge(400));
+    tracker->Release(1000);
+    EXPECT_EQ(tracker->used(), 0u);
+    EXPECT_EQ(tracker->peak(), 1000u);
+}
+
+TEST_F(MemoryTrackerTest, tracked_memory) {
+    auto tracker = MakeShared<QueryMemoryTracker>(1024);
+    {
+        // not charged outside of a query
+        TrackedMemory memory;
+        memory.Grow(100);
+        EXPECT_EQ(memory.size(), 0u);
+    }
+    SharedPtr<VectorBuffer> buffer;
+    {
+        ScopedMemoryTracker scoped_tracker(tracker.get());
+        EXPECT_EQ(QueryMemoryTracker::Current(), tracker.get());
+        {
+            TrackedMemory memory;
+            memory.Grow(100);
+            memory.Grow(200);
+            EXPECT_EQ(tracker->used(), 300u);
+        }
+        EXPECT_EQ(tracker->used(), 0u);
+
+        buffer = VectorBuffer::Make(8, 64, VectorBufferType::kStandard);
+        EXPECT_EQ(tracker->used(), 512u);
+        EXPECT_THROW(VectorBuffer::Make(8, 128, VectorBufferType::kStandard), RecoverableException);
+        EXPECT_EQ(tracker->used(), 512u);
+    }
+    EXPECT_EQ(QueryMemoryTracker::Current(), nullptr);
+    // the buffer outlives the scope, it is released on destruction
+    buffer.reset();
+    EXPECT_EQ(tracker->used(), 0u);
+}
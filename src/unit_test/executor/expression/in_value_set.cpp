@@ -0,0 +1,84 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "unit_test/base_test.h"
+
+import stl;
+import in_value_set;
+import column_vector;
+import value;
+import logical_type;
+import internal_types;
+import data_type;
+
+using namespace infinity;
+
+class InValueSetTest : public BaseTest {};
+
+TEST_F(InValueSetTest, probe_integer) {
+    SharedPtr<DataType> data_type = MakeShared<DataType>(LogicalType::kBigInt);
+    SharedPtr<DataType> bool_type = MakeShared<DataType>(LogicalType::kBoolean);
+    const SizeT row_count = 1000;
+    auto column = ColumnVector::Make(data_type);
+    column->Initialize(ColumnVectorType::kFlat, row_count);
+    for (SizeT i = 0; i < row_count; ++i) {
+        column->AppendValue(Value::MakeBigInt(i));
+    }
+
+    // both the linear probe of short lists and the hash set of long ones
+    for (SizeT list_size : {3, 100}) {
+        Vector<Value> values;
+        for (SizeT i = 0; i < list_size; ++i) {
+            values.emplace_back(Value::MakeBigInt(i * 7));
+            values.emplace_back(Value::MakeBigInt(i * 7));
+        }
+        auto in_value_set = InValueSet::Make(*data_type, values);
+        ASSERT_NE(in_value_set, nullptr);
+        EXPECT_EQ(in_value_set->Size(), list_size);
+        for (bool negate : {false, true}) {
+            auto result = ColumnVector::Make(bool_type);
+            result->Initialize(ColumnVectorType::kCompactBit, row_count);
+            in_value_set->Probe(column, row_count, negate, result);
+            result->Finalize(row_count);
+            for (SizeT i = 0; i < row_count; ++i) {
+                bool expected = i % 7 == 0 and i / 7 < list_size;
+                EXPECT_EQ(result->GetValue(i).value_.boolean, expected != negate);
+            }
+        }
+    }
+}
+
+TEST_F(InValueSetTest, probe_varchar) {
+    SharedPtr<DataType> data_type = MakeShared<DataType>(LogicalType::kVarchar);
+    SharedPtr<DataType> bool_type = MakeShared<DataType>(LogicalType::kBoolean);
+    Vector<String> strings{"abc", "this is a long string kept in the heap", "xyz", "this is another long string"};
+    auto column = ColumnVector::Make(data_type);
+    column->Initialize(ColumnVectorType::kFlat, strings.size());
+    for (const auto &str : strings) {
+        column->AppendValue(Value::MakeVarchar(str));
+    }
+
+    Vector<Value> values{Value::MakeVarchar("xyz"), Value::MakeVarchar("this is a long string kept in the heap")};
+    auto in_value_set = InValueSet::Make(*data_type, values);
+    ASSERT_NE(in_value_set, nullptr);
+    auto result = ColumnVector::Make(bool_type);
+    result->Initialize(ColumnVectorType::kCompactBit, strings.size());
+    in_value_set->Probe(column, strings.size(), false, result);
+    result->Finalize(strings.size());
+    EXPECT_FALSE(result->GetValue(0).value_.boolean);
+    EXPECT_TRUE(result->GetValue(1).value_.boolean);
+    EXPECT_TRUE(result->GetValue(2).value_.boolean);
+    EXPECT_FALSE(result->GetValue(3).value_.boolean);
+}
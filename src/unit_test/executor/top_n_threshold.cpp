@@ -0,0 +1,92 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "unit_test/base_test.h"
+
+import stl;
+import top_n_threshold;
+import zone_map;
+import column_vector;
+import value;
+import data_type;
+import logical_type;
+import internal_types;
+import select_statement;
+
+using namespace infinity;
+
+class TopNThresholdTest : public BaseTest {
+public:
+    // zone map of the integers [begin, end)
+    static ZoneMap MakeZoneMap(IntegerT begin, IntegerT end) {
+        ColumnVector column_vector(MakeShared<DataType>(LogicalType::kInteger));
+        column_vector.Initialize();
+        for (IntegerT i = begin; i < end; ++i) {
+            column_vector.AppendValue(Value::MakeInt(i));
+        }
+        ZoneMap zone_map;
+        zone_map.Update(column_vector, 0, end - begin);
+        return zone_map;
+    }
+};
+
+TEST_F(TopNThresholdTest, asc) {
+    TopNThreshold threshold(0, OrderType::kAsc);
+    ZoneMap zone_map = MakeZoneMap(100, 200);
+    // nothing is skipped before some task offers a value
+    EXPECT_TRUE(threshold.MayQualify(zone_map));
+    EXPECT_FALSE(threshold.threshold().has_value());
+
+    EXPECT_TRUE(threshold.Update(Value::MakeInt(150)));
+    EXPECT_TRUE(threshold.MayQualify(zone_map));
+    // only a tighter value replaces it
+    EXPECT_FALSE(threshold.Update(Value::MakeInt(180)));
+    EXPECT_TRUE(threshold.Update(Value::MakeInt(100)));
+    // a tie may be part of the result
+    EXPECT_TRUE(threshold.MayQualify(zone_map));
+    EXPECT_TRUE(threshold.Update(Value::MakeInt(99)));
+    EXPECT_FALSE(threshold.MayQualify(zone_map));
+    EXPECT_EQ(threshold.threshold()->GetValue<IntegerT>(), 99);
+}
+
+TEST_F(TopNThresholdTest, desc) {
+    TopNThreshold threshold(0, OrderType::kDesc);
+    ZoneMap zone_map = MakeZoneMap(100, 200);
+    EXPECT_TRUE(threshold.Update(Value::MakeInt(150)));
+    EXPECT_FALSE(threshold.Update(Value::MakeInt(120)));
+    EXPECT_TRUE(threshold.MayQualify(zone_map));
+    EXPECT_TRUE(threshold.Update(Value::MakeInt(200)));
+    EXPECT_FALSE(threshold.MayQualify(zone_map));
+    EXPECT_TRUE(threshold.MayQualify(MakeZoneMap(150, 201)));
+}
+
+TEST_F(TopNThresholdTest, nulls) {
+    TopNThreshold threshold(0, OrderType::kAsc);
+    EXPECT_TRUE(threshold.Update(Value::MakeInt(0)));
+
+    ColumnVector column_vector(MakeShared<DataType>(LogicalType::kInteger));
+    column_vector.Initialize();
+    for (IntegerT i = 10; i < 20; ++i) {
+        column_vector.AppendValue(Value::MakeInt(i));
+    }
+    column_vector.nulls_ptr_->SetFalse(5);
+    ZoneMap zone_map;
+    zone_map.Update(column_vector, 0, 10);
+    // null keys aren't bounded by the zone map
+    EXPECT_TRUE(threshold.MayQualify(zone_map));
+
+    // a value zone maps don't keep is ignored
+    EXPECT_FALSE(threshold.Update(Value::MakeVarchar(String("abc"))));
+}
@@ -0,0 +1,70 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "unit_test/base_test.h"
+
+#include <random>
+
+import stl;
+import aggregate_kernel;
+
+using namespace infinity;
+
+class AggregateKernelTest : public BaseTest {};
+
+TEST_F(AggregateKernelTest, match_row_by_row) {
+    std::mt19937_64 rng(0);
+    for (SizeT iter = 0; iter < 1000; ++iter) {
+        const SizeT count = rng() % 300;
+        Vector<i32> input(count);
+        for (auto &value : input) {
+            value = static_cast<i32>(rng() % 2001) - 1000;
+        }
+        // all valid, all null, or random nulls in each unit of 64 rows
+        Vector<u64> valid_units(count / 64 + 1);
+        for (auto &unit : valid_units) {
+            const u64 kind = rng() % 3;
+            unit = kind == 0 ? std::numeric_limits<u64>::max() : (kind == 1 ? 0 : rng());
+        }
+        const u64 *valid_ptr = iter % 4 == 0 ? nullptr : valid_units.data();
+
+        i64 sum = 0;
+        SizeT valid_count = 0;
+        i32 min_value = std::numeric_limits<i32>::max();
+        i32 max_value = std::numeric_limits<i32>::lowest();
+        for (SizeT i = 0; i < count; ++i) {
+            if (valid_ptr != nullptr and ((valid_ptr[i / 64] >> (i % 64)) & 1) == 0) {
+                continue;
+            }
+            sum += input[i];
+            ++valid_count;
+            min_value = std::min(min_value, input[i]);
+            max_value = std::max(max_value, input[i]);
+        }
+        EXPECT_EQ((SumKernel<i64>(input.data(), valid_ptr, count)), sum);
+        EXPECT_EQ(CountValidKernel(valid_ptr, count), valid_count);
+        EXPECT_EQ((ExtremeKernel<i32, true>(input.data(), valid_ptr, count, std::numeric_limits<i32>::max())), min_value);
+        EXPECT_EQ((ExtremeKernel<i32, false>(input.data(), valid_ptr, count, std::numeric_limits<i32>::lowest())), max_value);
+    }
+}
+
+TEST_F(AggregateKernelTest, floating_point) {
+    Vector<double> input{-1.5, 2.25, -8.0, 4.0, 0.5, 3.0, -0.25, 7.5, 1.0, -2.0};
+    const u64 valid_unit = 0b1111111011; // row 2 is null
+    EXPECT_DOUBLE_EQ((SumKernel<double>(input.data(), nullptr, input.size())), 6.5);
+    EXPECT_DOUBLE_EQ((SumKernel<double>(input.data(), &valid_unit, input.size())), 14.5);
+    EXPECT_DOUBLE_EQ((ExtremeKernel<double, true>(input.data(), &valid_unit, input.size(), std::numeric_limits<double>::max())), -2.0);
+    EXPECT_DOUBLE_EQ((ExtremeKernel<double, false>(input.data(), nullptr, input.size(), std::numeric_limits<double>::lowest())), 7.5);
+}
@@ -0,0 +1,131 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "unit_test/base_test.h"
+
+import stl;
+import catalog;
+import like;
+import scalar_function;
+import scalar_function_set;
+import function_set;
+import function;
+import column_expression;
+import value;
+import data_block;
+import base_expression;
+import column_vector;
+import logical_type;
+import internal_types;
+import data_type;
+
+class LikeFunctionsTest : public BaseTest {};
+
+TEST_F(LikeFunctionsTest, like_matcher) {
+    using namespace infinity;
+
+    auto match = [](const String &str, const String &pattern, bool ignore_case = false) {
+        LikeMatcher matcher(pattern, ignore_case);
+        return matcher.Match(str.data(), str.size());
+    };
+
+    EXPECT_TRUE(match("", ""));
+    EXPECT_FALSE(match("a", ""));
+    EXPECT_TRUE(match("", "%"));
+    EXPECT_TRUE(match("abc", "%%"));
+    EXPECT_TRUE(match("abc", "abc"));
+    EXPECT_FALSE(match("abcd", "abc"));
+    EXPECT_TRUE(match("abc", "a_c"));
+    EXPECT_FALSE(match("ac", "a_c"));
+    EXPECT_TRUE(match("abcdef", "abc%"));
+    EXPECT_FALSE(match("xabcdef", "abc%"));
+    EXPECT_TRUE(match("xyzabc", "%abc"));
+    EXPECT_FALSE(match("xyzabcx", "%abc"));
+    EXPECT_TRUE(match("xyzabcx", "%abc%"));
+    EXPECT_TRUE(match("xyzabcx", "%a_c%"));
+    EXPECT_FALSE(match("xyzacx", "%a_c%"));
+    EXPECT_TRUE(match("aXbYbZc", "a%b%c"));
+    EXPECT_FALSE(match("abc", "ab%bc"));
+    EXPECT_TRUE(match("abbc", "ab%bc"));
+    EXPECT_TRUE(match("aaab", "%a_b"));
+    EXPECT_TRUE(match("mississippi", "%iss%ipp%"));
+    EXPECT_FALSE(match("mississippi", "%iss%ipp%ss%"));
+
+    EXPECT_FALSE(match("Hello World", "hello%"));
+    EXPECT_TRUE(match("Hello World", "hello%", true));
+    EXPECT_TRUE(match("Hello World", "%WORLD", true));
+    EXPECT_TRUE(match("HELLO", "h_LlO", true));
+
+    // rejected by the prefix and length only
+    LikeMatcher matcher("abc%xyz");
+    EXPECT_FALSE(matcher.MayMatch("abd", 3, 20));
+    EXPECT_FALSE(matcher.MayMatch("abc", 3, 5));
+    EXPECT_TRUE(matcher.MayMatch("abc", 3, 20));
+}
+
+TEST_F(LikeFunctionsTest, like_func) {
+    using namespace infinity;
+
+    UniquePtr<NewCatalog> catalog_ptr = MakeUnique<NewCatalog>(nullptr);
+
+    RegisterLikeFunction(catalog_ptr);
+    RegisterNotLikeFunction(catalog_ptr);
+    RegisterILikeFunction(catalog_ptr);
+    RegisterNotILikeFunction(catalog_ptr);
+
+    SharedPtr<DataType> data_type = MakeShared<DataType>(LogicalType::kVarchar);
+    SharedPtr<DataType> result_type = MakeShared<DataType>(LogicalType::kBoolean);
+    SharedPtr<ColumnExpression> col1_expr_ptr = MakeShared<ColumnExpression>(*data_type, "t1", 1, "c1", 0, 0);
+    SharedPtr<ColumnExpression> col2_expr_ptr = MakeShared<ColumnExpression>(*data_type, "t1", 1, "c2", 1, 0);
+    Vector<SharedPtr<BaseExpression>> inputs{col1_expr_ptr, col2_expr_ptr};
+
+    // short strings are inlined, the long ones are stored in the heap
+    Vector<String> strings{"abc", "xxabcxx", "ABC", "Helloworld-this-is-a-long-string", "helloworld-abc-long-string-to-the-heap"};
+    Vector<String> patterns{"abc", "%abc%", "abc", "Hello%string", "%ABC%"};
+    Vector<Array<bool, 4>> expected{
+        {true, false, true, false},  // like, not_like, ilike, not_ilike
+        {true, false, true, false},
+        {false, true, true, false},
+        {true, false, true, false},
+        {false, true, true, false},
+    };
+
+    Vector<SharedPtr<DataType>> column_types{data_type, data_type};
+    DataBlock data_block;
+    data_block.Init(column_types);
+    for (SizeT i = 0; i < strings.size(); ++i) {
+        data_block.AppendValue(0, Value::MakeVarchar(strings[i]));
+        data_block.AppendValue(1, Value::MakeVarchar(patterns[i]));
+    }
+    data_block.Finalize();
+
+    Vector<String> func_names{"like", "not_like", "ilike", "not_ilike"};
+    for (SizeT f = 0; f < func_names.size(); ++f) {
+        SharedPtr<FunctionSet> function_set = NewCatalog::GetFunctionSetByName(catalog_ptr.get(), func_names[f]);
+        EXPECT_EQ(function_set->type_, FunctionType::kScalar);
+        SharedPtr<ScalarFunctionSet> scalar_function_set = std::static_pointer_cast<ScalarFunctionSet>(function_set);
+        ScalarFunction func = scalar_function_set->GetMostMatchFunction(inputs);
+
+        SharedPtr<ColumnVector> result = MakeShared<ColumnVector>(result_type);
+        result->Initialize();
+        func.function_(data_block, result);
+
+        for (SizeT i = 0; i < strings.size(); ++i) {
+            Value v = result->GetValue(i);
+            EXPECT_EQ(v.type_.type(), LogicalType::kBoolean);
+            EXPECT_EQ(v.value_.boolean, expected[i][f]);
+        }
+    }
+}
@@ -56,6 +56,8 @@ TEST_F(ConfigTest, test1) {
     EXPECT_EQ(config.log_to_stdout(), false);
     EXPECT_EQ(config.log_max_size(), 1024ul * 1024ul * 1024ul);
     EXPECT_EQ(config.log_file_rotate_count(), 10ul);
+    EXPECT_EQ(*config.slow_query_log_file_path(), "/tmp/infinity/log/slow_query.log");
+    EXPECT_EQ(config.slow_query_threshold_ms(), 0ul);
     // EXPECT_EQ(config.log_level(), LogLevel::kTrace);
 
     EXPECT_EQ(*config.data_dir(), "/tmp/infinity/data");
@@ -93,6 +95,8 @@ TEST_F(ConfigTest, test2) {
     EXPECT_EQ(config.log_max_size(), 2 * 1024ul * 1024ul * 1024ul);
     EXPECT_EQ(config.log_file_rotate_count(), 3ul);
     EXPECT_EQ(config.log_level(), LogLevel::kTrace);
+    EXPECT_EQ(*config.slow_query_log_file_path(), "/var/infinity/log/slow.log");
+    EXPECT_EQ(config.slow_query_threshold_ms(), 500ul);
 
     EXPECT_EQ(*config.data_dir(), "/var/infinity/data");
     EXPECT_EQ(*config.wal_dir(), "/var/infinity/wal");
@@ -0,0 +1,61 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "unit_test/base_test.h"
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+import stl;
+import slow_query_log;
+
+using namespace infinity;
+
+class SlowQueryLogTest : public BaseTest {};
+
+TEST_F(SlowQueryLogTest, write) {
+    const String dir = "/tmp/infinity/slow_query_log_test";
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directories(dir);
+    const String file_path = dir + "/slow_query.log";
+
+    SlowQueryLog &slow_query_log = SlowQueryLog::instance();
+    EXPECT_EQ(slow_query_log.threshold(), 0);
+    slow_query_log.Init(file_path, 1024 * 1024, 2, 100);
+    EXPECT_EQ(slow_query_log.threshold(), 100'000'000);
+
+    auto record = MakeUnique<SlowQueryRecord>();
+    record->session_id_ = 7;
+    record->query_text_ = "select * from t1";
+    record->elapsed_ = 150'000'000;
+    record->status_ = "OK";
+    record->physical_plan_ = "PROJECT (2)\n  -> TABLE SCAN (1)\n";
+    record->profile_ = "Execution: 150.00ms\n";
+    slow_query_log.Submit(std::move(record));
+    // UnInit writes the submitted records
+    slow_query_log.UnInit();
+    EXPECT_EQ(slow_query_log.threshold(), 0);
+
+    std::ifstream file(file_path);
+    std::stringstream content;
+    content << file.rdbuf();
+    const String text = content.str();
+    EXPECT_NE(text.find("session: 7"), String::npos);
+    EXPECT_NE(text.find("# query: select * from t1"), String::npos);
+    EXPECT_NE(text.find("  -> TABLE SCAN (1)"), String::npos);
+    EXPECT_NE(text.find("Execution: 150.00ms"), String::npos);
+    std::filesystem::remove_all(dir);
+}
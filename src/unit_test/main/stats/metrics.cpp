@@ -0,0 +1,70 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "unit_test/base_test.h"
+
+import stl;
+import metrics;
+
+using namespace infinity;
+
+class MetricsTest : public BaseTest {};
+
+TEST_F(MetricsTest, sharded_counter) {
+    ShardedCounter counter;
+    Vector<Thread> threads;
+    for (SizeT i = 0; i < 8; ++i) {
+        threads.emplace_back([&counter] {
+            for (SizeT j = 0; j < 1000; ++j) {
+                counter.Add(2);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(counter.Value(), 16000u);
+}
+
+TEST_F(MetricsTest, histogram) {
+    Histogram histogram({10, 100, 1000}, 1000);
+    histogram.Observe(5);
+    histogram.Observe(10);
+    histogram.Observe(50);
+    histogram.Observe(5000);
+    EXPECT_EQ(histogram.Count(), 4u);
+    EXPECT_EQ(histogram.Sum(), 5065u);
+    EXPECT_EQ(histogram.CumulativeCount(0), 2u);
+    EXPECT_EQ(histogram.CumulativeCount(1), 3u);
+    EXPECT_EQ(histogram.CumulativeCount(2), 3u);
+    EXPECT_EQ(histogram.CumulativeCount(3), 4u);
+
+    String output;
+    histogram.Render(output, "test_seconds", "type=\"a\"");
+    EXPECT_NE(output.find("test_seconds_bucket{type=\"a\",le=\"0.01\"} 2\n"), String::npos);
+    EXPECT_NE(output.find("test_seconds_bucket{type=\"a\",le=\"0.1\"} 3\n"), String::npos);
+    EXPECT_NE(output.find("test_seconds_bucket{type=\"a\",le=\"+Inf\"} 4\n"), String::npos);
+    EXPECT_NE(output.find("test_seconds_sum{type=\"a\"} 5.065\n"), String::npos);
+    EXPECT_NE(output.find("test_seconds_count{type=\"a\"} 4\n"), String::npos);
+}
+
+TEST_F(MetricsTest, render) {
+    Metrics::instance().compacted_row_count_.Add(3);
+    String output;
+    Metrics::instance().Render(output);
+    EXPECT_NE(output.find("# TYPE infinity_query_duration_seconds histogram\n"), String::npos);
+    EXPECT_NE(output.find("infinity_query_duration_seconds_count{type=\"select\"}"), String::npos);
+    EXPECT_NE(output.find("infinity_compacted_rows_total "), String::npos);
+}
@@ -273,6 +273,31 @@ TEST_F(StatementParsingTest, good_test1) {
         result->Reset();
     }
 
+    {
+        String input_sql = "SHOW TASKS;";
+        parser->Parse(input_sql, result.get());
+
+        EXPECT_TRUE(result->error_message_.empty());
+        EXPECT_FALSE(result->statements_ptr_ == nullptr);
+
+        for (auto &statement : *result->statements_ptr_) {
+            EXPECT_EQ(statement->type_, StatementType::kShow);
+            auto *show_statement = (ShowStatement *)(statement);
+            EXPECT_EQ(show_statement->show_type_, ShowStmtType::kTasks);
+        }
+
+        result->Reset();
+    }
+
+    {
+        String input_sql = "SHOW t1;";
+        parser->Parse(input_sql, result.get());
+
+        EXPECT_FALSE(result->error_message_.empty());
+
+        result->Reset();
+    }
+
     {
         String input_sql = "copy t1 to '/usr/filename' with (format csv, header, delimiter '|');";
         parser->Parse(input_sql, result.get());
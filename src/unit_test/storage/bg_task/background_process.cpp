@@ -31,6 +31,8 @@ import txn;
 import status;
 import backgroud_process;
 import bg_task;
+import rate_limiter;
+import storage;
 
 class BGProcessTest : public BaseTest {
     void SetUp() override {
@@ -58,3 +60,40 @@ TEST_F(BGProcessTest, test1) {
 
     processor.Stop();
 }
+
+TEST_F(BGProcessTest, list_tasks) {
+    using namespace infinity;
+
+    BGTaskProcessor processor(infinity::InfinityContext::instance().storage()->wal_manager(), 2);
+
+    // periodical checkpoints waiting in queue are coalesced
+    for (SizeT i = 0; i < 3; ++i) {
+        processor.Submit(MakeShared<TryCheckpointTask>(true));
+    }
+    Vector<BGTaskInfo> task_infos = processor.ListTasks();
+    EXPECT_EQ(task_infos.size(), 1u);
+    EXPECT_EQ(task_infos[0].task_class_, BGTaskClass::kCheckpoint);
+    EXPECT_FALSE(task_infos[0].running_);
+
+    processor.Start();
+    processor.Stop();
+    EXPECT_TRUE(processor.ListTasks().empty());
+}
+
+TEST_F(BGProcessTest, rate_limiter) {
+    using namespace infinity;
+
+    RateLimiter unlimited(0);
+    unlimited.Request(1024lu * 1024lu * 1024lu);
+    EXPECT_EQ(unlimited.total_bytes(), 1024lu * 1024lu * 1024lu);
+
+    const u64 rate = 10 * 1024 * 1024;
+    RateLimiter limiter(rate);
+    auto begin = Clock::now();
+    for (SizeT i = 0; i < 4; ++i) {
+        limiter.Request(rate / 2);
+    }
+    auto elapsed_ms = ChronoCast<MilliSeconds>(ElapsedFromStart(Clock::now(), begin)).count();
+    EXPECT_GE(elapsed_ms, 1900);
+    EXPECT_EQ(limiter.total_bytes(), 2 * rate);
+}
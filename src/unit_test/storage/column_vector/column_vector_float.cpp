@@ -530,3 +530,27 @@ TEST_F(ColumnVectorFloatTest, double_column_slice_init) {
         EXPECT_EQ(vx.value_.float64, static_cast<DoubleT>(src_idx) + 0.8f);
     }
 }
+
+TEST_F(ColumnVectorFloatTest, flat_float_raw_buffer) {
+    using namespace infinity;
+
+    SharedPtr<DataType> data_type = MakeShared<DataType>(LogicalType::kFloat);
+    ColumnVector column_vector(data_type);
+    column_vector.Initialize();
+
+    Vector<FloatT> raw_data(DEFAULT_VECTOR_SIZE);
+    for (i64 i = 0; i < DEFAULT_VECTOR_SIZE; ++i) {
+        raw_data[i] = static_cast<FloatT>(i) + 0.5f;
+    }
+
+    column_vector.AppendByRawBuffer(reinterpret_cast<const_ptr_t>(raw_data.data()), 10);
+    EXPECT_EQ(column_vector.Size(), 10u);
+    column_vector.AppendByRawBuffer(reinterpret_cast<const_ptr_t>(raw_data.data() + 10), DEFAULT_VECTOR_SIZE - 10);
+    EXPECT_EQ(column_vector.Size(), u64(DEFAULT_VECTOR_SIZE));
+    for (i64 i = 0; i < DEFAULT_VECTOR_SIZE; ++i) {
+        Value vx = column_vector.GetValue(i);
+        EXPECT_FLOAT_EQ(vx.value_.float32, static_cast<FloatT>(i) + 0.5f);
+    }
+
+    EXPECT_THROW(column_vector.AppendByRawBuffer(reinterpret_cast<const_ptr_t>(raw_data.data()), 1), UnrecoverableException);
+}
@@ -0,0 +1,57 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import bsi;
+import third_party;
+
+using namespace infinity;
+
+class BitSlicedIndexTest : public BaseTest {};
+
+TEST_F(BitSlicedIndexTest, range) {
+    // offset 3 and 7 have no key
+    Vector<u32> offsets{0, 1, 2, 4, 5, 6, 8, 9};
+    Vector<i64> keys{-5, 3, 0, 12, -5, 7, 3, 100};
+    BitSlicedIndex index;
+    index.Build(offsets, keys, 10);
+    EXPECT_EQ(index.DataNum(), 8u);
+    EXPECT_EQ(index.SegmentRowCount(), 10u);
+
+    auto to_vector = [](const RoaringBitmap &bitmap) { return Vector<u32>(bitmap.begin(), bitmap.end()); };
+    EXPECT_EQ(to_vector(index.RangeEqual(3)), (Vector<u32>{1, 8}));
+    EXPECT_EQ(to_vector(index.RangeEqual(-5)), (Vector<u32>{0, 5}));
+    EXPECT_TRUE(index.RangeEqual(4).isEmpty());
+    EXPECT_EQ(to_vector(index.RangeBetween(0, 12)), (Vector<u32>{1, 2, 4, 6, 8}));
+    EXPECT_EQ(to_vector(index.RangeBetween(4, 1000)), (Vector<u32>{4, 6, 9}));
+    EXPECT_EQ(to_vector(index.RangeBetween(std::numeric_limits<i64>::min(), -1)), (Vector<u32>{0, 5}));
+    EXPECT_TRUE(index.RangeBetween(101, 200).isEmpty());
+    EXPECT_TRUE(index.RangeBetween(10, 9).isEmpty());
+}
+
+TEST_F(BitSlicedIndexTest, single_key) {
+    BitSlicedIndex index;
+    index.Build({2, 3}, {42, 42}, 4);
+    EXPECT_EQ(index.BitDepth(), 0u);
+    EXPECT_EQ(index.RangeEqual(42).cardinality(), 2u);
+    EXPECT_TRUE(index.RangeEqual(41).isEmpty());
+    EXPECT_EQ(index.RangeBetween(0, 100).cardinality(), 2u);
+
+    BitSlicedIndex empty_index;
+    empty_index.Build({}, {}, 0);
+    EXPECT_EQ(empty_index.DataNum(), 0u);
+    EXPECT_TRUE(empty_index.RangeBetween(std::numeric_limits<i64>::min(), std::numeric_limits<i64>::max()).isEmpty());
+}
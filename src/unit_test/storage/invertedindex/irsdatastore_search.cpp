@@ -0,0 +1,100 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "index/norm.hpp"
+#include "search/term_filter.hpp"
+#include "unit_test/base_test.h"
+
+import stl;
+import global_resource_usage;
+import infinity_context;
+import iresearch_document;
+import iresearch_analyzer;
+import iresearch_datastore;
+import third_party;
+
+using namespace infinity;
+
+class IRSDataStoreSearchTest : public BaseTest {
+    void SetUp() override {
+        system("rm -rf /tmp/infinity");
+        infinity::GlobalResourceUsage::Init();
+        std::shared_ptr<std::string> config_path = nullptr;
+        infinity::InfinityContext::instance().Init(config_path);
+    }
+
+    void TearDown() override {
+        infinity::InfinityContext::instance().UnInit();
+        infinity::GlobalResourceUsage::UnInit();
+        BaseTest::TearDown();
+    }
+};
+
+// Several index segments, one per commit, searched by 1 and by several threads
+TEST_F(IRSDataStoreSearchTest, parallel_segments) {
+    constexpr static Array<IRSTypeInfo::type_id, 1> TEXT_FEATURES{IRSType<Norm>::id()};
+    static Features text_features{TEXT_FEATURES.data(), TEXT_FEATURES.size()};
+
+    constexpr u32 segment_count = 6;
+    constexpr u32 docs_per_segment = 500;
+    IRSDataStore datastore("enwiki", "/tmp/infinity/fulltext");
+    UniquePtr<IRSAnalyzer> stream = AnalyzerPool::instance().Get(SEGMENT);
+    for (u32 segment_id = 0; segment_id < segment_count; ++segment_id) {
+        {
+            auto ctx = datastore.GetWriter()->GetBatch();
+            for (u32 i = 0; i < docs_per_segment; ++i) {
+                // the docs repeat a few distinct texts, so many scores are tied over all the segments
+                auto doc = ctx.Insert(RowID2DocID(segment_id, 0, i));
+                auto field = MakeUnique<TextField>("body", irs::IndexFeatures::FREQ | irs::IndexFeatures::POS, text_features, stream.get());
+                field->f_ = String("hello ") + (i % 3 == 0 ? "hello " : "") + (i % 5 == 0 ? "world " : "") + "a b c";
+                doc.Insert<irs::Action::INDEX>(field.get());
+            }
+        }
+        datastore.Commit();
+    }
+
+    auto filter = MakeUnique<irs::by_term>();
+    *filter->mutable_field() = "body";
+    filter->mutable_options()->term = irs::bstring(reinterpret_cast<const irs::byte_type *>("hello"), 5);
+    Map<String, String> options;
+
+    // every doc is a result, the reference ranks them all
+    SearchPage all;
+    all.topn_ = segment_count * docs_per_segment;
+    ScoredIds expected;
+    EXPECT_EQ(datastore.Search(filter.get(), options, all, 1, nullptr, expected), 0);
+    EXPECT_EQ(expected.size(), segment_count * docs_per_segment);
+
+    for (SizeT parallelism : {1, 4}) {
+        // pages by offset
+        for (SizeT offset : {0, 100, 700}) {
+            SearchPage page;
+            page.topn_ = 100;
+            page.offset_ = offset;
+            ScoredIds result;
+            EXPECT_EQ(datastore.Search(filter.get(), options, page, parallelism, nullptr, result), 0);
+            EXPECT_EQ(result, ScoredIds(expected.begin() + offset, expected.begin() + offset + page.topn_));
+        }
+
+        // pages by the last doc of the previous page
+        SearchPage page;
+        page.topn_ = 100;
+        for (SizeT offset = 0; offset < 1000; offset += page.topn_) {
+            ScoredIds result;
+            EXPECT_EQ(datastore.Search(filter.get(), options, page, parallelism, nullptr, result), 0);
+            EXPECT_EQ(result, ScoredIds(expected.begin() + offset, expected.begin() + offset + page.topn_));
+            page.after_doc_ = result.back().second;
+        }
+    }
+}
@@ -0,0 +1,244 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import parquet_reader;
+import infinity_exception;
+import file_system;
+import local_file_system;
+import file_system_type;
+
+using namespace infinity;
+
+class ParquetReaderTest : public BaseTest {};
+
+namespace {
+
+// Writes the thrift compact encoding of a footer by hand, so the test can put any value in it
+struct CompactWriter {
+    void Varint(u64 value) {
+        while (value >= 0x80) {
+            bytes_.emplace_back(u8(value) | 0x80);
+            value >>= 7;
+        }
+        bytes_.emplace_back(u8(value));
+    }
+
+    void Int(i16 delta, u8 type, i64 value) {
+        bytes_.emplace_back(u8(delta << 4) | type);
+        Varint((u64(value) << 1) ^ u64(value >> 63));
+    }
+
+    void Binary(i16 delta, const String &value) {
+        bytes_.emplace_back(u8(delta << 4) | 8);
+        Varint(value.size());
+        bytes_.insert(bytes_.end(), value.begin(), value.end());
+    }
+
+    // Field header of a list of structs
+    void StructList(i16 delta, u8 size) {
+        bytes_.emplace_back(u8(delta << 4) | 9);
+        bytes_.emplace_back(u8(size << 4) | 12);
+    }
+
+    void Field(i16 delta, u8 type) { bytes_.emplace_back(u8(delta << 4) | type); }
+
+    void Stop() { bytes_.emplace_back(0); }
+
+    Vector<u8> bytes_{};
+};
+
+// One required INT32 column "c" in one row group, whose chunk metadata is given by the caller
+Vector<u8> SingleColumnFooter(i64 total_compressed_size, i64 data_page_offset) {
+    CompactWriter writer;
+    // FileMetaData.schema: the root and one leaf
+    writer.StructList(2, 2);
+    writer.Binary(4, "schema");
+    writer.Int(1, 5, 1);
+    writer.Stop();
+    writer.Int(1, 5, 1);
+    writer.Int(2, 5, 0);
+    writer.Binary(1, "c");
+    writer.Stop();
+    // FileMetaData.row_groups with one ColumnChunk
+    writer.StructList(2, 1);
+    writer.StructList(1, 1);
+    writer.Field(3, 12);
+    writer.Int(1, 5, 1);
+    writer.Int(3, 5, 0);
+    writer.Int(1, 6, 1);
+    writer.Int(2, 6, total_compressed_size);
+    writer.Int(2, 6, data_page_offset);
+    writer.Stop();
+    writer.Stop();
+    writer.Int(2, 6, 1);
+    writer.Stop();
+    writer.Stop();
+    return writer.bytes_;
+}
+
+void WriteParquetFile(const String &path, const Vector<u8> &body, const Vector<u8> &footer) {
+    String content = "PAR1";
+    content.append(body.begin(), body.end());
+    content.append(footer.begin(), footer.end());
+    u32 footer_size = footer.size();
+    for (SizeT i = 0; i < 4; ++i) {
+        content.push_back(char(footer_size >> (8 * i)));
+    }
+    content.append("PAR1");
+
+    LocalFileSystem fs;
+    UniquePtr<FileHandler> file_handler = fs.OpenFile(path, FileFlags::WRITE_FLAG | FileFlags::TRUNCATE_CREATE, FileLockType::kWriteLock);
+    file_handler->Write(content.data(), content.size());
+    file_handler->Close();
+}
+
+} // namespace
+
+TEST_F(ParquetReaderTest, snappy_literal) {
+    Vector<u8> input{0x05, 0x10, 'h', 'e', 'l', 'l', 'o'};
+    Vector<u8> output = SnappyDecompress(input.data(), input.size());
+    EXPECT_EQ(String(output.begin(), output.end()), "hello");
+}
+
+TEST_F(ParquetReaderTest, snappy_overlapping_copy) {
+    // literal "abc" followed by a copy of 9 bytes at offset 3
+    Vector<u8> input{0x0C, 0x08, 'a', 'b', 'c', 0x15, 0x03};
+    Vector<u8> output = SnappyDecompress(input.data(), input.size());
+    EXPECT_EQ(String(output.begin(), output.end()), "abcabcabcabc");
+}
+
+TEST_F(ParquetReaderTest, snappy_corrupted) {
+    // copy offset points before the beginning of the output
+    Vector<u8> input{0x0C, 0x08, 'a', 'b', 'c', 0x15, 0x09};
+    EXPECT_THROW(SnappyDecompress(input.data(), input.size()), RecoverableException);
+
+    // declared length is longer than the data
+    Vector<u8> truncated{0x06, 0x10, 'h', 'e', 'l', 'l', 'o'};
+    EXPECT_THROW(SnappyDecompress(truncated.data(), truncated.size()), RecoverableException);
+}
+
+TEST_F(ParquetReaderTest, rle_bit_packed_hybrid) {
+    // RLE run: 3 times 5, then one bit-packed group of 0..7 with bit width 3
+    Vector<u8> input{0x06, 0x05, 0x03, 0x88, 0xC6, 0xFA};
+    Vector<u32> output(11);
+    RleBitPackedDecoder(input.data(), input.size(), 3).Decode(output.data(), output.size());
+    Vector<u32> expected{5, 5, 5, 0, 1, 2, 3, 4, 5, 6, 7};
+    EXPECT_EQ(output, expected);
+}
+
+TEST_F(ParquetReaderTest, rle_decode_in_pieces) {
+    // 300 times 1 with bit width 1, varint header 600
+    Vector<u8> input{0xD8, 0x04, 0x01};
+    RleBitPackedDecoder decoder(input.data(), input.size(), 1);
+    Vector<u32> output(150);
+    decoder.Decode(output.data(), output.size());
+    EXPECT_EQ(std::count(output.begin(), output.end(), 1u), 150);
+    decoder.Decode(output.data(), output.size());
+    EXPECT_EQ(std::count(output.begin(), output.end(), 1u), 150);
+    EXPECT_THROW(decoder.Decode(output.data(), 1), RecoverableException);
+}
+
+TEST_F(ParquetReaderTest, snappy_length_out_of_range) {
+    // declares 2^35 - 1 bytes of output for a 6 bytes input
+    Vector<u8> input{0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00};
+    EXPECT_THROW(SnappyDecompress(input.data(), input.size()), RecoverableException);
+}
+
+TEST_F(ParquetReaderTest, rle_bit_width_out_of_range) {
+    Vector<u8> input{0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+    EXPECT_THROW(RleBitPackedDecoder(input.data(), input.size(), 33), RecoverableException);
+    EXPECT_THROW(RleBitPackedDecoder(input.data(), input.size(), -1), RecoverableException);
+}
+
+TEST_F(ParquetReaderTest, malformed_file) {
+    String path = "/tmp/test_malformed.parquet";
+    LocalFileSystem fs;
+
+    // a valid footer with a page body which is never read
+    {
+        WriteParquetFile(path, Vector<u8>(16), SingleColumnFooter(16, 4));
+        ParquetReader reader(path);
+        EXPECT_EQ(reader.RowGroupCount(), 1u);
+        EXPECT_EQ(reader.FindColumn("c"), 0);
+    }
+
+    // column chunk sizes and offsets beyond the file are rejected before anything is allocated
+    {
+        WriteParquetFile(path, Vector<u8>(16), SingleColumnFooter(i64(1) << 40, 4));
+        ParquetReader reader(path);
+        EXPECT_THROW(reader.ReadColumnChunk(0, 0), RecoverableException);
+    }
+    {
+        WriteParquetFile(path, Vector<u8>(16), SingleColumnFooter(-1, 4));
+        ParquetReader reader(path);
+        EXPECT_THROW(reader.ReadColumnChunk(0, 0), RecoverableException);
+    }
+    {
+        WriteParquetFile(path, Vector<u8>(16), SingleColumnFooter(16, -8));
+        ParquetReader reader(path);
+        EXPECT_THROW(reader.ReadColumnChunk(0, 0), RecoverableException);
+    }
+
+    // page header with a negative uncompressed size and one with more values than the chunk
+    {
+        CompactWriter page;
+        page.Int(1, 5, 0);
+        page.Int(1, 5, -1);
+        page.Int(1, 5, 4);
+        page.Stop();
+        Vector<u8> body = page.bytes_;
+        body.resize(body.size() + 4);
+        WriteParquetFile(path, body, SingleColumnFooter(body.size(), 4));
+        ParquetReader reader(path);
+        EXPECT_THROW(reader.ReadColumnChunk(0, 0), RecoverableException);
+    }
+    {
+        CompactWriter page;
+        page.Int(1, 5, 0);
+        page.Int(1, 5, 4);
+        page.Int(1, 5, 4);
+        page.Field(2, 12);
+        page.Int(1, 5, i32(1) << 30);
+        page.Stop();
+        page.Stop();
+        Vector<u8> body = page.bytes_;
+        body.resize(body.size() + 4);
+        WriteParquetFile(path, body, SingleColumnFooter(body.size(), 4));
+        ParquetReader reader(path);
+        EXPECT_THROW(reader.ReadColumnChunk(0, 0), RecoverableException);
+    }
+
+    // an unknown footer field made of deeply nested structs is rejected instead of overflowing the stack
+    {
+        CompactWriter footer;
+        footer.Field(1, 12);
+        footer.bytes_.insert(footer.bytes_.end(), 1 << 20, u8(0x1C));
+        WriteParquetFile(path, Vector<u8>(), footer.bytes_);
+        EXPECT_THROW(ParquetReader{path}, RecoverableException);
+    }
+
+    // a list longer than the footer
+    {
+        CompactWriter footer;
+        footer.StructList(2, 15);
+        footer.Varint(u64(1) << 40);
+        WriteParquetFile(path, Vector<u8>(), footer.bytes_);
+        EXPECT_THROW(ParquetReader{path}, RecoverableException);
+    }
+
+    fs.DeleteFile(path);
+}
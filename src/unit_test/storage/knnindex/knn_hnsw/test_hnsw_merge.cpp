@@ -0,0 +1,104 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+#include <random>
+
+import stl;
+import hnsw_alg;
+import hnsw_common;
+import plain_store;
+import dist_func_l2;
+
+using namespace infinity;
+
+class HnswMergeTest : public BaseTest {
+public:
+    using LabelT = u32;
+    using Hnsw = KnnHnsw<float, LabelT, PlainStore<float, LabelT>, PlainL2Dist<float, LabelT>>;
+
+    static constexpr SizeT dim_ = 16;
+    static constexpr SizeT M_ = 16;
+    static constexpr SizeT ef_construction_ = 100;
+};
+
+TEST_F(HnswMergeTest, graft_graphs) {
+    const SizeT vec_n1 = 2000;
+    const SizeT vec_n2 = 1000;
+    const SizeT append_n = 100;
+
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<float> distrib_real;
+    auto make_data = [&](SizeT vec_n) {
+        Vector<float> data(vec_n * dim_);
+        for (auto &v : data) {
+            v = distrib_real(rng);
+        }
+        return data;
+    };
+    Vector<float> data1 = make_data(vec_n1);
+    Vector<float> data2 = make_data(vec_n2);
+    auto hnsw1 = Hnsw::Make(vec_n1, dim_, M_, ef_construction_, {});
+    hnsw1->InsertVecsRaw(data1.data(), vec_n1);
+    auto hnsw2 = Hnsw::Make(vec_n2, dim_, M_, ef_construction_, {});
+    hnsw2->InsertVecsRaw(data2.data(), vec_n2);
+
+    // drop every 5th vector of both, then append some vectors which are in none of the graphs
+    Vector<float> merged_data;
+    auto keep = [&](const Vector<float> &data, SizeT vec_n) {
+        Vector<VertexType> vertex_map(vec_n, -1);
+        for (SizeT i = 0; i < vec_n; ++i) {
+            if (i % 5 != 0) {
+                vertex_map[i] = merged_data.size() / dim_;
+                merged_data.insert(merged_data.end(), data.begin() + i * dim_, data.begin() + (i + 1) * dim_);
+            }
+        }
+        return vertex_map;
+    };
+    Vector<VertexType> vertex_map1 = keep(data1, vec_n1);
+    Vector<VertexType> vertex_map2 = keep(data2, vec_n2);
+    const SizeT grafted_n = merged_data.size() / dim_;
+    Vector<float> append_data = make_data(append_n);
+    merged_data.insert(merged_data.end(), append_data.begin(), append_data.end());
+    const SizeT merged_n = merged_data.size() / dim_;
+
+    auto merged = Hnsw::Make(merged_n, dim_, M_, ef_construction_, {});
+    merged->StoreDataRaw(merged_data.data(), merged_n);
+    merged->GraftGraph(*hnsw1, vertex_map1);
+    merged->GraftGraph(*hnsw2, vertex_map2);
+    for (SizeT i = grafted_n; i < merged_n; ++i) {
+        merged->Build(i);
+    }
+    merged->Check();
+    EXPECT_GE(merged->ReachableVertexNum(), merged_n * 99 / 100);
+
+    merged->SetEf(50);
+    SizeT correct = 0;
+    for (SizeT i = 0; i < merged_n; ++i) {
+        auto result = merged->KnnSearchSorted(merged_data.data() + i * dim_, 1);
+        if (!result.empty() && result[0].second == LabelT(i)) {
+            ++correct;
+        }
+    }
+    EXPECT_GE(correct, merged_n * 98 / 100);
+
+    // the graph can be built again from scratch
+    merged->ResetGraph();
+    for (SizeT i = 0; i < merged_n; ++i) {
+        merged->Build(i);
+    }
+    merged->Check();
+    EXPECT_GE(merged->ReachableVertexNum(), merged_n * 99 / 100);
+}
@@ -0,0 +1,99 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import zone_map;
+import column_vector;
+import value;
+import data_type;
+import logical_type;
+import internal_types;
+import third_party;
+
+using namespace infinity;
+
+class ZoneMapTest : public BaseTest {};
+
+TEST_F(ZoneMapTest, integer_min_max) {
+    ColumnVector column_vector(MakeShared<DataType>(LogicalType::kInteger));
+    column_vector.Initialize();
+    for (IntegerT i = 10; i < 20; ++i) {
+        column_vector.AppendValue(Value::MakeInt(i));
+    }
+
+    ZoneMap zone_map;
+    // only rows [2, 6) are merged: 12 ... 15
+    zone_map.Update(column_vector, 2, 4);
+    EXPECT_EQ(zone_map.row_count(), 4u);
+    EXPECT_EQ(zone_map.null_count(), 0u);
+
+    EXPECT_TRUE(zone_map.MayContainEqual(Value::MakeInt(12)));
+    EXPECT_TRUE(zone_map.MayContainEqual(Value::MakeInt(15)));
+    EXPECT_FALSE(zone_map.MayContainEqual(Value::MakeInt(11)));
+    EXPECT_FALSE(zone_map.MayContainEqual(Value::MakeInt(16)));
+    EXPECT_TRUE(zone_map.MayContainLessEqual(Value::MakeInt(12)));
+    EXPECT_FALSE(zone_map.MayContainLessEqual(Value::MakeInt(11)));
+    EXPECT_TRUE(zone_map.MayContainGreaterEqual(Value::MakeInt(15)));
+    EXPECT_FALSE(zone_map.MayContainGreaterEqual(Value::MakeInt(16)));
+
+    // a float value compared with integer keys can't prune
+    EXPECT_TRUE(zone_map.MayContainEqual(Value::MakeDouble(100.0)));
+}
+
+TEST_F(ZoneMapTest, nulls) {
+    ColumnVector column_vector(MakeShared<DataType>(LogicalType::kBigInt));
+    column_vector.Initialize();
+    for (BigIntT i = 0; i < 4; ++i) {
+        column_vector.AppendValue(Value::MakeBigInt(i * 100));
+    }
+    column_vector.nulls_ptr_->SetFalse(0);
+    column_vector.nulls_ptr_->SetFalse(3);
+
+    ZoneMap zone_map;
+    zone_map.Update(column_vector, 0, 4);
+    EXPECT_EQ(zone_map.row_count(), 4u);
+    EXPECT_EQ(zone_map.null_count(), 2u);
+    EXPECT_FALSE(zone_map.MayContainEqual(Value::MakeBigInt(0)));
+    EXPECT_TRUE(zone_map.MayContainEqual(Value::MakeBigInt(100)));
+    EXPECT_FALSE(zone_map.MayContainGreaterEqual(Value::MakeBigInt(201)));
+
+    // all rows null: no comparison can match
+    ZoneMap null_zone_map;
+    null_zone_map.Update(column_vector, 0, 1);
+    EXPECT_EQ(null_zone_map.null_count(), 1u);
+    EXPECT_FALSE(null_zone_map.MayContainLessEqual(Value::MakeBigInt(1000)));
+    EXPECT_FALSE(null_zone_map.MayContainGreaterEqual(Value::MakeBigInt(-1000)));
+}
+
+TEST_F(ZoneMapTest, float_and_serialize) {
+    ColumnVector column_vector(MakeShared<DataType>(LogicalType::kFloat));
+    column_vector.Initialize();
+    for (FloatT f : {1.5f, -2.25f, 8.0f}) {
+        column_vector.AppendValue(Value::MakeFloat(f));
+    }
+
+    ZoneMap zone_map;
+    zone_map.Update(column_vector, 0, 3);
+    EXPECT_TRUE(zone_map.MayContainLessEqual(Value::MakeFloat(-2.25f)));
+    EXPECT_FALSE(zone_map.MayContainLessEqual(Value::MakeFloat(-2.5f)));
+    EXPECT_FALSE(zone_map.MayContainGreaterEqual(Value::MakeFloat(8.5f)));
+
+    ZoneMap deserialized = ZoneMap::Deserialize(zone_map.Serialize());
+    EXPECT_EQ(deserialized.row_count(), 3u);
+    EXPECT_TRUE(deserialized.MayContainEqual(Value::MakeFloat(8.0f)));
+    EXPECT_FALSE(deserialized.MayContainLessEqual(Value::MakeFloat(-2.5f)));
+    EXPECT_FALSE(deserialized.MayContainGreaterEqual(Value::MakeFloat(8.5f)));
+}
@@ -28,12 +28,17 @@ import data_block;
 import default_values;
 import txn_manager;
 import txn;
+import txn_store;
 import status;
 import internal_types;
 import logical_type;
 import extra_ddl_info;
 import column_def;
 import data_type;
+import embedding_info;
+import knn_expr;
+import data_table;
+import sql_runner;
 
 class TableTxnTest : public BaseTest {
     void SetUp() override {
@@ -569,3 +574,100 @@ TEST_F(TableTxnTest, test10) {
     // Txn3: Commit, OK
     txn_mgr->CommitTxn(new_txn3);
 }
+
+TEST_F(TableTxnTest, test11) {
+    using namespace infinity;
+    TxnManager *txn_mgr = infinity::InfinityContext::instance().storage()->txn_manager();
+
+    // Txn1: Create db1 and tbl1, OK
+    Txn *new_txn1 = txn_mgr->CreateTxn();
+    new_txn1->Begin();
+    EXPECT_TRUE(new_txn1->CreateDatabase("db1", ConflictType::kError).ok());
+    EXPECT_TRUE(new_txn1->CreateTable("db1", MockTableDesc(), ConflictType::kError).ok());
+    txn_mgr->CommitTxn(new_txn1);
+
+    // Txn2: Append two rows to tbl1, OK
+    Txn *new_txn2 = txn_mgr->CreateTxn();
+    new_txn2->Begin();
+    auto [table_entry, status1] = new_txn2->GetTableByName("db1", "tbl1");
+    EXPECT_TRUE(status1.ok());
+    EXPECT_EQ(new_txn2->GetExistTxnTableStore(table_entry), nullptr);
+
+    SizeT row_count = 2;
+    auto input_block = MakeShared<DataBlock>();
+    Vector<SharedPtr<DataType>> column_types;
+    column_types.emplace_back(MakeShared<DataType>(LogicalType::kTinyInt));
+    column_types.emplace_back(MakeShared<DataType>(LogicalType::kBigInt));
+    column_types.emplace_back(MakeShared<DataType>(LogicalType::kDouble));
+    input_block->Init(column_types, row_count);
+    for (SizeT i = 0; i < row_count; ++i) {
+        input_block->AppendValue(0, Value::MakeTinyInt(static_cast<i8>(i)));
+        input_block->AppendValue(1, Value::MakeBigInt(static_cast<i64>(i)));
+        input_block->AppendValue(2, Value::MakeDouble(static_cast<f64>(i)));
+    }
+    input_block->Finalize();
+    EXPECT_TRUE(new_txn2->Append("db1", "tbl1", input_block).ok());
+
+    // Txn2: The uncommitted rows are visible to txn2 itself
+    TxnTableStore *txn_store = new_txn2->GetExistTxnTableStore(table_entry);
+    EXPECT_NE(txn_store, nullptr);
+    auto local_blocks = txn_store->LocalBlocks();
+    EXPECT_EQ(local_blocks.size(), 1u);
+    EXPECT_EQ(local_blocks[0].second, row_count);
+    EXPECT_EQ(local_blocks[0].first->GetValue(1, 1), Value::MakeBigInt(1));
+
+    // Txn2: Delete the uncommitted rows, NOT OK
+    Status status2 = new_txn2->Delete("db1", "tbl1", {RowID(TXN_LOCAL_SEGMENT_ID, 0)});
+    EXPECT_FALSE(status2.ok());
+
+    txn_mgr->RollBackTxn(new_txn2);
+}
+
+TEST_F(TableTxnTest, test12) {
+    using namespace infinity;
+    TxnManager *txn_mgr = infinity::InfinityContext::instance().storage()->txn_manager();
+
+    SQLRunner::Run("create table t1(c1 int, c2 embedding(float, 4));", false);
+    SQLRunner::Run("insert into t1 values (1, [1.0, 0.0, 0.0, 0.0]), (2, [2.0, 0.0, 0.0, 0.0]), (3, [3.0, 0.0, 0.0, 0.0]);", false);
+
+    // Txn1: Insert c1 = 4, update c1 = 2 to c1 = 22 and delete c1 = 3, all uncommitted
+    Txn *new_txn1 = txn_mgr->CreateTxn();
+    new_txn1->Begin();
+    auto input_block = MakeShared<DataBlock>();
+    Vector<SharedPtr<DataType>> column_types;
+    column_types.emplace_back(MakeShared<DataType>(LogicalType::kInteger));
+    column_types.emplace_back(MakeShared<DataType>(LogicalType::kEmbedding, EmbeddingInfo::Make(EmbeddingDataType::kElemFloat, 4)));
+    input_block->Init(column_types, 2);
+    input_block->AppendValue(0, Value::MakeInt(4));
+    input_block->AppendValue(1, Value::MakeEmbedding(Vector<f32>{4.0f, 0.0f, 0.0f, 0.0f}));
+    input_block->AppendValue(0, Value::MakeInt(22));
+    input_block->AppendValue(1, Value::MakeEmbedding(Vector<f32>{2.5f, 0.0f, 0.0f, 0.0f}));
+    input_block->Finalize();
+    EXPECT_TRUE(new_txn1->Append("default", "t1", input_block).ok());
+    EXPECT_TRUE(new_txn1->Delete("default", "t1", {RowID(0, 1), RowID(0, 2)}).ok());
+
+    auto column_values = [](const SharedPtr<DataTable> &result) {
+        Vector<Value> values;
+        for (SizeT i = 0; i < result->DataBlockCount(); ++i) {
+            const SharedPtr<DataBlock> &data_block = result->GetDataBlockById(i);
+            for (SizeT row = 0; row < data_block->row_count(); ++row) {
+                values.push_back(data_block->GetValue(0, row));
+            }
+        }
+        return values;
+    };
+
+    // Txn1: The scan sees its own insert, update and delete
+    Vector<Value> scanned = column_values(SQLRunner::Run("select c1 from t1;", new_txn1));
+    EXPECT_EQ(scanned, (Vector<Value>{Value::MakeInt(1), Value::MakeInt(4), Value::MakeInt(22)}));
+
+    // Txn1: So does the knn scan, the deleted c1 = 3 is the nearest row
+    Vector<Value> nearest = column_values(SQLRunner::Run("select c1 from t1 search knn(c2, [3.1, 0.0, 0.0, 0.0], 'float', 'l2', 3);", new_txn1));
+    EXPECT_EQ(nearest, (Vector<Value>{Value::MakeInt(22), Value::MakeInt(4), Value::MakeInt(1)}));
+
+    txn_mgr->RollBackTxn(new_txn1);
+
+    // The rollback leaves the committed rows untouched
+    Vector<Value> committed = column_values(SQLRunner::Run("select c1 from t1;", false));
+    EXPECT_EQ(committed, (Vector<Value>{Value::MakeInt(1), Value::MakeInt(2), Value::MakeInt(3)}));
+}
@@ -45,6 +45,7 @@ import query_result;
 import session_manager;
 import base_statement;
 import parser_result;
+import txn;
 
 namespace infinity {
 
@@ -54,7 +55,11 @@ namespace infinity {
  * @param print
  * @return Table
  */
-SharedPtr<DataTable> SQLRunner::Run(const String &sql_text, bool print) {
+SharedPtr<DataTable> SQLRunner::Run(const String &sql_text, bool print) { return RunInTxn(sql_text, nullptr); }
+
+SharedPtr<DataTable> SQLRunner::Run(const String &sql_text, Txn *txn) { return RunInTxn(sql_text, txn); }
+
+SharedPtr<DataTable> SQLRunner::RunInTxn(const String &sql_text, Txn *txn) {
     //    if (print) {
     //        LOG_TRACE(fmt::format("{}", sql_text));
     //    }
@@ -78,8 +83,12 @@ SharedPtr<DataTable> SQLRunner::Run(const String &sql_text, bool print) {
         UnrecoverableError(parsed_result->error_message_);
     }
 
-    query_context_ptr->CreateTxn();
-    query_context_ptr->BeginTxn();
+    if (txn == nullptr) {
+        query_context_ptr->CreateTxn();
+        query_context_ptr->BeginTxn();
+    } else {
+        session_ptr->SetTxn(txn);
+    }
 
     //    LogicalPlanner logical_planner(query_context_ptr.get());
     //    Optimizer optimizer(query_context_ptr.get());
@@ -116,7 +125,11 @@ SharedPtr<DataTable> SQLRunner::Run(const String &sql_text, bool print) {
     query_result.root_operator_type_ = logical_plan->operator_type();
 
     parsed_result->Reset();
-    query_context_ptr->CommitTxn();
+    if (txn == nullptr) {
+        query_context_ptr->CommitTxn();
+    } else {
+        session_ptr->SetTxn(nullptr);
+    }
     return query_result.result_table_;
 }
 
@@ -18,6 +18,7 @@ export module sql_runner;
 
 import stl;
 import data_table;
+import txn;
 
 namespace infinity {
 
@@ -25,6 +26,12 @@ export class SQLRunner {
 
 public:
     static SharedPtr<DataTable> Run(const String &sql_text, bool print = true);
+
+    // Runs the statement in the started txn, which the caller commits or rolls back
+    static SharedPtr<DataTable> Run(const String &sql_text, Txn *txn);
+
+private:
+    static SharedPtr<DataTable> RunInTxn(const String &sql_text, Txn *txn);
 };
 
 } // namespace infinity